@@ -2,12 +2,22 @@
 #define ANN_H_INCLUDED
 
 #include "nsdsp_math.h"
+#include "fir_filter.h"
 
 /* Definiciones propias del módulo */
 #define LMAX 4      /* Número máximo de capas */
 #define ALPHA 0.01f /* Parámetro alpha para Leaky ReLU */
 #define ANN_OK  0
 #define ANN_KO  -1
+#define MAX_ANN_BUFFER  1024   /* Tamaño máximo de los vectores intermedios (canales x longitud) */
+#define MAX_ANN_CANALES 16     /* Número máximo de canales de entrada en convolución en streaming */
+#define ANN_CARRILES    8      /* Salidas por grupo del bucle de taps de la convolución directa (ancho SIMD) */
+#define ANN_Q8_MAX  127         /* Valor máximo representable en la cuantización int8 simétrica */
+
+/* Formato binario de modelo */
+#define ANN_MODEL_MAGIC     0x4E4E4153u /* "SANN" en little-endian */
+#define ANN_MODEL_VERSION   1u          /* Versión actual del formato */
+#define ANN_MODEL_ALIGN     16u         /* Alineamiento en bytes de los bloques de pesos y bias */
 
 /* Enumerado para tipos de función de activación */
 typedef enum {
@@ -19,16 +29,64 @@ typedef enum {
     STEP
 } ANN_TRIGGER;
 
+/* Enumerado para tipos de optimizador del entrenamiento en línea */
+typedef enum {
+    SGD,
+    MOMENTUM,
+    ADAM
+} ANN_OPTIMIZER;
+
+/* Enumerado para tipos de capa */
+typedef enum {
+    DENSE,          /* Capa totalmente conectada: y = W*x + b */
+    CONV1D,         /* Convolución 1-D multicanal */
+    MAXPOOL1D,      /* Pooling por máximo */
+    AVGPOOL1D,      /* Pooling por media */
+    GRU,            /* Capa recurrente GRU con estado persistente */
+    LSTM,           /* Capa recurrente LSTM con estado persistente */
+    SPARSE          /* Capa totalmente conectada con pesos dispersos (CSR): y = W*x + b */
+} ANN_LAYER_TYPE;
+
+/* Tamaño en floats del workspace de una capa recurrente: estado(s) + puertas x y h */
+#define ANN_RNN_WORKSPACE(tipo, ocultas, streams)  ((((tipo) == LSTM) ? 10u : 7u) * (ocultas) * (streams))
+
+/* Configuración de capas CONV1D y de pooling */
+typedef struct {
+    unsigned int canales_entrada;   /* Canales de entrada (C_in) */
+    unsigned int canales_salida;    /* Canales de salida (C_out). En pooling igual a C_in */
+    unsigned int longitud_entrada;  /* Muestras por canal de entrada (L_in) */
+    unsigned int kernel;            /* Longitud del kernel o de la ventana de pooling (K) */
+    unsigned int stride;            /* Paso entre salidas consecutivas */
+    unsigned int dilatacion;        /* Separación entre taps del kernel (1 = sin dilatación) */
+} CONV1D_CONFIG;
+
+/* Configuración y estado de capas recurrentes GRU/LSTM (G = 3 en GRU, 4 en LSTM) */
+typedef struct {
+    unsigned int entradas;  /* Tamaño de la entrada (I) */
+    unsigned int ocultas;   /* Tamaño del estado oculto (H) */
+    unsigned int streams;   /* Número de canales independientes que se actualizan juntos (S) */
+    MATRIZ *pesos_h;        /* Pesos recurrentes U fusionados de todas las puertas (G*H x H) */
+    float *estado_h;        /* Estado oculto persistente (H x S) */
+    float *estado_c;        /* Estado de celda persistente (H x S, solo LSTM) */
+    float *puertas_x;       /* Workspace W*x de las puertas (G*H x S) */
+    float *puertas_h;       /* Workspace U*h de las puertas (G*H x S) */
+} RNN_CONFIG;
+
 /* Objeto LAYER - Capa de la red neuronal */
 typedef struct {
-    MATRIZ *pesos;
-    MATRIZ *bias;
+    MATRIZ *pesos;          /* DENSE: salidas x entradas. CONV1D: C_out x (C_in*K). GRU/LSTM: G*H x I. Pooling: NULL */
+    MATRIZ *bias;           /* DENSE: salidas x 1. CONV1D: C_out x 1. GRU/LSTM: G*H x 1. Pooling: NULL */
+    ANN_LAYER_TYPE tipo;    /* Tipo de capa */
+    CONV1D_CONFIG *conv;    /* Configuración de CONV1D/pooling (NULL en otro caso) */
+    RNN_CONFIG *rnn;        /* Configuración y estado de GRU/LSTM (NULL en otro caso) */
+    MATRIZ_DISPERSA *dispersa;  /* SPARSE: pesos podados salidas x entradas (solo se lee en SPARSE) */
 } LAYER;
 
 /* Objeto NET - Estructura de la red */
 typedef struct {
     unsigned int levels;
     LAYER *layers[LMAX];
+    MATRIZ_OPERACION operacion[LMAX];  /* W*x preparado de cada capa DENSE (filas = 0 si no lo está) */
 } NET;
 
 /* Objeto ANN_SERVICE - Servicio de red neuronal */
@@ -39,11 +97,103 @@ typedef struct {
     MATRIZ y0;  /* Vector de salida */
 } ANN_SERVICE;
 
+/* Objeto LAYER_Q8 - Capa cuantizada (pesos int8 con escala por neurona) */
+typedef struct {
+    unsigned int filas;         /* Número de neuronas de la capa */
+    unsigned int columnas;      /* Número de entradas de la capa */
+    signed char *pesos_q;       /* Pesos cuantizados int8 (filas x columnas) */
+    float *escala;              /* Escala por neurona: w = pesos_q * escala */
+    float *bias;                /* Bias en coma flotante (filas) */
+} LAYER_Q8;
+
+/* Objeto ANN_Q8_SERVICE - Servicio de red neuronal cuantizada */
+typedef struct {
+    ANN_TRIGGER trigger;
+    MATRIZ x0;                  /* Vector de entrada */
+    unsigned int levels;        /* Número de capas */
+    LAYER_Q8 layers[LMAX];      /* Capas cuantizadas */
+    MATRIZ y0;                  /* Vector de salida */
+} ANN_Q8_SERVICE;
+
+/* Cabecera del fichero binario de modelo (32 bytes) */
+typedef struct {
+    unsigned int magic;         /* ANN_MODEL_MAGIC */
+    unsigned int version;       /* ANN_MODEL_VERSION */
+    unsigned int levels;        /* Número de capas */
+    unsigned int trigger;       /* Función de activación (ANN_TRIGGER) */
+    unsigned int tamano;        /* Tamaño total del modelo en bytes */
+    unsigned int reservado[3];  /* Reservado para versiones futuras (0) */
+} ANN_MODEL_HEADER;
+
+/* Descriptor de capa del fichero binario (16 bytes, uno por capa tras la cabecera) */
+typedef struct {
+    unsigned int filas;         /* Neuronas de la capa */
+    unsigned int columnas;      /* Entradas de la capa */
+    unsigned int offset_pesos;  /* Offset en bytes del bloque de pesos (filas x columnas float) */
+    unsigned int offset_bias;   /* Offset en bytes del bloque de bias (filas float) */
+} ANN_MODEL_LAYER;
+
+/* Objeto ANN_MODEL - Red cargada sin copia desde un modelo binario en memoria */
+typedef struct {
+    MATRIZ pesos[LMAX];         /* Vistas de los bloques de pesos del modelo */
+    MATRIZ bias[LMAX];          /* Vistas de los bloques de bias del modelo */
+    LAYER layers[LMAX];         /* Capas propias del modelo */
+    ANN_SERVICE service;        /* Servicio listo para iterate */
+} ANN_MODEL;
+
+/* Objeto ANN_TRAINER - Estado del entrenamiento en línea de un ANN_SERVICE */
+typedef struct {
+    ANN_SERVICE *service;           /* Red a entrenar (sus pesos y bias se modifican) */
+    ANN_OPTIMIZER optimizador;      /* SGD, MOMENTUM o ADAM */
+    float tasa;                     /* Tasa de aprendizaje */
+    float beta1;                    /* Factor de momento (MOMENTUM, ADAM) */
+    float beta2;                    /* Factor del segundo momento (ADAM) */
+    float epsilon;                  /* Término de estabilidad (ADAM) */
+    float beta1_t;                  /* beta1^t para la corrección de sesgo (ADAM) */
+    float beta2_t;                  /* beta2^t para la corrección de sesgo (ADAM) */
+    unsigned int batch;             /* Tamaño máximo de mini-lote */
+    float *activaciones[LMAX+1];    /* Caché de activaciones por capa (neuronas x batch) */
+    float *deltas[LMAX];            /* Errores retropropagados por capa (neuronas x batch) */
+    float *grad_pesos[LMAX];        /* Gradiente de los pesos por capa */
+    float *grad_bias[LMAX];         /* Gradiente del bias por capa */
+    float *m_pesos[LMAX];           /* Primer momento de los pesos (MOMENTUM, ADAM) */
+    float *m_bias[LMAX];            /* Primer momento del bias (MOMENTUM, ADAM) */
+    float *v_pesos[LMAX];           /* Segundo momento de los pesos (ADAM) */
+    float *v_bias[LMAX];            /* Segundo momento del bias (ADAM) */
+} ANN_TRAINER;
+
+/* Objeto CONV1D_STREAM - Convolución 1-D causal muestra a muestra */
+typedef struct {
+    LAYER *layer;                                   /* Capa CONV1D asociada */
+    ANN_TRIGGER trigger;                            /* Función de activación de la salida */
+    FIR_FILTER_OBJECT lineas[MAX_ANN_CANALES];      /* Línea de retardo por canal de entrada */
+    unsigned int muestras;                          /* Muestras recibidas hasta llenar la ventana */
+    unsigned int fase;                              /* Contador de stride */
+} CONV1D_STREAM;
+
 /* Declaración de la API */
 typedef struct {
     ANN_SERVICE (*get_ann)(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias);
     int (*iterate)(ANN_SERVICE *service);
     int (*trigger)(MATRIZ *input, MATRIZ *output, ANN_TRIGGER trigger);
+    ANN_Q8_SERVICE (*get_ann_q8)(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias,
+                                 signed char *pesos_q, float *escalas);
+    int (*iterate_q8)(ANN_Q8_SERVICE *service);
+    unsigned int (*build_model)(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias,
+                                void *buffer, unsigned int tamano);
+    int (*load_model)(const void *modelo, unsigned int tamano, ANN_MODEL *pmodel);
+    unsigned int (*train_workspace)(ANN_SERVICE *service, unsigned int batch, ANN_OPTIMIZER optimizador);
+    int (*get_trainer)(ANN_SERVICE *service, ANN_OPTIMIZER optimizador, float tasa, unsigned int batch,
+                       float *workspace, unsigned int tamano, ANN_TRAINER *ptrainer);
+    int (*train_step)(ANN_TRAINER *ptrainer, const float *x, const float *d, unsigned int n, float *perdida);
+    ANN_SERVICE (*get_ann_layers)(unsigned int levels, ANN_TRIGGER trigger, LAYER *layers);
+    int (*get_conv_stream)(LAYER *layer, ANN_TRIGGER trigger, float *pz, CONV1D_STREAM *pstream);
+    int (*conv_stream)(const float *xin, float *yout, CONV1D_STREAM *pstream);
+    int (*get_rnn)(LAYER *layer, ANN_LAYER_TYPE tipo, MATRIZ *pesos_x, MATRIZ *pesos_h, MATRIZ *bias,
+                   unsigned int streams, float *workspace, RNN_CONFIG *prnn);
+    int (*rnn_step)(LAYER *layer, MATRIZ *x, MATRIZ *y);
+    int (*rnn_reset)(LAYER *layer);
+    int (*sparse_layer)(LAYER *layer, float umbral, unsigned int bloque, MATRIZ_DISPERSA *pdispersa);
 } ANN_API;
 
 /* API pública del módulo */
@@ -19,9 +19,9 @@
 #endif
 
 
-#if (LAGRANGE_M>10)
+#if ((4*LAGRANGE_M-1)>MAX_FIR_LENGTH)
 #undef  LAGRANGE_M
-#define LAGRANGE_M      10          /* Valor máximo 39 coeficientes por filtro FIR */
+#define LAGRANGE_M      ((MAX_FIR_LENGTH+1)/4)  /* Valor máximo: 4*LAGRANGE_M-1 coeficientes por filtro FIR (64 con MAX_FIR_LENGTH=256) */
 #endif
 
 #if (WAVELET_LEVELS>8)
@@ -72,10 +72,36 @@ typedef struct
 } DWT_OBJECT;
 
 
+/* DWT en coma fija: muestras y coeficientes Q15 sobre filtros FIR_FILTER_OBJECT_Q15 */
+typedef struct
+{
+    int16_t lp_z[FIR_Q15_RETARDO(BUFFER_SIZE)];
+    int16_t hp_z[FIR_Q15_RETARDO(BUFFER_SIZE)];
+} LPHP_Z_Q15;
+
+
+typedef struct
+{
+    LPHP_Z_Q15 lphp_z[WAVELET_LEVELS];
+    int16_t lp_coef[BUFFER_SIZE];
+    int16_t hp_coef[BUFFER_SIZE];
+    int16_t yltemp[WAVELET_LEVELS];
+    int16_t yhtemp[WAVELET_LEVELS];
+    int16_t yout[WAVELET_LEVELS+1];
+    FIR_FILTER_OBJECT_Q15 filtrolp[WAVELET_LEVELS];
+    FIR_FILTER_OBJECT_Q15 filtrohp[WAVELET_LEVELS];
+    unsigned int decimator[WAVELET_LEVELS];
+    unsigned int enabler[WAVELET_LEVELS];
+    unsigned int saturados;                         // Coeficientes saturados al cuantificar (0 con los filtros soportados)
+} DWT_OBJECT_Q15;
+
+
 typedef struct
 {
     void (* get_dwt)(DWT_OBJECT *);
     void (* dwt)(float xin,DWT_OBJECT * dwt_object);
+    void (* get_dwt_q15)(DWT_OBJECT_Q15 *);
+    void (* dwt_q15)(int16_t xin,DWT_OBJECT_Q15 * dwt_object);
 
 } DWT_API;
 
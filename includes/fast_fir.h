@@ -0,0 +1,76 @@
+#ifndef FAST_FIR_H_INCLUDED
+#define FAST_FIR_H_INCLUDED
+
+#include "fir_filter.h"
+#include "fft.h"
+
+/* Definiciones propias del módulo */
+#define FAST_FIR_OK         0
+#define FAST_FIR_KO         -1
+#define FAST_FIR_UMBRAL     24      /* Coeficientes hasta los que la forma directa es más rápida (cruce medido en Test_Benchmark_Fast_Fir) */
+
+/* Número de particiones de bloque B para un filtro de ncoef coeficientes */
+#define FAST_FIR_PARTICIONES(ncoef, bloque)     (((ncoef) + (bloque) - 1) / (bloque))
+
+/* Tamaño en floats del workspace: espectros H, línea de retardo frecuencial, entrada, acumulador y salida */
+#define FAST_FIR_WORKSPACE(ncoef, bloque)       (4 * FAST_FIR_PARTICIONES(ncoef, bloque) * (bloque) + 5 * (bloque))
+
+/* Máximo número de etapas FFT de la convolución particionada no uniforme */
+#define FAST_FIR_MAX_ETAPAS     16
+
+/* Cota del workspace en floats de la convolución no uniforme: cabeza directa, etapas de
+ * cabeza..bloque_max/2 con una partición (9B cada una) y etapa final de bloque_max */
+#define FAST_FIR_NUPC_WORKSPACE(ncoef, cabeza, bloque_max) \
+    ((cabeza) + 14 * (bloque_max) + 4 * FAST_FIR_PARTICIONES(ncoef, bloque_max) * (bloque_max))
+
+/* Modo de cálculo seleccionado por get_fir */
+typedef enum {
+    FAST_FIR_DIRECTO,       /* Forma directa con fir_filter (ncoef <= FAST_FIR_UMBRAL) */
+    FAST_FIR_OLS,           /* Overlap-save con particiones uniformes de B coeficientes */
+    FAST_FIR_NUPC           /* Cabeza directa más particiones FFT crecientes, sin latencia */
+} FAST_FIR_MODO;
+
+/* Etapa de convolución por particiones uniformes (overlap-save con FFT real de 2B puntos) */
+typedef struct
+{
+    unsigned int bloque;        /* B: tamaño de bloque y de partición */
+    unsigned int particiones;   /* K: número de particiones de B coeficientes */
+    RFFT_PLAN *plan;            /* Plan real de 2B puntos (puede compartirse) */
+    COMPLEJO *H;                /* K espectros empaquetados de B COMPLEJO de las particiones */
+    COMPLEJO *fdl;              /* Línea de retardo frecuencial: K espectros de entrada (circular) */
+    unsigned int p_fdl;         /* Posición del espectro más reciente en fdl */
+    float *entrada;             /* 2B muestras: bloque anterior y bloque en curso */
+    COMPLEJO *acumulador;       /* B COMPLEJO: suma de productos y su transformada inversa */
+    float *salida;              /* B muestras de salida del último bloque completo */
+    unsigned int cuenta;        /* Muestras recibidas del bloque en curso */
+} FAST_FIR_ETAPA;
+
+/* Objeto FAST_FIR_OBJECT - Filtro FIR largo con selección automática de algoritmo */
+typedef struct
+{
+    FAST_FIR_MODO modo;         /* Algoritmo seleccionado */
+    unsigned int ncoef;         /* Número de coeficientes */
+    unsigned int latencia;      /* Retardo añadido en muestras (0 en forma directa y NUPC, B en overlap-save) */
+    FIR_FILTER_OBJECT directo;  /* Filtro en forma directa (cabeza en NUPC) */
+    unsigned int netapas;       /* Etapas FFT en uso */
+    FAST_FIR_ETAPA etapas[FAST_FIR_MAX_ETAPAS]; /* Etapas FFT (una en overlap-save) */
+} FAST_FIR_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_fir)(unsigned int ncoef, const float *pcoef, unsigned int bloque, RFFT_PLAN *plan,
+                   float *workspace, FAST_FIR_OBJECT *pfir);
+    int (*get_fir_nupc)(unsigned int ncoef, const float *pcoef, unsigned int cabeza, unsigned int bloque_max,
+                        RFFT_PLAN *planes, float *workspace, FAST_FIR_OBJECT *pfir);
+    float (*fir_filter)(float xin, FAST_FIR_OBJECT *pfir);
+    int (*fir_bloque)(const float *x, float *y, unsigned int nmuestras, FAST_FIR_OBJECT *pfir);
+} FAST_FIR_API;
+
+/* API pública del módulo */
+extern FAST_FIR_API fast_fir_api;
+
+/* Función de inicialización */
+extern void Init_Fast_Fir(void);
+
+#endif /* FAST_FIR_H_INCLUDED */
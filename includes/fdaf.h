@@ -0,0 +1,60 @@
+#ifndef FDAF_H_INCLUDED
+#define FDAF_H_INCLUDED
+
+#include "fft.h"
+
+/* Definiciones propias del módulo */
+#define FDAF_OK             0
+#define FDAF_KO             -1
+
+/* Número de particiones de bloque B para un filtro de ncoef coeficientes */
+#define FDAF_PARTICIONES(ncoef, bloque)     (((ncoef) + (bloque) - 1) / (bloque))
+
+/* Tamaño en floats del workspace: coeficientes W y línea de retardo frecuencial (K espectros cada uno),
+ * espectro de error y gradiente, potencia por bin, entrada, deseada, salida y error */
+#define FDAF_WORKSPACE(ncoef, bloque)       (4 * FDAF_PARTICIONES(ncoef, bloque) * (bloque) + 10 * (bloque) + 1)
+
+/* Objeto FDAF_OBJECT - Filtro adaptativo en el dominio de la frecuencia por bloques particionados */
+typedef struct
+{
+    unsigned int ncoef;         /* Número de coeficientes N */
+    unsigned int bloque;        /* B: tamaño de bloque y de partición */
+    unsigned int particiones;   /* K: número de particiones de B coeficientes */
+    unsigned int latencia;      /* Retardo de la salida en muestras (B) */
+    RFFT_PLAN *plan;            /* Plan real de 2B puntos (puede compartirse) */
+    float mu;                   /* Paso de adaptación normalizado */
+    float olvido;               /* Factor de olvido de la potencia por bin, en [0, 1) */
+    float delta;                /* Regularización de la normalización por bin (> 0) */
+    COMPLEJO *W;                /* K espectros empaquetados de B COMPLEJO de los coeficientes */
+    COMPLEJO *fdl;              /* Línea de retardo frecuencial: K espectros de entrada (circular) */
+    unsigned int p_fdl;         /* Posición del espectro más reciente en fdl */
+    COMPLEJO *espectro_error;   /* B COMPLEJO: espectro del error normalizado */
+    COMPLEJO *gradiente;        /* B COMPLEJO: salida del bloque y gradiente restringido de cada partición */
+    float *potencia;            /* B + 1 floats: potencia de la entrada por bin (DC..Nyquist) */
+    float *entrada;             /* 2B muestras: bloque anterior y bloque en curso */
+    float *deseada;             /* B muestras deseadas del bloque en curso */
+    float *salida;              /* B salidas del último bloque completo */
+    float *errores;             /* B errores del último bloque completo */
+    unsigned int cuenta;        /* Muestras recibidas del bloque en curso */
+    unsigned int bloques;       /* Bloques procesados */
+    float error;                /* Error de la última muestra entregada (retrasado B muestras) */
+} FDAF_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_fdaf)(unsigned int ncoef, unsigned int bloque, RFFT_PLAN *plan, float mu, float olvido, float delta,
+                    float *workspace, FDAF_OBJECT *pfdaf);
+    float (*fdaf_filter)(float xn, float dn, FDAF_OBJECT *pfdaf);
+    int (*fdaf_bloque)(const float *x, const float *d, float *y, float *e, unsigned int nmuestras,
+                       FDAF_OBJECT *pfdaf);
+    int (*coeficientes_fdaf)(FDAF_OBJECT *pfdaf, float *pcoef);
+} FDAF_API;
+
+/* API pública del módulo */
+extern FDAF_API fdaf_api;
+
+/* Función de inicialización */
+extern void Init_FDAF(void);
+
+#endif /* FDAF_H_INCLUDED */
@@ -0,0 +1,62 @@
+#ifndef FFT_H_INCLUDED
+#define FFT_H_INCLUDED
+
+/* Definiciones propias del módulo */
+#define FFT_OK          0
+#define FFT_KO          -1
+#define FFT_MAX_LOG2    20          /* Tamaño máximo de transformada: 2^20 = 1M puntos */
+#define FFT_PI          3.14159265358979323846
+
+/* Tamaños de las tablas de un plan de N puntos (N potencia de 2) */
+#define FFT_TWIDDLE_SIZE(n)     (n)     /* Elementos COMPLEJO de la tabla de twiddles */
+#define FFT_BITREV_SIZE(n)      (n)     /* Elementos unsigned int de la tabla de inversión de bits */
+
+/* Tamaños de las tablas de un plan real de N puntos (usa una FFT compleja de N/2 puntos) */
+#define RFFT_TWIDDLE_SIZE(n)    (FFT_TWIDDLE_SIZE((n) / 2) + (n) / 4 + 1)
+#define RFFT_BITREV_SIZE(n)     FFT_BITREV_SIZE((n) / 2)
+
+/* Declaración de objetos */
+typedef struct
+{
+    float re;
+    float im;
+} COMPLEJO;
+
+/* Plan de FFT: tablas precalculadas por el llamante una sola vez */
+typedef struct
+{
+    unsigned int n;             /* Número de puntos */
+    unsigned int log2n;         /* log2(n) */
+    COMPLEJO *twiddle;          /* Twiddles por etapa radix-4: re/im de W^j, W^2j y W^3j en seis tablas de L floats */
+    unsigned int *bitrev;       /* Permutación de inversión de bits */
+} FFT_PLAN;
+
+/* Plan de FFT real de N puntos. Espectro empaquetado en N/2 COMPLEJO:
+ * X[0].re = X(0), X[0].im = X(N/2) y X[k] = X(k) para 0 < k < N/2 */
+typedef struct
+{
+    unsigned int n;             /* Número de puntos reales */
+    FFT_PLAN compleja;          /* Plan complejo de N/2 puntos */
+    COMPLEJO *twiddle_r;        /* W_N^k, k = 0..N/4, para separar los espectros par e impar */
+} RFFT_PLAN;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_plan)(unsigned int n, COMPLEJO *twiddle, unsigned int *bitrev, FFT_PLAN *pplan);
+    int (*fft)(FFT_PLAN *pplan, COMPLEJO *x);
+    int (*fft_out)(FFT_PLAN *pplan, const COMPLEJO *x, COMPLEJO *y);
+    int (*ifft)(FFT_PLAN *pplan, COMPLEJO *x);
+    int (*ifft_out)(FFT_PLAN *pplan, const COMPLEJO *x, COMPLEJO *y);
+    int (*get_rplan)(unsigned int n, COMPLEJO *twiddle, unsigned int *bitrev, RFFT_PLAN *pplan);
+    int (*rfft)(RFFT_PLAN *pplan, const float *x, COMPLEJO *y);
+    int (*irfft)(RFFT_PLAN *pplan, const COMPLEJO *y, float *x);
+} FFT_API;
+
+/* API pública del módulo */
+extern FFT_API fft_api;
+
+/* Función de inicialización */
+extern void Init_FFT(void);
+
+#endif /* FFT_H_INCLUDED */
@@ -2,8 +2,16 @@
 #define FIR_FILTER_H_INCLUDED
 
 #include    <stddef.h>
+#include    <stdint.h>
 
-#define MAX_FIR_LENGTH  128
+#define MAX_FIR_LENGTH  256
+
+/* Longitud en muestras de la línea de retardo de un filtro Q15: copia espejo de ncoef muestras */
+#define FIR_Q15_RETARDO(ncoef)  (2*(ncoef))
+
+/* Límites del formato Q15. Los coeficientes se cuantifican en [-Q15_MAX, Q15_MAX] */
+#define Q15_MAX         32767
+#define Q15_MIN         (-32768)
 
 typedef struct
     {
@@ -13,10 +21,34 @@ typedef struct
         float * pz;
     } FIR_FILTER_OBJECT;
 
+/* Filtro en doble precisión: mismos campos que FIR_FILTER_OBJECT */
+typedef struct
+    {
+        unsigned int ncoef;
+        double * p_write;
+        double * pcoef;
+        double * pz;
+    } FIR_FILTER_OBJECT_D;
+
+/* Filtro en coma fija: coeficientes y muestras Q15, acumulación entera exacta saturada a Q31 */
+typedef struct
+    {
+        unsigned int ncoef;
+        unsigned int index_w;       /* Posición de x(n) en la línea de retardo */
+        int16_t * pcoef;            /* Coeficientes Q15 */
+        int16_t * pz;               /* Línea de retardo de FIR_Q15_RETARDO(ncoef) muestras */
+    } FIR_FILTER_OBJECT_Q15;
+
 typedef struct
     {
         FIR_FILTER_OBJECT (* get_fir)(unsigned int ncoef, float * pcoef, float * pz);
         float (* fir_filter) (float xin, FIR_FILTER_OBJECT * pfir );
+        FIR_FILTER_OBJECT_D (* get_fir_d)(unsigned int ncoef, double * pcoef, double * pz);
+        double (* fir_filter_d) (double xin, FIR_FILTER_OBJECT_D * pfir );
+        float (* fir_filter_m) (float xin, FIR_FILTER_OBJECT * pfir );     /* Muestras float, acumulación double */
+        FIR_FILTER_OBJECT_Q15 (* get_fir_q15)(unsigned int ncoef, int16_t * pcoef, int16_t * pz);
+        int16_t (* fir_filter_q15) (int16_t xin, FIR_FILTER_OBJECT_Q15 * pfir );
+        unsigned int (* cuantiza_q15)(const float * pvalor, unsigned int n, int16_t * pq15);  /* Devuelve los valores saturados */
     } FIR_FILTER_API;
 
 
@@ -0,0 +1,80 @@
+#ifndef KALMAN_H_INCLUDED
+#define KALMAN_H_INCLUDED
+
+#include "nsdsp_math.h"
+
+/* Definiciones propias del módulo */
+#define KALMAN_OK           0
+#define KALMAN_KO           -1
+
+/* Tamaños de estado con ruta desenrollada (especializada en compilación) */
+#define KALMAN_FIJO_MIN     2
+#define KALMAN_FIJO_MAX     6
+
+/* Tamaño en floats del workspace de un filtro de n estados y m medidas: estado x, modelo F, Q, H, R,
+ * covarianza P, ganancia K, innovación y su covarianza S, y auxiliares de 2 n x n y 3 n x m */
+#define KALMAN_WORKSPACE(n, m)          ((n) + 5 * (n) * (n) + 5 * (n) * (m) + 2 * (m) * (m) + (m))
+
+/* Tamaño en floats por filtro del lote: x, P, innovación, NIS y auxiliares de la actualización */
+#define KALMAN_LOTE_CARRIL(n, m)        (2 * (n) + 2 * (n) * (n) + 2 * (n) * (m) + (m) * (m) + 2 * (m) + 2)
+
+/* Tamaño en floats del workspace de un lote de nf filtros: modelo común y nf carriles */
+#define KALMAN_LOTE_WORKSPACE(n, m, nf) (2 * (n) * (n) + (n) * (m) + (m) * (m) + (nf) * KALMAN_LOTE_CARRIL(n, m))
+
+/* Objeto KALMAN_OBJECT - Filtro de Kalman lineal de n estados y m medidas */
+typedef struct
+{
+    unsigned int estados;       /* Dimensión del estado n */
+    unsigned int medidas;       /* Dimensión de la medida m */
+    unsigned int fijo;          /* n si se usa la ruta desenrollada (2..6), 0 para la ruta genérica sobre nsdsp_math */
+    MATRIZ x;                   /* Estado estimado (n x 1) */
+    MATRIZ P;                   /* Covarianza del error de estimación (n x n) */
+    MATRIZ F;                   /* Matriz de transición (n x n) */
+    MATRIZ Q;                   /* Covarianza del ruido de proceso (n x n) */
+    MATRIZ H;                   /* Matriz de observación (m x n) */
+    MATRIZ R;                   /* Covarianza del ruido de medida (m x m) */
+    MATRIZ K;                   /* Ganancia de Kalman de la última actualización (n x m) */
+    MATRIZ S;                   /* Factor de Cholesky L de la covarianza de la innovación (m x m, triangular inferior) */
+    MATRIZ innovacion;          /* Innovación y = z - H x de la última actualización (m x 1) */
+    float *auxiliar;            /* Auxiliares: 2 n x n y 3 n x m */
+    float nis;                  /* Innovación normalizada y^T S^-1 y de la última actualización */
+} KALMAN_OBJECT;
+
+/* Objeto KALMAN_LOTE_OBJECT - Lote de filtros independientes con modelo común, en disposición SoA:
+ * el elemento k de la variable del filtro f está en [k * filtros + f] */
+typedef struct
+{
+    unsigned int estados;       /* Dimensión del estado n */
+    unsigned int medidas;       /* Dimensión de la medida m */
+    unsigned int filtros;       /* Número de filtros del lote */
+    MATRIZ F;                   /* Matriz de transición común (n x n) */
+    MATRIZ Q;                   /* Covarianza del ruido de proceso común (n x n) */
+    MATRIZ H;                   /* Matriz de observación común (m x n) */
+    MATRIZ R;                   /* Covarianza del ruido de medida común (m x m) */
+    float *x;                   /* Estados: x_i del filtro f en x[i * filtros + f] */
+    float *P;                   /* Covarianzas: P_ij del filtro f en P[(i * n + j) * filtros + f] */
+    float *innovacion;          /* Innovaciones: y_a del filtro f en innovacion[a * filtros + f] */
+    float *nis;                 /* Innovación normalizada de cada filtro */
+    float *auxiliar;            /* Auxiliares de la actualización, también en SoA */
+    unsigned int fallos;        /* Filtros con S no definida positiva en la última actualización */
+} KALMAN_LOTE_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_kalman)(unsigned int estados, unsigned int medidas, float *workspace, KALMAN_OBJECT *pk);
+    int (*predice)(KALMAN_OBJECT *pk);
+    int (*actualiza)(const float *z, KALMAN_OBJECT *pk);
+    int (*get_lote)(unsigned int estados, unsigned int medidas, unsigned int filtros, float *workspace,
+                    KALMAN_LOTE_OBJECT *pl);
+    int (*predice_lote)(KALMAN_LOTE_OBJECT *pl);
+    int (*actualiza_lote)(const float *z, KALMAN_LOTE_OBJECT *pl);
+} KALMAN_API;
+
+/* API pública del módulo */
+extern KALMAN_API kalman_api;
+
+/* Función de inicialización */
+extern void Init_Kalman(void);
+
+#endif /* KALMAN_H_INCLUDED */
@@ -11,6 +11,7 @@
 
 /* Declaración de funciones públicas */
 extern int lagrange_halfband(int m, float *h0);
+extern int lagrange_halfband_d(int m, double *h0);
 
 #ifdef DEBUG
 /* Declaración de funciones de test */
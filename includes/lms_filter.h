@@ -0,0 +1,50 @@
+#ifndef LMS_FILTER_H_INCLUDED
+#define LMS_FILTER_H_INCLUDED
+
+#include "fir_filter.h"
+
+/* Definiciones propias del módulo */
+#define LMS_OK              0
+#define LMS_KO              -1
+#define LMS_CARRILES        4       /* Acumuladores parciales del bucle fusionado (ancho SIMD) */
+
+/* Tamaño en floats de la línea de retardo: anillo de ncoef muestras más su copia espejo */
+#define LMS_RETARDO(ncoef)  (2 * (ncoef))
+
+/* Regla de actualización de los coeficientes */
+typedef enum {
+    LMS_ESTANDAR,           /* w += mu e x */
+    LMS_NORMALIZADO,        /* w += mu e x / (epsilon + |x|^2) */
+    LMS_FUGAS               /* w = (1 - mu gamma) w + mu e x */
+} LMS_TIPO;
+
+/* Objeto LMS_OBJECT - Filtro FIR adaptativo sobre la línea de retardo de FIR_FILTER_OBJECT */
+typedef struct
+{
+    LMS_TIPO tipo;              /* Regla de actualización */
+    FIR_FILTER_OBJECT fir;      /* ncoef, coeficientes adaptativos pcoef, anillo pz y p_write (muestra más reciente) */
+    float mu;                   /* Paso de adaptación */
+    float epsilon;              /* Regularización del NLMS */
+    float retencion;            /* 1 - mu gamma en LMS_FUGAS, 1 en el resto */
+    float error;                /* Error a priori e[n] = d[n] - y[n] de la última muestra */
+    float ganancia;             /* Factor de la actualización pendiente (se aplica en la muestra siguiente) */
+    float factor;               /* Retención de la actualización pendiente */
+} LMS_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_lms)(unsigned int ncoef, float *pcoef, float *pz, LMS_TIPO tipo, float mu, float parametro,
+                   LMS_OBJECT *plms);
+    float (*lms_filter)(float xn, float dn, LMS_OBJECT *plms);
+    int (*lms_bloque)(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, LMS_OBJECT *plms);
+    int (*sincroniza_lms)(LMS_OBJECT *plms);
+} LMS_API;
+
+/* API pública del módulo */
+extern LMS_API lms_api;
+
+/* Función de inicialización */
+extern void Init_LMS(void);
+
+#endif /* LMS_FILTER_H_INCLUDED */
@@ -9,6 +9,16 @@
 #include "dwt.h"
 #include "nsdsp_math.h"
 #include "ann.h"
+#include "fft.h"
+#include "stft.h"
+#include "welch.h"
+#include "fast_fir.h"
+#include "sdft.h"
+#include "lms_filter.h"
+#include "fdaf.h"
+#include "rls.h"
+#include "saf.h"
+#include "kalman.h"
 
 // Función de inicialización principal
 extern void Init_NSDSP(void);
@@ -21,6 +31,16 @@ extern void Init_NSDSP(void);
 #include "test_dwt.h"
 #include "test_nsdsp_math.h"
 #include "test_ann.h"
+#include "test_fft.h"
+#include "test_stft.h"
+#include "test_welch.h"
+#include "test_fast_fir.h"
+#include "test_sdft.h"
+#include "test_lms_filter.h"
+#include "test_fdaf.h"
+#include "test_rls.h"
+#include "test_saf.h"
+#include "test_kalman.h"
 #endif
 
 #endif // NSDSP_H_INCLUDED
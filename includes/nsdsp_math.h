@@ -5,6 +5,33 @@
 #define NSDSP_MATH_OK  0
 #define NSDSP_MATH_KO  -1
 
+/* Tamaño de bloque de la factorización de Cholesky: un bloque de filas de NSDSP_MATH_BLOQUE floats
+ * por columna debe caber en la caché de datos de primer nivel */
+#define NSDSP_MATH_BLOQUE           32
+
+/* Tipo de sistema triangular (combinables con |) */
+#define NSDSP_MATH_INFERIOR         0x0     /* T triangular inferior */
+#define NSDSP_MATH_SUPERIOR         0x1     /* T triangular superior */
+#define NSDSP_MATH_TRASPUESTA       0x2     /* Resolver T^T X = B */
+#define NSDSP_MATH_UNIDAD           0x4     /* Diagonal de T unitaria implícita (no se lee) */
+
+/* Tamaño en floats del workspace de la QR de una matriz de n columnas: tau y una fila de trabajo */
+#define NSDSP_MATH_QR_WORKSPACE(n)  (2 * (n))
+
+/* Cálculo paralelo: número máximo de tareas por operación y trabajo mínimo (multiplicaciones) por
+ * debajo del cual el producto se calcula en el hilo llamante */
+#define NSDSP_MATH_TAREAS_MAX       64
+#define NSDSP_MATH_PARALELO_MINIMO  (64 * 64 * 64)
+
+/* Matrices de un lote que se procesan juntas: el bucle interno recorre NSDSP_MATH_CARRILES matrices */
+#define NSDSP_MATH_CARRILES         32
+
+/* Anchura máxima de los bloques de columnas de una matriz dispersa */
+#define NSDSP_MATH_DISPERSA_BLOQUE_MAX  8
+
+/* Columnas de Y que actualiza a la vez el bucle interno del producto disperso con varias columnas */
+#define NSDSP_MATH_DISPERSA_CARRILES    8
+
 /* Declaración de objetos */
 typedef struct
 {
@@ -13,11 +40,97 @@ typedef struct
     float * pmatriz;
 } MATRIZ;
 
+/* Matriz en doble precisión, con el mismo almacenamiento por filas que MATRIZ */
+typedef struct
+{
+    unsigned int filas;
+    unsigned int columnas;
+    double * pmatriz;
+} MATRIZ_D;
+
+/* Vista sobre el almacenamiento por filas de otra matriz: submatriz, ventana o traspuesta sin copia.
+ * El elemento (i, j) de la vista es pmatriz[i * paso + j], o pmatriz[j * paso + i] si es traspuesta */
+typedef struct
+{
+    unsigned int filas;         /* Filas de la vista (ya traspuesta) */
+    unsigned int columnas;      /* Columnas de la vista (ya traspuesta) */
+    unsigned int paso;          /* Floats entre filas consecutivas del almacenamiento, 0 si es denso */
+    unsigned int traspuesta;    /* 1 si la vista es la traspuesta del almacenamiento */
+    float * pmatriz;            /* Primer elemento de la vista en el almacenamiento */
+} MATRIZ_VISTA;
+
+/* Lote de matrices de igual dimensión en disposición SoA: el elemento (i, j) de la matriz l está en
+ * pmatriz[(i * columnas + j) * lote + l] */
+typedef struct
+{
+    unsigned int filas;         /* Filas de cada matriz */
+    unsigned int columnas;      /* Columnas de cada matriz */
+    unsigned int lote;          /* Número de matrices */
+    float * pmatriz;
+} MATRIZ_LOTE;
+
+/* Matriz dispersa en CSR por bloques de 1 x bloque columnas consecutivas (bloque = 1 es CSR). Los
+ * bloques de la fila i son los e = inicio_fila[i] .. inicio_fila[i+1]-1; el bloque e empieza en la
+ * columna columna[e] (múltiplo de bloque) y sus valores son valores[e * bloque .. e * bloque + bloque-1] */
+typedef struct
+{
+    unsigned int filas;
+    unsigned int columnas;
+    unsigned int bloque;        /* Columnas por bloque (1..NSDSP_MATH_DISPERSA_BLOQUE_MAX) */
+    unsigned int bloques;       /* Bloques almacenados */
+    unsigned int capacidad;     /* Bloques que caben en columna y valores (lo fija el llamante) */
+    unsigned int * inicio_fila; /* filas + 1 índices */
+    unsigned int * columna;     /* Columna inicial de cada bloque (capacidad) */
+    float * valores;            /* Valores de los bloques (capacidad * bloque) */
+} MATRIZ_DISPERSA;
+
+/* Operación preparada: las dimensiones se validan una vez con prepara_producto o prepara_suma y
+ * ejecuta_producto / ejecuta_suma las reutilizan sin ninguna comprobación en cada llamada */
+typedef struct
+{
+    unsigned int filas;         /* Filas de C (0 si la preparación falló) */
+    unsigned int interna;       /* Columnas de A y filas de B (producto) */
+    unsigned int columnas;      /* Columnas de C */
+    float signo;                /* Signo de B en la suma (+1 o -1) */
+} MATRIZ_OPERACION;
+
+/* Tarea paralela: calcula la parte indice (0..tareas-1) de una operación */
+typedef void (* NSDSP_MATH_TAREA)(void * contexto, unsigned int indice);
+
+/* Ejecutor de la aplicación (p.ej. un pool de hilos): ejecuta tarea(contexto, i) para i = 0..tareas-1,
+ * en cualquier orden e hilo, y retorna cuando han terminado todas. usuario es el puntero registrado */
+typedef void (* NSDSP_MATH_EJECUTOR)(NSDSP_MATH_TAREA tarea, void * contexto, unsigned int tareas, void * usuario);
+
 /* Declaración de la API */
 typedef struct
 {
     int (* product)(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3);
     int (* suma)(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3, int signo);
+    int (* cholesky)(MATRIZ * PA, MATRIZ * PL);
+    int (* lu)(MATRIZ * PA, MATRIZ * PLU, unsigned int * pivotes);
+    int (* qr)(MATRIZ * PA, MATRIZ * PQR, float * workspace);
+    int (* triangular)(MATRIZ * PT, MATRIZ * PB, int tipo);
+    int (* resuelve_cholesky)(MATRIZ * PL, MATRIZ * PB);
+    int (* resuelve_lu)(MATRIZ * PLU, const unsigned int * pivotes, MATRIZ * PB);
+    int (* resuelve_qr)(MATRIZ * PQR, const float * workspace, MATRIZ * PB);
+    int (* vista)(MATRIZ * PM, unsigned int fila, unsigned int columna, unsigned int filas,
+                  unsigned int columnas, int traspuesta, MATRIZ_VISTA * PV);
+    int (* producto_vista)(float alfa, MATRIZ_VISTA * PA, MATRIZ_VISTA * PB, float beta, MATRIZ_VISTA * PC);
+    int (* suma_vista)(float alfa, MATRIZ_VISTA * PA, float beta, MATRIZ_VISTA * PB, MATRIZ_VISTA * PC);
+    int (* paralelo)(NSDSP_MATH_EJECUTOR ejecutor, void * usuario, unsigned int tareas);
+    int (* producto_lote)(MATRIZ_LOTE * PA, MATRIZ_LOTE * PB, MATRIZ_LOTE * PC);
+    int (* entrelaza_lote)(const float * matrices, MATRIZ_LOTE * PL);
+    int (* separa_lote)(MATRIZ_LOTE * PL, float * matrices);
+    unsigned int (* cuenta_dispersa)(MATRIZ * PM, float umbral, unsigned int bloque);
+    int (* dispersa)(MATRIZ * PM, float umbral, unsigned int bloque, MATRIZ_DISPERSA * PS);
+    int (* producto_disperso)(MATRIZ_DISPERSA * PS, MATRIZ * PX, MATRIZ * PY);
+    int (* prepara_producto)(MATRIZ * PA, MATRIZ * PB, MATRIZ * PC, MATRIZ_OPERACION * PO);
+    int (* prepara_suma)(MATRIZ * PA, MATRIZ * PB, MATRIZ * PC, int signo, MATRIZ_OPERACION * PO);
+    void (* ejecuta_producto)(const MATRIZ_OPERACION * PO, const float * a, const float * b, float * c);
+    void (* ejecuta_suma)(const MATRIZ_OPERACION * PO, const float * a, const float * b, float * c);
+    int (* product_d)(MATRIZ_D * PM1, MATRIZ_D * PM2, MATRIZ_D * PM3);
+    int (* suma_d)(MATRIZ_D * PM1, MATRIZ_D * PM2, MATRIZ_D * PM3, int signo);
+    int (* product_m)(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3);
 } NSDSP_MATH_API;
 
 /* API pública del módulo */
@@ -0,0 +1,63 @@
+#ifndef RLS_H_INCLUDED
+#define RLS_H_INCLUDED
+
+#include "nsdsp_math.h"
+
+/* Definiciones propias del módulo */
+#define RLS_OK              0
+#define RLS_KO              -1
+
+/* Tamaño en floats del workspace: factor P^{1/2} (N x N), regresor y ganancia */
+#define RLS_QR_WORKSPACE(ncoef)         ((ncoef) * (ncoef) + 2 * (ncoef))
+
+/* Tamaño en floats del workspace del lattice: 5 variables de estado por etapa */
+#define RLS_LATTICE_WORKSPACE(orden)    (5 * (orden))
+
+/* Objeto RLS_QR_OBJECT - RLS por descomposición QR inversa (Givens), O(N^2) por muestra */
+typedef struct
+{
+    unsigned int ncoef;         /* Número de coeficientes N */
+    float lambda;               /* Factor de olvido, en (0, 1] */
+    float escala;               /* lambda^(-1/2) */
+    MATRIZ raiz;                /* U = P^{T/2} triangular superior (N x N), con P = U^T U */
+    float *pcoef;               /* Coeficientes w, adaptados in situ */
+    float *regresor;            /* x[n], x[n-1], ..., x[n-N+1] */
+    float *ganancia;            /* Columna de ganancia g gamma^(-1/2) del post-array */
+    float error;                /* Error a priori de la última muestra */
+} RLS_QR_OBJECT;
+
+/* Objeto RLS_LATTICE_OBJECT - RLS en celosía con estimación conjunta, O(N) por muestra */
+typedef struct
+{
+    unsigned int orden;         /* Número de etapas N (equivale a N coeficientes) */
+    float lambda;               /* Factor de olvido, en (0, 1] */
+    float energia;              /* F_0(n): energía de predicción de orden 0 */
+    float *delta;               /* Delta_m: correlación cruzada de errores de predicción hacia delante y atrás */
+    float *rho;                 /* rho_m: correlación cruzada de b_m y el error de estimación conjunta */
+    float *b_ant;               /* b_m(n-1): error de predicción hacia atrás a posteriori */
+    float *energia_b;           /* B_m(n-1): energía de predicción hacia atrás */
+    float *gamma;               /* gamma_m(n-1): factor de conversión */
+    float error;                /* Error a priori de la última muestra */
+} RLS_LATTICE_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_qr)(unsigned int ncoef, float lambda, float delta, float *pcoef, float *workspace,
+                  RLS_QR_OBJECT *prls);
+    float (*qr_filter)(float xn, float dn, RLS_QR_OBJECT *prls);
+    int (*qr_bloque)(const float *x, const float *d, float *y, float *e, unsigned int nmuestras,
+                     RLS_QR_OBJECT *prls);
+    int (*get_lattice)(unsigned int orden, float lambda, float delta, float *workspace, RLS_LATTICE_OBJECT *prls);
+    float (*lattice_filter)(float xn, float dn, RLS_LATTICE_OBJECT *prls);
+    int (*lattice_bloque)(const float *x, const float *d, float *y, float *e, unsigned int nmuestras,
+                          RLS_LATTICE_OBJECT *prls);
+} RLS_API;
+
+/* API pública del módulo */
+extern RLS_API rls_api;
+
+/* Función de inicialización */
+extern void Init_RLS(void);
+
+#endif /* RLS_H_INCLUDED */
@@ -52,6 +52,31 @@ typedef struct
     BUFFER_FIR z_buffers;                   // Buffers de filtros FIR
  } RT_MOMENTOS;
 
+// Objetos en doble precisión: mismos campos que BUFFER_Z, BUFFER_FIR y RT_MOMENTOS
+typedef struct
+{
+    unsigned int index_w;                   // índice de escritura
+    double buffer_z[N_MA];
+} BUFFER_Z_D;
+
+typedef struct
+{
+    BUFFER_Z_D mu_z;
+    BUFFER_Z_D sigma2_z;
+    BUFFER_Z_D a_z;
+    BUFFER_Z_D c_z;
+} BUFFER_FIR_D;
+
+typedef struct
+{
+    estado status;
+    double mu;
+    double var2;
+    double A;
+    double C;
+    BUFFER_FIR_D z_buffers;
+} RT_MOMENTOS_D;
+
 
 
 typedef struct
@@ -59,11 +84,16 @@ typedef struct
     RT_MOMENTOS_SERVICE (* suscribe_rt_momentos)(void);
     int (* unsuscribe_rt_momentos)(RT_MOMENTOS_SERVICE);
     int (* compute_rt_momentos)(RT_MOMENTOS_SERVICE,float);
+    RT_MOMENTOS_SERVICE (* suscribe_rt_momentos_d)(void);     // Servicios en doble precisión
+    int (* unsuscribe_rt_momentos_d)(RT_MOMENTOS_SERVICE);
+    int (* compute_rt_momentos_d)(RT_MOMENTOS_SERVICE,double);
+    int (* compute_rt_momentos_m)(RT_MOMENTOS_SERVICE,float);  // Servicios float, cálculo en double
 } SSP;
 
 
 extern SSP pse;                                 // pse es la estructura de métodos de la librería
 extern void Init_RT_Momentos(void);             // Declaración del método de inicialización de la librería
 extern RT_MOMENTOS servicios_rt_momentos[];     // Array de servicios para acceso externo
+extern RT_MOMENTOS_D servicios_rt_momentos_d[]; // Array de servicios en doble precisión
 
 #endif // RT_MOMENTOS_H_INCLUDED
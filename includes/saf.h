@@ -0,0 +1,66 @@
+#ifndef SAF_H_INCLUDED
+#define SAF_H_INCLUDED
+
+#include "dwt.h"
+#include "lms_filter.h"
+
+/* Definiciones propias del módulo */
+#define SAF_OK              0
+#define SAF_KO              -1
+
+/* Acumuladores parciales de los productos escalares: dos vectores de LMS_CARRILES ocultan la latencia de la suma */
+#define SAF_CARRILES        (2 * LMS_CARRILES)
+
+/* Número de subbandas: WAVELET_LEVELS detalles más la aproximación final */
+#define SAF_BANDAS          (WAVELET_LEVELS + 1)
+
+/* Factor de decimación de la banda b en la DWT: 2^(b+1) para los detalles, 2^WAVELET_LEVELS para la aproximación */
+#define SAF_DECIMACION(banda)           (1u << (((banda) < WAVELET_LEVELS) ? ((banda) + 1) : WAVELET_LEVELS))
+
+/* Muestras entre adaptaciones: todas las bandas de la DWT tienen muestra nueva cada 2^WAVELET_LEVELS muestras */
+#define SAF_PERIODO                     (1u << WAVELET_LEVELS)
+
+/* Coeficientes del filtro de análisis equivalente de la banda b a tasa completa (cascada de filtros del árbol DWT) */
+#define SAF_LONGITUD_BANDA(banda)       ((SAF_DECIMACION(banda) - 1) * (BUFFER_SIZE - 1) + 1)
+
+/* Suma de SAF_LONGITUD_BANDA de todas las bandas */
+#define SAF_ANALISIS                    ((BUFFER_SIZE - 1) * (3 * SAF_PERIODO - 2 - SAF_BANDAS) + SAF_BANDAS)
+
+/* Tamaño en floats del workspace: coeficientes del camino, líneas de retardo de la entrada y de cada banda,
+ * y coeficientes y líneas de retardo de los filtros de análisis */
+#define SAF_WORKSPACE(ncoef)            ((ncoef) + (SAF_BANDAS + 1) * LMS_RETARDO(ncoef) + 2 * SAF_ANALISIS)
+
+/* Objeto SAF_OBJECT - Filtro adaptativo multibanda: un único camino en banda completa adaptado con los errores
+ * de las subbandas DWT */
+typedef struct
+{
+    unsigned int ncoef;                         /* Coeficientes del camino en banda completa */
+    float *pcoef;                               /* Coeficientes w del camino */
+    float *pz;                                  /* Línea de retardo de x[n]: anillo de ncoef muestras y copia espejo */
+    float *pbanda[SAF_BANDAS];                  /* Líneas de retardo de x_b[n] a tasa completa, con la misma disposición */
+    unsigned int p_write;                       /* Posición de la muestra más reciente en las líneas de retardo */
+    FIR_FILTER_OBJECT analisis[SAF_BANDAS];     /* Filtros de análisis equivalentes de la referencia a tasa completa */
+    DWT_OBJECT deseada;                         /* Análisis DWT de la señal deseada d[n] */
+    float mu;                                   /* Paso de adaptación */
+    float epsilon;                              /* Regularización de la normalización de cada banda */
+    double energia[SAF_BANDAS];                 /* Energía de la ventana de cada banda, actualizada muestra a muestra */
+    float error_banda[SAF_BANDAS];              /* Error a priori de cada banda en la última adaptación */
+    unsigned int fase;                          /* n mod SAF_PERIODO: la adaptación se hace en la fase 0 */
+    float error;                                /* Error a priori en banda completa e[n] = d[n] - y[n] */
+} SAF_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_saf)(unsigned int ncoef, float mu, float epsilon, float *workspace, SAF_OBJECT *psaf);
+    float (*saf_filter)(float xn, float dn, SAF_OBJECT *psaf);
+    int (*saf_bloque)(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, SAF_OBJECT *psaf);
+} SAF_API;
+
+/* API pública del módulo */
+extern SAF_API saf_api;
+
+/* Función de inicialización */
+extern void Init_SAF(void);
+
+#endif /* SAF_H_INCLUDED */
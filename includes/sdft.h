@@ -0,0 +1,66 @@
+#ifndef SDFT_H_INCLUDED
+#define SDFT_H_INCLUDED
+
+#include "fft.h"
+
+/* Definiciones propias del módulo */
+#define SDFT_OK             0
+#define SDFT_KO             -1
+#define SDFT_NONE           -1
+#define MAX_SDFT            4           /* Número máximo de servicios concurrentes */
+#define MAX_SDFT_BINS       64          /* Bins seguidos por servicio (múltiplo de SDFT_CARRILES) */
+#define SDFT_CARRILES       4           /* Bins por grupo del bucle de actualización (ancho SIMD) */
+#define MAX_SDFT_LONGITUD   4096        /* Longitud máxima de la ventana deslizante */
+
+typedef int SDFT_SERVICE;
+
+typedef enum
+{
+    SDFT_FREE,
+    SDFT_ASIGNED
+} SDFT_ESTADO;
+
+/* Servicio SDFT: banco de K bins sobre una ventana deslizante de N muestras.
+ * Los bins se guardan como estructura de arrays para actualizar todos con un mismo bucle, en grupos
+ * de SDFT_CARRILES; los bins de relleno del último grupo tienen coeficientes nulos y valen siempre 0 */
+typedef struct
+{
+    SDFT_ESTADO status;                     /* Estado del servicio (SDFT_FREE, SDFT_ASIGNED) */
+    unsigned int n;                         /* Longitud de la ventana */
+    unsigned int nbins;                     /* Número de bins seguidos */
+    unsigned int ngrupos;                   /* Grupos de SDFT_CARRILES bins que cubren nbins */
+    unsigned int periodo;                   /* Ventanas entre reanclajes (0 = sin reanclaje) */
+    unsigned int p_write;                   /* Posición de escritura en el anillo */
+    unsigned int cuenta;                    /* Muestras desde el último reanclaje */
+    float bin[MAX_SDFT_BINS];               /* Frecuencia de cada bin en ciclos por ventana */
+    float re[MAX_SDFT_BINS];                /* Parte real de X_k */
+    float im[MAX_SDFT_BINS];                /* Parte imaginaria de X_k */
+    float w_re[MAX_SDFT_BINS];              /* W_k = exp(j 2 pi k / N) */
+    float w_im[MAX_SDFT_BINS];
+    float c_re[MAX_SDFT_BINS];              /* C_k = exp(-j 2 pi k), 1 para bins enteros */
+    float c_im[MAX_SDFT_BINS];
+    float s_re[MAX_SDFT_BINS];              /* Acumulador de reanclaje (DFT directa de la ventana) */
+    float s_im[MAX_SDFT_BINS];
+    float p_re[MAX_SDFT_BINS];              /* Fasor del acumulador: exp(-j 2 pi k m / N) */
+    float p_im[MAX_SDFT_BINS];
+    float anillo[MAX_SDFT_LONGITUD];        /* Últimas N muestras */
+} SDFT;
+
+/* Declaración de la API */
+typedef struct
+{
+    SDFT_SERVICE (*suscribe_sdft)(unsigned int n, const float *bins, unsigned int nbins, unsigned int periodo);
+    int (*unsuscribe_sdft)(SDFT_SERVICE id_service);
+    int (*compute_sdft)(SDFT_SERVICE id_service, float xn);
+    int (*compute_bloque_sdft)(SDFT_SERVICE id_service, const float *x, unsigned int nmuestras);
+    int (*amplitud_sdft)(SDFT_SERVICE id_service, float *amplitud);
+} SDFT_API;
+
+/* API pública del módulo */
+extern SDFT_API sdft_api;
+extern SDFT servicios_sdft[];                   /* Array de servicios para acceso externo */
+
+/* Función de inicialización */
+extern void Init_SDFT(void);
+
+#endif /* SDFT_H_INCLUDED */
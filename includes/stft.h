@@ -0,0 +1,49 @@
+#ifndef STFT_H_INCLUDED
+#define STFT_H_INCLUDED
+
+#include "fft.h"
+
+/* Definiciones propias del módulo */
+#define STFT_OK     0
+#define STFT_KO     -1
+
+/* Tipos de ventana precalculada */
+typedef enum {
+    RECTANGULAR,    /* w[i] = 1 */
+    HANN,           /* w[i] = 0.5 - 0.5 cos(2 pi i / N) */
+    HAMMING,        /* w[i] = 0.54 - 0.46 cos(2 pi i / N) */
+    BLACKMAN        /* w[i] = 0.42 - 0.5 cos(2 pi i / N) + 0.08 cos(4 pi i / N) */
+} STFT_VENTANA;
+
+/* Objeto STFT_OBJECT - Transformada de Fourier de tiempo corto en streaming */
+typedef struct
+{
+    unsigned int n;             /* Tamaño de trama (potencia de 2) */
+    unsigned int hop;           /* Salto entre tramas consecutivas (1 <= hop <= n) */
+    RFFT_PLAN *plan;            /* Plan real de n puntos (puede compartirse entre objetos) */
+    const float *ventana;       /* Ventana de n coeficientes */
+    float *anillo;              /* Buffer circular de las últimas n muestras */
+    unsigned int p_write;       /* Posición de escritura (muestra más antigua con el anillo lleno) */
+    unsigned int llenas;        /* Muestras válidas en el anillo (satura en n) */
+    unsigned int cuenta;        /* Muestras recibidas desde la última trama */
+    unsigned int tramas;        /* Número de tramas emitidas */
+} STFT_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_ventana)(STFT_VENTANA tipo, unsigned int n, float *ventana);
+    int (*get_stft)(unsigned int n, unsigned int hop, RFFT_PLAN *plan, const float *ventana,
+                    float *anillo, STFT_OBJECT *pstft);
+    int (*stft)(float xin, COMPLEJO *trama, STFT_OBJECT *pstft);
+    int (*stft_bloque)(const float *x, unsigned int nmuestras, COMPLEJO *tramas, unsigned int max_tramas,
+                       STFT_OBJECT *pstft);
+} STFT_API;
+
+/* API pública del módulo */
+extern STFT_API stft_api;
+
+/* Función de inicialización */
+extern void Init_STFT(void);
+
+#endif /* STFT_H_INCLUDED */
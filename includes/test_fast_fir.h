@@ -0,0 +1,11 @@
+#ifndef TEST_FAST_FIR_H_INCLUDED
+#define TEST_FAST_FIR_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_Fast_Fir_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_FAST_FIR_H_INCLUDED */
@@ -0,0 +1,11 @@
+#ifndef TEST_FDAF_H_INCLUDED
+#define TEST_FDAF_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_FDAF_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_FDAF_H_INCLUDED */
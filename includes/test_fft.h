@@ -0,0 +1,11 @@
+#ifndef TEST_FFT_H_INCLUDED
+#define TEST_FFT_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_FFT_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_FFT_H_INCLUDED */
@@ -0,0 +1,11 @@
+#ifndef TEST_KALMAN_H_INCLUDED
+#define TEST_KALMAN_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_Kalman_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_KALMAN_H_INCLUDED */
@@ -0,0 +1,11 @@
+#ifndef TEST_LMS_FILTER_H_INCLUDED
+#define TEST_LMS_FILTER_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_LMS_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_LMS_FILTER_H_INCLUDED */
@@ -0,0 +1,11 @@
+#ifndef TEST_RLS_H_INCLUDED
+#define TEST_RLS_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_RLS_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_RLS_H_INCLUDED */
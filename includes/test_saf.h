@@ -0,0 +1,11 @@
+#ifndef TEST_SAF_H_INCLUDED
+#define TEST_SAF_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_SAF_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_SAF_H_INCLUDED */
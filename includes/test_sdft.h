@@ -0,0 +1,11 @@
+#ifndef TEST_SDFT_H_INCLUDED
+#define TEST_SDFT_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_SDFT_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_SDFT_H_INCLUDED */
@@ -0,0 +1,11 @@
+#ifndef TEST_STFT_H_INCLUDED
+#define TEST_STFT_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_STFT_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_STFT_H_INCLUDED */
@@ -0,0 +1,11 @@
+#ifndef TEST_WELCH_H_INCLUDED
+#define TEST_WELCH_H_INCLUDED
+
+#ifdef DEBUG
+
+/* Declaración de función principal de test */
+extern int Run_All_Welch_Tests(void);
+
+#endif /* DEBUG */
+
+#endif /* TEST_WELCH_H_INCLUDED */
@@ -0,0 +1,43 @@
+#ifndef WELCH_H_INCLUDED
+#define WELCH_H_INCLUDED
+
+#include "fft.h"
+#include "stft.h"
+
+/* Definiciones propias del módulo */
+#define WELCH_OK            0
+#define WELCH_KO            -1
+#define MAX_WELCH_CANALES   16      /* Número máximo de canales por objeto */
+
+/* Tamaño en floats del workspace: anillos + PSD unilaterales + trama compartida */
+#define WELCH_WORKSPACE(n, canales)     ((canales) * (n) + (canales) * ((n) / 2 + 1) + (n))
+
+/* Objeto WELCH_OBJECT - Estimador de densidad espectral de potencia multicanal */
+typedef struct
+{
+    unsigned int n;                         /* Tamaño de segmento (potencia de 2) */
+    unsigned int canales;                   /* Número de canales */
+    float olvido;                           /* Factor de olvido: 0 = media aritmética, (0,1) = exponencial */
+    float escala;                           /* 1 / (fs * sum(w^2)) */
+    STFT_OBJECT stft[MAX_WELCH_CANALES];    /* Segmentación por canal (comparten plan y ventana) */
+    unsigned int segmentos[MAX_WELCH_CANALES];  /* Segmentos promediados por canal */
+    float *psd;                             /* PSD unilateral, canales x (n/2 + 1) */
+    COMPLEJO *trama;                        /* Trama de trabajo compartida (n/2 COMPLEJO) */
+} WELCH_OBJECT;
+
+/* Declaración de la API */
+typedef struct
+{
+    int (*get_welch)(unsigned int n, unsigned int hop, unsigned int canales, float fs, float olvido,
+                     RFFT_PLAN *plan, const float *ventana, float *workspace, WELCH_OBJECT *pwelch);
+    int (*welch)(const float *x, unsigned int nmuestras, WELCH_OBJECT *pwelch);
+    int (*reset)(WELCH_OBJECT *pwelch);
+} WELCH_API;
+
+/* API pública del módulo */
+extern WELCH_API welch_api;
+
+/* Función de inicialización */
+extern void Init_Welch(void);
+
+#endif /* WELCH_H_INCLUDED */
@@ -52,7 +52,10 @@
  * \subsection init_ann_func Init_ANN
  * Inicializa la estructura de punteros a funciones ann_api.
  * Esta función debe ser llamada antes de usar cualquier servicio del módulo.
- * Asigna los punteros a las funciones get_ann e iterate_ann.
+ * Asigna los punteros a las funciones get_ann, iterate_ann, trigger_ann,
+ * get_ann_q8, iterate_ann_q8, build_model_ann, load_model_ann, train_workspace_ann,
+ * get_trainer_ann, train_step_ann, get_ann_layers, get_conv_stream_ann, conv_stream_ann,
+ * get_rnn_ann, rnn_step_ann y rnn_reset_ann.
  *
  * \subsection get_ann_func get_ann
  * Crea y configura un servicio de red neuronal artificial.
@@ -129,6 +132,12 @@
  * }
  * \enddot
  *
+ * get_ann, get_ann_layers y load_model_ann preparan el producto W x de cada capa DENSE con
+ * nsdsp_math_api.prepara_producto, de modo que iterate_ann() lo ejecuta sin repetir la validación de
+ * punteros y dimensiones en cada capa de cada inferencia. Por ello las dimensiones de las capas no
+ * deben cambiar después de construir el servicio (los valores de los pesos sí). Las capas que no
+ * pudieron prepararse se siguen validando en cada llamada.
+ *
  * \param service Puntero al servicio ANN a procesar
  * \return ANN_OK (0) si el procesamiento fue exitoso, ANN_KO (-1) si hubo error
  *
@@ -148,6 +157,186 @@
  * \param trigger Tipo de función de activación
  * \return ANN_OK si éxito, ANN_KO si error
  *
+ * \subsection get_ann_q8_func get_ann_q8
+ * Crea un servicio de red neuronal cuantizada a partir de las mismas matrices MATRIZ de
+ * pesos y bias que utiliza get_ann(). Los pesos de cada neurona (fila) se cuantizan a int8
+ * con una escala simétrica propia:
+ * \f[
+ * s_f = \frac{\max_c |W_{fc}|}{127}, \qquad Q_{fc} = \mathrm{round}\left(\frac{W_{fc}}{s_f}\right)
+ * \f]
+ *
+ * Los pesos cuantizados y las escalas se escriben en buffers proporcionados por el llamante,
+ * dispuestos capa a capa de forma consecutiva. El bias se mantiene en coma flotante y no se copia.
+ *
+ * \param levels Número de capas de la red (debe ser <= LMAX)
+ * \param trigger Tipo de función de activación a usar
+ * \param pesos Array de matrices de pesos para cada capa
+ * \param bias Array de matrices de bias para cada capa
+ * \param pesos_q Buffer int8 de tamaño igual a la suma de filas×columnas de todas las capas
+ * \param escalas Buffer float de tamaño igual a la suma de filas de todas las capas
+ * \return Objeto ANN_Q8_SERVICE configurado (levels = 0 si hubo error)
+ *
+ * \subsection iterate_ann_q8_func iterate_ann_q8
+ * Realiza el forward pass de la red cuantizada. En cada capa la entrada se cuantiza
+ * dinámicamente a int8 con escala \f$ s_x = \max|x| / 127 \f$, el producto se acumula en
+ * int32 y se reescala a float antes de sumar el bias y aplicar la función de activación:
+ * \f[
+ * y_f = T\left(s_f \cdot s_x \sum_c Q_{fc} \, x^q_c + b_f\right)
+ * \f]
+ *
+ * Los pesos ocupan la cuarta parte de memoria que en float, lo que reduce el ancho de banda
+ * necesario por inferencia. El producto escalar int8 usa un núcleo AVX2 o SSE2 cuando el destino
+ * lo admite (extensión de signo a int16 y multiplicación-suma vpmaddwd/pmaddwd) y un bucle escalar
+ * en otro caso; la suma es entera y exacta, por lo que el resultado es idéntico en todos los caminos.
+ *
+ * \param service Puntero al servicio ANN cuantizado a procesar
+ * \return ANN_OK (0) si el procesamiento fue exitoso, ANN_KO (-1) si hubo error
+ *
+ * \subsection model_ann_func build_model_ann / load_model_ann
+ * Definen un formato binario versionado para los pesos de la red, pensado para ser
+ * proyectado en memoria (mmap, flash mapeada o fichero leído en un buffer) y enlazado
+ * directamente a las capas sin ninguna copia ni análisis de texto en el arranque.
+ *
+ * Disposición del fichero (enteros de 32 bits en el orden de bytes nativo):
+ * | Bloque | Tamaño | Contenido |
+ * |:-------|:------:|:----------|
+ * | ANN_MODEL_HEADER | 32 bytes | magic, version, levels, trigger, tamano, reservado |
+ * | ANN_MODEL_LAYER × levels | 16 bytes/capa | filas, columnas, offset_pesos, offset_bias |
+ * | Pesos capa i | filas×columnas float | Alineado a ANN_MODEL_ALIGN bytes |
+ * | Bias capa i | filas float | Alineado a ANN_MODEL_ALIGN bytes |
+ *
+ * build_model_ann() serializa las matrices MATRIZ de una red en un buffer del llamante
+ * (con buffer NULL devuelve el tamaño necesario). load_model_ann() valida la cabecera,
+ * los offsets y el encadenamiento de dimensiones, y hace que las MATRIZ del objeto
+ * ANN_MODEL apunten dentro del propio modelo. El servicio resultante usa las capas del
+ * objeto ANN_MODEL, por lo que pueden cargarse tantos modelos simultáneos como se desee.
+ * La memoria del modelo debe permanecer válida mientras se use el servicio y no es
+ * modificada por iterate_ann(), de modo que puede compartirse entre procesos en solo lectura.
+ *
+ * \param modelo Puntero al inicio del modelo en memoria (alineado al menos a 4 bytes)
+ * \param tamano Tamaño en bytes de la región de memoria del modelo
+ * \param pmodel Puntero al objeto ANN_MODEL a configurar
+ * \return ANN_OK (0) si el modelo es válido, ANN_KO (-1) en caso contrario
+ *
+ * \subsection train_ann_func train_workspace_ann / get_trainer_ann / train_step_ann
+ * Entrenamiento en línea por retropropagación sin asignación dinámica de memoria.
+ * train_workspace_ann() devuelve el número de floats de workspace necesarios para un
+ * tamaño máximo de mini-lote y un optimizador; get_trainer_ann() reparte ese workspace
+ * del llamante en un objeto ANN_TRAINER asociado a un ANN_SERVICE existente.
+ *
+ * Cada llamada a train_step_ann() procesa un mini-lote de n muestras (x con una muestra
+ * por fila, d con la salida deseada por fila):
+ * 1. Forward pass con caché de activaciones, \f$ A_{l+1} = T(W_l A_l + b_l) \f$, usando
+ *    nsdsp_math_api.product sobre el mini-lote completo (neuronas × n)
+ * 2. Pérdida cuadrática media \f$ L = \frac{1}{2n}\sum \|A_L - D\|^2 \f$
+ * 3. Retropropagación \f$ \delta_{l-1} = (W_l^T \delta_l) \odot T'(A_l) \f$ con gradientes
+ *    \f$ \nabla W_l = \delta_l A_l^T \f$ y \f$ \nabla b_l = \sum_n \delta_l \f$; las
+ *    traspuestas son vistas de nsdsp_math_api.producto_vista, sin copia
+ * 4. Actualización SGD, MOMENTUM (\f$ m = \beta_1 m + g \f$) o ADAM (con corrección de sesgo)
+ *
+ * Los parámetros beta1, beta2 y epsilon toman por defecto 0.9, 0.999 y 1e-8 y pueden
+ * modificarse en el objeto ANN_TRAINER. Los pesos se modifican sobre las propias matrices
+ * del servicio, por lo que no deben residir en memoria de solo lectura. La función STEP
+ * no es derivable y no propaga gradiente.
+ *
+ * \param ptrainer Puntero al objeto ANN_TRAINER
+ * \param x Entradas del mini-lote (n × entradas)
+ * \param d Salidas deseadas del mini-lote (n × salidas)
+ * \param n Número de muestras del mini-lote (1 <= n <= batch)
+ * \param perdida Puntero donde devolver la pérdida del mini-lote (puede ser NULL)
+ * \return ANN_OK (0) si el paso se realizó correctamente, ANN_KO (-1) si hubo error
+ *
+ * \subsection get_ann_layers_func get_ann_layers
+ * Crea un servicio ANN a partir de un array de objetos LAYER construidos por el llamante,
+ * lo que permite combinar capas de distinto tipo (ANN_LAYER_TYPE):
+ * - **DENSE**: \f$ y = T(W x + b) \f$, igual que en get_ann()
+ * - **CONV1D**: convolución 1-D multicanal válida (sin relleno), con kernel K, stride s y
+ *   dilatación d. Entrada dispuesta por canales [C_in][L_in] y salida [C_out][L_out]:
+ *   \f[
+ *   y_{o}[t] = T\left(b_o + \sum_{c=0}^{C_{in}-1}\sum_{k=0}^{K-1} w_{o,c,k}\, x_c[t s + k d]\right),
+ *   \qquad L_{out} = \left\lfloor \frac{L_{in} - (K-1)d - 1}{s} \right\rfloor + 1
+ *   \f]
+ *   Los pesos se almacenan en una MATRIZ de C_out × (C_in·K).
+ * - **MAXPOOL1D / AVGPOOL1D**: máximo o media sobre ventanas de K muestras con paso s, canal
+ *   a canal. No tienen pesos y no aplican función de activación.
+ * - **SPARSE**: \f$ y = T(W x + b) \f$ con W podada en CSR (ver sparse_layer_ann)
+ *
+ * La convolución se calcula de forma directa, sin expandir la entrada (im2col): para cada tap
+ * del kernel se acumula sobre toda la salida del canal. Con stride 1 el bucle de cada tap se
+ * recorre en grupos de ANN_CARRILES salidas, un bucle de longitud fija sobre punteros restrict
+ * que el compilador vectoriza con -O2; las salidas sobrantes y el caso con stride > 1 (accesos
+ * no contiguos) usan el bucle escalar. Los vectores intermedios están limitados a
+ * MAX_ANN_BUFFER elementos.
+ *
+ * \param levels Número de capas de la red (debe ser <= LMAX)
+ * \param trigger Tipo de función de activación a usar
+ * \param layers Array de capas configuradas por el llamante (debe permanecer válido)
+ * \return Objeto ANN_SERVICE configurado (levels = 0 si hubo error)
+ *
+ * \subsection conv_stream_func get_conv_stream_ann / conv_stream_ann
+ * Ejecución causal muestra a muestra de una capa CONV1D. Cada canal de entrada mantiene una
+ * línea de retardo FIR_FILTER_OBJECT de \f$ (K-1)d+1 \f$ muestras (inicializada con
+ * fir_api.get_fir y actualizada como en fir_filter), compartida por todos los canales de
+ * salida. conv_stream_ann() recibe un vector de C_in muestras y, una vez llena la ventana,
+ * produce un vector de C_out salidas cada stride muestras; devuelve 1 si ha generado salida,
+ * 0 si no y ANN_KO si hubo error. Las salidas coinciden con las columnas de la convolución
+ * por bloques sobre la misma señal.
+ *
+ * \param layer Capa CONV1D a ejecutar en streaming
+ * \param trigger Función de activación de la salida
+ * \param pz Buffer de retardos de C_in × ((K-1)d+1) floats
+ * \param pstream Puntero al objeto CONV1D_STREAM a inicializar
+ * \return ANN_OK (0) si éxito, ANN_KO (-1) si error
+ *
+ * \subsection rnn_func get_rnn_ann / rnn_step_ann / rnn_reset_ann
+ * Capas recurrentes GRU y LSTM con estado persistente entre llamadas. Los pesos de todas las
+ * puertas se apilan en una única matriz de entrada W (G·H × I) y una única matriz recurrente
+ * U (G·H × H), con G = 3 (z, r, n) en GRU y G = 4 (i, f, g, o) en LSTM, de modo que cada paso
+ * calcula todas las puertas con solo dos productos matriciales:
+ * \f[
+ * \mathrm{GRU:}\quad z = \sigma(W_z x + U_z h + b_z),\; r = \sigma(W_r x + U_r h + b_r),\;
+ * n = \tanh(W_n x + b_n + r \odot U_n h),\; h' = (1 - z) \odot n + z \odot h
+ * \f]
+ * \f[
+ * \mathrm{LSTM:}\quad c' = \sigma(a_f) \odot c + \sigma(a_i) \odot \tanh(a_g),\qquad
+ * h' = \sigma(a_o) \odot \tanh(c'),\qquad a = W x + U h + b
+ * \f]
+ *
+ * El estado se guarda en el workspace del llamante (ANN_RNN_WORKSPACE floats) como una matriz
+ * H × S, una columna por canal. Con S > 1 (modo multi-stream) rnn_step_ann() actualiza los
+ * estados de los S canales a la vez: la entrada es una matriz I × S y las puertas se obtienen
+ * con un GEMM en lugar de S productos matriz-vector, reutilizando cada fila de pesos para todos
+ * los canales. Con S = 1 la capa puede incluirse en una red mediante get_ann_layers(); en ese
+ * caso iterate_ann() avanza un paso temporal por llamada y la salida de la capa es h (sin
+ * aplicar la función de activación de la red). rnn_reset_ann() pone a cero el estado.
+ *
+ * \param layer Capa a configurar o ejecutar
+ * \param tipo GRU o LSTM
+ * \param pesos_x Pesos de entrada W (G·H × I)
+ * \param pesos_h Pesos recurrentes U (G·H × H)
+ * \param bias Bias de las puertas (G·H × 1)
+ * \param streams Número de canales independientes S
+ * \param workspace Buffer de ANN_RNN_WORKSPACE(tipo, H, S) floats
+ * \param prnn Objeto RNN_CONFIG a inicializar (debe permanecer válido)
+ * \param x Entrada I × S de rnn_step_ann
+ * \param y Salida H × S de rnn_step_ann (puede ser NULL; el estado queda en prnn->estado_h)
+ * \return ANN_OK (0) si éxito, ANN_KO (-1) si error
+ *
+ * \subsection sparse_layer_func sparse_layer_ann
+ * Poda una capa DENSE: los pesos con \f$ |w| \le \f$ umbral se anulan y la matriz se guarda en
+ * el CSR de bloques 1 × bloque del llamante (nsdsp_math_api.dispersa). La capa pasa a tipo
+ * SPARSE e iterate_ann() calcula W x con nsdsp_math_api.producto_disperso, de modo que el coste
+ * es proporcional a los pesos almacenados. Los pesos densos no se modifican: la capa puede
+ * volver a podarse con otro umbral o bloque. Los bloques 1 × 4 rinden más con poda
+ * estructurada o densidades medias; los bloques de 1 con poda no estructurada muy dispersa.
+ * El entrenamiento (train_step_ann) sigue exigiendo capas DENSE.
+ *
+ * \param layer Capa DENSE o SPARSE a podar
+ * \param umbral Umbral de poda (0 conserva todos los pesos no nulos)
+ * \param bloque Anchura de los bloques (1..NSDSP_MATH_DISPERSA_BLOQUE_MAX)
+ * \param pdispersa Matriz dispersa con inicio_fila, columna, valores y capacidad del llamante
+ * \return ANN_OK (0) si éxito, ANN_KO (-1) si error (la capa no cambia)
+ *
  * \section arquitectura_ann Arquitectura de la Red
  *
  * \dot
@@ -193,6 +382,16 @@
  * | 15/09/2025 | Dr. Carlos Romero | 1 | Implementación inicial con get_ann |
  * | 15/09/2025 | Dr. Carlos Romero | 2 | Añadidas funciones iterate_ann y trigger_ann |
  * | 16/09/2025 | Dr. Carlos Romero | 3 | Implementación completa de funciones trigger |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Añadida inferencia cuantizada int8 (get_ann_q8, iterate_ann_q8) |
+ * | 16/10/2026 | Dr. Carlos Romero | 5 | Añadido formato binario de modelo sin copia (build_model, load_model) |
+ * | 16/10/2026 | Dr. Carlos Romero | 6 | Añadido entrenamiento en línea (SGD, MOMENTUM, ADAM) |
+ * | 16/10/2026 | Dr. Carlos Romero | 7 | Añadidas capas CONV1D, MAXPOOL1D y AVGPOOL1D y convolución en streaming |
+ * | 16/10/2026 | Dr. Carlos Romero | 8 | Añadidas capas recurrentes GRU y LSTM con estado persistente y modo multi-stream |
+ * | 16/10/2026 | Dr. Carlos Romero | 9 | La retropropagación usa vistas traspuestas de nsdsp_math en lugar del buffer de trasposición |
+ * | 16/10/2026 | Dr. Carlos Romero | 10 | Añadidas capas SPARSE con pesos podados en CSR (sparse_layer) |
+ * | 16/10/2026 | Dr. Carlos Romero | 11 | Las capas DENSE se preparan al construir el servicio y iterate_ann no repite su validación |
+ * | 16/10/2026 | Dr. Carlos Romero | 12 | Producto escalar int8 con núcleos AVX2 y SSE2 (pmaddwd) y bucle escalar de respaldo |
+ * | 16/10/2026 | Dr. Carlos Romero | 13 | Taps de la convolución directa por grupos de ANN_CARRILES salidas, vectorizados con -O2 |
  *
  * \copyright ZGR R&D AIE
  */
@@ -202,12 +401,48 @@
 #include <stddef.h>
 #include <string.h>
 #include <math.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /* Declaración de funciones */
 void Init_ANN(void);
 ANN_SERVICE get_ann(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias);
 int iterate_ann(ANN_SERVICE *service);
 int trigger_ann(MATRIZ *input, MATRIZ *output, ANN_TRIGGER trigger);
+ANN_Q8_SERVICE get_ann_q8(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias,
+                          signed char *pesos_q, float *escalas);
+int iterate_ann_q8(ANN_Q8_SERVICE *service);
+unsigned int build_model_ann(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias,
+                            void *buffer, unsigned int tamano);
+int load_model_ann(const void *modelo, unsigned int tamano, ANN_MODEL *pmodel);
+unsigned int train_workspace_ann(ANN_SERVICE *service, unsigned int batch, ANN_OPTIMIZER optimizador);
+int get_trainer_ann(ANN_SERVICE *service, ANN_OPTIMIZER optimizador, float tasa, unsigned int batch,
+                    float *workspace, unsigned int tamano, ANN_TRAINER *ptrainer);
+int train_step_ann(ANN_TRAINER *ptrainer, const float *x, const float *d, unsigned int n, float *perdida);
+static int red_valida_ann(ANN_SERVICE *service);
+ANN_SERVICE get_ann_layers(unsigned int levels, ANN_TRIGGER trigger, LAYER *layers);
+int get_conv_stream_ann(LAYER *layer, ANN_TRIGGER trigger, float *pz, CONV1D_STREAM *pstream);
+int conv_stream_ann(const float *xin, float *yout, CONV1D_STREAM *pstream);
+int get_rnn_ann(LAYER *layer, ANN_LAYER_TYPE tipo, MATRIZ *pesos_x, MATRIZ *pesos_h, MATRIZ *bias,
+                unsigned int streams, float *workspace, RNN_CONFIG *prnn);
+int rnn_step_ann(LAYER *layer, MATRIZ *x, MATRIZ *y);
+int rnn_reset_ann(LAYER *layer);
+int sparse_layer_ann(LAYER *layer, float umbral, unsigned int bloque, MATRIZ_DISPERSA *pdispersa);
+static int dimensiones_capa_ann(LAYER *layer, unsigned int *n_entrada, unsigned int *n_salida);
+static void prepara_capas_ann(ANN_SERVICE *service);
+static int rnn_valida_ann(LAYER *layer);
+static void conv1d_directa_ann(LAYER *layer, const float *x, float *y);
+static void tap_conv1d_ann(float *restrict py, const float *restrict px, float w, unsigned int n);
+static void pooling1d_ann(LAYER *layer, const float *x, float *y);
+static void trasponer_ann(const float *origen, unsigned int filas, unsigned int columnas, float *destino);
+static float derivada_trigger_ann(float activacion, ANN_TRIGGER trigger);
+static void actualizar_parametros_ann(ANN_TRAINER *ptrainer, float *parametros, float *gradiente,
+                                      float *m, float *v, unsigned int n);
+static signed char cuantizar_q8(float valor, float inv_escala);
+static int producto_q8(const signed char *pa, const signed char *pb, unsigned int n);
 
 /* Definición de variables globales */
 ANN_API ann_api;
@@ -217,8 +452,9 @@ static LAYER layer_buffer[LMAX];
 
 /* Buffers estáticos para cálculos intermedios */
 #define MAX_NEURONS 100  /* Máximo número de neuronas por capa */
-static float temp_buffer1[MAX_NEURONS];
-static float temp_buffer2[MAX_NEURONS];
+static float temp_buffer1[MAX_ANN_BUFFER];
+static float temp_buffer2[MAX_ANN_BUFFER];
+static signed char temp_buffer_q8[MAX_NEURONS];
 
 /* Definición de funciones */
 
@@ -228,6 +464,20 @@ void Init_ANN(void)
     ann_api.get_ann = get_ann;
     ann_api.iterate = iterate_ann;
     ann_api.trigger = trigger_ann;
+    ann_api.get_ann_q8 = get_ann_q8;
+    ann_api.iterate_q8 = iterate_ann_q8;
+    ann_api.build_model = build_model_ann;
+    ann_api.load_model = load_model_ann;
+    ann_api.train_workspace = train_workspace_ann;
+    ann_api.get_trainer = get_trainer_ann;
+    ann_api.train_step = train_step_ann;
+    ann_api.get_ann_layers = get_ann_layers;
+    ann_api.get_conv_stream = get_conv_stream_ann;
+    ann_api.conv_stream = conv_stream_ann;
+    ann_api.get_rnn = get_rnn_ann;
+    ann_api.rnn_step = rnn_step_ann;
+    ann_api.rnn_reset = rnn_reset_ann;
+    ann_api.sparse_layer = sparse_layer_ann;
 }
 
 ANN_SERVICE get_ann(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias)
@@ -282,6 +532,10 @@ ANN_SERVICE get_ann(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MAT
         /* Usar el buffer estático de layers */
         layer_buffer[i].pesos = &pesos[i];
         layer_buffer[i].bias = &bias[i];
+        layer_buffer[i].tipo = DENSE;
+        layer_buffer[i].conv = NULL;
+        layer_buffer[i].rnn = NULL;
+        layer_buffer[i].dispersa = NULL;
         service.net.layers[i] = &layer_buffer[i];
     }
 
@@ -305,6 +559,8 @@ ANN_SERVICE get_ann(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MAT
         service.y0.pmatriz = NULL; /* Se asignará externamente */
     }
 
+    prepara_capas_ann(&service);
+
     return service;
 }
 
@@ -312,7 +568,10 @@ int iterate_ann(ANN_SERVICE *service)
 {
     unsigned int j;
     unsigned int current_level;
+    unsigned int n_entrada, n_salida;
     MATRIZ input, output, temp;
+    LAYER *layer;
+    MATRIZ_OPERACION *operacion;
     float *current_input, *current_output, *swap_ptr;
     int result;
     unsigned int num_elements;
@@ -339,7 +598,7 @@ int iterate_ann(ANN_SERVICE *service)
 
     /* Copiar entrada inicial x0 al buffer de trabajo */
     num_elements = service->x0.filas;
-    if (num_elements > MAX_NEURONS)
+    if (num_elements > MAX_ANN_BUFFER)
     {
         return ANN_KO;
     }
@@ -357,45 +616,113 @@ int iterate_ann(ANN_SERVICE *service)
     /* Procesar cada capa de la red */
     for (current_level = 0; current_level < service->net.levels; current_level++)
     {
-        /* Verificar que la capa existe */
-        if (service->net.layers[current_level] == NULL)
+        /* Verificar que la capa existe y es coherente */
+        layer = service->net.layers[current_level];
+        if (layer == NULL)
         {
             return ANN_KO;
         }
 
-        /* Obtener pesos y bias de la capa actual */
-        MATRIZ *pesos = service->net.layers[current_level]->pesos;
-        MATRIZ *bias = service->net.layers[current_level]->bias;
-
-        /* Verificar punteros */
-        if (pesos == NULL || bias == NULL)
+        /* Las capas DENSE preparadas al construir el servicio no repiten la validación: basta con
+         * que la entrada tenga la dimensión preparada */
+        operacion = &service->net.operacion[current_level];
+        if (layer->tipo == DENSE && operacion->filas != 0 && operacion->interna == input.filas)
+        {
+            n_salida = operacion->filas;
+        }
+        else if (dimensiones_capa_ann(layer, &n_entrada, &n_salida) != ANN_OK || n_salida > MAX_ANN_BUFFER)
         {
             return ANN_KO;
         }
+        else
+        {
+            operacion = NULL;
+        }
 
         /* Configurar matriz temporal para el resultado */
-        temp.filas = pesos->filas;
+        temp.filas = n_salida;
         temp.columnas = 1;
         temp.pmatriz = current_output;
 
-        /* Verificar que no excedemos el buffer */
-        if (temp.filas > MAX_NEURONS)
+        switch (layer->tipo)
         {
-            return ANN_KO;
-        }
+            case DENSE:
+                /* Calcular M*x + b */
+                /* Primero: M*x, sin comprobaciones si la capa está preparada */
+                if (operacion != NULL)
+                {
+                    nsdsp_math_api.ejecuta_producto(operacion, layer->pesos->pmatriz, input.pmatriz, temp.pmatriz);
+                    for (j = 0; j < temp.filas; j++)
+                    {
+                        temp.pmatriz[j] += layer->bias->pmatriz[j];
+                    }
+                    break;
+                }
 
-        /* Calcular M*x + b */
-        /* Primero: M*x */
-        result = nsdsp_math_api.product(pesos, &input, &temp);
-        if (result != NSDSP_MATH_OK)
-        {
-            return ANN_KO;
-        }
+                /* Verificar que no excedemos el número de neuronas por capa */
+                if (temp.filas > MAX_NEURONS)
+                {
+                    return ANN_KO;
+                }
 
-        /* Segundo: resultado + b (suma elemento a elemento) */
-        for (j = 0; j < temp.filas; j++)
-        {
-            temp.pmatriz[j] += bias->pmatriz[j];
+                result = nsdsp_math_api.product(layer->pesos, &input, &temp);
+                if (result != NSDSP_MATH_OK)
+                {
+                    return ANN_KO;
+                }
+
+                /* Segundo: resultado + b (suma elemento a elemento) */
+                for (j = 0; j < temp.filas; j++)
+                {
+                    temp.pmatriz[j] += layer->bias->pmatriz[j];
+                }
+                break;
+
+            case SPARSE:
+                /* W*x con los pesos podados en CSR, + b */
+                result = nsdsp_math_api.producto_disperso(layer->dispersa, &input, &temp);
+                if (result != NSDSP_MATH_OK)
+                {
+                    return ANN_KO;
+                }
+
+                for (j = 0; j < temp.filas; j++)
+                {
+                    temp.pmatriz[j] += layer->bias->pmatriz[j];
+                }
+                break;
+
+            case CONV1D:
+                if (input.filas != n_entrada)
+                {
+                    return ANN_KO;
+                }
+
+                /* Convolución directa (incluye el bias) */
+                conv1d_directa_ann(layer, input.pmatriz, temp.pmatriz);
+                break;
+
+            case MAXPOOL1D:
+            case AVGPOOL1D:
+                if (input.filas != n_entrada)
+                {
+                    return ANN_KO;
+                }
+
+                pooling1d_ann(layer, input.pmatriz, temp.pmatriz);
+                break;
+
+            case GRU:
+            case LSTM:
+                /* Un paso temporal; la salida es el nuevo estado oculto */
+                if (rnn_step_ann(layer, &input, &temp) != ANN_OK)
+                {
+                    return ANN_KO;
+                }
+                break;
+
+            default:
+                return ANN_KO;
         }
 
         /* Configurar matriz de salida para la función de activación */
@@ -403,11 +730,14 @@ int iterate_ann(ANN_SERVICE *service)
         output.columnas = 1;
         output.pmatriz = current_output;
 
-        /* Aplicar función de activación T(resultado) */
-        result = trigger_ann(&temp, &output, service->trigger);
-        if (result != ANN_OK)
+        /* Aplicar función de activación T(resultado). Las capas de pooling no la aplican */
+        if (layer->tipo == DENSE || layer->tipo == SPARSE || layer->tipo == CONV1D)
         {
-            return ANN_KO;
+            result = trigger_ann(&temp, &output, service->trigger);
+            if (result != ANN_OK)
+            {
+                return ANN_KO;
+            }
         }
 
         /* Preparar para la siguiente iteración */
@@ -538,3 +868,1539 @@ int trigger_ann(MATRIZ *input, MATRIZ *output, ANN_TRIGGER trigger)
 
     return ANN_OK;
 }
+
+ANN_Q8_SERVICE get_ann_q8(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias,
+                          signed char *pesos_q, float *escalas)
+{
+    ANN_Q8_SERVICE service;
+    unsigned int i, f, c;
+    unsigned int filas, columnas;
+    float *p_fila;
+    float max_abs, valor, escala, inv_escala;
+
+    /* Inicializar estructura a valores por defecto */
+    service.trigger = trigger;
+    service.levels = 0;
+    service.x0.filas = 0;
+    service.x0.columnas = 0;
+    service.x0.pmatriz = NULL;
+    service.y0.filas = 0;
+    service.y0.columnas = 0;
+    service.y0.pmatriz = NULL;
+
+    for (i = 0; i < LMAX; i++)
+    {
+        service.layers[i].filas = 0;
+        service.layers[i].columnas = 0;
+        service.layers[i].pesos_q = NULL;
+        service.layers[i].escala = NULL;
+        service.layers[i].bias = NULL;
+    }
+
+    /* Validar parámetros de entrada */
+    if (levels > LMAX || levels == 0)
+    {
+        return service;
+    }
+
+    if (pesos == NULL || bias == NULL || pesos_q == NULL || escalas == NULL)
+    {
+        return service;
+    }
+
+    /* Cuantizar cada capa */
+    for (i = 0; i < levels; i++)
+    {
+        filas = pesos[i].filas;
+        columnas = pesos[i].columnas;
+
+        /* Verificar matrices y encadenamiento de dimensiones entre capas */
+        if (pesos[i].pmatriz == NULL || bias[i].pmatriz == NULL ||
+            filas == 0 || columnas == 0 || filas > MAX_NEURONS || columnas > MAX_NEURONS ||
+            bias[i].filas != filas ||
+            (i > 0 && columnas != pesos[i-1].filas))
+        {
+            return service;
+        }
+
+        service.layers[i].filas = filas;
+        service.layers[i].columnas = columnas;
+        service.layers[i].pesos_q = pesos_q;
+        service.layers[i].escala = escalas;
+        service.layers[i].bias = bias[i].pmatriz;
+
+        /* Escala simétrica por neurona (fila): escala = max|w| / 127 */
+        for (f = 0; f < filas; f++)
+        {
+            p_fila = &pesos[i].pmatriz[f * columnas];
+
+            max_abs = 0.0f;
+            for (c = 0; c < columnas; c++)
+            {
+                valor = fabsf(p_fila[c]);
+                if (valor > max_abs)
+                {
+                    max_abs = valor;
+                }
+            }
+
+            escala = max_abs / (float)ANN_Q8_MAX;
+            inv_escala = (max_abs > 0.0f) ? (1.0f / escala) : 0.0f;
+            escalas[f] = escala;
+
+            for (c = 0; c < columnas; c++)
+            {
+                pesos_q[f * columnas + c] = cuantizar_q8(p_fila[c], inv_escala);
+            }
+        }
+
+        /* Avanzar en los buffers del llamante */
+        pesos_q += filas * columnas;
+        escalas += filas;
+    }
+
+    service.levels = levels;
+
+    /* Dimensiones de entrada y salida */
+    service.x0.filas = pesos[0].columnas;
+    service.x0.columnas = 1;
+    service.y0.filas = pesos[levels-1].filas;
+    service.y0.columnas = 1;
+
+    return service;
+}
+
+int iterate_ann_q8(ANN_Q8_SERVICE *service)
+{
+    unsigned int j, f;
+    unsigned int current_level;
+    unsigned int filas, columnas;
+    LAYER_Q8 *layer;
+    MATRIZ temp;
+    float *current_input, *current_output, *swap_ptr;
+    float max_abs, valor, escala_x, inv_escala_x;
+    int acumulador;
+
+    /* Validar parámetros */
+    if (service == NULL)
+    {
+        return ANN_KO;
+    }
+
+    if (service->levels == 0 || service->levels > LMAX)
+    {
+        return ANN_KO;
+    }
+
+    if (service->x0.pmatriz == NULL || service->y0.pmatriz == NULL)
+    {
+        return ANN_KO;
+    }
+
+    if (service->x0.filas > MAX_NEURONS)
+    {
+        return ANN_KO;
+    }
+
+    current_input = temp_buffer1;
+    current_output = temp_buffer2;
+
+    for (j = 0; j < service->x0.filas; j++)
+    {
+        current_input[j] = service->x0.pmatriz[j];
+    }
+
+    for (current_level = 0; current_level < service->levels; current_level++)
+    {
+        layer = &service->layers[current_level];
+        filas = layer->filas;
+        columnas = layer->columnas;
+
+        if (layer->pesos_q == NULL || layer->escala == NULL || layer->bias == NULL)
+        {
+            return ANN_KO;
+        }
+
+        /* Cuantización dinámica simétrica de la entrada de la capa */
+        max_abs = 0.0f;
+        for (j = 0; j < columnas; j++)
+        {
+            valor = fabsf(current_input[j]);
+            if (valor > max_abs)
+            {
+                max_abs = valor;
+            }
+        }
+
+        escala_x = max_abs / (float)ANN_Q8_MAX;
+        inv_escala_x = (max_abs > 0.0f) ? (1.0f / escala_x) : 0.0f;
+
+        for (j = 0; j < columnas; j++)
+        {
+            temp_buffer_q8[j] = cuantizar_q8(current_input[j], inv_escala_x);
+        }
+
+        /* y = (Wq * xq) * escala_w * escala_x + b, con acumulación int32 */
+        for (f = 0; f < filas; f++)
+        {
+            acumulador = producto_q8(&layer->pesos_q[f * columnas], temp_buffer_q8, columnas);
+            current_output[f] = (float)acumulador * layer->escala[f] * escala_x + layer->bias[f];
+        }
+
+        /* Aplicar función de activación sobre el propio buffer */
+        temp.filas = filas;
+        temp.columnas = 1;
+        temp.pmatriz = current_output;
+
+        if (trigger_ann(&temp, &temp, service->trigger) != ANN_OK)
+        {
+            return ANN_KO;
+        }
+
+        /* Intercambiar buffers para la siguiente capa */
+        swap_ptr = current_input;
+        current_input = current_output;
+        current_output = swap_ptr;
+    }
+
+    /* Copiar resultado final a y0 */
+    for (j = 0; j < service->y0.filas; j++)
+    {
+        service->y0.pmatriz[j] = current_input[j];
+    }
+
+    return ANN_OK;
+}
+
+/* Redondea un tamaño en bytes al siguiente múltiplo de ANN_MODEL_ALIGN */
+#define ANN_MODEL_ALINEAR(x)  (((x) + ANN_MODEL_ALIGN - 1u) & ~(ANN_MODEL_ALIGN - 1u))
+
+unsigned int build_model_ann(unsigned int levels, ANN_TRIGGER trigger, MATRIZ *pesos, MATRIZ *bias,
+                            void *buffer, unsigned int tamano)
+{
+    ANN_MODEL_HEADER header;
+    ANN_MODEL_LAYER descriptor;
+    unsigned char *pbuffer;
+    unsigned int i;
+    unsigned int offset, requerido;
+    unsigned int bytes_pesos, bytes_bias;
+
+    /* Validar parámetros de entrada */
+    if (levels > LMAX || levels == 0 || pesos == NULL || bias == NULL)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < levels; i++)
+    {
+        if (pesos[i].pmatriz == NULL || bias[i].pmatriz == NULL ||
+            pesos[i].filas == 0 || pesos[i].columnas == 0 ||
+            bias[i].filas != pesos[i].filas ||
+            (i > 0 && pesos[i].columnas != pesos[i-1].filas))
+        {
+            return 0;
+        }
+    }
+
+    /* Calcular el tamaño total: cabecera + descriptores + bloques alineados */
+    requerido = ANN_MODEL_ALINEAR(sizeof(ANN_MODEL_HEADER) + levels * sizeof(ANN_MODEL_LAYER));
+    for (i = 0; i < levels; i++)
+    {
+        requerido += ANN_MODEL_ALINEAR(pesos[i].filas * pesos[i].columnas * sizeof(float));
+        requerido += ANN_MODEL_ALINEAR(pesos[i].filas * sizeof(float));
+    }
+
+    /* Con buffer NULL solo se informa del tamaño necesario */
+    if (buffer == NULL)
+    {
+        return requerido;
+    }
+
+    if (tamano < requerido)
+    {
+        return 0;
+    }
+
+    pbuffer = (unsigned char *)buffer;
+    memset(pbuffer, 0, requerido);
+
+    /* Cabecera */
+    header.magic = ANN_MODEL_MAGIC;
+    header.version = ANN_MODEL_VERSION;
+    header.levels = levels;
+    header.trigger = (unsigned int)trigger;
+    header.tamano = requerido;
+    header.reservado[0] = 0;
+    header.reservado[1] = 0;
+    header.reservado[2] = 0;
+    memcpy(pbuffer, &header, sizeof(ANN_MODEL_HEADER));
+
+    /* Descriptores de capa y bloques de datos */
+    offset = ANN_MODEL_ALINEAR(sizeof(ANN_MODEL_HEADER) + levels * sizeof(ANN_MODEL_LAYER));
+    for (i = 0; i < levels; i++)
+    {
+        bytes_pesos = pesos[i].filas * pesos[i].columnas * sizeof(float);
+        bytes_bias = pesos[i].filas * sizeof(float);
+
+        descriptor.filas = pesos[i].filas;
+        descriptor.columnas = pesos[i].columnas;
+        descriptor.offset_pesos = offset;
+        descriptor.offset_bias = offset + ANN_MODEL_ALINEAR(bytes_pesos);
+        memcpy(pbuffer + sizeof(ANN_MODEL_HEADER) + i * sizeof(ANN_MODEL_LAYER), &descriptor, sizeof(ANN_MODEL_LAYER));
+
+        memcpy(pbuffer + descriptor.offset_pesos, pesos[i].pmatriz, bytes_pesos);
+        memcpy(pbuffer + descriptor.offset_bias, bias[i].pmatriz, bytes_bias);
+
+        offset = descriptor.offset_bias + ANN_MODEL_ALINEAR(bytes_bias);
+    }
+
+    return requerido;
+}
+
+int load_model_ann(const void *modelo, unsigned int tamano, ANN_MODEL *pmodel)
+{
+    ANN_MODEL_HEADER header;
+    ANN_MODEL_LAYER descriptor;
+    const unsigned char *pmodelo;
+    unsigned int i;
+    unsigned int inicio_datos;
+
+    /* Validar parámetros de entrada */
+    if (modelo == NULL || pmodel == NULL || tamano < sizeof(ANN_MODEL_HEADER))
+    {
+        return ANN_KO;
+    }
+
+    /* Los bloques se referencian como float: la base debe estar alineada */
+    if (((size_t)modelo % sizeof(float)) != 0)
+    {
+        return ANN_KO;
+    }
+
+    pmodelo = (const unsigned char *)modelo;
+    memcpy(&header, pmodelo, sizeof(ANN_MODEL_HEADER));
+
+    /* Validar cabecera */
+    if (header.magic != ANN_MODEL_MAGIC || header.version != ANN_MODEL_VERSION ||
+        header.levels == 0 || header.levels > LMAX ||
+        header.trigger > (unsigned int)STEP || header.tamano > tamano)
+    {
+        return ANN_KO;
+    }
+
+    inicio_datos = sizeof(ANN_MODEL_HEADER) + header.levels * sizeof(ANN_MODEL_LAYER);
+    if (inicio_datos > header.tamano)
+    {
+        return ANN_KO;
+    }
+
+    /* Validar descriptores y enlazar las vistas MATRIZ sobre el propio modelo */
+    for (i = 0; i < header.levels; i++)
+    {
+        memcpy(&descriptor, pmodelo + sizeof(ANN_MODEL_HEADER) + i * sizeof(ANN_MODEL_LAYER), sizeof(ANN_MODEL_LAYER));
+
+        if (descriptor.filas == 0 || descriptor.columnas == 0 ||
+            (i > 0 && descriptor.columnas != pmodel->pesos[i-1].filas))
+        {
+            return ANN_KO;
+        }
+
+        if ((descriptor.offset_pesos % ANN_MODEL_ALIGN) != 0 || (descriptor.offset_bias % ANN_MODEL_ALIGN) != 0 ||
+            descriptor.offset_pesos < inicio_datos || descriptor.offset_bias < inicio_datos)
+        {
+            return ANN_KO;
+        }
+
+        /* Comprobar límites sin desbordar la aritmética de 32 bits */
+        if (descriptor.offset_pesos > header.tamano || descriptor.offset_bias > header.tamano ||
+            descriptor.columnas > (header.tamano - descriptor.offset_pesos) / sizeof(float) / descriptor.filas ||
+            descriptor.filas > (header.tamano - descriptor.offset_bias) / sizeof(float))
+        {
+            return ANN_KO;
+        }
+
+        pmodel->pesos[i].filas = descriptor.filas;
+        pmodel->pesos[i].columnas = descriptor.columnas;
+        pmodel->pesos[i].pmatriz = (float *)(pmodelo + descriptor.offset_pesos);
+
+        pmodel->bias[i].filas = descriptor.filas;
+        pmodel->bias[i].columnas = 1;
+        pmodel->bias[i].pmatriz = (float *)(pmodelo + descriptor.offset_bias);
+
+        pmodel->layers[i].pesos = &pmodel->pesos[i];
+        pmodel->layers[i].bias = &pmodel->bias[i];
+        pmodel->layers[i].tipo = DENSE;
+        pmodel->layers[i].conv = NULL;
+        pmodel->layers[i].rnn = NULL;
+        pmodel->layers[i].dispersa = NULL;
+    }
+
+    /* Configurar el servicio con las capas propias del modelo */
+    pmodel->service.trigger = (ANN_TRIGGER)header.trigger;
+    pmodel->service.net.levels = header.levels;
+    for (i = 0; i < LMAX; i++)
+    {
+        pmodel->service.net.layers[i] = (i < header.levels) ? &pmodel->layers[i] : NULL;
+    }
+
+    pmodel->service.x0.filas = pmodel->pesos[0].columnas;
+    pmodel->service.x0.columnas = 1;
+    pmodel->service.x0.pmatriz = NULL;
+    pmodel->service.y0.filas = pmodel->pesos[header.levels-1].filas;
+    pmodel->service.y0.columnas = 1;
+    pmodel->service.y0.pmatriz = NULL;
+
+    prepara_capas_ann(&pmodel->service);
+
+    return ANN_OK;
+}
+
+unsigned int train_workspace_ann(ANN_SERVICE *service, unsigned int batch, ANN_OPTIMIZER optimizador)
+{
+    unsigned int l, entradas, salidas;
+    unsigned int total, parametros;
+
+    if (red_valida_ann(service) != ANN_OK || batch == 0)
+    {
+        return 0;
+    }
+
+    /* Caché de la entrada de la red */
+    total = service->net.layers[0]->pesos->columnas * batch;
+
+    for (l = 0; l < service->net.levels; l++)
+    {
+        entradas = service->net.layers[l]->pesos->columnas;
+        salidas = service->net.layers[l]->pesos->filas;
+        parametros = salidas * entradas + salidas;
+
+        /* Activaciones y deltas (neuronas x batch) y gradientes */
+        total += 2 * salidas * batch + parametros;
+
+        /* Estado del optimizador */
+        if (optimizador == MOMENTUM || optimizador == ADAM)
+        {
+            total += parametros;
+        }
+        if (optimizador == ADAM)
+        {
+            total += parametros;
+        }
+    }
+
+    return total;
+}
+
+int get_trainer_ann(ANN_SERVICE *service, ANN_OPTIMIZER optimizador, float tasa, unsigned int batch,
+                    float *workspace, unsigned int tamano, ANN_TRAINER *ptrainer)
+{
+    unsigned int l, i, entradas, salidas;
+    unsigned int requerido;
+    float *pw;
+
+    if (ptrainer == NULL || workspace == NULL)
+    {
+        return ANN_KO;
+    }
+
+    if (optimizador != SGD && optimizador != MOMENTUM && optimizador != ADAM)
+    {
+        return ANN_KO;
+    }
+
+    requerido = train_workspace_ann(service, batch, optimizador);
+    if (requerido == 0 || tamano < requerido)
+    {
+        return ANN_KO;
+    }
+
+    ptrainer->service = service;
+    ptrainer->optimizador = optimizador;
+    ptrainer->tasa = tasa;
+    ptrainer->beta1 = 0.9f;
+    ptrainer->beta2 = 0.999f;
+    ptrainer->epsilon = 1e-8f;
+    ptrainer->beta1_t = 1.0f;
+    ptrainer->beta2_t = 1.0f;
+    ptrainer->batch = batch;
+
+    for (l = 0; l < LMAX; l++)
+    {
+        ptrainer->activaciones[l+1] = NULL;
+        ptrainer->deltas[l] = NULL;
+        ptrainer->grad_pesos[l] = NULL;
+        ptrainer->grad_bias[l] = NULL;
+        ptrainer->m_pesos[l] = NULL;
+        ptrainer->m_bias[l] = NULL;
+        ptrainer->v_pesos[l] = NULL;
+        ptrainer->v_bias[l] = NULL;
+    }
+
+    /* Repartir el workspace del llamante */
+    pw = workspace;
+    ptrainer->activaciones[0] = pw;
+    pw += service->net.layers[0]->pesos->columnas * batch;
+
+    for (l = 0; l < service->net.levels; l++)
+    {
+        entradas = service->net.layers[l]->pesos->columnas;
+        salidas = service->net.layers[l]->pesos->filas;
+
+        ptrainer->activaciones[l+1] = pw;   pw += salidas * batch;
+        ptrainer->deltas[l] = pw;           pw += salidas * batch;
+        ptrainer->grad_pesos[l] = pw;       pw += salidas * entradas;
+        ptrainer->grad_bias[l] = pw;        pw += salidas;
+
+        if (optimizador == MOMENTUM || optimizador == ADAM)
+        {
+            ptrainer->m_pesos[l] = pw;      pw += salidas * entradas;
+            ptrainer->m_bias[l] = pw;       pw += salidas;
+        }
+        if (optimizador == ADAM)
+        {
+            ptrainer->v_pesos[l] = pw;      pw += salidas * entradas;
+            ptrainer->v_bias[l] = pw;       pw += salidas;
+        }
+    }
+
+    /* Limpiar todo el workspace (incluye el estado del optimizador) */
+    for (i = 0; i < requerido; i++)
+    {
+        workspace[i] = 0.0f;
+    }
+
+    return ANN_OK;
+}
+
+int train_step_ann(ANN_TRAINER *ptrainer, const float *x, const float *d, unsigned int n, float *perdida)
+{
+    ANN_SERVICE *service;
+    MATRIZ *pesos, *bias;
+    MATRIZ entrada, salida, operando;
+    MATRIZ_VISTA delta, traspuesta, gradiente;
+    unsigned int l, f, k, entradas, salidas, levels;
+    float *pa, *pdelta;
+    float error, acumulado, inv_n;
+
+    /* Validar parámetros */
+    if (ptrainer == NULL || x == NULL || d == NULL)
+    {
+        return ANN_KO;
+    }
+
+    service = ptrainer->service;
+    if (red_valida_ann(service) != ANN_OK || n == 0 || n > ptrainer->batch)
+    {
+        return ANN_KO;
+    }
+
+    levels = service->net.levels;
+    inv_n = 1.0f / (float)n;
+
+    /* Entrada del mini-lote: x (n x entradas, una muestra por fila) -> caché (entradas x n) */
+    entradas = service->net.layers[0]->pesos->columnas;
+    trasponer_ann(x, n, entradas, ptrainer->activaciones[0]);
+
+    /* Forward pass guardando las activaciones de cada capa: A(l+1) = T(W(l) * A(l) + b(l)) */
+    for (l = 0; l < levels; l++)
+    {
+        pesos = service->net.layers[l]->pesos;
+        bias = service->net.layers[l]->bias;
+
+        entrada.filas = pesos->columnas;
+        entrada.columnas = n;
+        entrada.pmatriz = ptrainer->activaciones[l];
+
+        salida.filas = pesos->filas;
+        salida.columnas = n;
+        salida.pmatriz = ptrainer->activaciones[l+1];
+
+        if (nsdsp_math_api.product(pesos, &entrada, &salida) != NSDSP_MATH_OK)
+        {
+            return ANN_KO;
+        }
+
+        for (f = 0; f < salida.filas; f++)
+        {
+            pa = &salida.pmatriz[f * n];
+            for (k = 0; k < n; k++)
+            {
+                pa[k] += bias->pmatriz[f];
+            }
+        }
+
+        /* La función de activación se aplica sobre el bloque completo como vector */
+        operando.filas = salida.filas * n;
+        operando.columnas = 1;
+        operando.pmatriz = salida.pmatriz;
+        if (trigger_ann(&operando, &operando, service->trigger) != ANN_OK)
+        {
+            return ANN_KO;
+        }
+    }
+
+    /* Pérdida cuadrática media y delta de la capa de salida */
+    salidas = service->net.layers[levels-1]->pesos->filas;
+    pa = ptrainer->activaciones[levels];
+    pdelta = ptrainer->deltas[levels-1];
+    acumulado = 0.0f;
+
+    for (f = 0; f < salidas; f++)
+    {
+        for (k = 0; k < n; k++)
+        {
+            error = pa[f * n + k] - d[k * salidas + f];
+            acumulado += 0.5f * error * error;
+            pdelta[f * n + k] = error * inv_n * derivada_trigger_ann(pa[f * n + k], service->trigger);
+        }
+    }
+
+    if (perdida != NULL)
+    {
+        *perdida = acumulado * inv_n;
+    }
+
+    /* Retropropagación: se calculan todos los gradientes antes de modificar ningún peso */
+    for (l = levels; l-- > 0; )
+    {
+        pesos = service->net.layers[l]->pesos;
+        entradas = pesos->columnas;
+        salidas = pesos->filas;
+        pdelta = ptrainer->deltas[l];
+
+        /* dW(l) = delta(l) * A(l)^T, con A(l)^T como vista traspuesta de la caché (entradas x n) */
+        entrada.filas = salidas;
+        entrada.columnas = n;
+        entrada.pmatriz = pdelta;
+
+        operando.filas = entradas;
+        operando.columnas = n;
+        operando.pmatriz = ptrainer->activaciones[l];
+
+        salida.filas = salidas;
+        salida.columnas = entradas;
+        salida.pmatriz = ptrainer->grad_pesos[l];
+
+        if (nsdsp_math_api.vista(&entrada, 0, 0, salidas, n, 0, &delta) != NSDSP_MATH_OK ||
+            nsdsp_math_api.vista(&operando, 0, 0, entradas, n, 1, &traspuesta) != NSDSP_MATH_OK ||
+            nsdsp_math_api.vista(&salida, 0, 0, salidas, entradas, 0, &gradiente) != NSDSP_MATH_OK ||
+            nsdsp_math_api.producto_vista(1.0f, &delta, &traspuesta, 0.0f, &gradiente) != NSDSP_MATH_OK)
+        {
+            return ANN_KO;
+        }
+
+        /* db(l) = suma de delta(l) sobre el mini-lote */
+        for (f = 0; f < salidas; f++)
+        {
+            acumulado = 0.0f;
+            for (k = 0; k < n; k++)
+            {
+                acumulado += pdelta[f * n + k];
+            }
+            ptrainer->grad_bias[l][f] = acumulado;
+        }
+
+        /* delta(l-1) = (W(l)^T * delta(l)) .* T'(A(l)) */
+        if (l > 0)
+        {
+            salida.filas = entradas;
+            salida.columnas = n;
+            salida.pmatriz = ptrainer->deltas[l-1];
+
+            if (nsdsp_math_api.vista(pesos, 0, 0, salidas, entradas, 1, &traspuesta) != NSDSP_MATH_OK ||
+                nsdsp_math_api.vista(&salida, 0, 0, entradas, n, 0, &gradiente) != NSDSP_MATH_OK ||
+                nsdsp_math_api.producto_vista(1.0f, &traspuesta, &delta, 0.0f, &gradiente) != NSDSP_MATH_OK)
+            {
+                return ANN_KO;
+            }
+
+            pa = ptrainer->activaciones[l];
+            for (k = 0; k < entradas * n; k++)
+            {
+                salida.pmatriz[k] *= derivada_trigger_ann(pa[k], service->trigger);
+            }
+        }
+    }
+
+    /* Actualización de parámetros */
+    if (ptrainer->optimizador == ADAM)
+    {
+        ptrainer->beta1_t *= ptrainer->beta1;
+        ptrainer->beta2_t *= ptrainer->beta2;
+    }
+
+    for (l = 0; l < levels; l++)
+    {
+        pesos = service->net.layers[l]->pesos;
+        bias = service->net.layers[l]->bias;
+
+        actualizar_parametros_ann(ptrainer, pesos->pmatriz, ptrainer->grad_pesos[l],
+                                  ptrainer->m_pesos[l], ptrainer->v_pesos[l], pesos->filas * pesos->columnas);
+        actualizar_parametros_ann(ptrainer, bias->pmatriz, ptrainer->grad_bias[l],
+                                  ptrainer->m_bias[l], ptrainer->v_bias[l], pesos->filas);
+    }
+
+    return ANN_OK;
+}
+
+ANN_SERVICE get_ann_layers(unsigned int levels, ANN_TRIGGER trigger, LAYER *layers)
+{
+    ANN_SERVICE service;
+    unsigned int i;
+    unsigned int n_entrada, n_salida, n_anterior;
+
+    /* Inicializar estructura a valores por defecto */
+    service.trigger = trigger;
+    service.net.levels = 0;
+    service.x0.filas = 0;
+    service.x0.columnas = 0;
+    service.x0.pmatriz = NULL;
+    service.y0.filas = 0;
+    service.y0.columnas = 0;
+    service.y0.pmatriz = NULL;
+
+    for (i = 0; i < LMAX; i++)
+    {
+        service.net.layers[i] = NULL;
+    }
+
+    if (levels > LMAX || levels == 0 || layers == NULL)
+    {
+        return service;
+    }
+
+    /* Verificar cada capa y el encadenamiento de dimensiones */
+    n_anterior = 0;
+    for (i = 0; i < levels; i++)
+    {
+        if (dimensiones_capa_ann(&layers[i], &n_entrada, &n_salida) != ANN_OK ||
+            n_salida > MAX_ANN_BUFFER || n_entrada > MAX_ANN_BUFFER ||
+            (i > 0 && n_entrada != n_anterior))
+        {
+            for (i = 0; i < LMAX; i++)
+            {
+                service.net.layers[i] = NULL;
+            }
+            return service;
+        }
+
+        if (i == 0)
+        {
+            service.x0.filas = n_entrada;
+            service.x0.columnas = 1;
+        }
+
+        service.net.layers[i] = &layers[i];
+        n_anterior = n_salida;
+    }
+
+    service.net.levels = levels;
+    service.y0.filas = n_anterior;
+    service.y0.columnas = 1;
+
+    prepara_capas_ann(&service);
+
+    return service;
+}
+
+int get_conv_stream_ann(LAYER *layer, ANN_TRIGGER trigger, float *pz, CONV1D_STREAM *pstream)
+{
+    unsigned int ci, span;
+    unsigned int n_entrada, n_salida;
+
+    if (layer == NULL || pz == NULL || pstream == NULL || layer->tipo != CONV1D)
+    {
+        return ANN_KO;
+    }
+
+    if (dimensiones_capa_ann(layer, &n_entrada, &n_salida) != ANN_OK)
+    {
+        return ANN_KO;
+    }
+
+    span = (layer->conv->kernel - 1) * layer->conv->dilatacion + 1;
+    if (layer->conv->canales_entrada > MAX_ANN_CANALES || span > MAX_FIR_LENGTH)
+    {
+        return ANN_KO;
+    }
+
+    /* Inicializar FIR Filter API */
+    Init_Fir();
+
+    /* Una línea de retardo FIR de 'span' muestras por canal de entrada. Los coeficientes
+     * (con dilatación) se leen directamente de la capa */
+    for (ci = 0; ci < layer->conv->canales_entrada; ci++)
+    {
+        pstream->lineas[ci] = fir_api.get_fir(span, NULL, &pz[ci * span]);
+    }
+
+    pstream->layer = layer;
+    pstream->trigger = trigger;
+    pstream->muestras = 0;
+    pstream->fase = 0;
+
+    return ANN_OK;
+}
+
+int conv_stream_ann(const float *xin, float *yout, CONV1D_STREAM *pstream)
+{
+    LAYER *layer;
+    CONV1D_CONFIG *conv;
+    FIR_FILTER_OBJECT *linea;
+    MATRIZ salida;
+    unsigned int co, ci, k, span, kernel, dilatacion, canales_entrada;
+    int idx_nuevo, idx;
+    float acumulador;
+    const float *pw;
+
+    if (xin == NULL || yout == NULL || pstream == NULL || pstream->layer == NULL)
+    {
+        return ANN_KO;
+    }
+
+    layer = pstream->layer;
+    conv = layer->conv;
+    kernel = conv->kernel;
+    dilatacion = conv->dilatacion;
+    canales_entrada = conv->canales_entrada;
+    span = (kernel - 1) * dilatacion + 1;
+
+    /* Escribir la nueva muestra de cada canal en su buffer circular */
+    for (ci = 0; ci < canales_entrada; ci++)
+    {
+        linea = &pstream->lineas[ci];
+        *(linea->p_write++) = xin[ci];
+        if (linea->p_write == linea->pz + linea->ncoef)
+        {
+            linea->p_write = linea->pz;
+        }
+    }
+
+    /* Esperar a tener una ventana completa */
+    if (pstream->muestras < span)
+    {
+        pstream->muestras++;
+        if (pstream->muestras < span)
+        {
+            return 0;
+        }
+    }
+
+    /* Decimación por stride */
+    if (pstream->fase != 0)
+    {
+        pstream->fase--;
+        return 0;
+    }
+    pstream->fase = conv->stride - 1;
+
+    /* y[co] = b[co] + sum_ci sum_k w[co][ci][k] * x[ci][n - (K-1-k)*d] */
+    for (co = 0; co < conv->canales_salida; co++)
+    {
+        acumulador = layer->bias->pmatriz[co];
+        for (ci = 0; ci < canales_entrada; ci++)
+        {
+            linea = &pstream->lineas[ci];
+            pw = &layer->pesos->pmatriz[(co * canales_entrada + ci) * kernel];
+
+            /* Índice de la muestra más reciente x[n] */
+            idx_nuevo = (int)(linea->p_write - linea->pz) - 1;
+            if (idx_nuevo < 0)
+            {
+                idx_nuevo += (int)span;
+            }
+
+            idx = idx_nuevo;
+            for (k = kernel; k-- > 0; )
+            {
+                acumulador += pw[k] * linea->pz[idx];
+                idx -= (int)dilatacion;
+                if (idx < 0)
+                {
+                    idx += (int)span;
+                }
+            }
+        }
+        yout[co] = acumulador;
+    }
+
+    salida.filas = conv->canales_salida;
+    salida.columnas = 1;
+    salida.pmatriz = yout;
+    if (trigger_ann(&salida, &salida, pstream->trigger) != ANN_OK)
+    {
+        return ANN_KO;
+    }
+
+    return 1;
+}
+
+int get_rnn_ann(LAYER *layer, ANN_LAYER_TYPE tipo, MATRIZ *pesos_x, MATRIZ *pesos_h, MATRIZ *bias,
+                unsigned int streams, float *workspace, RNN_CONFIG *prnn)
+{
+    unsigned int puertas, ocultas, tamano;
+
+    if (layer == NULL || pesos_x == NULL || pesos_h == NULL || bias == NULL ||
+        workspace == NULL || prnn == NULL || streams == 0 || (tipo != GRU && tipo != LSTM))
+    {
+        return ANN_KO;
+    }
+
+    if (pesos_x->pmatriz == NULL || pesos_h->pmatriz == NULL || bias->pmatriz == NULL)
+    {
+        return ANN_KO;
+    }
+
+    /* Los pesos de las G puertas están apilados por filas */
+    puertas = (tipo == LSTM) ? 4 : 3;
+    ocultas = pesos_h->columnas;
+    if (ocultas == 0 || pesos_x->columnas == 0 ||
+        pesos_h->filas != puertas * ocultas || pesos_x->filas != puertas * ocultas ||
+        bias->filas != puertas * ocultas || ocultas * streams > MAX_ANN_BUFFER)
+    {
+        return ANN_KO;
+    }
+
+    prnn->entradas = pesos_x->columnas;
+    prnn->ocultas = ocultas;
+    prnn->streams = streams;
+    prnn->pesos_h = pesos_h;
+
+    /* Reparto del workspace: h [, c], puertas_x, puertas_h */
+    tamano = ocultas * streams;
+    prnn->estado_h = workspace;
+    if (tipo == LSTM)
+    {
+        prnn->estado_c = workspace + tamano;
+        prnn->puertas_x = workspace + 2 * tamano;
+    }
+    else
+    {
+        prnn->estado_c = NULL;
+        prnn->puertas_x = workspace + tamano;
+    }
+    prnn->puertas_h = prnn->puertas_x + puertas * tamano;
+
+    layer->pesos = pesos_x;
+    layer->bias = bias;
+    layer->tipo = tipo;
+    layer->conv = NULL;
+    layer->rnn = prnn;
+    layer->dispersa = NULL;
+
+    return rnn_reset_ann(layer);
+}
+
+int rnn_step_ann(LAYER *layer, MATRIZ *x, MATRIZ *y)
+{
+    RNN_CONFIG *rnn;
+    MATRIZ puertas_x, puertas_h, estado;
+    unsigned int j, s, H, S;
+    float *gx, *gh, *b, *h, *c;
+    float z, r, n, i, f, g, o;
+
+    if (layer == NULL || x == NULL || x->pmatriz == NULL || rnn_valida_ann(layer) != ANN_OK)
+    {
+        return ANN_KO;
+    }
+
+    rnn = layer->rnn;
+    H = rnn->ocultas;
+    S = rnn->streams;
+
+    if (x->filas != rnn->entradas || x->columnas != S)
+    {
+        return ANN_KO;
+    }
+
+    if (y != NULL && (y->pmatriz == NULL || y->filas != H || y->columnas != S))
+    {
+        return ANN_KO;
+    }
+
+    /* Puertas de todas las neuronas y canales con dos productos: W*X y U*H */
+    puertas_x.filas = layer->pesos->filas;
+    puertas_x.columnas = S;
+    puertas_x.pmatriz = rnn->puertas_x;
+    puertas_h.filas = layer->pesos->filas;
+    puertas_h.columnas = S;
+    puertas_h.pmatriz = rnn->puertas_h;
+    estado.filas = H;
+    estado.columnas = S;
+    estado.pmatriz = rnn->estado_h;
+
+    if (nsdsp_math_api.product(layer->pesos, x, &puertas_x) != NSDSP_MATH_OK ||
+        nsdsp_math_api.product(rnn->pesos_h, &estado, &puertas_h) != NSDSP_MATH_OK)
+    {
+        return ANN_KO;
+    }
+
+    /* Actualización elemento a elemento; el bucle interno recorre los canales */
+    gx = rnn->puertas_x;
+    gh = rnn->puertas_h;
+    b = layer->bias->pmatriz;
+    h = rnn->estado_h;
+    c = rnn->estado_c;
+
+    if (layer->tipo == GRU)
+    {
+        for (j = 0; j < H; j++)
+        {
+            for (s = 0; s < S; s++)
+            {
+                z = 1.0f / (1.0f + expf(-(gx[j * S + s] + gh[j * S + s] + b[j])));
+                r = 1.0f / (1.0f + expf(-(gx[(H + j) * S + s] + gh[(H + j) * S + s] + b[H + j])));
+                n = tanhf(gx[(2 * H + j) * S + s] + b[2 * H + j] + r * gh[(2 * H + j) * S + s]);
+                h[j * S + s] = (1.0f - z) * n + z * h[j * S + s];
+            }
+        }
+    }
+    else
+    {
+        for (j = 0; j < H; j++)
+        {
+            for (s = 0; s < S; s++)
+            {
+                i = 1.0f / (1.0f + expf(-(gx[j * S + s] + gh[j * S + s] + b[j])));
+                f = 1.0f / (1.0f + expf(-(gx[(H + j) * S + s] + gh[(H + j) * S + s] + b[H + j])));
+                g = tanhf(gx[(2 * H + j) * S + s] + gh[(2 * H + j) * S + s] + b[2 * H + j]);
+                o = 1.0f / (1.0f + expf(-(gx[(3 * H + j) * S + s] + gh[(3 * H + j) * S + s] + b[3 * H + j])));
+                c[j * S + s] = f * c[j * S + s] + i * g;
+                h[j * S + s] = o * tanhf(c[j * S + s]);
+            }
+        }
+    }
+
+    if (y != NULL)
+    {
+        for (j = 0; j < H * S; j++)
+        {
+            y->pmatriz[j] = h[j];
+        }
+    }
+
+    return ANN_OK;
+}
+
+int rnn_reset_ann(LAYER *layer)
+{
+    unsigned int j, tamano;
+
+    if (layer == NULL || rnn_valida_ann(layer) != ANN_OK)
+    {
+        return ANN_KO;
+    }
+
+    tamano = layer->rnn->ocultas * layer->rnn->streams;
+    for (j = 0; j < tamano; j++)
+    {
+        layer->rnn->estado_h[j] = 0.0f;
+    }
+
+    if (layer->tipo == LSTM)
+    {
+        for (j = 0; j < tamano; j++)
+        {
+            layer->rnn->estado_c[j] = 0.0f;
+        }
+    }
+
+    return ANN_OK;
+}
+
+int sparse_layer_ann(LAYER *layer, float umbral, unsigned int bloque, MATRIZ_DISPERSA *pdispersa)
+{
+    if (layer == NULL || pdispersa == NULL || (layer->tipo != DENSE && layer->tipo != SPARSE))
+    {
+        return ANN_KO;
+    }
+
+    /* Los pesos densos se conservan: la capa puede volver a podarse con otro umbral */
+    if (layer->pesos == NULL || layer->bias == NULL || layer->pesos->pmatriz == NULL ||
+        layer->bias->pmatriz == NULL || layer->bias->filas != layer->pesos->filas)
+    {
+        return ANN_KO;
+    }
+
+    if (nsdsp_math_api.dispersa(layer->pesos, umbral, bloque, pdispersa) != NSDSP_MATH_OK)
+    {
+        return ANN_KO;
+    }
+
+    layer->tipo = SPARSE;
+    layer->dispersa = pdispersa;
+
+    return ANN_OK;
+}
+
+static int dimensiones_capa_ann(LAYER *layer, unsigned int *n_entrada, unsigned int *n_salida)
+{
+    CONV1D_CONFIG *conv;
+    unsigned int span, longitud_salida;
+
+    switch (layer->tipo)
+    {
+        case DENSE:
+            if (layer->pesos == NULL || layer->bias == NULL ||
+                layer->pesos->pmatriz == NULL || layer->bias->pmatriz == NULL)
+            {
+                return ANN_KO;
+            }
+            *n_entrada = layer->pesos->columnas;
+            *n_salida = layer->pesos->filas;
+            return ANN_OK;
+
+        case SPARSE:
+            if (layer->dispersa == NULL || layer->bias == NULL || layer->bias->pmatriz == NULL ||
+                layer->bias->filas != layer->dispersa->filas)
+            {
+                return ANN_KO;
+            }
+            *n_entrada = layer->dispersa->columnas;
+            *n_salida = layer->dispersa->filas;
+            return ANN_OK;
+
+        case CONV1D:
+        case MAXPOOL1D:
+        case AVGPOOL1D:
+            conv = layer->conv;
+            if (conv == NULL || conv->canales_entrada == 0 || conv->kernel == 0 ||
+                conv->stride == 0 || conv->longitud_entrada == 0)
+            {
+                return ANN_KO;
+            }
+
+            if (layer->tipo == CONV1D)
+            {
+                if (conv->dilatacion == 0 || conv->canales_salida == 0 ||
+                    layer->pesos == NULL || layer->bias == NULL ||
+                    layer->pesos->pmatriz == NULL || layer->bias->pmatriz == NULL ||
+                    layer->pesos->filas != conv->canales_salida ||
+                    layer->pesos->columnas != conv->canales_entrada * conv->kernel ||
+                    layer->bias->filas != conv->canales_salida)
+                {
+                    return ANN_KO;
+                }
+                span = (conv->kernel - 1) * conv->dilatacion + 1;
+            }
+            else
+            {
+                /* El pooling conserva los canales y no usa dilatación */
+                if (conv->canales_salida != conv->canales_entrada)
+                {
+                    return ANN_KO;
+                }
+                span = conv->kernel;
+            }
+
+            if (span > conv->longitud_entrada)
+            {
+                return ANN_KO;
+            }
+
+            longitud_salida = (conv->longitud_entrada - span) / conv->stride + 1;
+            *n_entrada = conv->canales_entrada * conv->longitud_entrada;
+            *n_salida = conv->canales_salida * longitud_salida;
+            return ANN_OK;
+
+        case GRU:
+        case LSTM:
+            /* Dentro de una red solo se admite un canal (S = 1) */
+            if (rnn_valida_ann(layer) != ANN_OK || layer->rnn->streams != 1)
+            {
+                return ANN_KO;
+            }
+            *n_entrada = layer->rnn->entradas;
+            *n_salida = layer->rnn->ocultas;
+            return ANN_OK;
+
+        default:
+            return ANN_KO;
+    }
+}
+
+static void conv1d_directa_ann(LAYER *layer, const float *x, float *y)
+{
+    CONV1D_CONFIG *conv;
+    unsigned int co, ci, k, t;
+    unsigned int longitud_entrada, longitud_salida, kernel, stride, dilatacion, canales_entrada;
+    const float *px;
+    float *py;
+    float w;
+
+    conv = layer->conv;
+    canales_entrada = conv->canales_entrada;
+    longitud_entrada = conv->longitud_entrada;
+    kernel = conv->kernel;
+    stride = conv->stride;
+    dilatacion = conv->dilatacion;
+    longitud_salida = (longitud_entrada - ((kernel - 1) * dilatacion + 1)) / stride + 1;
+
+    /* Convolución directa sin im2col: para cada tap del kernel se acumula w*x sobre toda la
+     * salida del canal. Con stride 1 la entrada del tap es contigua y tap_conv1d_ann la recorre
+     * por grupos de ANN_CARRILES */
+    for (co = 0; co < conv->canales_salida; co++)
+    {
+        py = &y[co * longitud_salida];
+        for (t = 0; t < longitud_salida; t++)
+        {
+            py[t] = layer->bias->pmatriz[co];
+        }
+
+        for (ci = 0; ci < canales_entrada; ci++)
+        {
+            for (k = 0; k < kernel; k++)
+            {
+                w = layer->pesos->pmatriz[(co * canales_entrada + ci) * kernel + k];
+                px = &x[ci * longitud_entrada + k * dilatacion];
+
+                if (stride == 1)
+                {
+                    tap_conv1d_ann(py, px, w, longitud_salida);
+                }
+                else
+                {
+                    for (t = 0; t < longitud_salida; t++)
+                    {
+                        py[t] += w * px[t * stride];
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void tap_conv1d_ann(float *restrict py, const float *restrict px, float w, unsigned int n)
+{
+    unsigned int g, j, t;
+
+    /* py += w px. La entrada (capa anterior) y la salida (buffer temporal) nunca se solapan; con
+     * restrict y un bucle interno de longitud fija el grupo se traduce a operaciones SIMD */
+    for (g = n / ANN_CARRILES; g > 0; g--)
+    {
+        for (j = 0; j < ANN_CARRILES; j++)
+        {
+            py[j] += w * px[j];
+        }
+        py += ANN_CARRILES;
+        px += ANN_CARRILES;
+    }
+    for (t = 0; t < n % ANN_CARRILES; t++)
+    {
+        py[t] += w * px[t];
+    }
+}
+
+static void pooling1d_ann(LAYER *layer, const float *x, float *y)
+{
+    CONV1D_CONFIG *conv;
+    unsigned int c, k, t;
+    unsigned int longitud_entrada, longitud_salida, kernel, stride;
+    const float *px;
+    float valor, inv_kernel;
+
+    conv = layer->conv;
+    longitud_entrada = conv->longitud_entrada;
+    kernel = conv->kernel;
+    stride = conv->stride;
+    longitud_salida = (longitud_entrada - kernel) / stride + 1;
+    inv_kernel = 1.0f / (float)kernel;
+
+    for (c = 0; c < conv->canales_entrada; c++)
+    {
+        for (t = 0; t < longitud_salida; t++)
+        {
+            px = &x[c * longitud_entrada + t * stride];
+            valor = px[0];
+
+            if (layer->tipo == MAXPOOL1D)
+            {
+                for (k = 1; k < kernel; k++)
+                {
+                    if (px[k] > valor)
+                    {
+                        valor = px[k];
+                    }
+                }
+            }
+            else
+            {
+                for (k = 1; k < kernel; k++)
+                {
+                    valor += px[k];
+                }
+                valor *= inv_kernel;
+            }
+
+            y[c * longitud_salida + t] = valor;
+        }
+    }
+}
+
+static void prepara_capas_ann(ANN_SERVICE *service)
+{
+    unsigned int l, n_entrada, n_salida;
+    MATRIZ entrada, salida;
+    LAYER *layer;
+
+    for (l = 0; l < LMAX; l++)
+    {
+        service->net.operacion[l].filas = 0;
+    }
+
+    /* Sin nsdsp_math inicializado todas las capas se validan en cada iteración */
+    if (nsdsp_math_api.prepara_producto == NULL)
+    {
+        return;
+    }
+
+    /* Se preparan las capas DENSE coherentes con la salida de la capa anterior; las dimensiones de
+     * las capas no deben cambiar después de construir el servicio */
+    entrada.filas = service->x0.filas;
+    entrada.columnas = 1;
+    entrada.pmatriz = NULL;
+    salida.columnas = 1;
+    salida.pmatriz = NULL;
+    for (l = 0; l < service->net.levels; l++)
+    {
+        layer = service->net.layers[l];
+        if (layer == NULL || dimensiones_capa_ann(layer, &n_entrada, &n_salida) != ANN_OK)
+        {
+            return;
+        }
+
+        salida.filas = n_salida;
+        if (layer->tipo == DENSE && n_salida <= MAX_NEURONS && n_entrada <= MAX_ANN_BUFFER)
+        {
+            nsdsp_math_api.prepara_producto(layer->pesos, &entrada, &salida, &service->net.operacion[l]);
+        }
+        entrada.filas = n_salida;
+    }
+}
+
+static int rnn_valida_ann(LAYER *layer)
+{
+    RNN_CONFIG *rnn;
+    unsigned int puertas;
+
+    if (layer->tipo != GRU && layer->tipo != LSTM)
+    {
+        return ANN_KO;
+    }
+
+    rnn = layer->rnn;
+    if (rnn == NULL || layer->pesos == NULL || layer->bias == NULL || rnn->pesos_h == NULL ||
+        layer->pesos->pmatriz == NULL || layer->bias->pmatriz == NULL || rnn->pesos_h->pmatriz == NULL ||
+        rnn->estado_h == NULL || rnn->puertas_x == NULL || rnn->puertas_h == NULL ||
+        (layer->tipo == LSTM && rnn->estado_c == NULL) ||
+        rnn->ocultas == 0 || rnn->entradas == 0 || rnn->streams == 0)
+    {
+        return ANN_KO;
+    }
+
+    puertas = (layer->tipo == LSTM) ? 4 : 3;
+    if (layer->pesos->filas != puertas * rnn->ocultas || layer->pesos->columnas != rnn->entradas ||
+        rnn->pesos_h->filas != puertas * rnn->ocultas || rnn->pesos_h->columnas != rnn->ocultas ||
+        layer->bias->filas != puertas * rnn->ocultas)
+    {
+        return ANN_KO;
+    }
+
+    return ANN_OK;
+}
+
+static int red_valida_ann(ANN_SERVICE *service)
+{
+    unsigned int l;
+    MATRIZ *pesos, *bias;
+
+    if (service == NULL || service->net.levels == 0 || service->net.levels > LMAX)
+    {
+        return ANN_KO;
+    }
+
+    for (l = 0; l < service->net.levels; l++)
+    {
+        /* El entrenamiento solo admite capas DENSE */
+        if (service->net.layers[l] == NULL || service->net.layers[l]->tipo != DENSE)
+        {
+            return ANN_KO;
+        }
+
+        pesos = service->net.layers[l]->pesos;
+        bias = service->net.layers[l]->bias;
+
+        if (pesos == NULL || bias == NULL || pesos->pmatriz == NULL || bias->pmatriz == NULL ||
+            pesos->filas == 0 || pesos->columnas == 0 || bias->filas != pesos->filas ||
+            (l > 0 && pesos->columnas != service->net.layers[l-1]->pesos->filas))
+        {
+            return ANN_KO;
+        }
+    }
+
+    return ANN_OK;
+}
+
+static void trasponer_ann(const float *origen, unsigned int filas, unsigned int columnas, float *destino)
+{
+    unsigned int f, c;
+
+    for (f = 0; f < filas; f++)
+    {
+        for (c = 0; c < columnas; c++)
+        {
+            destino[c * filas + f] = origen[f * columnas + c];
+        }
+    }
+}
+
+static float derivada_trigger_ann(float activacion, ANN_TRIGGER trigger)
+{
+    /* Derivada de la función de activación expresada en función de su propia salida */
+    switch (trigger)
+    {
+        case SIGMOID:
+            return activacion * (1.0f - activacion);
+
+        case TANH:
+            return 1.0f - activacion * activacion;
+
+        case RELU:
+            return (activacion > 0.0f) ? 1.0f : 0.0f;
+
+        case LEAK:
+            return (activacion > 0.0f) ? 1.0f : ALPHA;
+
+        case SOFT:
+            /* softplus'(x) = sigmoid(x) = 1 - exp(-softplus(x)) */
+            return 1.0f - expf(-activacion);
+
+        case STEP:
+        default:
+            /* STEP no es derivable: no propaga gradiente */
+            return 0.0f;
+    }
+}
+
+static void actualizar_parametros_ann(ANN_TRAINER *ptrainer, float *parametros, float *gradiente,
+                                      float *m, float *v, unsigned int n)
+{
+    unsigned int i;
+    float tasa, beta1, beta2, correccion1, correccion2, m_hat, v_hat;
+
+    tasa = ptrainer->tasa;
+    beta1 = ptrainer->beta1;
+    beta2 = ptrainer->beta2;
+
+    switch (ptrainer->optimizador)
+    {
+        case SGD:
+            /* w = w - tasa * g */
+            for (i = 0; i < n; i++)
+            {
+                parametros[i] -= tasa * gradiente[i];
+            }
+            break;
+
+        case MOMENTUM:
+            /* m = beta1 * m + g ; w = w - tasa * m */
+            for (i = 0; i < n; i++)
+            {
+                m[i] = beta1 * m[i] + gradiente[i];
+                parametros[i] -= tasa * m[i];
+            }
+            break;
+
+        case ADAM:
+            /* Adam con corrección de sesgo de los momentos */
+            correccion1 = 1.0f / (1.0f - ptrainer->beta1_t);
+            correccion2 = 1.0f / (1.0f - ptrainer->beta2_t);
+            for (i = 0; i < n; i++)
+            {
+                m[i] = beta1 * m[i] + (1.0f - beta1) * gradiente[i];
+                v[i] = beta2 * v[i] + (1.0f - beta2) * gradiente[i] * gradiente[i];
+                m_hat = m[i] * correccion1;
+                v_hat = v[i] * correccion2;
+                parametros[i] -= tasa * m_hat / (sqrtf(v_hat) + ptrainer->epsilon);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static signed char cuantizar_q8(float valor, float inv_escala)
+{
+    float escalado;
+
+    /* Redondeo al entero más próximo con saturación a [-127, 127] */
+    escalado = valor * inv_escala;
+    escalado = (escalado >= 0.0f) ? (escalado + 0.5f) : (escalado - 0.5f);
+
+    if (escalado > (float)ANN_Q8_MAX)
+    {
+        return (signed char)ANN_Q8_MAX;
+    }
+    if (escalado < -(float)ANN_Q8_MAX)
+    {
+        return (signed char)(-ANN_Q8_MAX);
+    }
+
+    return (signed char)escalado;
+}
+
+static int producto_q8(const signed char *pa, const signed char *pb, unsigned int n)
+{
+    unsigned int index;
+    int acumulador;
+#if defined(__AVX2__)
+    __m256i suma;
+    __m128i mitad;
+#elif defined(__SSE2__)
+    __m128i suma, va, vb;
+    const __m128i cero = _mm_setzero_si128();
+#endif
+
+    /* Producto escalar int8 x int8 con acumulación int32. Los operandos se extienden a int16 y
+     * se multiplican por parejas con vpmaddwd/pmaddwd, que suman dos productos en 32 bits. Con
+     * valores en [-127, 127] una pareja no desborda y la suma entera no depende del orden, de
+     * modo que el resultado es el mismo que el del bucle escalar */
+    acumulador = 0;
+    index = 0;
+#if defined(__AVX2__)
+    suma = _mm256_setzero_si256();
+    for (; index + 16 <= n; index += 16)
+    {
+        suma = _mm256_add_epi32(suma, _mm256_madd_epi16(
+                   _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&pa[index])),
+                   _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)&pb[index]))));
+    }
+    mitad = _mm_add_epi32(_mm256_castsi256_si128(suma), _mm256_extracti128_si256(suma, 1));
+    mitad = _mm_add_epi32(mitad, _mm_shuffle_epi32(mitad, 0x4E));
+    mitad = _mm_add_epi32(mitad, _mm_shuffle_epi32(mitad, 0xB1));
+    acumulador = _mm_cvtsi128_si32(mitad);
+#elif defined(__SSE2__)
+    suma = _mm_setzero_si128();
+    for (; index + 16 <= n; index += 16)
+    {
+        /* Extensión de signo int8 -> int16 intercalando cada byte con su máscara de signo */
+        va = _mm_loadu_si128((const __m128i *)&pa[index]);
+        vb = _mm_loadu_si128((const __m128i *)&pb[index]);
+        suma = _mm_add_epi32(suma, _mm_madd_epi16(_mm_unpacklo_epi8(va, _mm_cmpgt_epi8(cero, va)),
+                                                  _mm_unpacklo_epi8(vb, _mm_cmpgt_epi8(cero, vb))));
+        suma = _mm_add_epi32(suma, _mm_madd_epi16(_mm_unpackhi_epi8(va, _mm_cmpgt_epi8(cero, va)),
+                                                  _mm_unpackhi_epi8(vb, _mm_cmpgt_epi8(cero, vb))));
+    }
+    suma = _mm_add_epi32(suma, _mm_shuffle_epi32(suma, 0x4E));
+    suma = _mm_add_epi32(suma, _mm_shuffle_epi32(suma, 0xB1));
+    acumulador = _mm_cvtsi128_si32(suma);
+#endif
+
+    for (; index < n; index++)
+    {
+        acumulador += (int)pa[index] * (int)pb[index];
+    }
+
+    return acumulador;
+}
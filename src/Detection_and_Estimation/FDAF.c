@@ -0,0 +1,453 @@
+/** \page fdaf FDAF - FILTRADO ADAPTATIVO EN FRECUENCIA
+ * \brief Módulo de filtros adaptativos LMS por bloques en el dominio de la frecuencia para la librería NSDSP
+ *
+ * Este módulo implementa el filtro adaptativo en el dominio de la frecuencia con bloques
+ * particionados (PBFDAF) para filtros de miles de coeficientes (cancelación de eco y de ruido
+ * en caminos acústicos largos), donde el LMS en el tiempo del módulo LMS_Filter cuesta O(N)
+ * operaciones por muestra. El filtrado usa el mismo overlap-save particionado que el módulo
+ * FAST_FIR sobre la FFT real, y la adaptación se hace con el gradiente restringido y un paso
+ * normalizado por bin.
+ *
+ * \section teoria_fdaf Teoría
+ *
+ * La respuesta de N coeficientes se divide en K particiones de B coeficientes, representadas
+ * por sus espectros \f$ W_k \f$ de 2B puntos. Al completar el bloque j de B muestras:
+ * \f[
+ * X_j = \mathrm{RFFT}_{2B}\{x[(j-1)B \ldots (j+1)B - 1]\},\qquad
+ * \mathbf{y}_j = \text{últimas } B \text{ de } \mathrm{IRFFT}_{2B}\Big\{\sum_{k=0}^{K-1} W_k X_{j-k}\Big\},\qquad
+ * \mathbf{e}_j = \mathbf{d}_j - \mathbf{y}_j
+ * \f]
+ * El error se transforma completado por delante con B ceros y se normaliza bin a bin con una
+ * estimación suavizada de la potencia de la entrada:
+ * \f[
+ * P_j(f) = \lambda P_{j-1}(f) + (1 - \lambda)|X_j(f)|^2,\qquad
+ * E_j(f) = \frac{\mu}{K P_j(f) + \delta}\,\mathrm{RFFT}_{2B}\{[\mathbf{0}_B, \mathbf{e}_j]\}(f)
+ * \f]
+ * El gradiente de cada partición es la correlación \f$ X^*_{j-k} E_j \f$, cuyas B primeras
+ * muestras en el tiempo son la correlación lineal entre la entrada y el error. La restricción
+ * anula las otras B muestras antes de actualizar los coeficientes:
+ * \f[
+ * W_k \leftarrow W_k + \mathrm{RFFT}_{2B}\Big\{\big[\text{primeras } B \text{ de }
+ * \mathrm{IRFFT}_{2B}\{X^*_{j-k} E_j\},\ \mathbf{0}_B\big]\Big\}
+ * \f]
+ * Sin la restricción, la correlación circular aliasa la parte no causal del gradiente y el
+ * filtro converge a una solución sesgada. Con ella, cada partición sigue siendo un filtro
+ * FIR de B coeficientes y el algoritmo es un LMS por bloques exacto con paso distinto por bin.
+ *
+ * \subsection normalizacion_fdaf Normalización por bin
+ *
+ * Cada bin se adapta con un paso inversamente proporcional a su potencia, lo que equivale
+ * aproximadamente a blanquear la entrada: con entradas coloreadas (voz, ruido de maquinaria)
+ * todos los modos convergen a la misma velocidad, mientras que en el NLMS en el tiempo los
+ * modos de baja energía convergen mucho más despacio. El factor K hace que el rango útil de
+ * \f$ \mu \f$ (0 < μ <= 1) no dependa del número de particiones, y con μ = 1 la convergencia
+ * con entrada blanca es comparable a la del NLMS con paso 0.5.
+ *
+ * \subsection coste_fdaf Coste
+ *
+ * Por bloque de B muestras: una FFT de entrada, una inversa de salida, la FFT del error, K
+ * productos espectrales de filtrado y 2K FFTs de la restricción del gradiente. El coste por
+ * muestra es O(K log B), frente a O(KB) del LMS en el tiempo. La salida y el error se
+ * entregan con una latencia de B muestras.
+ *
+ * \section uso_fdaf Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_FDAF() (llamado automáticamente por Init_NSDSP())
+ * 2. Crear un plan real de 2B puntos con fft_api.get_rplan()
+ * 3. Crear el filtro con fdaf_api.get_fdaf() y un workspace de FDAF_WORKSPACE(N, B) floats
+ * 4. Filtrar y adaptar por bloques con fdaf_bloque() o muestra a muestra con fdaf_filter()
+ *
+ * Ejemplo de uso:
+ * \code
+ * #include "fdaf.h"
+ *
+ * static COMPLEJO twiddle[RFFT_TWIDDLE_SIZE(512)];
+ * static unsigned int bitrev[RFFT_BITREV_SIZE(512)];
+ * static float workspace[FDAF_WORKSPACE(4096, 256)];
+ * static FDAF_OBJECT cancelador;
+ * static RFFT_PLAN plan;
+ *
+ * void inicio(void) {             // Camino de eco de 4096 coeficientes en 16 particiones
+ *     fft_api.get_rplan(512, twiddle, bitrev, &plan);
+ *     fdaf_api.get_fdaf(4096, 256, &plan, 0.5f, 0.9f, 1e-6f, workspace, &cancelador);
+ * }
+ *
+ * void bloque(const float *altavoz, const float *microfono, float *limpia) {
+ *     fdaf_api.fdaf_bloque(altavoz, microfono, NULL, limpia, 256, &cancelador);  // Retraso de 256 muestras
+ * }
+ * \endcode
+ *
+ * \section funciones_fdaf Descripción de funciones
+ *
+ * \subsection init_fdaf_func Init_FDAF
+ * Inicializa la estructura de punteros a funciones fdaf_api.
+ *
+ * \subsection get_fdaf_func get_fdaf
+ * Reparte el workspace y limpia los coeficientes y el estado. Requiere que Init_FFT() se haya
+ * llamado.
+ * \param ncoef Número de coeficientes N (> 0)
+ * \param bloque B: tamaño de bloque y partición (potencia de 2)
+ * \param plan Plan real de 2B puntos
+ * \param mu Paso de adaptación normalizado (0 < μ <= 2, típicamente 0.1..1)
+ * \param olvido \f$ \lambda \f$ de la potencia por bin, en [0, 1)
+ * \param delta Regularización \f$ \delta \f$ (> 0), del orden de la potencia por bin del ruido
+ * \param workspace Buffer de FDAF_WORKSPACE(ncoef, bloque) floats
+ * \param pfdaf Objeto a inicializar
+ * \return FDAF_OK (0) si éxito, FDAF_KO (-1) si error
+ *
+ * \subsection fdaf_filter_func fdaf_filter
+ * Procesa una muestra. Devuelve la salida del filtro retrasada B muestras y deja el error
+ * correspondiente en pfdaf->error.
+ * \param xn Muestra de entrada x[n]
+ * \param dn Muestra deseada d[n]
+ * \param pfdaf Objeto filtro
+ * \return Salida y[n - B], o 0.0 si error
+ *
+ * \subsection fdaf_bloque_func fdaf_bloque
+ * Procesa un bloque de cualquier longitud, con salidas y errores retrasados B muestras. y y e
+ * pueden ser NULL si no se necesitan, y pueden coincidir con x o d para trabajar in-place.
+ * \param x Muestras de entrada
+ * \param d Muestras deseadas
+ * \param y Salidas del filtro (o NULL)
+ * \param e Errores (o NULL)
+ * \param nmuestras Número de muestras
+ * \param pfdaf Objeto filtro
+ * \return FDAF_OK (0) si éxito, FDAF_KO (-1) si error
+ *
+ * \subsection coeficientes_fdaf_func coeficientes_fdaf
+ * Obtiene la respuesta impulsional actual en el tiempo (para diagnóstico o para congelarla en
+ * un filtro FAST_FIR). Usa el buffer de gradiente como trabajo, sin alterar el estado.
+ * \param pfdaf Objeto filtro
+ * \param pcoef Buffer de ncoef floats
+ * \return FDAF_OK (0) si éxito, FDAF_KO (-1) si error
+ *
+ * \dot
+ * digraph fdaf_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[n]", shape=plaintext];
+ *   D [label="d[n]", shape=plaintext];
+ *   FFT [label="RFFT 2B", fillcolor=lightblue];
+ *   FDL [label="Σ W_k · X_{j-k}", fillcolor=lightcyan];
+ *   IFFT [label="IRFFT 2B\n(últimas B)", fillcolor=lightblue];
+ *   E [label="e = d - y", shape=circle, fillcolor=lightyellow];
+ *   EF [label="RFFT [0, e]\n· μ / (K P + δ)", fillcolor=lightblue];
+ *   G [label="X*_{j-k} E\nrestricción:\nIRFFT, anular B,\nRFFT", fillcolor=lightpink];
+ *   Y [label="y[n-B]", shape=plaintext];
+ *
+ *   X -> FFT -> FDL -> IFFT -> E;
+ *   D -> E;
+ *   IFFT -> Y;
+ *   E -> EF -> G;
+ *   FFT -> G [style=dashed];
+ *   G -> FDL [label="W_k +=", style=dashed];
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_fdaf Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: PBFDAF con gradiente restringido y normalización por bin |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "fdaf.h"
+#include <stddef.h>
+
+/* Declaración de funciones */
+void Init_FDAF(void);
+int Get_FDAF(unsigned int ncoef, unsigned int bloque, RFFT_PLAN *plan, float mu, float olvido, float delta,
+             float *workspace, FDAF_OBJECT *pfdaf);
+float FDAF_Filter(float xn, float dn, FDAF_OBJECT *pfdaf);
+int FDAF_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, FDAF_OBJECT *pfdaf);
+int Coeficientes_FDAF(FDAF_OBJECT *pfdaf, float *pcoef);
+static void procesar_fdaf(FDAF_OBJECT *pfdaf);
+
+/* Atributos */
+FDAF_API fdaf_api;
+
+/* Definición de funciones */
+
+void Init_FDAF(void)
+{
+    /* Inicializar punteros de la API */
+    fdaf_api.get_fdaf = Get_FDAF;
+    fdaf_api.fdaf_filter = FDAF_Filter;
+    fdaf_api.fdaf_bloque = FDAF_Bloque;
+    fdaf_api.coeficientes_fdaf = Coeficientes_FDAF;
+}
+
+int Get_FDAF(unsigned int ncoef, unsigned int bloque, RFFT_PLAN *plan, float mu, float olvido, float delta,
+             float *workspace, FDAF_OBJECT *pfdaf)
+{
+    unsigned int i, K, B, total;
+
+    if (workspace == NULL || pfdaf == NULL || plan == NULL || ncoef == 0 || bloque == 0 ||
+        plan->n != 2 * bloque || !(mu > 0.0f) || !(olvido >= 0.0f && olvido < 1.0f) || !(delta > 0.0f))
+    {
+        return FDAF_KO;
+    }
+
+    B = bloque;
+    K = FDAF_PARTICIONES(ncoef, bloque);
+
+    pfdaf->ncoef = ncoef;
+    pfdaf->bloque = B;
+    pfdaf->particiones = K;
+    pfdaf->latencia = B;
+    pfdaf->plan = plan;
+    pfdaf->mu = mu;
+    pfdaf->olvido = olvido;
+    pfdaf->delta = delta;
+
+    /* Reparto del workspace: primero los buffers COMPLEJO */
+    pfdaf->W = (COMPLEJO *)workspace;
+    pfdaf->fdl = (COMPLEJO *)&workspace[2 * K * B];
+    pfdaf->espectro_error = (COMPLEJO *)&workspace[4 * K * B];
+    pfdaf->gradiente = (COMPLEJO *)&workspace[4 * K * B + 2 * B];
+    pfdaf->potencia = &workspace[4 * K * B + 4 * B];
+    pfdaf->entrada = &workspace[4 * K * B + 5 * B + 1];
+    pfdaf->deseada = &workspace[4 * K * B + 7 * B + 1];
+    pfdaf->salida = &workspace[4 * K * B + 8 * B + 1];
+    pfdaf->errores = &workspace[4 * K * B + 9 * B + 1];
+
+    /* Coeficientes y estado iniciales nulos */
+    total = FDAF_WORKSPACE(ncoef, bloque);
+    for (i = 0; i < total; i++)
+    {
+        workspace[i] = 0.0f;
+    }
+
+    pfdaf->p_fdl = 0;
+    pfdaf->cuenta = 0;
+    pfdaf->bloques = 0;
+    pfdaf->error = 0.0f;
+
+    return FDAF_OK;
+}
+
+float FDAF_Filter(float xn, float dn, FDAF_OBJECT *pfdaf)
+{
+    float y;
+
+    if (pfdaf == NULL || pfdaf->W == NULL)
+    {
+        return 0.0f;
+    }
+
+    FDAF_Bloque(&xn, &dn, &y, NULL, 1, pfdaf);
+
+    return y;
+}
+
+int FDAF_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, FDAF_OBJECT *pfdaf)
+{
+    unsigned int i, tramo, B;
+    float *entrada, *deseada;
+    const float *salida, *errores;
+    float yn, en;
+
+    if (pfdaf == NULL || pfdaf->W == NULL || (nmuestras > 0 && (x == NULL || d == NULL)))
+    {
+        return FDAF_KO;
+    }
+
+    B = pfdaf->bloque;
+
+    while (nmuestras > 0)
+    {
+        /* Tramo hasta completar el bloque en curso */
+        tramo = B - pfdaf->cuenta;
+        if (tramo > nmuestras)
+        {
+            tramo = nmuestras;
+        }
+
+        /* Entradas antes que salidas: y y e pueden compartir memoria con x y d */
+        entrada = &pfdaf->entrada[B + pfdaf->cuenta];
+        deseada = &pfdaf->deseada[pfdaf->cuenta];
+        salida = &pfdaf->salida[pfdaf->cuenta];
+        errores = &pfdaf->errores[pfdaf->cuenta];
+        for (i = 0; i < tramo; i++)
+        {
+            entrada[i] = x[i];
+            deseada[i] = d[i];
+            yn = salida[i];
+            en = errores[i];
+
+            if (y != NULL)
+            {
+                y[i] = yn;
+            }
+            if (e != NULL)
+            {
+                e[i] = en;
+            }
+        }
+        pfdaf->error = errores[tramo - 1];
+
+        pfdaf->cuenta += tramo;
+        x += tramo;
+        d += tramo;
+        if (y != NULL)
+        {
+            y += tramo;
+        }
+        if (e != NULL)
+        {
+            e += tramo;
+        }
+        nmuestras -= tramo;
+
+        if (pfdaf->cuenta == B)
+        {
+            procesar_fdaf(pfdaf);
+            pfdaf->cuenta = 0;
+        }
+    }
+
+    return FDAF_OK;
+}
+
+int Coeficientes_FDAF(FDAF_OBJECT *pfdaf, float *pcoef)
+{
+    unsigned int k, i, B;
+    float *tiempo;
+
+    if (pfdaf == NULL || pfdaf->W == NULL || pcoef == NULL)
+    {
+        return FDAF_KO;
+    }
+
+    /* Cada partición: primeras B muestras de la transformada inversa de W_k */
+    B = pfdaf->bloque;
+    tiempo = (float *)pfdaf->gradiente;
+    for (k = 0; k < pfdaf->particiones; k++)
+    {
+        fft_api.irfft(pfdaf->plan, &pfdaf->W[k * B], tiempo);
+        for (i = 0; i < B && k * B + i < pfdaf->ncoef; i++)
+        {
+            pcoef[k * B + i] = tiempo[i];
+        }
+    }
+
+    return FDAF_OK;
+}
+
+static void procesar_fdaf(FDAF_OBJECT *pfdaf)
+{
+    unsigned int i, k, b, B, K, p;
+    const COMPLEJO *X;
+    COMPLEJO *W, *acc, *E;
+    float *tiempo, *potencia, alfa, escala, re, im;
+
+    B = pfdaf->bloque;
+    K = pfdaf->particiones;
+    potencia = pfdaf->potencia;
+
+    /* Espectro de la ventana [bloque anterior | bloque actual] en la posición más reciente */
+    pfdaf->p_fdl = (pfdaf->p_fdl + 1 == K) ? 0 : pfdaf->p_fdl + 1;
+    X = &pfdaf->fdl[pfdaf->p_fdl * B];
+    fft_api.rfft(pfdaf->plan, pfdaf->entrada, (COMPLEJO *)X);
+
+    /* Y = sum_k W_k X_{j-k}, recorriendo la línea de retardo desde el espectro más reciente */
+    acc = pfdaf->gradiente;
+    for (b = 0; b < B; b++)
+    {
+        acc[b].re = 0.0f;
+        acc[b].im = 0.0f;
+    }
+
+    p = pfdaf->p_fdl;
+    for (k = 0; k < K; k++)
+    {
+        W = &pfdaf->W[k * B];
+        X = &pfdaf->fdl[p * B];
+
+        /* DC y Nyquist empaquetados: productos reales independientes */
+        acc[0].re += W[0].re * X[0].re;
+        acc[0].im += W[0].im * X[0].im;
+
+        for (b = 1; b < B; b++)
+        {
+            acc[b].re += W[b].re * X[b].re - W[b].im * X[b].im;
+            acc[b].im += W[b].re * X[b].im + W[b].im * X[b].re;
+        }
+
+        p = (p == 0) ? K - 1 : p - 1;
+    }
+
+    /* Salida por overlap-save y error del bloque; el error se completa por delante con B ceros */
+    tiempo = (float *)acc;
+    fft_api.irfft(pfdaf->plan, acc, tiempo);
+
+    E = pfdaf->espectro_error;
+    for (i = 0; i < B; i++)
+    {
+        pfdaf->salida[i] = tiempo[B + i];
+        pfdaf->errores[i] = pfdaf->deseada[i] - tiempo[B + i];
+        ((float *)E)[i] = 0.0f;
+        ((float *)E)[B + i] = pfdaf->errores[i];
+        pfdaf->entrada[i] = pfdaf->entrada[B + i];
+    }
+    fft_api.rfft(pfdaf->plan, (float *)E, E);
+
+    /* Potencia por bin del espectro más reciente: el primer bloque la inicializa */
+    X = &pfdaf->fdl[pfdaf->p_fdl * B];
+    alfa = (pfdaf->bloques == 0) ? 0.0f : pfdaf->olvido;
+    potencia[0] = alfa * potencia[0] + (1.0f - alfa) * X[0].re * X[0].re;
+    potencia[B] = alfa * potencia[B] + (1.0f - alfa) * X[0].im * X[0].im;
+    for (b = 1; b < B; b++)
+    {
+        potencia[b] = alfa * potencia[b] + (1.0f - alfa) * (X[b].re * X[b].re + X[b].im * X[b].im);
+    }
+    pfdaf->bloques++;
+
+    /* Error normalizado por bin, común a todas las particiones */
+    E[0].re *= pfdaf->mu / (K * potencia[0] + pfdaf->delta);
+    E[0].im *= pfdaf->mu / (K * potencia[B] + pfdaf->delta);
+    for (b = 1; b < B; b++)
+    {
+        escala = pfdaf->mu / (K * potencia[b] + pfdaf->delta);
+        E[b].re *= escala;
+        E[b].im *= escala;
+    }
+
+    /* Gradiente restringido de cada partición: X*_{j-k} E, anulando las B últimas muestras */
+    p = pfdaf->p_fdl;
+    for (k = 0; k < K; k++)
+    {
+        W = &pfdaf->W[k * B];
+        X = &pfdaf->fdl[p * B];
+
+        acc[0].re = X[0].re * E[0].re;
+        acc[0].im = X[0].im * E[0].im;
+        for (b = 1; b < B; b++)
+        {
+            re = X[b].re * E[b].re + X[b].im * E[b].im;
+            im = X[b].re * E[b].im - X[b].im * E[b].re;
+            acc[b].re = re;
+            acc[b].im = im;
+        }
+
+        fft_api.irfft(pfdaf->plan, acc, tiempo);
+        for (i = B; i < 2 * B; i++)
+        {
+            tiempo[i] = 0.0f;
+        }
+        fft_api.rfft(pfdaf->plan, tiempo, acc);
+
+        for (b = 0; b < B; b++)
+        {
+            W[b].re += acc[b].re;
+            W[b].im += acc[b].im;
+        }
+
+        p = (p == 0) ? K - 1 : p - 1;
+    }
+}
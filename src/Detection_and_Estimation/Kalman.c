@@ -0,0 +1,1436 @@
+/** \page kalman KALMAN - FILTRO DE KALMAN LINEAL
+ * \brief Módulo de estimación de estado con filtro de Kalman lineal para la librería NSDSP
+ *
+ * Este módulo implementa el filtro de Kalman lineal discreto para estimación de estado
+ * (seguimiento, eliminación de derivas) aguas abajo de los estimadores estadísticos de la
+ * librería, por ejemplo tomando la covarianza de medida R de la varianza de rt_momentos. Se
+ * construye sobre el módulo nsdsp_math (MATRIZ) y ofrece tres rutas de cálculo con el mismo
+ * resultado:
+ * - Ruta genérica: cualquier dimensión, con las operaciones matriciales de nsdsp_math_api
+ * - Ruta desenrollada: estados de 2 a 6, con la dimensión fijada en compilación
+ * - Lote: muchos filtros independientes con modelo común, en disposición SoA
+ *
+ * \section teoria_kalman Ecuaciones del filtro
+ *
+ * Para el modelo \f$ x_{k+1} = F x_k + w_k \f$, \f$ z_k = H x_k + v_k \f$, con
+ * \f$ w_k \sim N(0, Q) \f$ y \f$ v_k \sim N(0, R) \f$, la predicción es
+ * \f[
+ * \hat{x}^- = F\hat{x}, \qquad P^- = F P F^T + Q
+ * \f]
+ * y la actualización con la medida z:
+ * \f[
+ * y = z - H\hat{x}^-,\qquad S = H P^- H^T + R,\qquad K = P^- H^T S^{-1},\qquad
+ * \hat{x} = \hat{x}^- + K y
+ * \f]
+ *
+ * \subsection cholesky_kalman_sec Resolución de la innovación por Cholesky
+ *
+ * S nunca se invierte: se factoriza \f$ S = L L^T \f$ y cada fila de K se obtiene resolviendo
+ * \f$ L L^T k_i = (P^- H^T)_i \f$ por sustitución hacia delante y hacia atrás. La misma
+ * factorización da la innovación normalizada \f$ \mathrm{NIS} = y^T S^{-1} y = \|L^{-1}y\|^2 \f$,
+ * útil para validar medidas (gating). Si S no es definida positiva la actualización se rechaza
+ * y el estado no cambia. La ruta genérica usa nsdsp_math_api.cholesky y
+ * nsdsp_math_api.resuelve_cholesky; la desenrollada y el lote llevan su propia factorización y
+ * sustituciones, con el mismo orden de operaciones.
+ *
+ * \subsection joseph_kalman_sec Covarianza en forma de Joseph
+ *
+ * La forma corta \f$ P = (I - KH)P^- \f$ pierde la simetría y la definición positiva en
+ * precisión simple. Se usa la forma de Joseph, válida para cualquier ganancia:
+ * \f[
+ * P = (I - KH)P^-(I - KH)^T + K R K^T
+ * \f]
+ * evaluada sin formar \f$ I - KH \f$: con \f$ T = P^- - K (P^- H^T)^T \f$ y
+ * \f$ M = K R - T H^T \f$ resulta \f$ P = T + M K^T \f$, que se simetriza al final.
+ *
+ * \section rutas_kalman Rutas de cálculo
+ *
+ * \subsection fijo_kalman_sec Ruta desenrollada (n = 2..6)
+ *
+ * Para los tamaños de estado habituales (posición-velocidad, posición-velocidad-aceleración,
+ * deriva con sesgo...) el coste lo dominan los bucles y no las operaciones. Los núcleos de
+ * predicción y actualización se instancian una vez por cada n de KALMAN_FIJO_MIN a
+ * KALMAN_FIJO_MAX con la dimensión como constante, de modo que el compilador desenrolla por
+ * completo los bucles sobre el estado. La factorización de S y el cálculo de K se hacen en el
+ * mismo núcleo, sin pasar por nsdsp_math_api; la dimensión de la medida m sigue siendo un
+ * parámetro en ejecución, así que solo se desenrollan los bucles sobre el estado.
+ * get_kalman() selecciona la instancia en el campo fijo; ponerlo a 0 fuerza la ruta genérica.
+ *
+ * \subsection lote_kalman_sec Lote de filtros (SoA)
+ *
+ * Para seguir muchas señales con el mismo modelo (un canal por sensor, un filtro por tono) el
+ * lote guarda cada variable en estructura de arrays: el elemento k de todos los filtros es
+ * contiguo. Los filtros se procesan en grupos de NSDSP_MATH_CARRILES, como los lotes de
+ * nsdsp_math: para cada grupo se calcula la predicción o la actualización completa, de modo que
+ * sus filas de x, P y auxiliares siguen en caché de una operación a la siguiente. Cada operación
+ * toma los punteros de fila del grupo una vez por elemento (i, j) de la matriz y llama a un
+ * núcleo de carril con un bucle de longitud fija NSDSP_MATH_CARRILES sobre punteros restrict,
+ * que el compilador vectoriza ya con -O2 (compruébese con -fopt-info-vec); el grupo final, si
+ * está incompleto, recorre solo sus carriles. La factorización de Cholesky se hace por carril con
+ * una máscara: los filtros cuya S no es definida positiva anulan su ganancia y conservan el
+ * estado, y se cuentan en fallos.
+ *
+ * \section uso_kalman Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_Kalman() (llamado automáticamente por Init_NSDSP())
+ * 2. Crear el filtro con kalman_api.get_kalman() sobre un workspace de KALMAN_WORKSPACE(n, m)
+ *    floats, o el lote con kalman_api.get_lote() sobre KALMAN_LOTE_WORKSPACE(n, m, nf) floats
+ * 3. Escribir el modelo en F, Q, H, R (por defecto F = I, Q = 0, H = [I 0], R = I, P = I, x = 0)
+ * 4. Alternar predice() y actualiza() con cada medida
+ *
+ * Ejemplo de uso (velocidad constante, medida de posición):
+ * \code
+ * #include "kalman.h"
+ *
+ * static float ws[KALMAN_WORKSPACE(2, 1)];
+ * static KALMAN_OBJECT cv;
+ *
+ * void inicio(float T, float q, float r) {
+ *     kalman_api.get_kalman(2, 1, ws, &cv);      // Ruta desenrollada n = 2
+ *     cv.F.pmatriz[1] = T;                      // F = [1 T; 0 1]
+ *     cv.Q.pmatriz[0] = q * T * T * T / 3.0f;   cv.Q.pmatriz[1] = q * T * T / 2.0f;
+ *     cv.Q.pmatriz[2] = q * T * T / 2.0f;       cv.Q.pmatriz[3] = q * T;
+ *     cv.R.pmatriz[0] = r;                      // Por ejemplo, var2 de rt_momentos
+ * }
+ *
+ * void medida(float z) {
+ *     kalman_api.predice(&cv);
+ *     kalman_api.actualiza(&z, &cv);            // cv.x.pmatriz: posición y velocidad
+ * }
+ * \endcode
+ *
+ * \section funciones_kalman Descripción de funciones
+ *
+ * \subsection init_kalman_func Init_Kalman
+ * Inicializa la estructura de punteros a funciones kalman_api.
+ *
+ * \subsection get_kalman_func get_kalman
+ * Crea un filtro de n estados y m medidas con el modelo por defecto.
+ * \param estados Dimensión del estado n (> 0)
+ * \param medidas Dimensión de la medida m (> 0)
+ * \param workspace Buffer de KALMAN_WORKSPACE(n, m) floats
+ * \param pk Objeto a inicializar
+ * \return KALMAN_OK (0) si éxito, KALMAN_KO (-1) si error
+ *
+ * \subsection predice_kalman_func predice
+ * Propaga el estado y la covarianza un paso con F y Q.
+ * \param pk Objeto filtro
+ * \return KALMAN_OK (0) si éxito, KALMAN_KO (-1) si error
+ *
+ * \subsection actualiza_kalman_func actualiza
+ * Corrige el estado con una medida. La innovación, la ganancia, el factor de Cholesky de S y
+ * el NIS quedan en el objeto.
+ * \param z Medida (m floats)
+ * \param pk Objeto filtro
+ * \return KALMAN_OK (0) si éxito, KALMAN_KO (-1) si error o si S no es definida positiva
+ *
+ * \subsection get_lote_kalman_func get_lote
+ * Crea un lote de filtros independientes con modelo común, todos con x = 0 y P = I.
+ * \param estados Dimensión del estado n (> 0)
+ * \param medidas Dimensión de la medida m (> 0)
+ * \param filtros Número de filtros del lote (> 0)
+ * \param workspace Buffer de KALMAN_LOTE_WORKSPACE(n, m, filtros) floats
+ * \param pl Objeto a inicializar
+ * \return KALMAN_OK (0) si éxito, KALMAN_KO (-1) si error
+ *
+ * \subsection predice_lote_kalman_func predice_lote / actualiza_lote
+ * Predicen o actualizan todos los filtros del lote. Las medidas van en SoA: la componente a
+ * del filtro f en z[a * filtros + f].
+ * \param z Medidas del lote (m x filtros floats, solo actualiza_lote)
+ * \param pl Objeto lote
+ * \return KALMAN_OK (0) si éxito, KALMAN_KO (-1) si error o si algún filtro rechazó la medida
+ *
+ * \dot
+ * digraph kalman_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   Z [label="z_k", shape=plaintext];
+ *   PRED [label="Predicción\nx = Fx\nP = FPF^T + Q", fillcolor=lightblue];
+ *   INNOV [label="Innovación\ny = z - Hx\nS = HPH^T + R", fillcolor=lightyellow];
+ *   CHOL [label="Cholesky\nS = LL^T", fillcolor=lightpink];
+ *   GAIN [label="K = PH^T S^-1\nx = x + Ky", fillcolor=lightcyan];
+ *   JOSEPH [label="Joseph\nP = (I-KH)P(I-KH)^T + KRK^T", fillcolor=lightgreen];
+ *   X [label="x_k, P_k", shape=plaintext];
+ *
+ *   PRED -> INNOV;
+ *   Z -> INNOV;
+ *   INNOV -> CHOL -> GAIN -> JOSEPH -> X;
+ *   X -> PRED [style=dashed, label="k+1"];
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_kalman Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: Kalman lineal con Joseph y Cholesky, ruta desenrollada n = 2..6 y lote SoA |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | La factorización de S y las sustituciones usan las de nsdsp_math |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | La ruta genérica usa vistas traspuestas y productos con acumulación, sin copias |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Lote por grupos de NSDSP_MATH_CARRILES con núcleos de carril vectorizables con -O2; la ruta desenrollada factoriza S sin nsdsp_math_api |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "kalman.h"
+#include <stddef.h>
+#include <math.h>
+
+/* Los núcleos de la ruta desenrollada se expanden en cada instancia para que la dimensión del
+ * estado llegue al compilador como constante */
+#if defined(__GNUC__)
+#define KALMAN_NUCLEO       static inline __attribute__((always_inline))
+#else
+#define KALMAN_NUCLEO       static inline
+#endif
+
+/* Declaración de funciones */
+void Init_Kalman(void);
+int Get_Kalman(unsigned int estados, unsigned int medidas, float *workspace, KALMAN_OBJECT *pk);
+int Predice_Kalman(KALMAN_OBJECT *pk);
+int Actualiza_Kalman(const float *z, KALMAN_OBJECT *pk);
+int Get_Lote_Kalman(unsigned int estados, unsigned int medidas, unsigned int filtros, float *workspace,
+                    KALMAN_LOTE_OBJECT *pl);
+int Predice_Lote_Kalman(KALMAN_LOTE_OBJECT *pl);
+int Actualiza_Lote_Kalman(const float *z, KALMAN_LOTE_OBJECT *pl);
+static void predice_grupo(KALMAN_LOTE_OBJECT *pl, unsigned int g, unsigned int carriles);
+static unsigned int actualiza_grupo(const float *z, KALMAN_LOTE_OBJECT *pl, unsigned int g,
+                                    unsigned int carriles);
+static void carril_fija(float *restrict d, float c, unsigned int carriles);
+static void carril_copia(float *restrict d, const float *restrict s, unsigned int carriles);
+static void carril_axpy(float *restrict d, float c, const float *restrict s, unsigned int carriles);
+static void carril_suma(float *restrict d, const float *restrict s, const float *restrict t,
+                        unsigned int carriles);
+static void carril_resta(float *restrict d, const float *restrict s, const float *restrict t,
+                         unsigned int carriles);
+static void carril_divide(float *restrict d, const float *restrict s, unsigned int carriles);
+static void carril_enmascara(float *restrict d, const float *restrict mascara, const float *restrict s,
+                             unsigned int carriles);
+static void carril_norma(float *restrict d, const float *restrict mascara, const float *restrict s,
+                         unsigned int carriles);
+static void carril_simetriza(float *restrict d, float *restrict s, unsigned int carriles);
+static void carril_pivote(float *restrict d, float *restrict mascara, unsigned int carriles);
+static void vista_kalman(MATRIZ *pm, unsigned int filas, unsigned int columnas, float *p);
+static void completa_kalman(MATRIZ *pm, int traspuesta, MATRIZ_VISTA *pv);
+static int ganancia_kalman(KALMAN_OBJECT *pk, const float *pht, float *v);
+static void simetriza_kalman(float *P, unsigned int n);
+static void predice_generico(KALMAN_OBJECT *pk);
+static int actualiza_generico(const float *z, KALMAN_OBJECT *pk);
+KALMAN_NUCLEO void predice_nucleo(KALMAN_OBJECT *pk, const unsigned int n);
+KALMAN_NUCLEO int ganancia_nucleo(KALMAN_OBJECT *pk, const float *pht, float *v, const unsigned int n);
+KALMAN_NUCLEO int actualiza_nucleo(const float *z, KALMAN_OBJECT *pk, const unsigned int n);
+static void predice_2(KALMAN_OBJECT *pk);
+static void predice_3(KALMAN_OBJECT *pk);
+static void predice_4(KALMAN_OBJECT *pk);
+static void predice_5(KALMAN_OBJECT *pk);
+static void predice_6(KALMAN_OBJECT *pk);
+static int actualiza_2(const float *z, KALMAN_OBJECT *pk);
+static int actualiza_3(const float *z, KALMAN_OBJECT *pk);
+static int actualiza_4(const float *z, KALMAN_OBJECT *pk);
+static int actualiza_5(const float *z, KALMAN_OBJECT *pk);
+static int actualiza_6(const float *z, KALMAN_OBJECT *pk);
+
+/* Atributos */
+KALMAN_API kalman_api;
+
+/* Definición de funciones */
+
+void Init_Kalman(void)
+{
+    /* Inicializar punteros de la API */
+    kalman_api.get_kalman = Get_Kalman;
+    kalman_api.predice = Predice_Kalman;
+    kalman_api.actualiza = Actualiza_Kalman;
+    kalman_api.get_lote = Get_Lote_Kalman;
+    kalman_api.predice_lote = Predice_Lote_Kalman;
+    kalman_api.actualiza_lote = Actualiza_Lote_Kalman;
+}
+
+int Get_Kalman(unsigned int estados, unsigned int medidas, float *workspace, KALMAN_OBJECT *pk)
+{
+    unsigned int i, n, m, total;
+    float *p;
+
+    if (pk == NULL || workspace == NULL || estados == 0 || medidas == 0)
+    {
+        return KALMAN_KO;
+    }
+
+    n = estados;
+    m = medidas;
+    total = KALMAN_WORKSPACE(n, m);
+    for (i = 0; i < total; i++)
+    {
+        workspace[i] = 0.0f;
+    }
+
+    /* Reparto del workspace */
+    p = workspace;
+    vista_kalman(&pk->x, n, 1, p);
+    p += n;
+    vista_kalman(&pk->P, n, n, p);
+    p += n * n;
+    vista_kalman(&pk->F, n, n, p);
+    p += n * n;
+    vista_kalman(&pk->Q, n, n, p);
+    p += n * n;
+    vista_kalman(&pk->H, m, n, p);
+    p += m * n;
+    vista_kalman(&pk->R, m, m, p);
+    p += m * m;
+    vista_kalman(&pk->K, n, m, p);
+    p += n * m;
+    vista_kalman(&pk->S, m, m, p);
+    p += m * m;
+    vista_kalman(&pk->innovacion, m, 1, p);
+    p += m;
+    pk->auxiliar = p;
+
+    /* Modelo por defecto: F = I, Q = 0, H = [I 0], R = I, P = I, x = 0 */
+    for (i = 0; i < n; i++)
+    {
+        pk->F.pmatriz[i * n + i] = 1.0f;
+        pk->P.pmatriz[i * n + i] = 1.0f;
+    }
+    for (i = 0; i < m; i++)
+    {
+        if (i < n)
+        {
+            pk->H.pmatriz[i * n + i] = 1.0f;
+        }
+        pk->R.pmatriz[i * m + i] = 1.0f;
+    }
+
+    pk->estados = n;
+    pk->medidas = m;
+    pk->fijo = (n >= KALMAN_FIJO_MIN && n <= KALMAN_FIJO_MAX) ? n : 0;
+    pk->nis = 0.0f;
+
+    return KALMAN_OK;
+}
+
+int Predice_Kalman(KALMAN_OBJECT *pk)
+{
+    if (pk == NULL || pk->x.pmatriz == NULL || (pk->fijo != 0 && pk->fijo != pk->estados))
+    {
+        return KALMAN_KO;
+    }
+
+    switch (pk->fijo)
+    {
+        case 2:
+            predice_2(pk);
+            break;
+        case 3:
+            predice_3(pk);
+            break;
+        case 4:
+            predice_4(pk);
+            break;
+        case 5:
+            predice_5(pk);
+            break;
+        case 6:
+            predice_6(pk);
+            break;
+        default:
+            predice_generico(pk);
+            break;
+    }
+
+    return KALMAN_OK;
+}
+
+int Actualiza_Kalman(const float *z, KALMAN_OBJECT *pk)
+{
+    if (z == NULL || pk == NULL || pk->x.pmatriz == NULL || (pk->fijo != 0 && pk->fijo != pk->estados))
+    {
+        return KALMAN_KO;
+    }
+
+    switch (pk->fijo)
+    {
+        case 2:
+            return actualiza_2(z, pk);
+        case 3:
+            return actualiza_3(z, pk);
+        case 4:
+            return actualiza_4(z, pk);
+        case 5:
+            return actualiza_5(z, pk);
+        case 6:
+            return actualiza_6(z, pk);
+        default:
+            return actualiza_generico(z, pk);
+    }
+}
+
+int Get_Lote_Kalman(unsigned int estados, unsigned int medidas, unsigned int filtros, float *workspace,
+                    KALMAN_LOTE_OBJECT *pl)
+{
+    unsigned int i, f, n, m, nf, total;
+    float *p;
+
+    if (pl == NULL || workspace == NULL || estados == 0 || medidas == 0 || filtros == 0)
+    {
+        return KALMAN_KO;
+    }
+
+    n = estados;
+    m = medidas;
+    nf = filtros;
+    total = KALMAN_LOTE_WORKSPACE(n, m, nf);
+    for (i = 0; i < total; i++)
+    {
+        workspace[i] = 0.0f;
+    }
+
+    /* Modelo común seguido de las variables de los filtros en SoA */
+    p = workspace;
+    vista_kalman(&pl->F, n, n, p);
+    p += n * n;
+    vista_kalman(&pl->Q, n, n, p);
+    p += n * n;
+    vista_kalman(&pl->H, m, n, p);
+    p += m * n;
+    vista_kalman(&pl->R, m, m, p);
+    p += m * m;
+    pl->x = p;
+    p += n * nf;
+    pl->P = p;
+    p += n * n * nf;
+    pl->innovacion = p;
+    p += m * nf;
+    pl->nis = p;
+    p += nf;
+    pl->auxiliar = p;
+
+    for (i = 0; i < n; i++)
+    {
+        pl->F.pmatriz[i * n + i] = 1.0f;
+        for (f = 0; f < nf; f++)
+        {
+            pl->P[(i * n + i) * nf + f] = 1.0f;
+        }
+    }
+    for (i = 0; i < m; i++)
+    {
+        if (i < n)
+        {
+            pl->H.pmatriz[i * n + i] = 1.0f;
+        }
+        pl->R.pmatriz[i * m + i] = 1.0f;
+    }
+
+    pl->estados = n;
+    pl->medidas = m;
+    pl->filtros = nf;
+    pl->fallos = 0;
+
+    return KALMAN_OK;
+}
+
+int Predice_Lote_Kalman(KALMAN_LOTE_OBJECT *pl)
+{
+    unsigned int g, nf, carriles;
+
+    if (pl == NULL || pl->x == NULL)
+    {
+        return KALMAN_KO;
+    }
+
+    /* Grupos de NSDSP_MATH_CARRILES filtros: el grupo completo de x, P y T queda en caché durante
+     * toda la predicción */
+    nf = pl->filtros;
+    for (g = 0; g < nf; g += NSDSP_MATH_CARRILES)
+    {
+        carriles = (nf - g < NSDSP_MATH_CARRILES) ? nf - g : NSDSP_MATH_CARRILES;
+        predice_grupo(pl, g, carriles);
+    }
+
+    return KALMAN_OK;
+}
+
+int Actualiza_Lote_Kalman(const float *z, KALMAN_LOTE_OBJECT *pl)
+{
+    unsigned int g, nf, carriles;
+
+    if (z == NULL || pl == NULL || pl->x == NULL)
+    {
+        return KALMAN_KO;
+    }
+
+    nf = pl->filtros;
+    pl->fallos = 0;
+    for (g = 0; g < nf; g += NSDSP_MATH_CARRILES)
+    {
+        carriles = (nf - g < NSDSP_MATH_CARRILES) ? nf - g : NSDSP_MATH_CARRILES;
+        pl->fallos += actualiza_grupo(z, pl, g, carriles);
+    }
+
+    return (pl->fallos == 0) ? KALMAN_OK : KALMAN_KO;
+}
+
+static void predice_grupo(KALMAN_LOTE_OBJECT *pl, unsigned int g, unsigned int carriles)
+{
+    unsigned int i, j, k, n, nf;
+    const float *F, *Q;
+    float *x, *P, *T, *xt;
+    float *fila;
+
+    n = pl->estados;
+    nf = pl->filtros;
+    F = pl->F.pmatriz;
+    Q = pl->Q.pmatriz;
+    x = &pl->x[g];
+    P = &pl->P[g];
+    T = &pl->auxiliar[g];
+    xt = &pl->auxiliar[n * n * nf + g];
+
+    /* x = F x: coeficiente común por fila, bucle interior sobre los carriles del grupo */
+    for (i = 0; i < n; i++)
+    {
+        fila = &xt[i * nf];
+        carril_fija(fila, 0.0f, carriles);
+        for (k = 0; k < n; k++)
+        {
+            carril_axpy(fila, F[i * n + k], &x[k * nf], carriles);
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        carril_copia(&x[i * nf], &xt[i * nf], carriles);
+    }
+
+    /* T = F P */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            fila = &T[(i * n + j) * nf];
+            carril_fija(fila, 0.0f, carriles);
+            for (k = 0; k < n; k++)
+            {
+                carril_axpy(fila, F[i * n + k], &P[(k * n + j) * nf], carriles);
+            }
+        }
+    }
+
+    /* P = T F^T + Q, triángulo superior reflejado */
+    for (i = 0; i < n; i++)
+    {
+        for (j = i; j < n; j++)
+        {
+            fila = &P[(i * n + j) * nf];
+            carril_fija(fila, Q[i * n + j], carriles);
+            for (k = 0; k < n; k++)
+            {
+                carril_axpy(fila, F[j * n + k], &T[(i * n + k) * nf], carriles);
+            }
+            if (j != i)
+            {
+                carril_copia(&P[(j * n + i) * nf], fila, carriles);
+            }
+        }
+    }
+}
+
+static unsigned int actualiza_grupo(const float *z, KALMAN_LOTE_OBJECT *pl, unsigned int g,
+                                    unsigned int carriles)
+{
+    unsigned int i, j, k, a, b, f, n, m, nf, fallos;
+    const float *H, *R;
+    float *x, *P, *y, *T, *M, *K, *L, *v, *mascara, *nis;
+    float *fila;
+
+    n = pl->estados;
+    m = pl->medidas;
+    nf = pl->filtros;
+    H = pl->H.pmatriz;
+    R = pl->R.pmatriz;
+    z = &z[g];
+    x = &pl->x[g];
+    P = &pl->P[g];
+    y = &pl->innovacion[g];
+    nis = &pl->nis[g];
+    T = &pl->auxiliar[g];
+    M = &T[n * n * nf];
+    K = &M[n * m * nf];
+    L = &K[n * m * nf];
+    v = &L[m * m * nf];
+    mascara = &v[(n + m) * nf];
+
+    /* y = z - H x */
+    for (a = 0; a < m; a++)
+    {
+        fila = &y[a * nf];
+        carril_copia(fila, &z[a * nf], carriles);
+        for (k = 0; k < n; k++)
+        {
+            carril_axpy(fila, -H[a * n + k], &x[k * nf], carriles);
+        }
+    }
+
+    /* M = P H^T */
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            fila = &M[(i * m + a) * nf];
+            carril_fija(fila, 0.0f, carriles);
+            for (k = 0; k < n; k++)
+            {
+                carril_axpy(fila, H[a * n + k], &P[(i * n + k) * nf], carriles);
+            }
+        }
+    }
+
+    /* Triángulo inferior de S = H M + R */
+    for (a = 0; a < m; a++)
+    {
+        for (b = 0; b <= a; b++)
+        {
+            fila = &L[(a * m + b) * nf];
+            carril_fija(fila, R[a * m + b], carriles);
+            for (k = 0; k < n; k++)
+            {
+                carril_axpy(fila, H[a * n + k], &M[(k * m + b) * nf], carriles);
+            }
+        }
+    }
+
+    /* Cholesky por columnas en todos los carriles: un pivote no positivo anula la máscara del
+     * filtro y se sustituye por 1 para que el resto de la factorización siga siendo finita */
+    carril_fija(mascara, 1.0f, carriles);
+    for (j = 0; j < m; j++)
+    {
+        fila = &L[(j * m + j) * nf];
+        for (k = 0; k < j; k++)
+        {
+            carril_resta(fila, &L[(j * m + k) * nf], &L[(j * m + k) * nf], carriles);
+        }
+        carril_pivote(fila, mascara, carriles);
+        for (i = j + 1; i < m; i++)
+        {
+            for (k = 0; k < j; k++)
+            {
+                carril_resta(&L[(i * m + j) * nf], &L[(i * m + k) * nf], &L[(j * m + k) * nf], carriles);
+            }
+            carril_divide(&L[(i * m + j) * nf], fila, carriles);
+        }
+    }
+
+    /* Filas de K: L L^T k_i = m_i, hacia delante y hacia atrás */
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            fila = &K[(i * m + a) * nf];
+            carril_copia(fila, &M[(i * m + a) * nf], carriles);
+            for (b = 0; b < a; b++)
+            {
+                carril_resta(fila, &L[(a * m + b) * nf], &K[(i * m + b) * nf], carriles);
+            }
+            carril_divide(fila, &L[(a * m + a) * nf], carriles);
+        }
+        for (a = m; a-- > 0;)
+        {
+            fila = &K[(i * m + a) * nf];
+            for (b = a + 1; b < m; b++)
+            {
+                carril_resta(fila, &L[(b * m + a) * nf], &K[(i * m + b) * nf], carriles);
+            }
+            carril_enmascara(fila, mascara, &L[(a * m + a) * nf], carriles);
+        }
+    }
+
+    /* NIS = |L^-1 y|^2 y x = x + K y */
+    carril_fija(nis, 0.0f, carriles);
+    for (a = 0; a < m; a++)
+    {
+        fila = &v[a * nf];
+        carril_copia(fila, &y[a * nf], carriles);
+        for (b = 0; b < a; b++)
+        {
+            carril_resta(fila, &L[(a * m + b) * nf], &v[b * nf], carriles);
+        }
+        carril_divide(fila, &L[(a * m + a) * nf], carriles);
+        carril_norma(nis, mascara, fila, carriles);
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            carril_suma(&x[i * nf], &K[(i * m + a) * nf], &y[a * nf], carriles);
+        }
+    }
+
+    /* Joseph: T = P - K M^T, M = K R - T H^T, P = T + M K^T */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            fila = &T[(i * n + j) * nf];
+            carril_copia(fila, &P[(i * n + j) * nf], carriles);
+            for (a = 0; a < m; a++)
+            {
+                carril_resta(fila, &K[(i * m + a) * nf], &M[(j * m + a) * nf], carriles);
+            }
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            fila = &M[(i * m + a) * nf];
+            carril_fija(fila, 0.0f, carriles);
+            for (b = 0; b < m; b++)
+            {
+                carril_axpy(fila, R[b * m + a], &K[(i * m + b) * nf], carriles);
+            }
+            for (k = 0; k < n; k++)
+            {
+                carril_axpy(fila, -H[a * n + k], &T[(i * n + k) * nf], carriles);
+            }
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            fila = &P[(i * n + j) * nf];
+            carril_copia(fila, &T[(i * n + j) * nf], carriles);
+            for (a = 0; a < m; a++)
+            {
+                carril_suma(fila, &M[(i * m + a) * nf], &K[(j * m + a) * nf], carriles);
+            }
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (j = i + 1; j < n; j++)
+        {
+            carril_simetriza(&P[(i * n + j) * nf], &P[(j * n + i) * nf], carriles);
+        }
+    }
+
+    fallos = 0;
+    for (f = 0; f < carriles; f++)
+    {
+        if (mascara[f] == 0.0f)
+        {
+            fallos++;
+        }
+    }
+
+    return fallos;
+}
+
+/* Operaciones por carril de un grupo del lote. Los grupos completos recorren un bucle de longitud
+ * fija NSDSP_MATH_CARRILES sobre punteros restrict, que el compilador vectoriza ya con -O2; el
+ * grupo final incompleto usa el mismo bucle con la longitud real */
+
+static void carril_fija(float *restrict d, float c, unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] = c;
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] = c;
+        }
+    }
+}
+
+static void carril_copia(float *restrict d, const float *restrict s, unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] = s[l];
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] = s[l];
+        }
+    }
+}
+
+static void carril_axpy(float *restrict d, float c, const float *restrict s, unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] += c * s[l];
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] += c * s[l];
+        }
+    }
+}
+
+static void carril_suma(float *restrict d, const float *restrict s, const float *restrict t,
+                        unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] += s[l] * t[l];
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] += s[l] * t[l];
+        }
+    }
+}
+
+static void carril_resta(float *restrict d, const float *restrict s, const float *restrict t,
+                         unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] -= s[l] * t[l];
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] -= s[l] * t[l];
+        }
+    }
+}
+
+static void carril_divide(float *restrict d, const float *restrict s, unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] /= s[l];
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] /= s[l];
+        }
+    }
+}
+
+static void carril_enmascara(float *restrict d, const float *restrict mascara, const float *restrict s,
+                             unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] = mascara[l] * d[l] / s[l];
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] = mascara[l] * d[l] / s[l];
+        }
+    }
+}
+
+static void carril_norma(float *restrict d, const float *restrict mascara, const float *restrict s,
+                         unsigned int carriles)
+{
+    unsigned int l;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            d[l] += mascara[l] * s[l] * s[l];
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            d[l] += mascara[l] * s[l] * s[l];
+        }
+    }
+}
+
+static void carril_simetriza(float *restrict d, float *restrict s, unsigned int carriles)
+{
+    unsigned int l;
+    float c;
+
+    if (carriles == NSDSP_MATH_CARRILES)
+    {
+        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+        {
+            c = 0.5f * (d[l] + s[l]);
+            d[l] = c;
+            s[l] = c;
+        }
+    }
+    else
+    {
+        for (l = 0; l < carriles; l++)
+        {
+            c = 0.5f * (d[l] + s[l]);
+            d[l] = c;
+            s[l] = c;
+        }
+    }
+}
+
+static void carril_pivote(float *restrict d, float *restrict mascara, unsigned int carriles)
+{
+    unsigned int l;
+    float valido;
+
+    /* sqrtf mantiene errno y no se vectoriza con -O2; son m raíces por grupo y actualización */
+    for (l = 0; l < carriles; l++)
+    {
+        valido = (d[l] > 0.0f) ? 1.0f : 0.0f;
+        mascara[l] *= valido;
+        d[l] = sqrtf(valido * d[l] + (1.0f - valido));
+    }
+}
+
+static void vista_kalman(MATRIZ *pm, unsigned int filas, unsigned int columnas, float *p)
+{
+    pm->filas = filas;
+    pm->columnas = columnas;
+    pm->pmatriz = p;
+}
+
+static void completa_kalman(MATRIZ *pm, int traspuesta, MATRIZ_VISTA *pv)
+{
+    /* Vista densa de la matriz completa, o de su traspuesta */
+    pv->filas = traspuesta ? pm->columnas : pm->filas;
+    pv->columnas = traspuesta ? pm->filas : pm->columnas;
+    pv->paso = pm->columnas;
+    pv->traspuesta = traspuesta ? 1 : 0;
+    pv->pmatriz = pm->pmatriz;
+}
+
+static int ganancia_kalman(KALMAN_OBJECT *pk, const float *pht, float *v)
+{
+    unsigned int i, a, n, m;
+    MATRIZ fila;
+
+    n = pk->estados;
+    m = pk->medidas;
+
+    /* S = L L^T in situ (solo se lee el triángulo inferior) */
+    if (nsdsp_math_api.cholesky(&pk->S, &pk->S) != NSDSP_MATH_OK)
+    {
+        return KALMAN_KO;
+    }
+
+    /* Filas de K: L L^T k_i = (P H^T)_i, cada fila contigua vista como columna de m x 1 */
+    fila.filas = m;
+    fila.columnas = 1;
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            pk->K.pmatriz[i * m + a] = pht[i * m + a];
+        }
+        fila.pmatriz = &pk->K.pmatriz[i * m];
+        nsdsp_math_api.resuelve_cholesky(&pk->S, &fila);
+    }
+
+    /* NIS = |L^-1 y|^2 sobre v */
+    for (a = 0; a < m; a++)
+    {
+        v[a] = pk->innovacion.pmatriz[a];
+    }
+    fila.pmatriz = v;
+    nsdsp_math_api.triangular(&pk->S, &fila, NSDSP_MATH_INFERIOR);
+    pk->nis = 0.0f;
+    for (a = 0; a < m; a++)
+    {
+        pk->nis += v[a] * v[a];
+    }
+
+    return KALMAN_OK;
+}
+
+static void simetriza_kalman(float *P, unsigned int n)
+{
+    unsigned int i, j;
+    float c;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = i + 1; j < n; j++)
+        {
+            c = 0.5f * (P[i * n + j] + P[j * n + i]);
+            P[i * n + j] = c;
+            P[j * n + i] = c;
+        }
+    }
+}
+
+static void predice_generico(KALMAN_OBJECT *pk)
+{
+    unsigned int i, n;
+    MATRIZ B, xt;
+    MATRIZ_VISTA F, Ft, P, vB;
+
+    n = pk->estados;
+    vista_kalman(&B, n, n, &pk->auxiliar[n * n]);
+    vista_kalman(&xt, n, 1, &pk->auxiliar[2 * n * n]);
+    completa_kalman(&pk->F, 0, &F);
+    completa_kalman(&pk->F, 1, &Ft);
+    completa_kalman(&pk->P, 0, &P);
+    completa_kalman(&B, 0, &vB);
+
+    /* x = F x */
+    nsdsp_math_api.product(&pk->F, &pk->x, &xt);
+    for (i = 0; i < n; i++)
+    {
+        pk->x.pmatriz[i] = xt.pmatriz[i];
+    }
+
+    /* P = Q + (F P) F^T, con F^T como vista traspuesta de F */
+    nsdsp_math_api.producto_vista(1.0f, &F, &P, 0.0f, &vB);
+    for (i = 0; i < n * n; i++)
+    {
+        pk->P.pmatriz[i] = pk->Q.pmatriz[i];
+    }
+    nsdsp_math_api.producto_vista(1.0f, &vB, &Ft, 1.0f, &P);
+    simetriza_kalman(pk->P.pmatriz, n);
+}
+
+static int actualiza_generico(const float *z, KALMAN_OBJECT *pk)
+{
+    unsigned int a, i, n, m;
+    MATRIZ B, C2, C3;
+    MATRIZ_VISTA H, Ht, P, R, S, K, Kt, x, y, vB, vC2, vC3;
+
+    n = pk->estados;
+    m = pk->medidas;
+    vista_kalman(&B, n, n, &pk->auxiliar[n * n]);
+    vista_kalman(&C2, n, m, &pk->auxiliar[2 * n * n + n * m]);
+    vista_kalman(&C3, m, n, &pk->auxiliar[2 * n * n + 2 * n * m]);
+    completa_kalman(&pk->H, 0, &H);
+    completa_kalman(&pk->H, 1, &Ht);
+    completa_kalman(&pk->P, 0, &P);
+    completa_kalman(&pk->R, 0, &R);
+    completa_kalman(&pk->S, 0, &S);
+    completa_kalman(&pk->K, 0, &K);
+    completa_kalman(&pk->K, 1, &Kt);
+    completa_kalman(&pk->x, 0, &x);
+    completa_kalman(&pk->innovacion, 0, &y);
+    completa_kalman(&B, 0, &vB);
+    completa_kalman(&C2, 0, &vC2);
+    completa_kalman(&C3, 0, &vC3);
+
+    /* C2 = P H^T, S = R + H C2 */
+    nsdsp_math_api.producto_vista(1.0f, &P, &Ht, 0.0f, &vC2);
+    for (a = 0; a < m * m; a++)
+    {
+        S.pmatriz[a] = pk->R.pmatriz[a];
+    }
+    nsdsp_math_api.producto_vista(1.0f, &H, &vC2, 1.0f, &S);
+
+    /* y = z - H x */
+    for (a = 0; a < m; a++)
+    {
+        y.pmatriz[a] = z[a];
+    }
+    nsdsp_math_api.producto_vista(-1.0f, &H, &x, 1.0f, &y);
+
+    if (ganancia_kalman(pk, C2.pmatriz, C3.pmatriz) != KALMAN_OK)
+    {
+        return KALMAN_KO;
+    }
+
+    /* x = x + K y */
+    nsdsp_math_api.producto_vista(1.0f, &K, &y, 1.0f, &x);
+
+    /* Joseph: T = P - K (H P) en B, con H P en C3 (m x n) */
+    nsdsp_math_api.producto_vista(1.0f, &H, &P, 0.0f, &vC3);
+    for (i = 0; i < n * n; i++)
+    {
+        B.pmatriz[i] = pk->P.pmatriz[i];
+    }
+    nsdsp_math_api.producto_vista(-1.0f, &K, &vC3, 1.0f, &vB);
+
+    /* M = K R - T H^T en C3 (n x m) */
+    vista_kalman(&C3, n, m, C3.pmatriz);
+    completa_kalman(&C3, 0, &vC3);
+    nsdsp_math_api.producto_vista(1.0f, &K, &R, 0.0f, &vC3);
+    nsdsp_math_api.producto_vista(-1.0f, &vB, &Ht, 1.0f, &vC3);
+
+    /* P = T + M K^T */
+    for (i = 0; i < n * n; i++)
+    {
+        P.pmatriz[i] = B.pmatriz[i];
+    }
+    nsdsp_math_api.producto_vista(1.0f, &vC3, &Kt, 1.0f, &P);
+    simetriza_kalman(pk->P.pmatriz, n);
+
+    return KALMAN_OK;
+}
+
+KALMAN_NUCLEO void predice_nucleo(KALMAN_OBJECT *pk, const unsigned int n)
+{
+    unsigned int i, j, k;
+    float *restrict x;
+    float *restrict P;
+    float *restrict T;
+    float *restrict xt;
+    const float *F, *Q;
+    float acumulador;
+
+    x = pk->x.pmatriz;
+    P = pk->P.pmatriz;
+    F = pk->F.pmatriz;
+    Q = pk->Q.pmatriz;
+    T = pk->auxiliar;
+    xt = &pk->auxiliar[2 * n * n];
+
+    /* x = F x */
+    for (i = 0; i < n; i++)
+    {
+        acumulador = 0.0f;
+        for (k = 0; k < n; k++)
+        {
+            acumulador += F[i * n + k] * x[k];
+        }
+        xt[i] = acumulador;
+    }
+    for (i = 0; i < n; i++)
+    {
+        x[i] = xt[i];
+    }
+
+    /* T = F P, P = T F^T + Q sobre el triángulo superior */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            acumulador = 0.0f;
+            for (k = 0; k < n; k++)
+            {
+                acumulador += F[i * n + k] * P[k * n + j];
+            }
+            T[i * n + j] = acumulador;
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (j = i; j < n; j++)
+        {
+            acumulador = Q[i * n + j];
+            for (k = 0; k < n; k++)
+            {
+                acumulador += T[i * n + k] * F[j * n + k];
+            }
+            P[i * n + j] = acumulador;
+            P[j * n + i] = acumulador;
+        }
+    }
+}
+
+KALMAN_NUCLEO int ganancia_nucleo(KALMAN_OBJECT *pk, const float *pht, float *v, const unsigned int n)
+{
+    unsigned int i, j, k, a, b, m;
+    float *restrict K;
+    float *restrict L;
+    const float *y;
+    float acumulador, diagonal;
+
+    m = pk->medidas;
+    K = pk->K.pmatriz;
+    L = pk->S.pmatriz;
+    y = pk->innovacion.pmatriz;
+
+    /* S = L L^T in situ por columnas, con el mismo orden de operaciones que nsdsp_math_api.cholesky */
+    for (j = 0; j < m; j++)
+    {
+        diagonal = L[j * m + j];
+        for (k = 0; k < j; k++)
+        {
+            diagonal -= L[j * m + k] * L[j * m + k];
+        }
+        if (!(diagonal > 0.0f))
+        {
+            for (a = 0; a < m * m; a++)
+            {
+                L[a] = 0.0f;
+            }
+            return KALMAN_KO;
+        }
+        diagonal = sqrtf(diagonal);
+        L[j * m + j] = diagonal;
+        for (i = j + 1; i < m; i++)
+        {
+            acumulador = L[i * m + j];
+            for (k = 0; k < j; k++)
+            {
+                acumulador -= L[i * m + k] * L[j * m + k];
+            }
+            L[i * m + j] = acumulador / diagonal;
+        }
+        for (k = j + 1; k < m; k++)
+        {
+            L[j * m + k] = 0.0f;
+        }
+    }
+
+    /* Filas de K: L L^T k_i = (P H^T)_i, hacia delante y hacia atrás */
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            acumulador = pht[i * m + a];
+            for (b = 0; b < a; b++)
+            {
+                acumulador -= L[a * m + b] * K[i * m + b];
+            }
+            K[i * m + a] = acumulador / L[a * m + a];
+        }
+        for (a = m; a-- > 0;)
+        {
+            acumulador = K[i * m + a];
+            for (b = a + 1; b < m; b++)
+            {
+                acumulador -= L[b * m + a] * K[i * m + b];
+            }
+            K[i * m + a] = acumulador / L[a * m + a];
+        }
+    }
+
+    /* NIS = |L^-1 y|^2 sobre v */
+    pk->nis = 0.0f;
+    for (a = 0; a < m; a++)
+    {
+        acumulador = y[a];
+        for (b = 0; b < a; b++)
+        {
+            acumulador -= L[a * m + b] * v[b];
+        }
+        v[a] = acumulador / L[a * m + a];
+        pk->nis += v[a] * v[a];
+    }
+
+    return KALMAN_OK;
+}
+
+KALMAN_NUCLEO int actualiza_nucleo(const float *z, KALMAN_OBJECT *pk, const unsigned int n)
+{
+    unsigned int i, j, k, a, b, m;
+    float *restrict x;
+    float *restrict P;
+    float *restrict T;
+    float *restrict M;
+    float *K, *L, *y, *v;
+    const float *H, *R;
+    float acumulador, simetrico;
+
+    m = pk->medidas;
+    x = pk->x.pmatriz;
+    P = pk->P.pmatriz;
+    H = pk->H.pmatriz;
+    R = pk->R.pmatriz;
+    K = pk->K.pmatriz;
+    L = pk->S.pmatriz;
+    y = pk->innovacion.pmatriz;
+    T = &pk->auxiliar[n * n];
+    M = &pk->auxiliar[2 * n * n];
+    v = &pk->auxiliar[2 * n * n + n * m];
+
+    /* y = z - H x y M = P H^T */
+    for (a = 0; a < m; a++)
+    {
+        acumulador = z[a];
+        for (k = 0; k < n; k++)
+        {
+            acumulador -= H[a * n + k] * x[k];
+        }
+        y[a] = acumulador;
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            acumulador = 0.0f;
+            for (k = 0; k < n; k++)
+            {
+                acumulador += P[i * n + k] * H[a * n + k];
+            }
+            M[i * m + a] = acumulador;
+        }
+    }
+
+    /* Triángulo inferior de S = H M + R y factorización */
+    for (a = 0; a < m; a++)
+    {
+        for (b = 0; b <= a; b++)
+        {
+            acumulador = R[a * m + b];
+            for (k = 0; k < n; k++)
+            {
+                acumulador += H[a * n + k] * M[k * m + b];
+            }
+            L[a * m + b] = acumulador;
+        }
+    }
+    if (ganancia_nucleo(pk, M, v, n) != KALMAN_OK)
+    {
+        return KALMAN_KO;
+    }
+
+    /* x = x + K y */
+    for (i = 0; i < n; i++)
+    {
+        acumulador = 0.0f;
+        for (a = 0; a < m; a++)
+        {
+            acumulador += K[i * m + a] * y[a];
+        }
+        x[i] += acumulador;
+    }
+
+    /* Joseph: T = P - K M^T, M = K R - T H^T, P = T + M K^T */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            acumulador = P[i * n + j];
+            for (a = 0; a < m; a++)
+            {
+                acumulador -= K[i * m + a] * M[j * m + a];
+            }
+            T[i * n + j] = acumulador;
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            acumulador = 0.0f;
+            for (b = 0; b < m; b++)
+            {
+                acumulador += K[i * m + b] * R[b * m + a];
+            }
+            for (k = 0; k < n; k++)
+            {
+                acumulador -= T[i * n + k] * H[a * n + k];
+            }
+            M[i * m + a] = acumulador;
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (j = i; j < n; j++)
+        {
+            acumulador = T[i * n + j];
+            simetrico = T[j * n + i];
+            for (a = 0; a < m; a++)
+            {
+                acumulador += M[i * m + a] * K[j * m + a];
+                simetrico += M[j * m + a] * K[i * m + a];
+            }
+            acumulador = 0.5f * (acumulador + simetrico);
+            P[i * n + j] = acumulador;
+            P[j * n + i] = acumulador;
+        }
+    }
+
+    return KALMAN_OK;
+}
+
+/* Instancias de la ruta desenrollada: la dimensión del estado es constante en cada una */
+
+static void predice_2(KALMAN_OBJECT *pk)
+{
+    predice_nucleo(pk, 2);
+}
+
+static void predice_3(KALMAN_OBJECT *pk)
+{
+    predice_nucleo(pk, 3);
+}
+
+static void predice_4(KALMAN_OBJECT *pk)
+{
+    predice_nucleo(pk, 4);
+}
+
+static void predice_5(KALMAN_OBJECT *pk)
+{
+    predice_nucleo(pk, 5);
+}
+
+static void predice_6(KALMAN_OBJECT *pk)
+{
+    predice_nucleo(pk, 6);
+}
+
+static int actualiza_2(const float *z, KALMAN_OBJECT *pk)
+{
+    return actualiza_nucleo(z, pk, 2);
+}
+
+static int actualiza_3(const float *z, KALMAN_OBJECT *pk)
+{
+    return actualiza_nucleo(z, pk, 3);
+}
+
+static int actualiza_4(const float *z, KALMAN_OBJECT *pk)
+{
+    return actualiza_nucleo(z, pk, 4);
+}
+
+static int actualiza_5(const float *z, KALMAN_OBJECT *pk)
+{
+    return actualiza_nucleo(z, pk, 5);
+}
+
+static int actualiza_6(const float *z, KALMAN_OBJECT *pk)
+{
+    return actualiza_nucleo(z, pk, 6);
+}
@@ -1 +1,383 @@
+/** \page lms_filter LMS FILTER - FILTRADO ADAPTATIVO
+ * \brief Módulo de filtros FIR adaptativos LMS, NLMS y LMS con fugas para la librería NSDSP
+ *
+ * Este módulo implementa filtros FIR cuyos coeficientes se adaptan muestra a muestra para
+ * minimizar el error cuadrático medio entre la salida del filtro y una señal deseada
+ * (identificación de sistemas, cancelación de eco y de ruido, ecualización). El objeto
+ * LMS_OBJECT contiene un FIR_FILTER_OBJECT con los coeficientes adaptativos y la línea de
+ * retardo. Los coeficientes tienen la misma ordenación que en fir_filter (pcoef[0] multiplica
+ * a la muestra más reciente), por lo que pueden congelarse en un filtro FIR convencional.
+ *
+ * \section teoria_lms Teoría
+ *
+ * Con el vector de entrada \f$ \mathbf{x}_n = [x[n], x[n-1], \ldots, x[n-N+1]]^T \f$:
+ * \f[
+ * y[n] = \mathbf{w}_n^T \mathbf{x}_n,\qquad e[n] = d[n] - y[n],\qquad
+ * \mathbf{w}_{n+1} = \alpha\,\mathbf{w}_n + g[n]\,\mathbf{x}_n
+ * \f]
+ * donde según el tipo de filtro:
+ * - LMS_ESTANDAR: \f$ \alpha = 1,\ g[n] = \mu\,e[n] \f$
+ * - LMS_NORMALIZADO: \f$ \alpha = 1,\ g[n] = \mu\,e[n] / (\epsilon + \|\mathbf{x}_n\|^2) \f$,
+ *   convergente para \f$ 0 < \mu < 2 \f$ con independencia de la potencia de la entrada
+ * - LMS_FUGAS: \f$ \alpha = 1 - \mu\gamma,\ g[n] = \mu\,e[n] \f$, que converge a
+ *   \f$ (\mathbf{R} + \gamma\mathbf{I})^{-1}\mathbf{p} \f$ y evita la deriva de los
+ *   coeficientes con entradas poco excitadas
+ *
+ * \section fusion_lms Filtrado y actualización fusionados
+ *
+ * Una implementación directa recorre la línea de retardo dos veces por muestra: una para
+ * calcular y[n] y otra para actualizar los coeficientes. Aquí la actualización de la muestra
+ * n-1 se aplica en el mismo bucle que calcula y[n]:
+ * \f[
+ * w_i \leftarrow \alpha\,w_i + g[n-1]\,x[n-1-i],\qquad y[n] \mathrel{+}= w_i\,x[n-i]
+ * \f]
+ * El resultado es idéntico al del LMS clásico, pero la línea de retardo y los coeficientes se
+ * leen una sola vez por muestra. La norma \f$ \|\mathbf{x}_n\|^2 \f$ del NLMS se acumula en el
+ * mismo bucle, sin recursiones que acumulen error.
+ *
+ * Para que el bucle sea vectorizable, la línea de retardo se escribe en sentido descendente
+ * sobre un anillo de N muestras con copia espejo (LMS_RETARDO(N) = 2N floats): p_write apunta
+ * a x[n] y las ventanas \f$ \mathbf{x}_n \f$ y \f$ \mathbf{x}_{n-1} \f$ son siempre contiguas
+ * (p_write[0..N-1] y p_write[1..N]). El bucle reparte las sumas en LMS_CARRILES acumuladores
+ * parciales independientes, que el compilador asigna a registros SIMD sin necesidad de
+ * reordenar operaciones en coma flotante.
+ *
+ * Como la actualización queda pendiente hasta la muestra siguiente, pcoef contiene
+ * \f$ \mathbf{w}_n \f$ (los coeficientes usados en la última salida). sincroniza_lms aplica la
+ * actualización pendiente cuando se necesitan los coeficientes \f$ \mathbf{w}_{n+1} \f$.
+ *
+ * \section uso_lms Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_LMS() (llamado automáticamente por Init_NSDSP())
+ * 2. Crear el filtro con lms_api.get_lms() sobre un buffer de coeficientes iniciales y una
+ *    línea de retardo de LMS_RETARDO(N) floats
+ * 3. Filtrar y adaptar muestra a muestra con lms_filter() o por bloques con lms_bloque()
+ *
+ * Ejemplo de uso:
+ * \code
+ * #include "lms_filter.h"
+ *
+ * static float w[64];                     // Coeficientes iniciales (a cero)
+ * static float z[LMS_RETARDO(64)];
+ * static LMS_OBJECT canceller;
+ *
+ * void inicio(void) {
+ *     lms_api.get_lms(64, w, z, LMS_NORMALIZADO, 0.5f, 1e-6f, &canceller);
+ * }
+ *
+ * float muestra(float referencia, float microfono) {
+ *     lms_api.lms_filter(referencia, microfono, &canceller);
+ *     return canceller.error;                // Señal sin el eco estimado
+ * }
+ * \endcode
+ *
+ * \section funciones_lms Descripción de funciones
+ *
+ * \subsection init_lms_func Init_LMS
+ * Inicializa la estructura de punteros a funciones lms_api.
+ *
+ * \subsection get_lms_func get_lms
+ * Crea el filtro adaptativo sobre el FIR_FILTER_OBJECT devuelto por fir_api.get_fir y limpia la
+ * línea de retardo. Los coeficientes de pcoef se conservan como punto de partida. Requiere que
+ * Init_Fir() se haya llamado.
+ * \param ncoef Número de coeficientes N (> 0)
+ * \param pcoef Coeficientes iniciales, adaptados in situ (N floats)
+ * \param pz Línea de retardo de LMS_RETARDO(N) floats
+ * \param tipo LMS_ESTANDAR, LMS_NORMALIZADO o LMS_FUGAS
+ * \param mu Paso de adaptación (> 0)
+ * \param parametro \f$ \epsilon \f$ (>= 0) en LMS_NORMALIZADO, \f$ \gamma \f$ (>= 0, \f$ \mu\gamma < 1 \f$)
+ *        en LMS_FUGAS; se ignora en LMS_ESTANDAR
+ * \param plms Objeto a inicializar
+ * \return LMS_OK (0) si éxito, LMS_KO (-1) si error
+ *
+ * \subsection lms_filter_func lms_filter
+ * Filtra una muestra y adapta los coeficientes. Misma semántica que fir_api.fir_filter con la
+ * señal deseada como parámetro adicional; el error a priori queda en plms->error.
+ * \param xn Muestra de entrada x[n]
+ * \param dn Muestra deseada d[n]
+ * \param plms Objeto filtro
+ * \return Salida y[n], o 0.0 si error
+ *
+ * \subsection lms_bloque_func lms_bloque
+ * Procesa un bloque de muestras. y y e pueden ser NULL si no se necesitan, y pueden coincidir
+ * con x o d para trabajar in-place.
+ * \param x Muestras de entrada
+ * \param d Muestras deseadas
+ * \param y Salidas del filtro (o NULL)
+ * \param e Errores a priori (o NULL)
+ * \param nmuestras Número de muestras
+ * \param plms Objeto filtro
+ * \return LMS_OK (0) si éxito, LMS_KO (-1) si error
+ *
+ * \subsection sincroniza_lms_func sincroniza_lms
+ * Aplica la actualización pendiente para que pcoef contenga los coeficientes de la muestra
+ * siguiente. El filtrado posterior continúa sin diferencias.
+ * \param plms Objeto filtro
+ * \return LMS_OK (0) si éxito, LMS_KO (-1) si error
+ *
+ * \dot
+ * digraph lms_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[n]", shape=plaintext];
+ *   D [label="d[n]", shape=plaintext];
+ *   Z [label="Anillo espejo\n(escritura descendente)", fillcolor=lightyellow];
+ *   LOOP [label="Bucle fusionado:\nw = αw + g·x[n-1-i]\ny += w·x[n-i]\n|x|² += x[n-i]²", fillcolor=lightcyan];
+ *   E [label="e = d - y", shape=circle, fillcolor=lightyellow];
+ *   G [label="g = μe\n(/(ε+|x|²) en NLMS)", fillcolor=lightblue];
+ *   Y [label="y[n]", shape=plaintext];
+ *
+ *   X -> Z -> LOOP -> E;
+ *   D -> E;
+ *   LOOP -> Y;
+ *   E -> G;
+ *   G -> LOOP [label="muestra n+1", style=dashed];
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_lms_filter Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: LMS, NLMS y LMS con fugas con filtrado y actualización fusionados |
+ *
+ * \copyright ZGR R&D AIE
+ */
 
+#include "lms_filter.h"
+
+/* Declaración de funciones */
+void Init_LMS(void);
+int Get_LMS(unsigned int ncoef, float *pcoef, float *pz, LMS_TIPO tipo, float mu, float parametro,
+            LMS_OBJECT *plms);
+float LMS_Filter(float xn, float dn, LMS_OBJECT *plms);
+int LMS_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, LMS_OBJECT *plms);
+int Sincroniza_LMS(LMS_OBJECT *plms);
+static float paso_lms(float xn, float dn, LMS_OBJECT *plms);
+static float fusion_lms(float *restrict pw, const float *restrict px, unsigned int m, float a, float g,
+                        float *energia);
+
+/* Atributos */
+LMS_API lms_api;
+
+/* Definición de funciones */
+
+void Init_LMS(void)
+{
+    /* Inicializar punteros de la API */
+    lms_api.get_lms = Get_LMS;
+    lms_api.lms_filter = LMS_Filter;
+    lms_api.lms_bloque = LMS_Bloque;
+    lms_api.sincroniza_lms = Sincroniza_LMS;
+}
+
+int Get_LMS(unsigned int ncoef, float *pcoef, float *pz, LMS_TIPO tipo, float mu, float parametro,
+            LMS_OBJECT *plms)
+{
+    unsigned int i;
+
+    if (plms == NULL || pcoef == NULL || pz == NULL || ncoef == 0 || !(mu > 0.0f))
+    {
+        return LMS_KO;
+    }
+
+    switch (tipo)
+    {
+        case LMS_ESTANDAR:
+            plms->epsilon = 0.0f;
+            plms->retencion = 1.0f;
+            break;
+
+        case LMS_NORMALIZADO:
+            if (!(parametro >= 0.0f))
+            {
+                return LMS_KO;
+            }
+            plms->epsilon = parametro;
+            plms->retencion = 1.0f;
+            break;
+
+        case LMS_FUGAS:
+            if (!(parametro >= 0.0f) || !(mu * parametro < 1.0f))
+            {
+                return LMS_KO;
+            }
+            plms->epsilon = 0.0f;
+            plms->retencion = 1.0f - mu * parametro;
+            break;
+
+        default:
+            return LMS_KO;
+    }
+
+    /* El anillo es el de fir_filter; la copia espejo se limpia aparte */
+    plms->fir = fir_api.get_fir(ncoef, pcoef, pz);
+    for (i = ncoef; i < LMS_RETARDO(ncoef); i++)
+    {
+        pz[i] = 0.0f;
+    }
+
+    plms->tipo = tipo;
+    plms->mu = mu;
+    plms->error = 0.0f;
+    plms->ganancia = 0.0f;
+    plms->factor = 1.0f;
+
+    return LMS_OK;
+}
+
+float LMS_Filter(float xn, float dn, LMS_OBJECT *plms)
+{
+    if (plms == NULL || plms->fir.pz == NULL)
+    {
+        return 0.0f;
+    }
+
+    return paso_lms(xn, dn, plms);
+}
+
+int LMS_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, LMS_OBJECT *plms)
+{
+    unsigned int i;
+    float yn;
+
+    if (plms == NULL || plms->fir.pz == NULL || (nmuestras > 0 && (x == NULL || d == NULL)))
+    {
+        return LMS_KO;
+    }
+
+    for (i = 0; i < nmuestras; i++)
+    {
+        yn = paso_lms(x[i], d[i], plms);
+
+        if (y != NULL)
+        {
+            y[i] = yn;
+        }
+        if (e != NULL)
+        {
+            e[i] = plms->error;
+        }
+    }
+
+    return LMS_OK;
+}
+
+int Sincroniza_LMS(LMS_OBJECT *plms)
+{
+    unsigned int i, n;
+    float *pw, *px;
+
+    if (plms == NULL || plms->fir.pz == NULL)
+    {
+        return LMS_KO;
+    }
+
+    /* La actualización pendiente usa la ventana x_n, que sigue completa en el anillo */
+    n = plms->fir.ncoef;
+    pw = plms->fir.pcoef;
+    px = plms->fir.p_write;
+    for (i = 0; i < n; i++)
+    {
+        pw[i] = plms->factor * pw[i] + plms->ganancia * px[i];
+    }
+
+    plms->ganancia = 0.0f;
+    plms->factor = 1.0f;
+
+    return LMS_OK;
+}
+
+static float paso_lms(float xn, float dn, LMS_OBJECT *plms)
+{
+    unsigned int n, m;
+    float *pw, *px;
+    float x_old, w, y, energia, e;
+
+    n = plms->fir.ncoef;
+    pw = plms->fir.pcoef;
+
+    /* Escritura descendente en el anillo y su espejo: tras escribir, x[n-i] = px[i] para i = 0..N */
+    px = (plms->fir.p_write == plms->fir.pz) ? plms->fir.pz + n - 1 : plms->fir.p_write - 1;
+    x_old = px[0];
+    px[0] = xn;
+    px[n] = xn;
+    plms->fir.p_write = px;
+
+    /* px[N] ya contiene x[n], por lo que el último coeficiente se trata fuera del bucle */
+    m = n - 1;
+    y = fusion_lms(pw, px, m, plms->factor, plms->ganancia, &energia);
+
+    w = plms->factor * pw[m] + plms->ganancia * x_old;
+    pw[m] = w;
+    y += w * px[m];
+    energia += px[m] * px[m];
+
+    /* Actualización de esta muestra, pendiente hasta la siguiente */
+    e = dn - y;
+    plms->error = e;
+    plms->factor = plms->retencion;
+
+    if (plms->tipo == LMS_NORMALIZADO)
+    {
+        /* Sin regularización, una ventana nula no aporta dirección de actualización */
+        plms->ganancia = (plms->epsilon + energia > 0.0f) ? plms->mu * e / (plms->epsilon + energia) : 0.0f;
+    }
+    else
+    {
+        plms->ganancia = plms->mu * e;
+    }
+
+    return y;
+}
+
+static float fusion_lms(float *restrict pw, const float *restrict px, unsigned int m, float a, float g,
+                        float *energia)
+{
+    unsigned int i, j;
+    float w, y, potencia_total;
+    float acumulador[LMS_CARRILES], potencia[LMS_CARRILES];
+
+    for (j = 0; j < LMS_CARRILES; j++)
+    {
+        acumulador[j] = 0.0f;
+        potencia[j] = 0.0f;
+    }
+
+    /* Bucle fusionado sobre los m primeros coeficientes: w_n = a w_{n-1} + g x_{n-1} e
+     * y[n] = w_n x_n en una sola lectura, con un acumulador parcial por carril */
+    for (i = m / LMS_CARRILES; i > 0; i--)
+    {
+        for (j = 0; j < LMS_CARRILES; j++)
+        {
+            w = a * pw[j] + g * px[j + 1];
+            pw[j] = w;
+            acumulador[j] += w * px[j];
+            potencia[j] += px[j] * px[j];
+        }
+        pw += LMS_CARRILES;
+        px += LMS_CARRILES;
+    }
+
+    y = 0.0f;
+    potencia_total = 0.0f;
+    for (i = 0; i < m % LMS_CARRILES; i++)
+    {
+        w = a * pw[i] + g * px[i + 1];
+        pw[i] = w;
+        y += w * px[i];
+        potencia_total += px[i] * px[i];
+    }
+
+    for (j = 0; j < LMS_CARRILES; j++)
+    {
+        y += acumulador[j];
+        potencia_total += potencia[j];
+    }
+
+    *energia = potencia_total;
+    return y;
+}
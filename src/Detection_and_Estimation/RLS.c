@@ -0,0 +1,475 @@
+/** \page rls RLS - MÍNIMOS CUADRADOS RECURSIVOS
+ * \brief Módulo de filtros adaptativos RLS (QR inverso y celosía) para la librería NSDSP
+ *
+ * Este módulo implementa filtros adaptativos de mínimos cuadrados recursivos para plantas no
+ * estacionarias en las que el LMS converge demasiado despacio. El RLS minimiza la suma de
+ * errores ponderada exponencialmente \f$ \sum_k \lambda^{n-k} e^2[k] \f$ y su convergencia no
+ * depende de la dispersión de autovalores de la entrada. Se ofrecen dos formas:
+ * - RLS por QR inverso: O(N²) por muestra, numéricamente estable y con coeficientes
+ *   transversales explícitos
+ * - RLS en celosía (LSL) con estimación conjunta: O(N) por muestra, para órdenes altos
+ *
+ * \section teoria_qr_rls RLS por QR inverso
+ *
+ * El RLS convencional propaga la inversa de la matriz de correlación P(n) con una
+ * actualización de Riccati que, en precisión simple, pierde la simetría y la definición
+ * positiva de P con el tiempo. El QR inverso propaga un factor \f$ P = U^T U \f$ con
+ * rotaciones de Givens, que son ortogonales y no amplifican los errores de redondeo. En cada
+ * muestra se anulan con rotaciones las componentes del vector \f$ \mathbf{a} \f$ del pre-array:
+ * \f[
+ * \begin{bmatrix} 1 & \mathbf{a}^T \\ \mathbf{0} & \lambda^{-1/2} U^T(n-1) \end{bmatrix} \Theta =
+ * \begin{bmatrix} \gamma^{-1/2} & \mathbf{0}^T \\ \mathbf{g}\,\gamma^{-1/2} & U^T(n) \end{bmatrix},
+ * \qquad \mathbf{a} = \lambda^{-1/2} U(n-1)\,\mathbf{x}_n
+ * \f]
+ * y los coeficientes se actualizan con la ganancia de Kalman y el error a priori:
+ * \f[
+ * \xi[n] = d[n] - \mathbf{w}^T(n-1)\mathbf{x}_n,\qquad
+ * \mathbf{w}(n) = \mathbf{w}(n-1) + \frac{\mathbf{g}\,\gamma^{-1/2}}{\gamma^{-1/2}}\,\xi[n]
+ * \f]
+ * Las rotaciones se aplican de la última componente a la primera, de modo que U se mantiene
+ * triangular superior y el coste es de unas 3N² operaciones por muestra. La inicialización es
+ * \f$ P(0) = \delta^{-1} I \f$.
+ *
+ * \section teoria_lattice_rls RLS en celosía
+ *
+ * La celosía resuelve recursivamente en orden los problemas de predicción hacia delante y
+ * hacia atrás de órdenes 0..N-1. Los errores de predicción hacia atrás \f$ b_m(n) \f$ son una
+ * base ortogonal del espacio de la entrada, y la señal deseada se estima sobre ellos etapa a
+ * etapa (estimación conjunta). Con errores a posteriori, para m = 0..N-1:
+ * \f[
+ * \Delta_m(n) = \lambda\Delta_m(n-1) + \frac{b_m(n-1)\,f_m(n)}{\gamma_m(n-1)},\qquad
+ * f_{m+1}(n) = f_m(n) - \frac{\Delta_m(n)}{B_m(n-1)}\,b_m(n-1),\qquad
+ * b_{m+1}(n) = b_m(n-1) - \frac{\Delta_m(n)}{F_m(n)}\,f_m(n)
+ * \f]
+ * \f[
+ * F_{m+1}(n) = F_m(n) - \frac{\Delta_m^2(n)}{B_m(n-1)},\qquad
+ * B_{m+1}(n) = B_m(n-1) - \frac{\Delta_m^2(n)}{F_m(n)},\qquad
+ * \gamma_{m+1}(n) = \gamma_m(n) - \frac{b_m^2(n)}{B_m(n)}
+ * \f]
+ * \f[
+ * \rho_m(n) = \lambda\rho_m(n) + \frac{b_m(n)\,e_m(n)}{\gamma_m(n)},\qquad
+ * e_{m+1}(n) = e_m(n) - \frac{\rho_m(n)}{B_m(n)}\,b_m(n)
+ * \f]
+ * con \f$ f_0 = b_0 = x[n] \f$, \f$ F_0(n) = B_0(n) = \lambda F_0(n-1) + x^2[n] \f$,
+ * \f$ \gamma_0 = 1 \f$ y \f$ e_0 = d[n] \f$. El error a priori es \f$ e_N(n)/\gamma_N(n) \f$,
+ * idéntico al del RLS transversal de N coeficientes. El estado por etapa son cinco escalares,
+ * todos preasignados; el filtro no expone coeficientes transversales.
+ *
+ * Las energías y los factores de conversión se mantienen positivos por construcción en
+ * aritmética exacta; en precisión simple se acotan inferiormente para que una etapa mal
+ * condicionada no propague divisiones por cero.
+ *
+ * \section uso_rls Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_RLS() (llamado automáticamente por Init_NSDSP())
+ * 2. Crear el filtro con rls_api.get_qr() (workspace de RLS_QR_WORKSPACE(N) floats) o con
+ *    rls_api.get_lattice() (workspace de RLS_LATTICE_WORKSPACE(N) floats)
+ * 3. Filtrar y adaptar muestra a muestra o por bloques
+ *
+ * Ejemplo de uso:
+ * \code
+ * #include "rls.h"
+ *
+ * static float w[16];
+ * static float ws_qr[RLS_QR_WORKSPACE(16)];
+ * static float ws_lattice[RLS_LATTICE_WORKSPACE(256)];
+ * static RLS_QR_OBJECT planta;
+ * static RLS_LATTICE_OBJECT canal;
+ *
+ * void inicio(void) {
+ *     rls_api.get_qr(16, 0.99f, 1e-2f, w, ws_qr, &planta);            // Coeficientes en w
+ *     rls_api.get_lattice(256, 0.999f, 1e-2f, ws_lattice, &canal);    // Orden alto, O(N)
+ * }
+ *
+ * void muestra(float x, float d) {
+ *     rls_api.qr_filter(x, d, &planta);
+ *     rls_api.lattice_filter(x, d, &canal);
+ * }
+ * \endcode
+ *
+ * \section funciones_rls Descripción de funciones
+ *
+ * \subsection init_rls_func Init_RLS
+ * Inicializa la estructura de punteros a funciones rls_api.
+ *
+ * \subsection get_qr_rls_func get_qr
+ * Crea un RLS por QR inverso. Los coeficientes de pcoef se conservan como punto de partida.
+ * \param ncoef Número de coeficientes N (> 0)
+ * \param lambda Factor de olvido, en (0, 1]
+ * \param delta Regularización inicial, P(0) = I / delta (> 0)
+ * \param pcoef Coeficientes, adaptados in situ (N floats)
+ * \param workspace Buffer de RLS_QR_WORKSPACE(N) floats
+ * \param prls Objeto a inicializar
+ * \return RLS_OK (0) si éxito, RLS_KO (-1) si error
+ *
+ * \subsection qr_filter_rls_func qr_filter / lattice_filter
+ * Filtran una muestra con los coeficientes anteriores y adaptan el filtro. El error a priori
+ * queda en prls->error.
+ * \param xn Muestra de entrada x[n]
+ * \param dn Muestra deseada d[n]
+ * \param prls Objeto filtro
+ * \return Salida a priori y[n], o 0.0 si error
+ *
+ * \subsection qr_bloque_rls_func qr_bloque / lattice_bloque
+ * Procesan un bloque de muestras. y y e pueden ser NULL si no se necesitan.
+ * \param x Muestras de entrada
+ * \param d Muestras deseadas
+ * \param y Salidas a priori (o NULL)
+ * \param e Errores a priori (o NULL)
+ * \param nmuestras Número de muestras
+ * \param prls Objeto filtro
+ * \return RLS_OK (0) si éxito, RLS_KO (-1) si error
+ *
+ * \subsection get_lattice_rls_func get_lattice
+ * Crea un RLS en celosía de N etapas con las energías iniciales a delta.
+ * \param orden Número de etapas N (> 0)
+ * \param lambda Factor de olvido, en (0, 1]
+ * \param delta Energía inicial de predicción (> 0)
+ * \param workspace Buffer de RLS_LATTICE_WORKSPACE(N) floats
+ * \param prls Objeto a inicializar
+ * \return RLS_OK (0) si éxito, RLS_KO (-1) si error
+ *
+ * \dot
+ * digraph rls_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[n], d[n]", shape=plaintext];
+ *   SEL [label="Orden y coste", shape=diamond, fillcolor=lightyellow];
+ *   QR [label="QR inverso\nGivens sobre U\nO(N²)", fillcolor=lightblue];
+ *   W [label="w(n) explícitos", fillcolor=lightcyan];
+ *   LAT [label="Celosía\nf_m, b_m, Δ_m, ρ_m\nO(N)", fillcolor=lightpink];
+ *   E [label="ξ[n] a priori", shape=plaintext];
+ *
+ *   X -> SEL;
+ *   SEL -> QR [label="N pequeño"];
+ *   SEL -> LAT [label="N grande"];
+ *   QR -> W -> E;
+ *   LAT -> E;
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_rls Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: RLS por QR inverso y RLS en celosía |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "rls.h"
+#include <stddef.h>
+#include <math.h>
+
+/* Cota inferior de energías y factores de conversión en la celosía */
+#define RLS_MINIMO          1e-30f
+
+/* Declaración de funciones */
+void Init_RLS(void);
+int Get_QR_RLS(unsigned int ncoef, float lambda, float delta, float *pcoef, float *workspace, RLS_QR_OBJECT *prls);
+float QR_RLS_Filter(float xn, float dn, RLS_QR_OBJECT *prls);
+int QR_RLS_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, RLS_QR_OBJECT *prls);
+int Get_Lattice_RLS(unsigned int orden, float lambda, float delta, float *workspace, RLS_LATTICE_OBJECT *prls);
+float Lattice_RLS_Filter(float xn, float dn, RLS_LATTICE_OBJECT *prls);
+int Lattice_RLS_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras,
+                       RLS_LATTICE_OBJECT *prls);
+static float paso_qr_rls(float xn, float dn, RLS_QR_OBJECT *prls);
+static float paso_lattice_rls(float xn, float dn, RLS_LATTICE_OBJECT *prls);
+
+/* Atributos */
+RLS_API rls_api;
+
+/* Definición de funciones */
+
+void Init_RLS(void)
+{
+    /* Inicializar punteros de la API */
+    rls_api.get_qr = Get_QR_RLS;
+    rls_api.qr_filter = QR_RLS_Filter;
+    rls_api.qr_bloque = QR_RLS_Bloque;
+    rls_api.get_lattice = Get_Lattice_RLS;
+    rls_api.lattice_filter = Lattice_RLS_Filter;
+    rls_api.lattice_bloque = Lattice_RLS_Bloque;
+}
+
+int Get_QR_RLS(unsigned int ncoef, float lambda, float delta, float *pcoef, float *workspace, RLS_QR_OBJECT *prls)
+{
+    unsigned int i, total;
+    float diagonal;
+
+    if (prls == NULL || pcoef == NULL || workspace == NULL || ncoef == 0 ||
+        !(lambda > 0.0f && lambda <= 1.0f) || !(delta > 0.0f))
+    {
+        return RLS_KO;
+    }
+
+    prls->ncoef = ncoef;
+    prls->lambda = lambda;
+    prls->escala = 1.0f / sqrtf(lambda);
+    prls->raiz.filas = ncoef;
+    prls->raiz.columnas = ncoef;
+    prls->raiz.pmatriz = workspace;
+    prls->regresor = &workspace[ncoef * ncoef];
+    prls->ganancia = &workspace[ncoef * ncoef + ncoef];
+    prls->pcoef = pcoef;
+    prls->error = 0.0f;
+
+    /* U(0) = delta^(-1/2) I y regresor nulo */
+    total = RLS_QR_WORKSPACE(ncoef);
+    for (i = 0; i < total; i++)
+    {
+        workspace[i] = 0.0f;
+    }
+
+    diagonal = 1.0f / sqrtf(delta);
+    for (i = 0; i < ncoef; i++)
+    {
+        workspace[i * ncoef + i] = diagonal;
+    }
+
+    return RLS_OK;
+}
+
+float QR_RLS_Filter(float xn, float dn, RLS_QR_OBJECT *prls)
+{
+    if (prls == NULL || prls->raiz.pmatriz == NULL)
+    {
+        return 0.0f;
+    }
+
+    return paso_qr_rls(xn, dn, prls);
+}
+
+int QR_RLS_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, RLS_QR_OBJECT *prls)
+{
+    unsigned int i;
+    float yn;
+
+    if (prls == NULL || prls->raiz.pmatriz == NULL || (nmuestras > 0 && (x == NULL || d == NULL)))
+    {
+        return RLS_KO;
+    }
+
+    for (i = 0; i < nmuestras; i++)
+    {
+        yn = paso_qr_rls(x[i], d[i], prls);
+
+        if (y != NULL)
+        {
+            y[i] = yn;
+        }
+        if (e != NULL)
+        {
+            e[i] = prls->error;
+        }
+    }
+
+    return RLS_OK;
+}
+
+int Get_Lattice_RLS(unsigned int orden, float lambda, float delta, float *workspace, RLS_LATTICE_OBJECT *prls)
+{
+    unsigned int m;
+
+    if (prls == NULL || workspace == NULL || orden == 0 || !(lambda > 0.0f && lambda <= 1.0f) || !(delta > 0.0f))
+    {
+        return RLS_KO;
+    }
+
+    prls->orden = orden;
+    prls->lambda = lambda;
+    prls->energia = delta;
+    prls->delta = workspace;
+    prls->rho = &workspace[orden];
+    prls->b_ant = &workspace[2 * orden];
+    prls->energia_b = &workspace[3 * orden];
+    prls->gamma = &workspace[4 * orden];
+    prls->error = 0.0f;
+
+    /* Estado inicial: errores y correlaciones nulos, energías delta y conversión unidad */
+    for (m = 0; m < orden; m++)
+    {
+        prls->delta[m] = 0.0f;
+        prls->rho[m] = 0.0f;
+        prls->b_ant[m] = 0.0f;
+        prls->energia_b[m] = delta;
+        prls->gamma[m] = 1.0f;
+    }
+
+    return RLS_OK;
+}
+
+float Lattice_RLS_Filter(float xn, float dn, RLS_LATTICE_OBJECT *prls)
+{
+    if (prls == NULL || prls->delta == NULL)
+    {
+        return 0.0f;
+    }
+
+    return paso_lattice_rls(xn, dn, prls);
+}
+
+int Lattice_RLS_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras,
+                       RLS_LATTICE_OBJECT *prls)
+{
+    unsigned int i;
+    float yn;
+
+    if (prls == NULL || prls->delta == NULL || (nmuestras > 0 && (x == NULL || d == NULL)))
+    {
+        return RLS_KO;
+    }
+
+    for (i = 0; i < nmuestras; i++)
+    {
+        yn = paso_lattice_rls(x[i], d[i], prls);
+
+        if (y != NULL)
+        {
+            y[i] = yn;
+        }
+        if (e != NULL)
+        {
+            e[i] = prls->error;
+        }
+    }
+
+    return RLS_OK;
+}
+
+static float paso_qr_rls(float xn, float dn, RLS_QR_OBJECT *prls)
+{
+    unsigned int i, j, n;
+    float *U, *u, *v, *w;
+    float y, xi, c0, a, r, c, s, t1, t2, escala;
+
+    n = prls->ncoef;
+    U = prls->raiz.pmatriz;
+    u = prls->regresor;
+    v = prls->ganancia;
+    w = prls->pcoef;
+    escala = prls->escala;
+
+    /* Regresor x_n y error a priori con los coeficientes w(n-1) */
+    for (i = n - 1; i > 0; i--)
+    {
+        u[i] = u[i - 1];
+    }
+    u[0] = xn;
+
+    y = 0.0f;
+    for (i = 0; i < n; i++)
+    {
+        y += w[i] * u[i];
+        v[i] = 0.0f;
+    }
+    xi = dn - y;
+
+    /* Rotaciones de Givens de la última componente de a a la primera: la fila j de U solo tiene
+     * elementos en las columnas j..N-1 y la ganancia solo se ha rellenado en esas posiciones */
+    c0 = 1.0f;
+    for (j = n; j-- > 0;)
+    {
+        a = 0.0f;
+        for (i = j; i < n; i++)
+        {
+            a += U[j * n + i] * u[i];
+        }
+        a *= escala;
+
+        r = sqrtf(c0 * c0 + a * a);
+        c = c0 / r;
+        s = a / r;
+        c0 = r;
+
+        for (i = j; i < n; i++)
+        {
+            t1 = v[i];
+            t2 = escala * U[j * n + i];
+            v[i] = c * t1 + s * t2;
+            U[j * n + i] = c * t2 - s * t1;
+        }
+    }
+
+    /* w(n) = w(n-1) + g xi, con g = (g gamma^(-1/2)) / gamma^(-1/2) */
+    xi /= c0;
+    for (i = 0; i < n; i++)
+    {
+        w[i] += v[i] * xi;
+    }
+
+    prls->error = dn - y;
+
+    return y;
+}
+
+static float paso_lattice_rls(float xn, float dn, RLS_LATTICE_OBJECT *prls)
+{
+    unsigned int m, M;
+    float lambda, f, b, F, B, gamma, e, delta, f_sig, b_sig, F_sig, B_sig, gamma_sig;
+
+    M = prls->orden;
+    lambda = prls->lambda;
+
+    /* Orden 0: f_0 = b_0 = x[n], F_0 = B_0 = lambda F_0 + x^2 */
+    prls->energia = lambda * prls->energia + xn * xn;
+    f = xn;
+    b = xn;
+    F = prls->energia;
+    B = prls->energia;
+    gamma = 1.0f;
+    e = dn;
+
+    for (m = 0; m < M; m++)
+    {
+        /* Estimación conjunta sobre el error hacia atrás b_m(n) */
+        prls->rho[m] = lambda * prls->rho[m] + b * e / gamma;
+        e -= (prls->rho[m] / B) * b;
+        gamma_sig = gamma - b * b / B;
+        if (gamma_sig < RLS_MINIMO)
+        {
+            gamma_sig = RLS_MINIMO;
+        }
+
+        /* Actualización en orden de la predicción con b_m(n-1), B_m(n-1) y gamma_m(n-1) */
+        f_sig = 0.0f;
+        b_sig = 0.0f;
+        F_sig = RLS_MINIMO;
+        B_sig = RLS_MINIMO;
+        if (m + 1 < M)
+        {
+            delta = lambda * prls->delta[m] + prls->b_ant[m] * f / prls->gamma[m];
+            prls->delta[m] = delta;
+            f_sig = f - (delta / prls->energia_b[m]) * prls->b_ant[m];
+            b_sig = prls->b_ant[m] - (delta / F) * f;
+            F_sig = F - delta * delta / prls->energia_b[m];
+            B_sig = prls->energia_b[m] - delta * delta / F;
+            if (F_sig < RLS_MINIMO)
+            {
+                F_sig = RLS_MINIMO;
+            }
+            if (B_sig < RLS_MINIMO)
+            {
+                B_sig = RLS_MINIMO;
+            }
+        }
+
+        prls->b_ant[m] = b;
+        prls->energia_b[m] = B;
+        prls->gamma[m] = gamma;
+
+        f = f_sig;
+        b = b_sig;
+        F = F_sig;
+        B = B_sig;
+        gamma = gamma_sig;
+    }
+
+    /* Error a priori: el a posteriori de orden N dividido por el factor de conversión */
+    prls->error = e / gamma;
+
+    return dn - prls->error;
+}
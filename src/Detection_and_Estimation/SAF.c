@@ -0,0 +1,390 @@
+/** \page saf SAF - FILTROS ADAPTATIVOS EN SUBBANDAS
+ * \brief Módulo de filtros adaptativos en subbandas sobre el banco de análisis DWT para la librería NSDSP
+ *
+ * Este módulo implementa un filtro adaptativo en subbandas de estructura multibanda (MSAF). El
+ * NLMS en banda completa converge despacio con entradas coloreadas porque su velocidad la fija el
+ * modo más lento de la matriz de correlación, es decir, la banda de menor potencia. El MSAF
+ * mantiene un único filtro en banda completa, pero lo adapta con los errores de las subbandas
+ * DWT normalizados cada uno con la potencia de su banda, de modo que las bandas de poca
+ * potencia convergen tan deprisa como las de mucha.
+ *
+ * \section teoria_saf Estructura
+ *
+ * Las bandas son las de la DWT de dwt.h (Lagrange, Db4 o Db8, WAVELET_LEVELS niveles): la banda
+ * b tiene como filtro equivalente la cascada de las ramas del árbol de Mallat,
+ * \f[
+ * H_b(z) = H_1\left(z^{2^b}\right) \prod_{i<b} H_0\left(z^{2^i}\right),\qquad
+ * H_L(z) = \prod_{i<L} H_0\left(z^{2^i}\right)
+ * \f]
+ * de \f$ (D_b - 1)(L_f - 1) + 1 \f$ coeficientes, con \f$ D_b \f$ la decimación de la banda
+ * (SAF_DECIMACION) y \f$ L_f \f$ la longitud de los filtros de la DWT. La referencia x[n] se
+ * filtra con \f$ H_b \f$ a tasa completa, y la muestra \f$ x_b[n] \f$ coincide con la que
+ * entrega Dwt para la banda b cuando n es múltiplo de \f$ D_b \f$. La deseada d[n] se analiza con
+ * un objeto DWT (Get_DWT/Dwt). Cada \f$ P = 2^L \f$ muestras (SAF_PERIODO) todas las bandas de la
+ * DWT tienen muestra nueva, y el filtro \f$ \mathbf{w} \f$ de N coeficientes se adapta con
+ * \f[
+ * e_b = d_b[n] - \mathbf{w}^T \mathbf{x}_b[n],\qquad
+ * \mathbf{w} \leftarrow \mathbf{w} + \mu \sum_b \frac{e_b}{\epsilon + \|\mathbf{x}_b[n]\|^2}\,\mathbf{x}_b[n]
+ * \f]
+ * donde \f$ \mathbf{x}_b[n] \f$ son las N últimas muestras de la banda. La salida es la del filtro
+ * en banda completa, \f$ y[n] = \mathbf{w}^T \mathbf{x}[n] \f$, sin banco de síntesis ni latencia.
+ *
+ * Como el camino desconocido h es lineal, \f$ d_b = h * x_b \f$ y w = h anula a la vez todos los
+ * errores de banda: el filtro se aplica a las bandas sin decimar, por lo que el aliasing del
+ * banco de muestreo crítico no limita la precisión y el error final es el del NLMS. La
+ * decimación solo reduce la frecuencia de adaptación. La actualización combina las direcciones
+ * de las L + 1 bandas, casi ortogonales entre sí, y equivale a blanquear la entrada a nivel de
+ * banda.
+ *
+ * El coste por muestra de entrada, en multiplicaciones-suma, es
+ * \f[
+ * C_{SAF} \approx N + \frac{2 (L + 1) N}{2^L} + \sum_b \left((D_b - 1)(L_f - 1) + 1\right) + C_{DWT}
+ * \f]
+ * (salida en banda completa, producto y actualización de cada banda cada \f$ 2^L \f$ muestras,
+ * filtros de análisis de la referencia y DWT de la deseada): unas 2.5 N con L = 2 y 2 N con
+ * L = 3, frente a 3 N del NLMS (producto, potencia y actualización en cada muestra). La energía
+ * de la ventana de cada banda se actualiza de forma recursiva en doble precisión, sumando la
+ * muestra que entra y restando la que sale. Los productos escalares usan SAF_CARRILES
+ * acumuladores parciales, dos vectores SIMD, para no quedar limitados por la latencia de la
+ * suma. La ventaja principal del SAF es, en todo caso, el número de muestras que necesita para
+ * converger con entradas coloreadas.
+ *
+ * \section limitaciones_saf Limitaciones
+ *
+ * Los filtros de análisis equivalentes se aplican con fir_filter, por lo que la banda más larga,
+ * SAF_LONGITUD_BANDA(WAVELET_LEVELS) = \f$ (2^L - 1)(L_f - 1) + 1 \f$, no puede superar
+ * MAX_FIR_LENGTH; get_saf devuelve SAF_KO en otro caso.
+ *
+ * \section uso_saf Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_SAF() (llamado automáticamente por Init_NSDSP(), junto con Init_Fir()
+ *    e Init_DWT())
+ * 2. Crear el filtro con saf_api.get_saf() sobre un workspace de SAF_WORKSPACE(N) floats
+ * 3. Filtrar y adaptar muestra a muestra o por bloques
+ *
+ * Ejemplo de uso:
+ * \code
+ *  * #include "saf.h"
+ *
+ * static float workspace[SAF_WORKSPACE(512)];
+ * static SAF_OBJECT eco;
+ *
+ * void inicio(void) {
+ *     saf_api.get_saf(512, 0.5f, 1e-3f, workspace, &eco);
+ * }
+ *
+ * void muestra(float x, float d) {
+ *     saf_api.saf_filter(x, d, &eco);      // eco.error: error a priori e[n] = d[n] - y[n]
+ *                                          // eco.error_banda[b]: error de cada banda en la última adaptación
+ * }
+ * \endcode
+ *
+ * \section funciones_saf Descripción de funciones
+ *
+ * \subsection init_saf_func Init_SAF
+ * Inicializa la estructura de punteros a funciones saf_api.
+ *
+ * \subsection get_saf_func get_saf
+ * Crea el filtro: coeficientes nulos, filtros de análisis equivalentes a partir de los de la
+ * DWT y un objeto DWT para la deseada.
+ * \param ncoef Coeficientes del camino en banda completa (> 0)
+ * \param mu Paso de adaptación (0 < mu < 2)
+ * \param epsilon Regularización de la normalización de cada banda (>= 0)
+ * \param workspace Buffer de SAF_WORKSPACE(ncoef) floats
+ * \param psaf Objeto a inicializar
+ * \return SAF_OK (0) si éxito, SAF_KO (-1) si error o si la banda más larga supera MAX_FIR_LENGTH
+ *
+ * \subsection saf_filter_func saf_filter
+ * Analiza una muestra de x[n] y d[n], calcula la salida en banda completa y, en la fase 0 del
+ * periodo, adapta el filtro con los errores de banda. El error a priori queda en psaf->error y
+ * los de banda en psaf->error_banda.
+ * \param xn Muestra de entrada x[n]
+ * \param dn Muestra deseada d[n]
+ * \param psaf Objeto filtro
+ * \return Salida y[n] = w^T x[n], o 0.0 si error
+ *
+ * \subsection saf_bloque_func saf_bloque
+ * Procesa un bloque de muestras. y y e (errores a priori) pueden ser NULL.
+ * \param x Muestras de entrada
+ * \param d Muestras deseadas
+ * \param y Salidas (o NULL)
+ * \param e Errores a priori (o NULL)
+ * \param nmuestras Número de muestras
+ * \param psaf Objeto filtro
+ * \return SAF_OK (0) si éxito, SAF_KO (-1) si error
+ *
+ * \dot
+ * digraph saf_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[n]", shape=plaintext];
+ *   D [label="d[n]", shape=plaintext];
+ *   AX [label="Filtros H_b\n(tasa completa)", fillcolor=lightpink];
+ *   AD [label="DWT\ndeseada", fillcolor=lightpink];
+ *   W [label="w (banda completa)", fillcolor=lightyellow];
+ *   ADAPT [label="e_b = d_b - w^T x_b\ncada 2^L muestras", fillcolor=lightblue];
+ *   Y [label="y[n], e[n]", shape=plaintext];
+ *
+ *   X -> W -> Y;
+ *   X -> AX -> ADAPT [label="x_b"];
+ *   D -> AD -> ADAPT [label="d_b"];
+ *   ADAPT -> W [label="actualización"];
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_saf Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: NLMS decimados sobre el análisis DWT y síntesis |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Estructura multibanda: filtro único en banda completa adaptado con los errores de banda, sin suelo de aliasing |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "saf.h"
+#include <stddef.h>
+
+/* Declaración de funciones */
+void Init_SAF(void);
+int Get_SAF(unsigned int ncoef, float mu, float epsilon, float *workspace, SAF_OBJECT *psaf);
+float SAF_Filter(float xn, float dn, SAF_OBJECT *psaf);
+int SAF_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, SAF_OBJECT *psaf);
+static void convoluciona_saf(float *pa, unsigned int la, const float *pf, unsigned int salto, float *pout);
+static float paso_saf(float xn, float dn, SAF_OBJECT *psaf);
+static float producto_saf(const float *restrict pw, const float *restrict px, unsigned int n);
+static void actualiza_saf(float *restrict pw, const float *restrict px, unsigned int n, float g);
+
+/* Atributos */
+SAF_API saf_api;
+
+/* Definición de funciones */
+
+void Init_SAF(void)
+{
+    /* Inicializar punteros de la API */
+    saf_api.get_saf = Get_SAF;
+    saf_api.saf_filter = SAF_Filter;
+    saf_api.saf_bloque = SAF_Bloque;
+}
+
+int Get_SAF(unsigned int ncoef, float mu, float epsilon, float *workspace, SAF_OBJECT *psaf)
+{
+    unsigned int b, i, longitud;
+    float *pw, *paproximacion;
+
+    if (psaf == NULL || workspace == NULL || ncoef == 0 || !(mu > 0.0f) || !(epsilon >= 0.0f) ||
+        SAF_LONGITUD_BANDA(WAVELET_LEVELS) > MAX_FIR_LENGTH)
+    {
+        return SAF_KO;
+    }
+
+    psaf->ncoef = ncoef;
+    psaf->mu = mu;
+    psaf->epsilon = epsilon;
+
+    /* Coeficientes nulos y líneas de retardo de la entrada y de cada banda */
+    pw = workspace;
+    psaf->pcoef = pw;
+    for (i = 0; i < ncoef + (SAF_BANDAS + 1) * LMS_RETARDO(ncoef); i++)
+    {
+        pw[i] = 0.0f;
+    }
+    pw += ncoef;
+    psaf->pz = pw;
+    pw += LMS_RETARDO(ncoef);
+    for (b = 0; b < SAF_BANDAS; b++)
+    {
+        psaf->pbanda[b] = pw;
+        pw += LMS_RETARDO(ncoef);
+    }
+    psaf->p_write = 0;
+
+    /* Análisis de la deseada con la DWT; sus filtros definen las bandas */
+    dwt_api.get_dwt(&psaf->deseada);
+
+    /* Filtros equivalentes: la aproximación del nivel i se acumula en el espacio de la banda de aproximación
+     * y cada detalle es esa aproximación por H1 expandido 2^i */
+    paproximacion = pw;
+    for (b = 0; b < WAVELET_LEVELS; b++)
+    {
+        paproximacion += SAF_LONGITUD_BANDA(b);
+    }
+    paproximacion[0] = 1.0f;
+
+    longitud = 1;
+    for (b = 0; b < WAVELET_LEVELS; b++)
+    {
+        convoluciona_saf(paproximacion, longitud, psaf->deseada.hp_coef, 1u << b, pw);
+        psaf->analisis[b] = fir_api.get_fir(SAF_LONGITUD_BANDA(b), pw, pw + SAF_ANALISIS);
+        pw += SAF_LONGITUD_BANDA(b);
+
+        convoluciona_saf(paproximacion, longitud, psaf->deseada.lp_coef, 1u << b, paproximacion);
+        longitud += (BUFFER_SIZE - 1) << b;
+    }
+    psaf->analisis[WAVELET_LEVELS] = fir_api.get_fir(SAF_LONGITUD_BANDA(WAVELET_LEVELS), pw, pw + SAF_ANALISIS);
+
+    for (b = 0; b < SAF_BANDAS; b++)
+    {
+        psaf->error_banda[b] = 0.0f;
+        psaf->energia[b] = 0.0;
+    }
+    psaf->fase = 0;
+    psaf->error = 0.0f;
+
+    return SAF_OK;
+}
+
+float SAF_Filter(float xn, float dn, SAF_OBJECT *psaf)
+{
+    if (psaf == NULL || psaf->pcoef == NULL)
+    {
+        return 0.0f;
+    }
+
+    return paso_saf(xn, dn, psaf);
+}
+
+int SAF_Bloque(const float *x, const float *d, float *y, float *e, unsigned int nmuestras, SAF_OBJECT *psaf)
+{
+    unsigned int i;
+    float yn;
+
+    if (psaf == NULL || psaf->pcoef == NULL || (nmuestras > 0 && (x == NULL || d == NULL)))
+    {
+        return SAF_KO;
+    }
+
+    for (i = 0; i < nmuestras; i++)
+    {
+        yn = paso_saf(x[i], d[i], psaf);
+
+        if (y != NULL)
+        {
+            y[i] = yn;
+        }
+        if (e != NULL)
+        {
+            e[i] = psaf->error;
+        }
+    }
+
+    return SAF_OK;
+}
+
+static void convoluciona_saf(float *pa, unsigned int la, const float *pf, unsigned int salto, float *pout)
+{
+    unsigned int i, j, n;
+    float suma;
+
+    /* pout = pa * pf expandido por salto, de la última muestra a la primera para poder operar en sitio */
+    n = la + (BUFFER_SIZE - 1) * salto;
+    for (i = n; i-- > 0;)
+    {
+        suma = 0.0f;
+        for (j = 0; j < BUFFER_SIZE && j * salto <= i; j++)
+        {
+            if (i - j * salto < la)
+            {
+                suma += pa[i - j * salto] * pf[j];
+            }
+        }
+        pout[i] = suma;
+    }
+}
+
+static float paso_saf(float xn, float dn, SAF_OBJECT *psaf)
+{
+    unsigned int b, n, p;
+    float y, xb, g[SAF_BANDAS];
+
+    n = psaf->ncoef;
+
+    /* Anillo con copia espejo: las n últimas muestras, de la más reciente a la más antigua, empiezan en p.
+     * La posición p guardaba la muestra que sale de la ventana, que se descuenta de la energía de la banda */
+    p = (psaf->p_write == 0) ? n - 1 : psaf->p_write - 1;
+    psaf->p_write = p;
+    psaf->pz[p] = xn;
+    psaf->pz[p + n] = xn;
+    for (b = 0; b < SAF_BANDAS; b++)
+    {
+        xb = fir_api.fir_filter(xn, &psaf->analisis[b]);
+        psaf->energia[b] += (double)xb * xb - (double)psaf->pbanda[b][p] * psaf->pbanda[b][p];
+        psaf->pbanda[b][p] = xb;
+        psaf->pbanda[b][p + n] = xb;
+    }
+    dwt_api.dwt(dn, &psaf->deseada);
+
+    /* Salida y error a priori en banda completa */
+    y = producto_saf(psaf->pcoef, &psaf->pz[p], n);
+    psaf->error = dn - y;
+
+    /* Adaptación cuando todas las bandas de la DWT tienen muestra nueva: los errores de banda se calculan
+     * con los mismos coeficientes antes de actualizar */
+    if (psaf->fase == 0)
+    {
+        for (b = 0; b < SAF_BANDAS; b++)
+        {
+            psaf->error_banda[b] = psaf->deseada.yout[b] - producto_saf(psaf->pcoef, &psaf->pbanda[b][p], n);
+            g[b] = psaf->mu * psaf->error_banda[b] /
+                   (psaf->epsilon + ((psaf->energia[b] > 0.0) ? (float)psaf->energia[b] : 0.0f));
+        }
+        for (b = 0; b < SAF_BANDAS; b++)
+        {
+            actualiza_saf(psaf->pcoef, &psaf->pbanda[b][p], n, g[b]);
+        }
+    }
+
+    psaf->fase = (psaf->fase + 1) & (SAF_PERIODO - 1);
+
+    return y;
+}
+
+static float producto_saf(const float *restrict pw, const float *restrict px, unsigned int n)
+{
+    unsigned int i, j;
+    float y;
+    float acumulador[SAF_CARRILES];
+
+    for (j = 0; j < SAF_CARRILES; j++)
+    {
+        acumulador[j] = 0.0f;
+    }
+
+    /* Producto w^T x con un acumulador parcial por carril */
+    for (i = n / SAF_CARRILES; i > 0; i--)
+    {
+        for (j = 0; j < SAF_CARRILES; j++)
+        {
+            acumulador[j] += pw[j] * px[j];
+        }
+        pw += SAF_CARRILES;
+        px += SAF_CARRILES;
+    }
+
+    y = 0.0f;
+    for (i = 0; i < n % SAF_CARRILES; i++)
+    {
+        y += pw[i] * px[i];
+    }
+
+    for (j = 0; j < SAF_CARRILES; j++)
+    {
+        y += acumulador[j];
+    }
+
+    return y;
+}
+
+static void actualiza_saf(float *restrict pw, const float *restrict px, unsigned int n, float g)
+{
+    unsigned int i;
+
+    for (i = 0; i < n; i++)
+    {
+        pw[i] += g * px[i];
+    }
+}
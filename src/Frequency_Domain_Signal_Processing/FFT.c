@@ -1 +1,828 @@
+/** \page fft FFT - TRANSFORMADA RÁPIDA DE FOURIER
+ * \brief Módulo de transformada rápida de Fourier compleja para la librería NSDSP
+ *
+ * Este módulo implementa la FFT compleja de N puntos (N potencia de 2, hasta 2^FFT_MAX_LOG2)
+ * mediante un algoritmo iterativo de decimación en tiempo radix-4, con una etapa radix-2
+ * inicial cuando log2(N) es impar. Siguiendo el criterio del resto de la librería no se
+ * reserva memoria dinámica: las tablas de twiddles y de inversión de bits las proporciona el
+ * llamante y se calculan una sola vez al crear el plan, de modo que la ejecución no evalúa
+ * ninguna función trigonométrica.
+ *
+ * \section teoria_fft Teoría
+ *
+ * La DFT de N puntos y su inversa se definen como:
+ * \f[
+ * X[k] = \sum_{n=0}^{N-1} x[n]\, W_N^{kn}, \qquad
+ * x[n] = \frac{1}{N}\sum_{k=0}^{N-1} X[k]\, W_N^{-kn}, \qquad W_N = e^{-j 2\pi / N}
+ * \f]
+ *
+ * Tras reordenar la entrada por inversión de bits, cada etapa radix-4 combina cuatro DFT de
+ * L puntos en una de 4L puntos. Con la ordenación binaria los bloques 1 y 2 de cada grupo
+ * contienen las subsecuencias 4q+2 y 4q+1, por lo que la mariposa es:
+ * \f[
+ * t_1 = W_{4L}^{j} a_2,\; t_2 = W_{4L}^{2j} a_1,\; t_3 = W_{4L}^{3j} a_3,\qquad
+ * s_0 = a_0 + t_2,\; s_1 = a_0 - t_2,\; s_2 = t_1 + t_3,\; s_3 = t_1 - t_3
+ * \f]
+ * \f[
+ * X[j] = s_0 + s_2,\quad X[j+L] = s_1 - j s_3,\quad X[j+2L] = s_0 - s_2,\quad X[j+3L] = s_1 + j s_3
+ * \f]
+ * con solo tres productos complejos por mariposa. La primera etapa (radix-2 o radix-4 con
+ * L = 1) no necesita twiddles. La inversa se obtiene como \f$ x = \overline{\mathrm{FFT}(\bar X)}/N \f$
+ * con las mismas tablas.
+ *
+ * \subsection simd_fft Mariposas SIMD
+ *
+ * Las mariposas de una etapa son independientes en j, pero los datos van entrelazados en
+ * COMPLEJO y el compilador no los vectoriza. Con __AVX__ se procesan ocho mariposas por
+ * iteración y con __SSE2__ cuatro: cada grupo de COMPLEJO se separa por barajado en un vector
+ * de partes reales y otro de imaginarias, los productos complejos se hacen en esa forma y las
+ * salidas se vuelven a entrelazar. Para que los twiddles se carguen con lecturas contiguas, el
+ * plan los guarda por etapa en seis tablas de L floats (partes real e imaginaria de
+ * \f$ W^{j} \f$, \f$ W^{2j} \f$ y \f$ W^{3j} \f$). La etapa con L = 2 y cualquier resto usan el
+ * bucle escalar, que es también la ruta completa en destinos sin SSE2. Todas las rutas hacen
+ * las mismas operaciones en el mismo orden y dan el mismo resultado.
+ *
+ * \section uso_fft Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_FFT() (llamado automáticamente por Init_NSDSP())
+ * 2. Reservar las tablas del plan (FFT_TWIDDLE_SIZE(N) COMPLEJO y FFT_BITREV_SIZE(N) unsigned int)
+ * 3. Crear el plan con fft_api.get_plan()
+ * 4. Transformar con fft_api.fft() / fft_api.ifft() (in-place) o fft_out() / ifft_out()
+ *
+ * Ejemplo de uso:
+ * \code
+ * #include "fft.h"
+ *
+ * static COMPLEJO twiddle[FFT_TWIDDLE_SIZE(1024)];
+ * static unsigned int bitrev[FFT_BITREV_SIZE(1024)];
+ * static COMPLEJO x[1024], X[1024];
+ *
+ * int main(void) {
+ *     FFT_PLAN plan;
+ *
+ *     Init_FFT();
+ *     fft_api.get_plan(1024, twiddle, bitrev, &plan);
+ *
+ *     // ... rellenar x ...
+ *     fft_api.fft_out(&plan, x, X);   // X = FFT(x)
+ *     fft_api.ifft(&plan, X);         // X = x
+ *
+ *     return 0;
+ * }
+ * \endcode
+ *
+ * \section funciones_fft Descripción de funciones
+ *
+ * \subsection init_fft_func Init_FFT
+ * Inicializa la estructura de punteros a funciones fft_api con get_fft_plan, fft, fft_out,
+ * ifft, ifft_out, get_rfft_plan, rfft e irfft.
+ *
+ * \subsection get_fft_plan_func get_fft_plan
+ * Crea un plan de N puntos. Calcula la tabla de inversión de bits y, para cada etapa radix-4
+ * con L > 1, \f$ W_{4L}^{j}, W_{4L}^{2j}, W_{4L}^{3j} \f$, j = 0..L-1, en seis tablas de L floats
+ * (real e imaginaria de cada potencia) consecutivas por etapa, que ocupan los mismos
+ * FFT_TWIDDLE_SIZE(n) COMPLEJO. Los twiddles se calculan en doble precisión. El plan no modifica sus tablas al ejecutarse y puede compartirse entre
+ * varias señales.
+ * \param n Número de puntos (potencia de 2, 2 <= n <= 2^FFT_MAX_LOG2)
+ * \param twiddle Tabla de FFT_TWIDDLE_SIZE(n) elementos COMPLEJO
+ * \param bitrev Tabla de FFT_BITREV_SIZE(n) elementos unsigned int
+ * \param pplan Plan a inicializar
+ * \return FFT_OK (0) si éxito, FFT_KO (-1) si error
+ *
+ * \subsection fft_func fft / fft_out
+ * Transformada directa. fft() trabaja in-place sobre x; fft_out() lee x y escribe en y (x no
+ * se modifica y no debe solaparse con y).
+ * \param pplan Plan creado con get_fft_plan
+ * \param x Señal de entrada de n muestras
+ * \param y Espectro de salida de n muestras (solo fft_out)
+ * \return FFT_OK (0) si éxito, FFT_KO (-1) si error
+ *
+ * \subsection ifft_func ifft / ifft_out
+ * Transformada inversa normalizada por 1/N, con las mismas variantes in-place y out-of-place.
+ * \param pplan Plan creado con get_fft_plan
+ * \param x Espectro de entrada de n muestras
+ * \param y Señal de salida de n muestras (solo ifft_out)
+ * \return FFT_OK (0) si éxito, FFT_KO (-1) si error
+ *
+ * \subsection rfft_func get_rfft_plan / rfft / irfft
+ * Transformada de señales reales de N puntos mediante una FFT compleja de N/2 puntos. Las
+ * muestras se agrupan como \f$ z[n] = x[2n] + j\,x[2n+1] \f$ y, tras la FFT, los espectros de
+ * las muestras pares e impares se separan por simetría hermítica:
+ * \f[
+ * E[k] = \frac{Z[k] + \overline{Z[N/2-k]}}{2},\quad
+ * O[k] = \frac{Z[k] - \overline{Z[N/2-k]}}{2j},\quad
+ * X[k] = E[k] + W_N^k O[k],\quad X[N/2-k] = \overline{E[k] - W_N^k O[k]}
+ * \f]
+ * procesando a la vez los bins k y N/2-k. irfft() deshace el proceso y aplica una IFFT de N/2
+ * puntos. El espectro usa el formato hermítico empaquetado de N/2 elementos COMPLEJO: X[0].re
+ * es la componente continua, X[0].im la de Nyquist (ambas reales) y X[k], 0 < k < N/2, los
+ * bins positivos; el resto se obtiene por conjugación. Así entrada y salida ocupan N floats y
+ * pueden compartir memoria (x == (float *)y). El coste y la memoria son aproximadamente la
+ * mitad de los de una FFT compleja de N puntos.
+ *
+ * El plan real contiene su propio plan complejo de N/2 puntos y la tabla \f$ W_N^k \f$,
+ * k = 0..N/4, en los buffers del llamante (RFFT_TWIDDLE_SIZE(N) y RFFT_BITREV_SIZE(N)).
+ * \param n Número de puntos reales (potencia de 2, 4 <= n <= 2^(FFT_MAX_LOG2+1))
+ * \param twiddle Tabla de RFFT_TWIDDLE_SIZE(n) elementos COMPLEJO
+ * \param bitrev Tabla de RFFT_BITREV_SIZE(n) elementos unsigned int
+ * \param pplan Plan real a inicializar
+ * \param x Señal real de n muestras
+ * \param y Espectro empaquetado de n/2 elementos COMPLEJO
+ * \return FFT_OK (0) si éxito, FFT_KO (-1) si error
+ *
+ * \dot
+ * digraph fft_flow {
+ *   rankdir=TB;
+ *   node [shape=box, style=filled];
+ *
+ *   START [label="fft(plan, x)", fillcolor=lightgreen];
+ *   PERM [label="Permutación por\ninversión de bits", fillcolor=lightyellow];
+ *   FIRST [label="Primera etapa sin twiddles\n(radix-2 si log2N impar, radix-4 si par)", fillcolor=lightblue];
+ *   STAGE [label="Etapa radix-4\nL -> 4L", fillcolor=lightblue];
+ *   CHECK [label="4L < N", shape=diamond, fillcolor=lightcyan];
+ *   END [label="return FFT_OK", fillcolor=lightgreen];
+ *
+ *   START -> PERM -> FIRST -> CHECK;
+ *   CHECK -> STAGE [label="Sí"];
+ *   STAGE -> CHECK;
+ *   CHECK -> END [label="No"];
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_fft Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: planes precalculados y FFT radix-4/2 in-place y out-of-place |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Añadida FFT real (rfft, irfft) con espectro hermítico empaquetado |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Mariposas radix-4 con SSE2 y AVX, twiddles por etapa en tablas separadas de partes real e imaginaria |
+ *
+ * \copyright ZGR R&D AIE
+ */
 
+#include "fft.h"
+#include <stddef.h>
+#include <math.h>
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Declaración de funciones */
+void Init_FFT(void);
+int get_fft_plan(unsigned int n, COMPLEJO *twiddle, unsigned int *bitrev, FFT_PLAN *pplan);
+int fft(FFT_PLAN *pplan, COMPLEJO *x);
+int fft_out(FFT_PLAN *pplan, const COMPLEJO *x, COMPLEJO *y);
+int ifft(FFT_PLAN *pplan, COMPLEJO *x);
+int ifft_out(FFT_PLAN *pplan, const COMPLEJO *x, COMPLEJO *y);
+int get_rfft_plan(unsigned int n, COMPLEJO *twiddle, unsigned int *bitrev, RFFT_PLAN *pplan);
+int rfft(RFFT_PLAN *pplan, const float *x, COMPLEJO *y);
+int irfft(RFFT_PLAN *pplan, const COMPLEJO *y, float *x);
+static int plan_valido_fft(FFT_PLAN *pplan);
+static int plan_real_valido_fft(RFFT_PLAN *pplan);
+static void permutar_fft(FFT_PLAN *pplan, COMPLEJO *x);
+static void etapas_fft(FFT_PLAN *pplan, COMPLEJO *x);
+static void mariposas_fft(COMPLEJO *x, unsigned int L, const float *w);
+#if defined(__SSE2__)
+static unsigned int mariposas_sse_fft(COMPLEJO *x, unsigned int L, const float *w, unsigned int j);
+#endif
+#if defined(__AVX__)
+static void carga_avx_fft(const COMPLEJO *p, __m256 *re, __m256 *im);
+static void guarda_avx_fft(COMPLEJO *p, __m256 re, __m256 im);
+static unsigned int mariposas_avx_fft(COMPLEJO *x, unsigned int L, const float *w, unsigned int j);
+#endif
+static void conjugar_fft(COMPLEJO *x, unsigned int n, float escala);
+
+/* Declaración de objetos */
+FFT_API fft_api;
+
+/* Definición de funciones */
+
+void Init_FFT(void)
+{
+    /* Inicializar punteros de la API */
+    fft_api.get_plan = get_fft_plan;
+    fft_api.fft = fft;
+    fft_api.fft_out = fft_out;
+    fft_api.ifft = ifft;
+    fft_api.ifft_out = ifft_out;
+    fft_api.get_rplan = get_rfft_plan;
+    fft_api.rfft = rfft;
+    fft_api.irfft = irfft;
+}
+
+int get_fft_plan(unsigned int n, COMPLEJO *twiddle, unsigned int *bitrev, FFT_PLAN *pplan)
+{
+    unsigned int i, j, log2n, rev, mascara, L;
+    float *w;
+    double fase;
+
+    if (twiddle == NULL || bitrev == NULL || pplan == NULL)
+    {
+        return FFT_KO;
+    }
+
+    /* n debe ser potencia de 2 dentro del rango soportado */
+    if (n < 2 || (n & (n - 1)) != 0 || n > (1u << FFT_MAX_LOG2))
+    {
+        return FFT_KO;
+    }
+
+    log2n = 0;
+    while ((1u << log2n) < n)
+    {
+        log2n++;
+    }
+
+    /* Tabla de inversión de bits: se incrementa un contador con los bits invertidos */
+    rev = 0;
+    for (i = 0; i < n; i++)
+    {
+        bitrev[i] = rev;
+        mascara = n >> 1;
+        while (mascara != 0 && (rev & mascara) != 0)
+        {
+            rev ^= mascara;
+            mascara >>= 1;
+        }
+        rev |= mascara;
+    }
+
+    /* Twiddles de las etapas radix-4 con L > 1: por etapa, seis tablas de L floats con las partes
+     * real e imaginaria de W^j, W^2j y W^3j, para que las mariposas las lean seguidas */
+    L = (log2n & 1u) ? 2 : 4;
+    w = (float *)twiddle;
+    for (; L < n; L <<= 2)
+    {
+        for (j = 0; j < L; j++)
+        {
+            fase = -2.0 * FFT_PI * (double)j / (double)(4 * L);
+            w[j] = (float)cos(fase);
+            w[L + j] = (float)sin(fase);
+            w[2 * L + j] = (float)cos(2.0 * fase);
+            w[3 * L + j] = (float)sin(2.0 * fase);
+            w[4 * L + j] = (float)cos(3.0 * fase);
+            w[5 * L + j] = (float)sin(3.0 * fase);
+        }
+        w += 6 * L;
+    }
+
+    pplan->n = n;
+    pplan->log2n = log2n;
+    pplan->twiddle = twiddle;
+    pplan->bitrev = bitrev;
+
+    return FFT_OK;
+}
+
+int fft(FFT_PLAN *pplan, COMPLEJO *x)
+{
+    if (plan_valido_fft(pplan) != FFT_OK || x == NULL)
+    {
+        return FFT_KO;
+    }
+
+    permutar_fft(pplan, x);
+    etapas_fft(pplan, x);
+
+    return FFT_OK;
+}
+
+int fft_out(FFT_PLAN *pplan, const COMPLEJO *x, COMPLEJO *y)
+{
+    unsigned int i;
+
+    if (plan_valido_fft(pplan) != FFT_OK || x == NULL || y == NULL || x == y)
+    {
+        return FFT_KO;
+    }
+
+    /* La permutación se hace al copiar */
+    for (i = 0; i < pplan->n; i++)
+    {
+        y[i] = x[pplan->bitrev[i]];
+    }
+    etapas_fft(pplan, y);
+
+    return FFT_OK;
+}
+
+int ifft(FFT_PLAN *pplan, COMPLEJO *x)
+{
+    if (plan_valido_fft(pplan) != FFT_OK || x == NULL)
+    {
+        return FFT_KO;
+    }
+
+    permutar_fft(pplan, x);
+    conjugar_fft(x, pplan->n, 1.0f);
+    etapas_fft(pplan, x);
+    conjugar_fft(x, pplan->n, 1.0f / (float)pplan->n);
+
+    return FFT_OK;
+}
+
+int ifft_out(FFT_PLAN *pplan, const COMPLEJO *x, COMPLEJO *y)
+{
+    unsigned int i;
+
+    if (plan_valido_fft(pplan) != FFT_OK || x == NULL || y == NULL || x == y)
+    {
+        return FFT_KO;
+    }
+
+    /* Permutación y conjugación en la misma pasada */
+    for (i = 0; i < pplan->n; i++)
+    {
+        y[i].re = x[pplan->bitrev[i]].re;
+        y[i].im = -x[pplan->bitrev[i]].im;
+    }
+    etapas_fft(pplan, y);
+    conjugar_fft(y, pplan->n, 1.0f / (float)pplan->n);
+
+    return FFT_OK;
+}
+
+int get_rfft_plan(unsigned int n, COMPLEJO *twiddle, unsigned int *bitrev, RFFT_PLAN *pplan)
+{
+    unsigned int k;
+    double fase;
+
+    if (pplan == NULL || twiddle == NULL || n < 4 || (n & (n - 1)) != 0)
+    {
+        return FFT_KO;
+    }
+
+    /* Plan complejo de N/2 puntos al principio de la tabla; W_N^k a continuación */
+    if (get_fft_plan(n / 2, twiddle, bitrev, &pplan->compleja) != FFT_OK)
+    {
+        return FFT_KO;
+    }
+
+    pplan->twiddle_r = twiddle + FFT_TWIDDLE_SIZE(n / 2);
+    for (k = 0; k <= n / 4; k++)
+    {
+        fase = -2.0 * FFT_PI * (double)k / (double)n;
+        pplan->twiddle_r[k].re = (float)cos(fase);
+        pplan->twiddle_r[k].im = (float)sin(fase);
+    }
+    pplan->n = n;
+
+    return FFT_OK;
+}
+
+int rfft(RFFT_PLAN *pplan, const float *x, COMPLEJO *y)
+{
+    unsigned int i, k, m, mitad, b;
+    const COMPLEJO *w;
+    float er, ei, or_, oi, tr, ti;
+
+    if (plan_real_valido_fft(pplan) != FFT_OK || x == NULL || y == NULL)
+    {
+        return FFT_KO;
+    }
+
+    mitad = pplan->n / 2;
+
+    /* FFT compleja de z[n] = x[2n] + j x[2n+1], in-place si x y y comparten memoria */
+    if ((const void *)x == (const void *)y)
+    {
+        permutar_fft(&pplan->compleja, y);
+    }
+    else
+    {
+        for (i = 0; i < mitad; i++)
+        {
+            b = pplan->compleja.bitrev[i];
+            y[i].re = x[2 * b];
+            y[i].im = x[2 * b + 1];
+        }
+    }
+    etapas_fft(&pplan->compleja, y);
+
+    /* Bins 0 y N/2, empaquetados en y[0] */
+    tr = y[0].re;
+    y[0].re = tr + y[0].im;
+    y[0].im = tr - y[0].im;
+
+    /* Separación de los espectros par e impar por parejas (k, N/2 - k) */
+    w = pplan->twiddle_r;
+    for (k = 1; k <= mitad / 2; k++)
+    {
+        m = mitad - k;
+
+        er = 0.5f * (y[k].re + y[m].re);
+        ei = 0.5f * (y[k].im - y[m].im);
+        or_ = 0.5f * (y[k].im + y[m].im);
+        oi = -0.5f * (y[k].re - y[m].re);
+
+        /* t = W^k * O */
+        tr = w[k].re * or_ - w[k].im * oi;
+        ti = w[k].re * oi + w[k].im * or_;
+
+        y[k].re = er + tr;
+        y[k].im = ei + ti;
+        y[m].re = er - tr;
+        y[m].im = ti - ei;
+    }
+
+    return FFT_OK;
+}
+
+int irfft(RFFT_PLAN *pplan, const COMPLEJO *y, float *x)
+{
+    unsigned int k, m, mitad;
+    const COMPLEJO *w;
+    COMPLEJO *z;
+    float er, ei, dr, di, or_, oi, x0, xn;
+
+    if (plan_real_valido_fft(pplan) != FFT_OK || x == NULL || y == NULL)
+    {
+        return FFT_KO;
+    }
+
+    mitad = pplan->n / 2;
+
+    /* Z[k] = E[k] + j O[k] se construye directamente en la memoria de salida */
+    z = (COMPLEJO *)x;
+
+    x0 = y[0].re;
+    xn = y[0].im;
+
+    w = pplan->twiddle_r;
+    for (k = 1; k <= mitad / 2; k++)
+    {
+        m = mitad - k;
+
+        /* E = (X_k + conj X_m)/2, O = (X_k - conj X_m) conj(W^k)/2 */
+        er = 0.5f * (y[k].re + y[m].re);
+        ei = 0.5f * (y[k].im - y[m].im);
+        dr = 0.5f * (y[k].re - y[m].re);
+        di = 0.5f * (y[k].im + y[m].im);
+        or_ = dr * w[k].re + di * w[k].im;
+        oi = di * w[k].re - dr * w[k].im;
+
+        /* Z_k = E + j O, Z_m = conj(E - j O) */
+        z[k].re = er - oi;
+        z[k].im = ei + or_;
+        z[m].re = er + oi;
+        z[m].im = or_ - ei;
+    }
+
+    z[0].re = 0.5f * (x0 + xn);
+    z[0].im = 0.5f * (x0 - xn);
+
+    /* IFFT compleja de N/2 puntos: z[n] = x[2n] + j x[2n+1] */
+    permutar_fft(&pplan->compleja, z);
+    conjugar_fft(z, mitad, 1.0f);
+    etapas_fft(&pplan->compleja, z);
+    conjugar_fft(z, mitad, 1.0f / (float)mitad);
+
+    return FFT_OK;
+}
+
+static int plan_valido_fft(FFT_PLAN *pplan)
+{
+    if (pplan == NULL || pplan->twiddle == NULL || pplan->bitrev == NULL ||
+        pplan->n < 2 || pplan->log2n == 0 || pplan->log2n > FFT_MAX_LOG2 ||
+        pplan->n != (1u << pplan->log2n))
+    {
+        return FFT_KO;
+    }
+
+    return FFT_OK;
+}
+
+static int plan_real_valido_fft(RFFT_PLAN *pplan)
+{
+    if (pplan == NULL || pplan->twiddle_r == NULL || plan_valido_fft(&pplan->compleja) != FFT_OK ||
+        pplan->n != 2 * pplan->compleja.n)
+    {
+        return FFT_KO;
+    }
+
+    return FFT_OK;
+}
+
+static void permutar_fft(FFT_PLAN *pplan, COMPLEJO *x)
+{
+    unsigned int i, r;
+    COMPLEJO temp;
+
+    for (i = 0; i < pplan->n; i++)
+    {
+        r = pplan->bitrev[i];
+        if (i < r)
+        {
+            temp = x[i];
+            x[i] = x[r];
+            x[r] = temp;
+        }
+    }
+}
+
+static void etapas_fft(FFT_PLAN *pplan, COMPLEJO *x)
+{
+    unsigned int n, k, L;
+    const float *w;
+    float s0r, s0i, s1r, s1i, s2r, s2i, s3r, s3i;
+
+    n = pplan->n;
+
+    /* Primera etapa sin twiddles */
+    if (pplan->log2n & 1u)
+    {
+        for (k = 0; k < n; k += 2)
+        {
+            s0r = x[k].re;
+            s0i = x[k].im;
+            x[k].re = s0r + x[k + 1].re;
+            x[k].im = s0i + x[k + 1].im;
+            x[k + 1].re = s0r - x[k + 1].re;
+            x[k + 1].im = s0i - x[k + 1].im;
+        }
+        L = 2;
+    }
+    else
+    {
+        for (k = 0; k < n; k += 4)
+        {
+            s0r = x[k].re + x[k + 1].re;
+            s0i = x[k].im + x[k + 1].im;
+            s1r = x[k].re - x[k + 1].re;
+            s1i = x[k].im - x[k + 1].im;
+            s2r = x[k + 2].re + x[k + 3].re;
+            s2i = x[k + 2].im + x[k + 3].im;
+            s3r = x[k + 2].re - x[k + 3].re;
+            s3i = x[k + 2].im - x[k + 3].im;
+
+            x[k].re = s0r + s2r;
+            x[k].im = s0i + s2i;
+            x[k + 1].re = s1r + s3i;
+            x[k + 1].im = s1i - s3r;
+            x[k + 2].re = s0r - s2r;
+            x[k + 2].im = s0i - s2i;
+            x[k + 3].re = s1r - s3i;
+            x[k + 3].im = s1i + s3r;
+        }
+        L = 4;
+    }
+
+    /* Etapas radix-4: cuatro DFT de L puntos -> una de 4L puntos. Cada etapa ocupa 6L floats de
+     * la tabla de twiddles */
+    w = (const float *)pplan->twiddle;
+    for (; L < n; L <<= 2)
+    {
+        for (k = 0; k < n; k += 4 * L)
+        {
+            mariposas_fft(&x[k], L, w);
+        }
+        w += 6 * L;
+    }
+}
+
+static void mariposas_fft(COMPLEJO *x, unsigned int L, const float *w)
+{
+    unsigned int j;
+    COMPLEJO *p0, *p1, *p2, *p3;
+    const float *w1r, *w1i, *w2r, *w2i, *w3r, *w3i;
+    float t1r, t1i, t2r, t2i, t3r, t3i;
+    float s0r, s0i, s1r, s1i, s2r, s2i, s3r, s3i;
+
+    /* Las mariposas que caben en vectores van por la ruta SIMD; el resto (L = 2, o la cola de
+     * una etapa) por el bucle escalar */
+    j = 0;
+#if defined(__AVX__)
+    j = mariposas_avx_fft(x, L, w, j);
+#endif
+#if defined(__SSE2__)
+    j = mariposas_sse_fft(x, L, w, j);
+#endif
+
+    p0 = x;
+    p1 = p0 + L;
+    p2 = p1 + L;
+    p3 = p2 + L;
+    w1r = w;
+    w1i = w1r + L;
+    w2r = w1i + L;
+    w2i = w2r + L;
+    w3r = w2i + L;
+    w3i = w3r + L;
+
+    for (; j < L; j++)
+    {
+        /* t1 = W^j a2, t2 = W^2j a1, t3 = W^3j a3 */
+        t1r = p2[j].re * w1r[j] - p2[j].im * w1i[j];
+        t1i = p2[j].re * w1i[j] + p2[j].im * w1r[j];
+        t2r = p1[j].re * w2r[j] - p1[j].im * w2i[j];
+        t2i = p1[j].re * w2i[j] + p1[j].im * w2r[j];
+        t3r = p3[j].re * w3r[j] - p3[j].im * w3i[j];
+        t3i = p3[j].re * w3i[j] + p3[j].im * w3r[j];
+
+        s0r = p0[j].re + t2r;
+        s0i = p0[j].im + t2i;
+        s1r = p0[j].re - t2r;
+        s1i = p0[j].im - t2i;
+        s2r = t1r + t3r;
+        s2i = t1i + t3i;
+        s3r = t1r - t3r;
+        s3i = t1i - t3i;
+
+        p0[j].re = s0r + s2r;
+        p0[j].im = s0i + s2i;
+        p1[j].re = s1r + s3i;
+        p1[j].im = s1i - s3r;
+        p2[j].re = s0r - s2r;
+        p2[j].im = s0i - s2i;
+        p3[j].re = s1r - s3i;
+        p3[j].im = s1i + s3r;
+    }
+}
+
+#if defined(__SSE2__)
+static unsigned int mariposas_sse_fft(COMPLEJO *x, unsigned int L, const float *w, unsigned int j)
+{
+    COMPLEJO *p0, *p1, *p2, *p3;
+    const float *w1r, *w1i, *w2r, *w2i, *w3r, *w3i;
+    __m128 a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, u0, u1;
+    __m128 t1r, t1i, t2r, t2i, t3r, t3i;
+    __m128 s0r, s0i, s1r, s1i, s2r, s2i, s3r, s3i;
+
+    p0 = x;
+    p1 = p0 + L;
+    p2 = p1 + L;
+    p3 = p2 + L;
+    w1r = w;
+    w1i = w1r + L;
+    w2r = w1i + L;
+    w2i = w2r + L;
+    w3r = w2i + L;
+    w3i = w3r + L;
+
+    /* Cuatro mariposas por iteración. Cada pareja de cargas de COMPLEJO se separa en un vector de
+     * partes reales y otro de imaginarias, y los twiddles se leen seguidos de sus tablas */
+    for (; j + 4 <= L; j += 4)
+    {
+        u0 = _mm_loadu_ps(&p0[j].re);
+        u1 = _mm_loadu_ps(&p0[j + 2].re);
+        a0r = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+        a0i = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(3, 1, 3, 1));
+        u0 = _mm_loadu_ps(&p1[j].re);
+        u1 = _mm_loadu_ps(&p1[j + 2].re);
+        a1r = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+        a1i = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(3, 1, 3, 1));
+        u0 = _mm_loadu_ps(&p2[j].re);
+        u1 = _mm_loadu_ps(&p2[j + 2].re);
+        a2r = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+        a2i = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(3, 1, 3, 1));
+        u0 = _mm_loadu_ps(&p3[j].re);
+        u1 = _mm_loadu_ps(&p3[j + 2].re);
+        a3r = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+        a3i = _mm_shuffle_ps(u0, u1, _MM_SHUFFLE(3, 1, 3, 1));
+
+        /* t1 = W^j a2, t2 = W^2j a1, t3 = W^3j a3 */
+        u0 = _mm_loadu_ps(&w1r[j]);
+        u1 = _mm_loadu_ps(&w1i[j]);
+        t1r = _mm_sub_ps(_mm_mul_ps(a2r, u0), _mm_mul_ps(a2i, u1));
+        t1i = _mm_add_ps(_mm_mul_ps(a2r, u1), _mm_mul_ps(a2i, u0));
+        u0 = _mm_loadu_ps(&w2r[j]);
+        u1 = _mm_loadu_ps(&w2i[j]);
+        t2r = _mm_sub_ps(_mm_mul_ps(a1r, u0), _mm_mul_ps(a1i, u1));
+        t2i = _mm_add_ps(_mm_mul_ps(a1r, u1), _mm_mul_ps(a1i, u0));
+        u0 = _mm_loadu_ps(&w3r[j]);
+        u1 = _mm_loadu_ps(&w3i[j]);
+        t3r = _mm_sub_ps(_mm_mul_ps(a3r, u0), _mm_mul_ps(a3i, u1));
+        t3i = _mm_add_ps(_mm_mul_ps(a3r, u1), _mm_mul_ps(a3i, u0));
+
+        s0r = _mm_add_ps(a0r, t2r);
+        s0i = _mm_add_ps(a0i, t2i);
+        s1r = _mm_sub_ps(a0r, t2r);
+        s1i = _mm_sub_ps(a0i, t2i);
+        s2r = _mm_add_ps(t1r, t3r);
+        s2i = _mm_add_ps(t1i, t3i);
+        s3r = _mm_sub_ps(t1r, t3r);
+        s3i = _mm_sub_ps(t1i, t3i);
+
+        /* Salidas reentrelazadas en COMPLEJO */
+        a0r = _mm_add_ps(s0r, s2r);
+        a0i = _mm_add_ps(s0i, s2i);
+        _mm_storeu_ps(&p0[j].re, _mm_unpacklo_ps(a0r, a0i));
+        _mm_storeu_ps(&p0[j + 2].re, _mm_unpackhi_ps(a0r, a0i));
+        a1r = _mm_add_ps(s1r, s3i);
+        a1i = _mm_sub_ps(s1i, s3r);
+        _mm_storeu_ps(&p1[j].re, _mm_unpacklo_ps(a1r, a1i));
+        _mm_storeu_ps(&p1[j + 2].re, _mm_unpackhi_ps(a1r, a1i));
+        a2r = _mm_sub_ps(s0r, s2r);
+        a2i = _mm_sub_ps(s0i, s2i);
+        _mm_storeu_ps(&p2[j].re, _mm_unpacklo_ps(a2r, a2i));
+        _mm_storeu_ps(&p2[j + 2].re, _mm_unpackhi_ps(a2r, a2i));
+        a3r = _mm_sub_ps(s1r, s3i);
+        a3i = _mm_add_ps(s1i, s3r);
+        _mm_storeu_ps(&p3[j].re, _mm_unpacklo_ps(a3r, a3i));
+        _mm_storeu_ps(&p3[j + 2].re, _mm_unpackhi_ps(a3r, a3i));
+    }
+
+    return j;
+}
+#endif
+
+#if defined(__AVX__)
+static void carga_avx_fft(const COMPLEJO *p, __m256 *re, __m256 *im)
+{
+    __m256 u0, u1, v0, v1;
+
+    /* Ocho COMPLEJO -> partes reales e imaginarias en orden: se reúnen primero las mitades de
+     * 128 bits para que el barajado dentro de cada mitad no altere el orden de los elementos */
+    u0 = _mm256_loadu_ps(&p[0].re);
+    u1 = _mm256_loadu_ps(&p[4].re);
+    v0 = _mm256_permute2f128_ps(u0, u1, 0x20);
+    v1 = _mm256_permute2f128_ps(u0, u1, 0x31);
+    *re = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static void guarda_avx_fft(COMPLEJO *p, __m256 re, __m256 im)
+{
+    __m256 v0, v1;
+
+    v0 = _mm256_unpacklo_ps(re, im);
+    v1 = _mm256_unpackhi_ps(re, im);
+    _mm256_storeu_ps(&p[0].re, _mm256_permute2f128_ps(v0, v1, 0x20));
+    _mm256_storeu_ps(&p[4].re, _mm256_permute2f128_ps(v0, v1, 0x31));
+}
+
+static unsigned int mariposas_avx_fft(COMPLEJO *x, unsigned int L, const float *w, unsigned int j)
+{
+    COMPLEJO *p0, *p1, *p2, *p3;
+    const float *w1r, *w1i, *w2r, *w2i, *w3r, *w3i;
+    __m256 a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, u0, u1;
+    __m256 t1r, t1i, t2r, t2i, t3r, t3i;
+    __m256 s0r, s0i, s1r, s1i, s2r, s2i, s3r, s3i;
+
+    p0 = x;
+    p1 = p0 + L;
+    p2 = p1 + L;
+    p3 = p2 + L;
+    w1r = w;
+    w1i = w1r + L;
+    w2r = w1i + L;
+    w2i = w2r + L;
+    w3r = w2i + L;
+    w3i = w3r + L;
+
+    /* Ocho mariposas por iteración, con las mismas operaciones y en el mismo orden que la ruta
+     * escalar */
+    for (; j + 8 <= L; j += 8)
+    {
+        carga_avx_fft(&p0[j], &a0r, &a0i);
+        carga_avx_fft(&p1[j], &a1r, &a1i);
+        carga_avx_fft(&p2[j], &a2r, &a2i);
+        carga_avx_fft(&p3[j], &a3r, &a3i);
+
+        /* t1 = W^j a2, t2 = W^2j a1, t3 = W^3j a3 */
+        u0 = _mm256_loadu_ps(&w1r[j]);
+        u1 = _mm256_loadu_ps(&w1i[j]);
+        t1r = _mm256_sub_ps(_mm256_mul_ps(a2r, u0), _mm256_mul_ps(a2i, u1));
+        t1i = _mm256_add_ps(_mm256_mul_ps(a2r, u1), _mm256_mul_ps(a2i, u0));
+        u0 = _mm256_loadu_ps(&w2r[j]);
+        u1 = _mm256_loadu_ps(&w2i[j]);
+        t2r = _mm256_sub_ps(_mm256_mul_ps(a1r, u0), _mm256_mul_ps(a1i, u1));
+        t2i = _mm256_add_ps(_mm256_mul_ps(a1r, u1), _mm256_mul_ps(a1i, u0));
+        u0 = _mm256_loadu_ps(&w3r[j]);
+        u1 = _mm256_loadu_ps(&w3i[j]);
+        t3r = _mm256_sub_ps(_mm256_mul_ps(a3r, u0), _mm256_mul_ps(a3i, u1));
+        t3i = _mm256_add_ps(_mm256_mul_ps(a3r, u1), _mm256_mul_ps(a3i, u0));
+
+        s0r = _mm256_add_ps(a0r, t2r);
+        s0i = _mm256_add_ps(a0i, t2i);
+        s1r = _mm256_sub_ps(a0r, t2r);
+        s1i = _mm256_sub_ps(a0i, t2i);
+        s2r = _mm256_add_ps(t1r, t3r);
+        s2i = _mm256_add_ps(t1i, t3i);
+        s3r = _mm256_sub_ps(t1r, t3r);
+        s3i = _mm256_sub_ps(t1i, t3i);
+
+        guarda_avx_fft(&p0[j], _mm256_add_ps(s0r, s2r), _mm256_add_ps(s0i, s2i));
+        guarda_avx_fft(&p1[j], _mm256_add_ps(s1r, s3i), _mm256_sub_ps(s1i, s3r));
+        guarda_avx_fft(&p2[j], _mm256_sub_ps(s0r, s2r), _mm256_sub_ps(s0i, s2i));
+        guarda_avx_fft(&p3[j], _mm256_sub_ps(s1r, s3i), _mm256_add_ps(s1i, s3r));
+    }
+
+    return j;
+}
+#endif
+
+static void conjugar_fft(COMPLEJO *x, unsigned int n, float escala)
+{
+    unsigned int i;
+
+    for (i = 0; i < n; i++)
+    {
+        x[i].re = x[i].re * escala;
+        x[i].im = -x[i].im * escala;
+    }
+}
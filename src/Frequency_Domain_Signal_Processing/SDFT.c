@@ -0,0 +1,414 @@
+/** \page sdft SDFT - BANCO DE DFT DESLIZANTE
+ * \brief Módulo de seguimiento de tonos por DFT deslizante para la librería NSDSP
+ *
+ * Este módulo sigue en tiempo real un conjunto reducido de frecuencias conocidas (armónicos
+ * de red, órdenes de eje) sin calcular una FFT completa por muestra. Cada servicio mantiene
+ * K bins de la DFT de las últimas N muestras y los actualiza con O(K) operaciones por
+ * muestra. Sigue el mismo modelo de suscripción que RT_MOMENTOS: un array estático de
+ * servicios que se asignan y liberan por identificador, típicamente uno por canal.
+ *
+ * \section teoria_sdft Teoría
+ *
+ * Para un bin k (en ciclos por ventana, no necesariamente entero) la DFT de la ventana que
+ * termina en n es \f$ X_k(n) = \sum_{m=0}^{N-1} x[n-N+1+m]\, e^{-j 2\pi k m / N} \f$, y
+ * cumple la recursión deslizante:
+ * \f[
+ * X_k(n) = W_k \left( X_k(n-1) - x[n-N] + C_k\, x[n] \right),\qquad
+ * W_k = e^{j 2\pi k / N},\quad C_k = e^{-j 2\pi k}
+ * \f]
+ * con \f$ C_k = 1 \f$ para bins enteros. Los bins son independientes entre sí, por lo que
+ * se almacenan como estructura de arrays (re, im, W, C) y la actualización es un único
+ * bucle sin dependencias entre iteraciones. El bucle recorre grupos de SDFT_CARRILES bins
+ * con un bucle interno de longitud fija, que el compilador vectoriza también con -O2; el
+ * último grupo se completa con bins de coeficientes nulos que permanecen a cero.
+ *
+ * \subsection reanclaje_sdft Reanclaje
+ *
+ * La recursión es marginalmente estable: el redondeo de \f$ W_k \f$ a float hace que
+ * \f$ |W_k| \neq 1 \f$ y el error se acumula sin límite en ejecuciones largas. Cada
+ * \f$ P \f$ ventanas el servicio reancla los bins: durante la última ventana del periodo
+ * un acumulador calcula la DFT directa de esa ventana (al estilo de Goertzel, con un fasor
+ * que se reinicia a 1 en cada ventana) y, al completarla, sustituye a los bins recursivos.
+ * El error queda acotado al de una sola ventana y el coste se reparte uniformemente entre
+ * las muestras (sin picos de cálculo).
+ *
+ * \section uso_sdft Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_SDFT() (llamado automáticamente por Init_NSDSP())
+ * 2. Suscribir un servicio: service = sdft_api.suscribe_sdft(N, bins, K, P)
+ * 3. Procesar muestras: sdft_api.compute_sdft(service, muestra) o compute_bloque_sdft()
+ * 4. Leer los bins en servicios_sdft[service].re / .im o las amplitudes con amplitud_sdft()
+ * 5. Liberar servicio: sdft_api.unsuscribe_sdft(service)
+ *
+ * Ejemplo:
+ * \code
+ * // Armónicos 1..8 de 50 Hz con fs = 3200 Hz y ventana de 640 muestras (0.2 s)
+ * float bins[8];
+ * float amplitud[8];
+ * for (int h = 0; h < 8; h++) bins[h] = 50.0f * (h + 1) * 640.0f / 3200.0f;
+ *
+ * SDFT_SERVICE service = sdft_api.suscribe_sdft(640, bins, 8, 16);
+ * for (int i = 0; i < 10000; i++) {
+ *     sdft_api.compute_sdft(service, obtener_muestra());
+ * }
+ * sdft_api.amplitud_sdft(service, amplitud);
+ * sdft_api.unsuscribe_sdft(service);
+ * \endcode
+ *
+ * \section funciones_sdft Descripción de funciones
+ *
+ * \subsection init_sdft Init_SDFT
+ * Inicializa la estructura de punteros a funciones sdft_api.
+ *
+ * \subsection suscribe_sdft Suscribe_SDFT
+ * Busca un servicio libre, calcula en doble precisión los coeficientes \f$ W_k \f$ y
+ * \f$ C_k \f$ de cada bin y pone a cero el anillo y los bins.
+ * \param n Longitud de la ventana (1 <= n <= MAX_SDFT_LONGITUD)
+ * \param bins Frecuencias de los bins en ciclos por ventana (f N / fs), 0 <= k <= N/2
+ * \param nbins Número de bins (1 <= nbins <= MAX_SDFT_BINS)
+ * \param periodo Ventanas entre reanclajes (0 desactiva el reanclaje)
+ * \return Identificador del servicio (0 a MAX_SDFT-1) o SDFT_NONE si no hay disponibles o
+ * los parámetros no son válidos
+ *
+ * \subsection unsuscribe_sdft Unsuscribe_SDFT
+ * Libera el servicio.
+ * \return SDFT_OK (0) si éxito, SDFT_KO (-1) si el servicio no estaba asignado
+ *
+ * \subsection compute_sdft Compute_SDFT
+ * Actualiza todos los bins con una muestra y, si corresponde, el acumulador de reanclaje.
+ * \return SDFT_OK (0) si éxito, SDFT_KO (-1) si error
+ *
+ * \subsection compute_bloque_sdft Compute_Bloque_SDFT
+ * Aplica Compute_SDFT a un bloque de muestras.
+ * \return SDFT_OK (0) si éxito, SDFT_KO (-1) si error
+ *
+ * \subsection amplitud_sdft Amplitud_SDFT
+ * Estima la amplitud de pico de un tono en cada bin: \f$ 2|X_k|/N \f$ (\f$ |X_k|/N \f$ en
+ * los bins 0 y N/2).
+ * \param amplitud Vector de nbins floats
+ * \return SDFT_OK (0) si éxito, SDFT_KO (-1) si error
+ *
+ * \dot
+ * digraph sdft_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[n]", shape=plaintext];
+ *   RING [label="Anillo N\n(x[n-N])", fillcolor=lightyellow];
+ *   REC [label="X_k = W_k (X_k - x[n-N] + C_k x[n])\nk = 0..K-1", fillcolor=lightblue];
+ *   ACC [label="S_k += x[n] p_k\n(última ventana del periodo)", fillcolor=lightcyan];
+ *   ANCLA [label="Fin de periodo:\nX_k = S_k", shape=diamond, fillcolor=lightyellow];
+ *   OUT [label="servicios_sdft[id].re / im", fillcolor=lightgreen];
+ *
+ *   X -> RING -> REC -> ANCLA;
+ *   X -> ACC -> ANCLA;
+ *   ANCLA -> OUT;
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_sdft Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: banco SDFT con suscripción y reanclaje |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Actualización por grupos de SDFT_CARRILES bins con relleno, vectorizada con -O2 |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "sdft.h"
+#include <stddef.h>
+#include <math.h>
+
+/* Declaración de funciones */
+void Init_SDFT(void);
+SDFT_SERVICE Suscribe_SDFT(unsigned int n, const float *bins, unsigned int nbins, unsigned int periodo);
+int Unsuscribe_SDFT(SDFT_SERVICE id_service);
+int Compute_SDFT(SDFT_SERVICE id_service, float xn);
+int Compute_Bloque_SDFT(SDFT_SERVICE id_service, const float *x, unsigned int nmuestras);
+int Amplitud_SDFT(SDFT_SERVICE id_service, float *amplitud);
+static void actualizar_sdft(SDFT *ps, float xn);
+static void recursion_sdft(float *restrict re, float *restrict im, const float *restrict w_re,
+                           const float *restrict w_im, const float *restrict c_re, const float *restrict c_im,
+                           unsigned int ngrupos, float x_old, float xn);
+static void acumulador_sdft(float *restrict s_re, float *restrict s_im, float *restrict p_re,
+                            float *restrict p_im, const float *restrict w_re, const float *restrict w_im,
+                            unsigned int ngrupos, float xn);
+
+/* Atributos */
+SDFT servicios_sdft[MAX_SDFT];
+SDFT_API sdft_api;
+
+/* Definición de funciones */
+
+void Init_SDFT(void)
+{
+    /* Inicializar punteros de la API */
+    sdft_api.suscribe_sdft = Suscribe_SDFT;
+    sdft_api.unsuscribe_sdft = Unsuscribe_SDFT;
+    sdft_api.compute_sdft = Compute_SDFT;
+    sdft_api.compute_bloque_sdft = Compute_Bloque_SDFT;
+    sdft_api.amplitud_sdft = Amplitud_SDFT;
+}
+
+SDFT_SERVICE Suscribe_SDFT(unsigned int n, const float *bins, unsigned int nbins, unsigned int periodo)
+{
+    static SDFT_SERVICE service = 0;
+    SDFT_SERVICE result;
+    SDFT *ps;
+    unsigned int checked, k, i;
+    double fase;
+
+    if (bins == NULL || n == 0 || n > MAX_SDFT_LONGITUD || nbins == 0 || nbins > MAX_SDFT_BINS)
+    {
+        return (SDFT_SERVICE)(SDFT_NONE);
+    }
+
+    for (k = 0; k < nbins; k++)
+    {
+        if (!(bins[k] >= 0.0f) || bins[k] > 0.5f * (float)n)
+        {
+            return (SDFT_SERVICE)(SDFT_NONE);
+        }
+    }
+
+    /* Búsqueda circular de un servicio libre, como en RT_MOMENTOS */
+    result = (SDFT_SERVICE)(SDFT_NONE);
+    for (checked = 0; checked < MAX_SDFT && result == SDFT_NONE; checked++)
+    {
+        if (servicios_sdft[service].status == SDFT_FREE)
+        {
+            result = service;
+        }
+
+        service++;
+        if (service == MAX_SDFT)
+        {
+            service = 0;
+        }
+    }
+
+    if (result == SDFT_NONE)
+    {
+        return result;
+    }
+
+    ps = &servicios_sdft[result];
+    ps->status = SDFT_ASIGNED;
+    ps->n = n;
+    ps->nbins = nbins;
+    ps->ngrupos = (nbins + SDFT_CARRILES - 1) / SDFT_CARRILES;
+    ps->periodo = periodo;
+    ps->p_write = 0;
+    ps->cuenta = 0;
+
+    /* Coeficientes calculados en doble precisión */
+    for (k = 0; k < nbins; k++)
+    {
+        ps->bin[k] = bins[k];
+
+        fase = 2.0 * FFT_PI * (double)bins[k] / (double)n;
+        ps->w_re[k] = (float)cos(fase);
+        ps->w_im[k] = (float)sin(fase);
+
+        fase = -2.0 * FFT_PI * (double)bins[k];
+        ps->c_re[k] = (float)cos(fase);
+        ps->c_im[k] = (float)sin(fase);
+
+        ps->re[k] = 0.0f;
+        ps->im[k] = 0.0f;
+        ps->s_re[k] = 0.0f;
+        ps->s_im[k] = 0.0f;
+        ps->p_re[k] = 1.0f;
+        ps->p_im[k] = 0.0f;
+    }
+
+    /* Relleno del último grupo: W = C = p = 0 mantiene X_k = S_k = 0 */
+    for (; k < ps->ngrupos * SDFT_CARRILES; k++)
+    {
+        ps->bin[k] = 0.0f;
+        ps->w_re[k] = 0.0f;
+        ps->w_im[k] = 0.0f;
+        ps->c_re[k] = 0.0f;
+        ps->c_im[k] = 0.0f;
+        ps->re[k] = 0.0f;
+        ps->im[k] = 0.0f;
+        ps->s_re[k] = 0.0f;
+        ps->s_im[k] = 0.0f;
+        ps->p_re[k] = 0.0f;
+        ps->p_im[k] = 0.0f;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        ps->anillo[i] = 0.0f;
+    }
+
+    return result;
+}
+
+int Unsuscribe_SDFT(SDFT_SERVICE id_service)
+{
+    int result;
+
+    result = SDFT_KO;
+
+    if (id_service >= 0 && id_service < MAX_SDFT && servicios_sdft[id_service].status == SDFT_ASIGNED)
+    {
+        servicios_sdft[id_service].status = SDFT_FREE;
+        result = SDFT_OK;
+    }
+
+    return result;
+}
+
+int Compute_SDFT(SDFT_SERVICE id_service, float xn)
+{
+    if (id_service < 0 || id_service >= MAX_SDFT || servicios_sdft[id_service].status != SDFT_ASIGNED)
+    {
+        return SDFT_KO;
+    }
+
+    actualizar_sdft(&servicios_sdft[id_service], xn);
+
+    return SDFT_OK;
+}
+
+int Compute_Bloque_SDFT(SDFT_SERVICE id_service, const float *x, unsigned int nmuestras)
+{
+    unsigned int i;
+    SDFT *ps;
+
+    if (id_service < 0 || id_service >= MAX_SDFT || servicios_sdft[id_service].status != SDFT_ASIGNED ||
+        (x == NULL && nmuestras > 0))
+    {
+        return SDFT_KO;
+    }
+
+    ps = &servicios_sdft[id_service];
+    for (i = 0; i < nmuestras; i++)
+    {
+        actualizar_sdft(ps, x[i]);
+    }
+
+    return SDFT_OK;
+}
+
+int Amplitud_SDFT(SDFT_SERVICE id_service, float *amplitud)
+{
+    unsigned int k;
+    float escala;
+    SDFT *ps;
+
+    if (id_service < 0 || id_service >= MAX_SDFT || servicios_sdft[id_service].status != SDFT_ASIGNED ||
+        amplitud == NULL)
+    {
+        return SDFT_KO;
+    }
+
+    ps = &servicios_sdft[id_service];
+    for (k = 0; k < ps->nbins; k++)
+    {
+        /* DC y Nyquist no tienen imagen espectral */
+        escala = (ps->bin[k] == 0.0f || ps->bin[k] == 0.5f * (float)ps->n) ? 1.0f : 2.0f;
+        amplitud[k] = escala * sqrtf(ps->re[k] * ps->re[k] + ps->im[k] * ps->im[k]) / (float)ps->n;
+    }
+
+    return SDFT_OK;
+}
+
+static void actualizar_sdft(SDFT *ps, float xn)
+{
+    unsigned int k;
+    float x_old;
+
+    /* Anillo: x[n-N] sale, x[n] entra */
+    x_old = ps->anillo[ps->p_write];
+    ps->anillo[ps->p_write] = xn;
+    ps->p_write = (ps->p_write + 1 == ps->n) ? 0 : ps->p_write + 1;
+
+    recursion_sdft(ps->re, ps->im, ps->w_re, ps->w_im, ps->c_re, ps->c_im, ps->ngrupos, x_old, xn);
+
+    if (ps->periodo == 0)
+    {
+        return;
+    }
+
+    /* Acumulador de reanclaje durante la última ventana del periodo */
+    ps->cuenta++;
+    if (ps->cuenta > (ps->periodo - 1) * ps->n)
+    {
+        acumulador_sdft(ps->s_re, ps->s_im, ps->p_re, ps->p_im, ps->w_re, ps->w_im, ps->ngrupos, xn);
+
+        /* Ventana completa: los bins se sustituyen por la DFT directa (el relleno sigue a cero) */
+        if (ps->cuenta == ps->periodo * ps->n)
+        {
+            for (k = 0; k < ps->nbins; k++)
+            {
+                ps->re[k] = ps->s_re[k];
+                ps->im[k] = ps->s_im[k];
+                ps->s_re[k] = 0.0f;
+                ps->s_im[k] = 0.0f;
+                ps->p_re[k] = 1.0f;
+                ps->p_im[k] = 0.0f;
+            }
+            ps->cuenta = 0;
+        }
+    }
+}
+
+static void recursion_sdft(float *restrict re, float *restrict im, const float *restrict w_re,
+                           const float *restrict w_im, const float *restrict c_re, const float *restrict c_im,
+                           unsigned int ngrupos, float x_old, float xn)
+{
+    unsigned int g, j;
+    float t_re, t_im;
+
+    /* X_k = W_k (X_k - x[n-N] + C_k x[n]), sin dependencias entre bins. Cada grupo de
+     * SDFT_CARRILES bins es un bucle de longitud fija que se traduce a operaciones SIMD */
+    for (g = ngrupos; g > 0; g--)
+    {
+        for (j = 0; j < SDFT_CARRILES; j++)
+        {
+            t_re = re[j] - x_old + c_re[j] * xn;
+            t_im = im[j] + c_im[j] * xn;
+            re[j] = w_re[j] * t_re - w_im[j] * t_im;
+            im[j] = w_re[j] * t_im + w_im[j] * t_re;
+        }
+        re += SDFT_CARRILES;
+        im += SDFT_CARRILES;
+        w_re += SDFT_CARRILES;
+        w_im += SDFT_CARRILES;
+        c_re += SDFT_CARRILES;
+        c_im += SDFT_CARRILES;
+    }
+}
+
+static void acumulador_sdft(float *restrict s_re, float *restrict s_im, float *restrict p_re,
+                            float *restrict p_im, const float *restrict w_re, const float *restrict w_im,
+                            unsigned int ngrupos, float xn)
+{
+    unsigned int g, j;
+    float pr;
+
+    /* S_k += x[n] p_k, p_k *= conj(W_k), por grupos como recursion_sdft */
+    for (g = ngrupos; g > 0; g--)
+    {
+        for (j = 0; j < SDFT_CARRILES; j++)
+        {
+            s_re[j] += xn * p_re[j];
+            s_im[j] += xn * p_im[j];
+            pr = p_re[j];
+            p_re[j] = pr * w_re[j] + p_im[j] * w_im[j];
+            p_im[j] = p_im[j] * w_re[j] - pr * w_im[j];
+        }
+        s_re += SDFT_CARRILES;
+        s_im += SDFT_CARRILES;
+        p_re += SDFT_CARRILES;
+        p_im += SDFT_CARRILES;
+        w_re += SDFT_CARRILES;
+        w_im += SDFT_CARRILES;
+    }
+}
@@ -0,0 +1,377 @@
+/** \page stft STFT - TRANSFORMADA DE FOURIER DE TIEMPO CORTO
+ * \brief Módulo de STFT en streaming para la librería NSDSP
+ *
+ * Este módulo calcula espectros de tiempo corto de una señal real recibida muestra a muestra
+ * o por bloques, con el mismo estilo de empuje que Dwt(): cada llamada entrega muestras nuevas
+ * y, cuando corresponde, se obtiene una trama espectral. El objeto mantiene un buffer circular
+ * con las últimas N muestras y emite la FFT real de la trama enventanada cada hop muestras.
+ * Las tablas (plan real, ventana y anillo) las proporciona el llamante, por lo que no se
+ * reserva memoria dinámica, y la trama se escribe directamente en el buffer de destino.
+ *
+ * \section teoria_stft Teoría
+ *
+ * La trama m-ésima es la DFT de N puntos del segmento que termina en la muestra actual,
+ * multiplicado por la ventana w:
+ * \f[
+ * X_m[k] = \sum_{i=0}^{N-1} w[i]\, x[n_m - N + 1 + i]\, e^{-j 2\pi k i / N},
+ * \qquad n_m = n_0 + m \cdot hop
+ * \f]
+ * donde \f$ n_0 \f$ es la muestra con la que se llena el anillo por primera vez. Las ventanas
+ * se generan en su forma periódica (DFT-par), que cumple la condición de suma constante con
+ * solapamiento (COLA): Hann y Hamming con hop = N/2 y Blackman con hop = N/3.
+ *
+ * \section uso_stft Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_STFT() e Init_FFT() (llamados automáticamente por Init_NSDSP())
+ * 2. Crear un plan real de N puntos con fft_api.get_rplan()
+ * 3. Precalcular la ventana con stft_api.get_ventana()
+ * 4. Crear el objeto con stft_api.get_stft()
+ * 5. Empujar muestras con stft_api.stft() o bloques con stft_api.stft_bloque()
+ *
+ * Ejemplo de uso:
+ * \code
+ * #include "stft.h"
+ *
+ * static COMPLEJO twiddle[RFFT_TWIDDLE_SIZE(256)];
+ * static unsigned int bitrev[RFFT_BITREV_SIZE(256)];
+ * static float ventana[256], anillo[256];
+ * static COMPLEJO trama[128];
+ *
+ * void procesar(float xin) {
+ *     static RFFT_PLAN plan;
+ *     static STFT_OBJECT obj;
+ *     static int creado = 0;
+ *
+ *     if (!creado) {
+ *         fft_api.get_rplan(256, twiddle, bitrev, &plan);
+ *         stft_api.get_ventana(HANN, 256, ventana);
+ *         stft_api.get_stft(256, 64, &plan, ventana, anillo, &obj);
+ *         creado = 1;
+ *     }
+ *
+ *     if (stft_api.stft(xin, trama, &obj) == 1) {
+ *         // trama contiene el espectro empaquetado (formato de rfft)
+ *     }
+ * }
+ * \endcode
+ *
+ * \section funciones_stft Descripción de funciones
+ *
+ * \subsection init_stft_func Init_STFT
+ * Inicializa la estructura de punteros a funciones stft_api con get_ventana_stft, get_stft,
+ * stft y stft_bloque.
+ *
+ * \subsection get_ventana_stft_func get_ventana_stft
+ * Calcula en doble precisión los N coeficientes de una ventana RECTANGULAR, HANN, HAMMING o
+ * BLACKMAN en su forma periódica. La ventana se calcula una vez y puede compartirse entre
+ * varios objetos STFT.
+ * \param tipo Tipo de ventana
+ * \param n Número de coeficientes
+ * \param ventana Buffer de n floats
+ * \return STFT_OK (0) si éxito, STFT_KO (-1) si error
+ *
+ * \subsection get_stft_func get_stft
+ * Inicializa un objeto STFT_OBJECT y pone a cero el anillo.
+ * \param n Tamaño de trama (debe coincidir con el del plan real)
+ * \param hop Salto entre tramas (1 <= hop <= n)
+ * \param plan Plan real de n puntos
+ * \param ventana Ventana de n coeficientes
+ * \param anillo Buffer circular de n floats
+ * \param pstft Objeto a inicializar
+ * \return STFT_OK (0) si éxito, STFT_KO (-1) si error
+ *
+ * \subsection stft_func stft
+ * Empuja una muestra. La primera trama se emite al recibir la muestra N y, a partir de ahí,
+ * una cada hop muestras. La trama se construye desenrollando el anillo (dos tramos contiguos)
+ * y aplicando la ventana directamente sobre el buffer de destino, donde se calcula la FFT
+ * real in-place; no hay copias intermedias.
+ * \param xin Nueva muestra
+ * \param trama Destino de n/2 COMPLEJO (espectro empaquetado de rfft)
+ * \param pstft Objeto STFT
+ * \return 1 si se ha emitido una trama, 0 si no, STFT_KO (-1) si error
+ *
+ * \subsection stft_bloque_func stft_bloque
+ * Empuja un bloque de muestras. Las muestras se copian al anillo por tramos hasta la siguiente
+ * trama y las tramas emitidas se escriben consecutivamente en tramas (n/2 COMPLEJO cada una).
+ * Antes de consumir el bloque se comprueba que caben todas las tramas que va a producir; si no
+ * caben se devuelve error sin modificar el objeto. El resultado es idéntico a empujar las
+ * mismas muestras con stft().
+ * \param x Bloque de muestras
+ * \param nmuestras Número de muestras del bloque
+ * \param tramas Destino de max_tramas × n/2 COMPLEJO
+ * \param max_tramas Capacidad del destino en tramas
+ * \param pstft Objeto STFT
+ * \return Número de tramas emitidas (>= 0) o STFT_KO (-1) si error
+ *
+ * \dot
+ * digraph stft_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[n]", shape=plaintext];
+ *   RING [label="Anillo\nN muestras", fillcolor=lightyellow];
+ *   HOP [label="cuenta >= hop\ny anillo lleno", shape=diamond, fillcolor=lightcyan];
+ *   WIN [label="Desenrollar\n× ventana", fillcolor=lightblue];
+ *   RFFT [label="rfft in-place\nen la trama", fillcolor=lightblue];
+ *   OUT [label="Trama\n(buffer llamante)", fillcolor=lightgreen];
+ *
+ *   X -> RING -> HOP;
+ *   HOP -> WIN [label="Sí"];
+ *   WIN -> RFFT -> OUT;
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_stft Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: STFT en streaming con ventanas precalculadas |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "stft.h"
+#include <stddef.h>
+#include <math.h>
+
+/* Declaración de funciones */
+void Init_STFT(void);
+int get_ventana_stft(STFT_VENTANA tipo, unsigned int n, float *ventana);
+int get_stft(unsigned int n, unsigned int hop, RFFT_PLAN *plan, const float *ventana,
+             float *anillo, STFT_OBJECT *pstft);
+int stft(float xin, COMPLEJO *trama, STFT_OBJECT *pstft);
+int stft_bloque(const float *x, unsigned int nmuestras, COMPLEJO *tramas, unsigned int max_tramas,
+                STFT_OBJECT *pstft);
+static int objeto_valido_stft(STFT_OBJECT *pstft);
+static unsigned int pendientes_stft(STFT_OBJECT *pstft);
+static void emitir_trama_stft(STFT_OBJECT *pstft, COMPLEJO *trama);
+
+/* Declaración de objetos */
+STFT_API stft_api;
+
+/* Definición de funciones */
+
+void Init_STFT(void)
+{
+    /* Inicializar punteros de la API */
+    stft_api.get_ventana = get_ventana_stft;
+    stft_api.get_stft = get_stft;
+    stft_api.stft = stft;
+    stft_api.stft_bloque = stft_bloque;
+}
+
+int get_ventana_stft(STFT_VENTANA tipo, unsigned int n, float *ventana)
+{
+    unsigned int i;
+    double fase;
+
+    if (ventana == NULL || n == 0)
+    {
+        return STFT_KO;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        fase = 2.0 * FFT_PI * (double)i / (double)n;
+
+        switch (tipo)
+        {
+            case RECTANGULAR:
+                ventana[i] = 1.0f;
+                break;
+
+            case HANN:
+                ventana[i] = (float)(0.5 - 0.5 * cos(fase));
+                break;
+
+            case HAMMING:
+                ventana[i] = (float)(0.54 - 0.46 * cos(fase));
+                break;
+
+            case BLACKMAN:
+                ventana[i] = (float)(0.42 - 0.5 * cos(fase) + 0.08 * cos(2.0 * fase));
+                break;
+
+            default:
+                return STFT_KO;
+        }
+    }
+
+    return STFT_OK;
+}
+
+int get_stft(unsigned int n, unsigned int hop, RFFT_PLAN *plan, const float *ventana,
+             float *anillo, STFT_OBJECT *pstft)
+{
+    unsigned int i;
+
+    if (plan == NULL || ventana == NULL || anillo == NULL || pstft == NULL)
+    {
+        return STFT_KO;
+    }
+
+    if (plan->n != n || hop == 0 || hop > n)
+    {
+        return STFT_KO;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        anillo[i] = 0.0f;
+    }
+
+    pstft->n = n;
+    pstft->hop = hop;
+    pstft->plan = plan;
+    pstft->ventana = ventana;
+    pstft->anillo = anillo;
+    pstft->p_write = 0;
+    pstft->llenas = 0;
+    pstft->cuenta = 0;
+    pstft->tramas = 0;
+
+    return STFT_OK;
+}
+
+int stft(float xin, COMPLEJO *trama, STFT_OBJECT *pstft)
+{
+    if (objeto_valido_stft(pstft) != STFT_OK || trama == NULL)
+    {
+        return STFT_KO;
+    }
+
+    pstft->anillo[pstft->p_write] = xin;
+    pstft->p_write++;
+    if (pstft->p_write == pstft->n)
+    {
+        pstft->p_write = 0;
+    }
+
+    if (pstft->llenas < pstft->n)
+    {
+        pstft->llenas++;
+    }
+    pstft->cuenta++;
+
+    if (pendientes_stft(pstft) == 0)
+    {
+        emitir_trama_stft(pstft, trama);
+        return 1;
+    }
+
+    return 0;
+}
+
+int stft_bloque(const float *x, unsigned int nmuestras, COMPLEJO *tramas, unsigned int max_tramas,
+                STFT_OBJECT *pstft)
+{
+    unsigned int i, primera, tramo, hasta_fin, emitidas, necesarias;
+
+    if (objeto_valido_stft(pstft) != STFT_OK || (x == NULL && nmuestras > 0))
+    {
+        return STFT_KO;
+    }
+
+    /* Tramas que producirá el bloque: la primera tras 'primera' muestras y luego cada hop */
+    primera = pendientes_stft(pstft);
+    necesarias = (nmuestras >= primera) ? 1 + (nmuestras - primera) / pstft->hop : 0;
+    if (necesarias > max_tramas || (necesarias > 0 && tramas == NULL))
+    {
+        return STFT_KO;
+    }
+
+    emitidas = 0;
+    while (nmuestras > 0)
+    {
+        /* Copiar hasta la siguiente trama (o hasta el final del bloque) en tramos contiguos */
+        tramo = pendientes_stft(pstft);
+        if (tramo > nmuestras)
+        {
+            tramo = nmuestras;
+        }
+
+        for (i = 0; i < tramo; )
+        {
+            hasta_fin = pstft->n - pstft->p_write;
+            if (hasta_fin > tramo - i)
+            {
+                hasta_fin = tramo - i;
+            }
+
+            for (; hasta_fin > 0; hasta_fin--, i++)
+            {
+                pstft->anillo[pstft->p_write++] = x[i];
+            }
+
+            if (pstft->p_write == pstft->n)
+            {
+                pstft->p_write = 0;
+            }
+        }
+
+        pstft->llenas = (pstft->llenas + tramo < pstft->n) ? pstft->llenas + tramo : pstft->n;
+        pstft->cuenta += tramo;
+        x += tramo;
+        nmuestras -= tramo;
+
+        if (pendientes_stft(pstft) == 0)
+        {
+            emitir_trama_stft(pstft, &tramas[emitidas * (pstft->n / 2)]);
+            emitidas++;
+        }
+    }
+
+    return (int)emitidas;
+}
+
+static int objeto_valido_stft(STFT_OBJECT *pstft)
+{
+    if (pstft == NULL || pstft->plan == NULL || pstft->ventana == NULL || pstft->anillo == NULL ||
+        pstft->n == 0 || pstft->plan->n != pstft->n || pstft->hop == 0 || pstft->hop > pstft->n ||
+        pstft->p_write >= pstft->n)
+    {
+        return STFT_KO;
+    }
+
+    return STFT_OK;
+}
+
+static unsigned int pendientes_stft(STFT_OBJECT *pstft)
+{
+    /* Muestras que faltan para la siguiente trama: llenar el anillo y completar el hop */
+    unsigned int por_llenar, por_hop;
+
+    por_llenar = pstft->n - pstft->llenas;
+    por_hop = (pstft->cuenta < pstft->hop) ? pstft->hop - pstft->cuenta : 0;
+
+    return (por_llenar > por_hop) ? por_llenar : por_hop;
+}
+
+static void emitir_trama_stft(STFT_OBJECT *pstft, COMPLEJO *trama)
+{
+    unsigned int i, tramo;
+    float *destino;
+    const float *w;
+
+    /* Desenrollar el anillo desde la muestra más antigua aplicando la ventana */
+    destino = (float *)trama;
+    w = pstft->ventana;
+    tramo = pstft->n - pstft->p_write;
+
+    for (i = 0; i < tramo; i++)
+    {
+        destino[i] = w[i] * pstft->anillo[pstft->p_write + i];
+    }
+    for (i = tramo; i < pstft->n; i++)
+    {
+        destino[i] = w[i] * pstft->anillo[i - tramo];
+    }
+
+    /* FFT real in-place sobre el buffer del llamante */
+    fft_api.rfft(pstft->plan, destino, trama);
+
+    pstft->cuenta = 0;
+    pstft->tramas++;
+}
@@ -0,0 +1,288 @@
+/** \page welch WELCH - DENSIDAD ESPECTRAL DE POTENCIA
+ * \brief Módulo de estimación de la PSD por el método de Welch para la librería NSDSP
+ *
+ * Este módulo estima la densidad espectral de potencia (PSD) unilateral de varias señales
+ * reales mediante el periodograma promediado de Welch: la señal se divide en segmentos
+ * solapados de N muestras, cada segmento se enventana y transforma con la FFT real y
+ * \f$ |X|^2 \f$ se acumula en una media que se actualiza con cada segmento. La segmentación
+ * reutiliza los objetos STFT_OBJECT del módulo STFT (un anillo por canal) y todos los canales
+ * comparten un único plan real, una única ventana y una única trama de trabajo.
+ *
+ * \section teoria_welch Teoría
+ *
+ * Para cada segmento m de un canal se calcula el periodograma modificado unilateral:
+ * \f[
+ * P_m[k] = \frac{c_k\, |X_m[k]|^2}{f_s \sum_{i=0}^{N-1} w[i]^2},\qquad
+ * c_k = \begin{cases} 1 & k = 0,\ N/2 \\ 2 & 0 < k < N/2 \end{cases}
+ * \f]
+ * de modo que \f$ \sum_k P[k]\, f_s/N \f$ es la potencia de la señal (unidades²/Hz). La
+ * estimación se actualiza con cada segmento como:
+ * \f[
+ * \hat{P} \leftarrow \hat{P} + \alpha_m (P_m - \hat{P}),\qquad
+ * \alpha_m = \begin{cases} 1/m & \lambda = 0 \\ \max\left(1/m,\ 1 - \lambda\right) & 0 < \lambda < 1 \end{cases}
+ * \f]
+ * Con \f$ \lambda = 0 \f$ es la media aritmética de todos los segmentos (Welch clásico); con
+ * \f$ 0 < \lambda < 1 \f$ empieza como media aritmética y pasa a un olvido exponencial con
+ * memoria efectiva \f$ 1/(1-\lambda) \f$ segmentos, sin el sesgo inicial de arrancar en cero.
+ *
+ * \section uso_welch Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_Welch() (llamado automáticamente por Init_NSDSP())
+ * 2. Crear un plan real de N puntos con fft_api.get_rplan() y una ventana con stft_api.get_ventana()
+ * 3. Crear el objeto con welch_api.get_welch() y un workspace de WELCH_WORKSPACE(N, canales) floats
+ * 4. Entregar bloques de muestras de todos los canales con welch_api.welch()
+ * 5. Leer la PSD en pwelch->psd y, si se desea, reiniciar la media con welch_api.reset()
+ *
+ * Ejemplo de uso:
+ * \code
+ * #include "welch.h"
+ *
+ * static COMPLEJO twiddle[RFFT_TWIDDLE_SIZE(512)];
+ * static unsigned int bitrev[RFFT_BITREV_SIZE(512)];
+ * static float ventana[512];
+ * static float workspace[WELCH_WORKSPACE(512, 4)];
+ * static WELCH_OBJECT psd;
+ * static RFFT_PLAN plan;
+ *
+ * void inicio(void) {
+ *     fft_api.get_rplan(512, twiddle, bitrev, &plan);
+ *     stft_api.get_ventana(HANN, 512, ventana);
+ *     welch_api.get_welch(512, 256, 4, 1000.0f, 0.0f, &plan, ventana, workspace, &psd);
+ * }
+ *
+ * void bloque(const float *x) {     // 4 canales × 100 muestras, canal a canal
+ *     welch_api.welch(x, 100, &psd);
+ *     // psd.psd[c * 257 + k]: PSD del canal c en la frecuencia k * 1000 / 512 Hz
+ * }
+ * \endcode
+ *
+ * \section funciones_welch Descripción de funciones
+ *
+ * \subsection init_welch_func Init_Welch
+ * Inicializa la estructura de punteros a funciones welch_api con get_welch, welch y reset_welch.
+ *
+ * \subsection get_welch_func get_welch
+ * Inicializa el objeto, reparte el workspace (anillos, PSD y trama) y calcula la escala
+ * \f$ 1/(f_s \sum w^2) \f$. Requiere que Init_STFT() e Init_FFT() se hayan llamado.
+ * \param n Tamaño de segmento (debe coincidir con el del plan real)
+ * \param hop Salto entre segmentos (n - solape, 1 <= hop <= n)
+ * \param canales Número de canales (1 <= canales <= MAX_WELCH_CANALES)
+ * \param fs Frecuencia de muestreo en Hz (> 0)
+ * \param olvido Factor de olvido \f$ \lambda \in [0, 1) \f$
+ * \param plan Plan real de n puntos compartido por todos los canales
+ * \param ventana Ventana de n coeficientes
+ * \param workspace Buffer de WELCH_WORKSPACE(n, canales) floats
+ * \param pwelch Objeto a inicializar
+ * \return WELCH_OK (0) si éxito, WELCH_KO (-1) si error
+ *
+ * \subsection welch_func welch
+ * Procesa un bloque de nmuestras por canal, dispuesto canal a canal
+ * (x[c * nmuestras + i]). Cada canal se segmenta en tramos de como máximo hop muestras, de
+ * modo que cada llamada a stft_bloque produce a lo sumo un segmento, que se acumula en la PSD
+ * del canal usando la trama compartida. El bloque puede tener cualquier longitud; los
+ * segmentos que crucen bloques se completan en las llamadas siguientes.
+ * \param x Bloque de canales × nmuestras floats
+ * \param nmuestras Muestras por canal
+ * \param pwelch Objeto Welch
+ * \return Número de segmentos acumulados en total (>= 0) o WELCH_KO (-1) si error
+ *
+ * \subsection reset_welch_func reset_welch
+ * Pone a cero la PSD y el contador de segmentos de todos los canales para comenzar una nueva
+ * estimación. Las muestras de los anillos se conservan, por lo que el siguiente segmento
+ * respeta el solape con el anterior.
+ * \param pwelch Objeto Welch
+ * \return WELCH_OK (0) si éxito, WELCH_KO (-1) si error
+ *
+ * \dot
+ * digraph welch_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[c][n]", shape=plaintext];
+ *   STFT [label="STFT_OBJECT\n(canal c)", fillcolor=lightyellow];
+ *   RFFT [label="Ventana + rfft\n(plan compartido)", fillcolor=lightblue];
+ *   POW [label="c_k |X|² · escala", fillcolor=lightblue];
+ *   AVG [label="Media\n(aritmética / olvido)", fillcolor=lightcyan];
+ *   PSD [label="psd[c][k]", fillcolor=lightgreen];
+ *
+ *   X -> STFT -> RFFT -> POW -> AVG -> PSD;
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_welch Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: PSD de Welch multicanal con olvido exponencial |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "welch.h"
+#include <stddef.h>
+
+/* Declaración de funciones */
+void Init_Welch(void);
+int get_welch(unsigned int n, unsigned int hop, unsigned int canales, float fs, float olvido,
+              RFFT_PLAN *plan, const float *ventana, float *workspace, WELCH_OBJECT *pwelch);
+int welch(const float *x, unsigned int nmuestras, WELCH_OBJECT *pwelch);
+int reset_welch(WELCH_OBJECT *pwelch);
+static void acumular_welch(WELCH_OBJECT *pwelch, unsigned int canal);
+
+/* Declaración de objetos */
+WELCH_API welch_api;
+
+/* Definición de funciones */
+
+void Init_Welch(void)
+{
+    /* Inicializar punteros de la API */
+    welch_api.get_welch = get_welch;
+    welch_api.welch = welch;
+    welch_api.reset = reset_welch;
+}
+
+int get_welch(unsigned int n, unsigned int hop, unsigned int canales, float fs, float olvido,
+              RFFT_PLAN *plan, const float *ventana, float *workspace, WELCH_OBJECT *pwelch)
+{
+    unsigned int c, i;
+    double energia;
+
+    if (plan == NULL || ventana == NULL || workspace == NULL || pwelch == NULL)
+    {
+        return WELCH_KO;
+    }
+
+    if (canales == 0 || canales > MAX_WELCH_CANALES || !(fs > 0.0f) || olvido < 0.0f || olvido >= 1.0f)
+    {
+        return WELCH_KO;
+    }
+
+    /* Energía de la ventana para la normalización */
+    energia = 0.0;
+    for (i = 0; i < n && i < plan->n; i++)
+    {
+        energia += (double)ventana[i] * (double)ventana[i];
+    }
+    if (!(energia > 0.0))
+    {
+        return WELCH_KO;
+    }
+
+    /* Reparto del workspace: anillos, PSD y trama */
+    for (c = 0; c < canales; c++)
+    {
+        if (stft_api.get_stft(n, hop, plan, ventana, &workspace[c * n], &pwelch->stft[c]) != STFT_OK)
+        {
+            return WELCH_KO;
+        }
+    }
+
+    pwelch->n = n;
+    pwelch->canales = canales;
+    pwelch->olvido = olvido;
+    pwelch->escala = (float)(1.0 / ((double)fs * energia));
+    pwelch->psd = &workspace[canales * n];
+    pwelch->trama = (COMPLEJO *)&workspace[canales * n + canales * (n / 2 + 1)];
+
+    return reset_welch(pwelch);
+}
+
+int welch(const float *x, unsigned int nmuestras, WELCH_OBJECT *pwelch)
+{
+    unsigned int c, posicion, tramo, total;
+    int ret;
+
+    if (pwelch == NULL || pwelch->psd == NULL || pwelch->trama == NULL ||
+        pwelch->canales == 0 || pwelch->canales > MAX_WELCH_CANALES || (x == NULL && nmuestras > 0))
+    {
+        return WELCH_KO;
+    }
+
+    total = 0;
+    for (c = 0; c < pwelch->canales; c++)
+    {
+        /* Tramos de hop muestras: como mucho un segmento por llamada a stft_bloque */
+        for (posicion = 0; posicion < nmuestras; posicion += tramo)
+        {
+            tramo = pwelch->stft[c].hop;
+            if (tramo > nmuestras - posicion)
+            {
+                tramo = nmuestras - posicion;
+            }
+
+            ret = stft_api.stft_bloque(&x[c * nmuestras + posicion], tramo, pwelch->trama, 1, &pwelch->stft[c]);
+            if (ret < 0)
+            {
+                return WELCH_KO;
+            }
+
+            if (ret == 1)
+            {
+                acumular_welch(pwelch, c);
+                total++;
+            }
+        }
+    }
+
+    return (int)total;
+}
+
+int reset_welch(WELCH_OBJECT *pwelch)
+{
+    unsigned int c, k, bins;
+
+    if (pwelch == NULL || pwelch->psd == NULL || pwelch->canales > MAX_WELCH_CANALES)
+    {
+        return WELCH_KO;
+    }
+
+    bins = pwelch->n / 2 + 1;
+    for (c = 0; c < pwelch->canales; c++)
+    {
+        for (k = 0; k < bins; k++)
+        {
+            pwelch->psd[c * bins + k] = 0.0f;
+        }
+        pwelch->segmentos[c] = 0;
+    }
+
+    return WELCH_OK;
+}
+
+static void acumular_welch(WELCH_OBJECT *pwelch, unsigned int canal)
+{
+    unsigned int k, mitad;
+    float alfa, escala, potencia;
+    float *psd;
+    const COMPLEJO *X;
+
+    mitad = pwelch->n / 2;
+    psd = &pwelch->psd[canal * (mitad + 1)];
+    X = pwelch->trama;
+
+    /* Media aritmética (alfa = 1/m) que, con olvido, pasa a exponencial (alfa = 1 - lambda) */
+    pwelch->segmentos[canal]++;
+    alfa = 1.0f / (float)pwelch->segmentos[canal];
+    if (pwelch->olvido > 0.0f && alfa < 1.0f - pwelch->olvido)
+    {
+        alfa = 1.0f - pwelch->olvido;
+    }
+
+    escala = pwelch->escala;
+
+    /* DC y Nyquist (empaquetados en X[0]) sin factor 2 */
+    potencia = escala * X[0].re * X[0].re;
+    psd[0] += alfa * (potencia - psd[0]);
+    potencia = escala * X[0].im * X[0].im;
+    psd[mitad] += alfa * (potencia - psd[mitad]);
+
+    escala = 2.0f * escala;
+    for (k = 1; k < mitad; k++)
+    {
+        potencia = escala * (X[k].re * X[k].re + X[k].im * X[k].im);
+        psd[k] += alfa * (potencia - psd[k]);
+    }
+}
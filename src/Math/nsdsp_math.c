@@ -2,8 +2,11 @@
  * \brief Módulo de operaciones matemáticas para la librería NSDSP
  *
  * Este módulo implementa operaciones matemáticas avanzadas para el procesamiento
- * digital de señales, incluyendo operaciones con matrices. El módulo está diseñado
- * para trabajar con memoria estática y ser eficiente en sistemas embebidos.
+ * digital de señales, incluyendo operaciones con matrices y las factorizaciones que necesitan
+ * los estimadores de la librería (mínimos cuadrados, Kalman, RLS, Wiener): Cholesky, LU con
+ * pivotaje parcial, QR de Householder y sustitución triangular. El módulo está diseñado
+ * para trabajar con memoria estática y ser eficiente en sistemas embebidos: ninguna función
+ * reserva memoria y todo el trabajo auxiliar lo aporta quien llama.
  * Utiliza una estructura API para acceder a todas las funciones disponibles.
  *
  * \section uso_math Uso del módulo
@@ -51,13 +54,34 @@
  * }
  * \endcode
  *
+ * Ejemplo de resolución de sistemas con las factorizaciones:
+ * \code
+ * static float a[N * N], l[N * N], b[N * K];
+ * static float ws_qr[NSDSP_MATH_QR_WORKSPACE(N)];
+ * static unsigned int pivotes[N];
+ *
+ * MATRIZ A = {N, N, a}, L = {N, N, l}, B = {N, K, b};
+ *
+ * // A definida positiva: L L^T = A fuera de sitio (A se conserva) y A X = B in situ sobre B
+ * nsdsp_math_api.cholesky(&A, &L);
+ * nsdsp_math_api.resuelve_cholesky(&L, &B);
+ *
+ * // A general: P A = L U in situ sobre A
+ * nsdsp_math_api.lu(&A, &A, pivotes);
+ * nsdsp_math_api.resuelve_lu(&A, pivotes, &B);
+ *
+ * // Mínimos cuadrados con A de M x N (M >= N): la solución queda en las N primeras filas de B
+ * nsdsp_math_api.qr(&A, &A, ws_qr);
+ * nsdsp_math_api.resuelve_qr(&A, ws_qr, &B);
+ * \endcode
+ *
  * \section funciones_math Descripción de funciones
  *
  * \subsection nsdsp_math_init_func nsdsp_math_init
  * Inicializa la estructura de punteros a funciones nsdsp_math_api.
  * Esta función debe ser llamada antes de usar cualquier servicio del módulo.
- * Asigna los punteros a las funciones matriz_producto y matriz_suma en los campos
- * product y suma de la API respectivamente.
+ * Asigna los punteros a las funciones matriz_producto, matriz_suma y a las factorizaciones y
+ * resoluciones en los campos correspondientes de la API.
  *
  * \subsection matriz_producto_func matriz_producto
  * Realiza el producto de dos matrices M1 y M2, almacenando el resultado en M3.
@@ -79,8 +103,8 @@
  *   CHECK_DIM [label="Verificar dimensiones:\ncol(M1)==fil(M2)\nfil(M1)==fil(M3)\ncol(M2)==col(M3)", shape=diamond, fillcolor=lightcyan];
  *   CLEAR_M3 [label="Limpiar M3\na ceros", fillcolor=lightpink];
  *   LOOP_F [label="Para cada fila f\nde M1", shape=diamond, fillcolor=lightblue];
- *   LOOP_C [label="Para cada columna c\nde M2", shape=diamond, fillcolor=lightblue];
- *   CALC_DOT [label="Calcular producto punto:\nM3[f,c] = M1[f,:] · M2[:,c]", fillcolor=lightgreen];
+ *   LOOP_C [label="Para cada columna k\nde M1", shape=diamond, fillcolor=lightblue];
+ *   CALC_DOT [label="Acumular fila contigua:\nM3[f,:] += M1[f,k] · M2[k,:]", fillcolor=lightgreen];
  *   RETURN_OK [label="return NSDSP_MATH_OK", fillcolor=lightgreen];
  *   RETURN_ERROR [label="return NSDSP_MATH_KO", fillcolor=lightcoral];
  *
@@ -92,12 +116,14 @@
  *   CLEAR_M3 -> RETURN_ERROR;
  *   LOOP_F -> LOOP_C [label="f < filas(M1)"];
  *   LOOP_F -> RETURN_OK [label="f >= filas(M1)"];
- *   LOOP_C -> CALC_DOT [label="c < col(M2)"];
- *   LOOP_C -> LOOP_F [label="c >= col(M2)"];
+ *   LOOP_C -> CALC_DOT [label="k < col(M1)"];
+ *   LOOP_C -> LOOP_F [label="k >= col(M1)"];
  *   CALC_DOT -> LOOP_C;
  * }
  * \enddot
  *
+ * El producto usa el mismo núcleo que matriz_producto_vista sobre vistas densas.
+ *
  * \param PM1 Puntero a la primera matriz (a×b)
  * \param PM2 Puntero a la segunda matriz (b×c)
  * \param PM3 Puntero a la matriz resultado (a×c)
@@ -149,6 +175,167 @@
  * \param signo Si >= 0 realiza suma, si < 0 realiza resta
  * \return NSDSP_MATH_OK (0) si la operación se realizó correctamente, NSDSP_MATH_KO (-1) si hubo error
  *
+ * \subsection factorizaciones_math Factorizaciones
+ * Las tres factorizaciones reciben la matriz A y la matriz destino; si ambas comparten buffer
+ * la factorización se hace in situ y, si no, A se copia antes y se conserva. En caso de error
+ * (punteros, dimensiones, matriz no definida positiva o singular) el destino se llena con ceros,
+ * igual que en el producto y la suma.
+ *
+ * \subsubsection matriz_cholesky_func matriz_cholesky
+ * Factoriza una matriz simétrica definida positiva como \f$ A = L L^T \f$. Solo se lee el
+ * triángulo inferior de A; el triángulo superior de L se anula. La factorización se hace por
+ * bloques de NSDSP_MATH_BLOQUE columnas: se factoriza el bloque diagonal, se resuelve el panel
+ * inferior y se actualiza el resto de la matriz por franjas, de modo que las filas del panel se
+ * reutilizan desde la caché en lugar de recorrer la matriz completa en cada columna.
+ * \param PA Matriz A (n×n)
+ * \param PL Factor L (n×n), puede ser PA
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error o A no es definida positiva
+ *
+ * \subsubsection matriz_lu_func matriz_lu
+ * Factoriza \f$ P A = L U \f$ por eliminación de Gauss con pivotaje parcial. L (diagonal
+ * unitaria implícita) queda bajo la diagonal y U sobre ella. pivotes[k] es la fila que se
+ * intercambió con la k en el paso k. Las actualizaciones recorren filas contiguas.
+ * \param PA Matriz A (n×n)
+ * \param PLU Factores L y U (n×n), puede ser PA
+ * \param pivotes Vector de n índices de pivote
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error o A es singular
+ *
+ * \subsubsection matriz_qr_func matriz_qr
+ * Factoriza \f$ A = Q R \f$ con reflexiones de Householder \f$ H_k = I - \tau_k v_k v_k^T \f$.
+ * R queda en el triángulo superior y los vectores \f$ v_k \f$ (con \f$ v_k(k) = 1 \f$ implícito)
+ * bajo la diagonal. Los \f$ \tau_k \f$ quedan en las n primeras posiciones del workspace.
+ * \param PA Matriz A (m×n, m >= n)
+ * \param PQR Factores (m×n), puede ser PA
+ * \param workspace Buffer de NSDSP_MATH_QR_WORKSPACE(n) floats
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error
+ *
+ * \subsection resoluciones_math Resolución de sistemas
+ * Todas las resoluciones trabajan in situ sobre los segundos miembros B (n×k, k columnas
+ * independientes). En caso de error B se llena con ceros.
+ *
+ * \subsubsection matriz_triangular_func matriz_triangular
+ * Resuelve \f$ T X = B \f$ o \f$ T^T X = B \f$ por sustitución hacia delante o hacia atrás.
+ * El tipo combina NSDSP_MATH_INFERIOR o NSDSP_MATH_SUPERIOR con NSDSP_MATH_TRASPUESTA y
+ * NSDSP_MATH_UNIDAD (diagonal unitaria, no se lee). Cada paso actualiza filas completas de B.
+ * \param PT Matriz triangular T (n×n)
+ * \param PB Segundos miembros B (n×k), sustituidos por X
+ * \param tipo Combinación de NSDSP_MATH_INFERIOR/SUPERIOR, TRASPUESTA y UNIDAD
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error o diagonal nula
+ *
+ * \subsubsection matriz_resuelve_func matriz_resuelve_cholesky / matriz_resuelve_lu / matriz_resuelve_qr
+ * Resuelven A X = B a partir de los factores: \f$ L L^T X = B \f$; \f$ L U X = P B \f$; y
+ * \f$ \min \|A X - B\| \f$ aplicando \f$ Q^T \f$ a B (m×k) y resolviendo con R. En la QR la
+ * solución ocupa las n primeras filas de B y las m - n restantes contienen el residuo en la
+ * base de Q, cuya norma es la del residuo de mínimos cuadrados.
+ *
+ * \subsection vistas_math Vistas
+ * Una MATRIZ_VISTA describe una submatriz, una ventana o la traspuesta de otra matriz sin
+ * copiarla: el elemento (i, j) es pmatriz[i * paso + j], o pmatriz[j * paso + i] si la vista
+ * es traspuesta. paso = 0 indica almacenamiento denso, de modo que una vista inicializada a
+ * cero solo necesita dimensiones y puntero.
+ *
+ * \subsubsection matriz_vista_func matriz_vista
+ * Crea la vista de la submatriz de filas×columnas que empieza en (fila, columna) de M, o de su
+ * traspuesta (columnas×filas). Las ventanas deslizantes se obtienen avanzando fila o columna.
+ * \param PM Matriz almacenada
+ * \param fila, columna Esquina superior izquierda de la submatriz
+ * \param filas, columnas Dimensiones de la submatriz en M
+ * \param traspuesta Distinto de 0 para ver la traspuesta
+ * \param PV Vista resultado (pmatriz = NULL si hay error)
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si la submatriz no está dentro de M
+ *
+ * \subsubsection matriz_producto_vista_func matriz_producto_vista
+ * \f$ C = \alpha A B + \beta C \f$ sobre vistas. Con \f$ \beta = 1 \f$ acumula in situ y con
+ * \f$ \beta = 0 \f$ C no se lee. Si las filas de B son contiguas el bucle interno acumula filas
+ * de B sobre filas de C; si B es traspuesta calcula productos escalares de filas contiguas de A y
+ * B, de cuatro en cuatro columnas. Una C traspuesta se calcula como \f$ C^T = \alpha B^T A^T +
+ * \beta C^T \f$. C no puede solaparse con A ni con B.
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error (C se llena con ceros)
+ *
+ * \subsubsection matriz_suma_vista_func matriz_suma_vista
+ * \f$ C = \alpha A + \beta B \f$ elemento a elemento sobre vistas. C puede ser la misma vista
+ * que A o que B (operación in situ).
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error (C se llena con ceros)
+ *
+ * \subsection paralelo_math Cálculo paralelo
+ * La librería no crea hilos: la aplicación registra con matriz_paralelo un NSDSP_MATH_EJECUTOR (su
+ * pool de hilos) y el número de tareas en que se reparte cada operación. matriz_producto y
+ * matriz_producto_vista dividen C en paneles de filas (o de columnas si C tiene menos filas que
+ * tareas) y el lote se divide en grupos de NSDSP_MATH_CARRILES matrices. Los productos de menos
+ * de NSDSP_MATH_PARALELO_MINIMO multiplicaciones se calculan en el hilo llamante. Cada panel
+ * acumula en el mismo orden que el cálculo en serie, por lo que el resultado no depende del
+ * número de tareas. nsdsp_math_init() deja el cálculo en serie.
+ *
+ * \subsubsection matriz_paralelo_func matriz_paralelo
+ * \param ejecutor Ejecutor de la aplicación, NULL para calcular en serie
+ * \param usuario Puntero que se pasa al ejecutor en cada llamada
+ * \param tareas Número de tareas (1..NSDSP_MATH_TAREAS_MAX), normalmente el de hilos del pool
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si tareas no es válido o falta el ejecutor
+ *
+ * \subsection lote_math Lotes de matrices pequeñas
+ * Miles de productos de igual dimensión (4×4 a 32×32) se calculan juntos en disposición SoA
+ * (MATRIZ_LOTE): el bucle interno recorre el mismo elemento de NSDSP_MATH_CARRILES matrices
+ * consecutivas, contiguo en memoria, en lugar de bucles de 4 a 32 iteraciones por matriz.
+ *
+ * \subsubsection matriz_producto_lote_func matriz_producto_lote
+ * \f$ C_l = A_l B_l \f$ para cada matriz l del lote.
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error (C se llena con ceros)
+ *
+ * \subsubsection matriz_entrelaza_lote_func matriz_entrelaza_lote / matriz_separa_lote
+ * Convierten entre matrices densas consecutivas (AoS) y la disposición SoA del lote.
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error
+ *
+ * \subsection dispersa_math Matrices dispersas
+ * MATRIZ_DISPERSA guarda una matriz podada en CSR de bloques de 1 × bloque: cada fila es una lista
+ * de bloques de columnas consecutivas con columna inicial y valores. Con bloque 1 es el CSR clásico;
+ * con bloques de 4 el índice se lee una vez por cada cuatro valores y el producto se desenrolla, lo
+ * que compensa los ceros almacenados dentro de los bloques a partir de densidades medias. Los
+ * buffers son del llamante y su capacidad se expresa en bloques.
+ *
+ * \subsubsection matriz_cuenta_dispersa_func matriz_cuenta_dispersa
+ * Número de bloques con algún \f$ |a_{ij}| > \f$ umbral, para dimensionar los buffers.
+ * \return Número de bloques, 0 si los parámetros no son válidos
+ *
+ * \subsubsection matriz_dispersa_func matriz_dispersa
+ * Convierte una matriz densa a CSR. Los valores con \f$ |a_{ij}| \le \f$ umbral dentro de un
+ * bloque almacenado se guardan como 0, de modo que el resultado es exactamente la densa podada.
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error o capacidad insuficiente
+ *
+ * \subsubsection matriz_producto_disperso_func matriz_producto_disperso
+ * \f$ Y = S X \f$. Con X de una columna (SpMV) cada fila es un producto escalar por bloques; con
+ * bloques 1×4 cada columna del bloque tiene su propia suma parcial, de modo que los bloques completos
+ * de la fila se acumulan como una multiplicación-acumulación de 4 carriles (vector de 128 bits) y
+ * las cuatro sumas se reducen al final de la fila. Con varias columnas (SpMM) cada valor almacenado
+ * acumula una fila contigua de X sobre la de Y en grupos de NSDSP_MATH_DISPERSA_CARRILES columnas
+ * de ancho fijo, que el compilador vectoriza sin intrínsecos, y las columnas restantes una a una.
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si error (Y se llena con ceros)
+ *
+ * \subsection preparada_math Operaciones preparadas
+ * product y suma validan punteros y dimensiones y llenan C con ceros si hay error en cada llamada.
+ * Cuando la misma operación se repite con las mismas dimensiones (capas de una red, bucles de un
+ * filtro), MATRIZ_OPERACION guarda las dimensiones validadas una vez y la ejecución llama
+ * directamente al núcleo, con el mismo resultado que product y suma.
+ *
+ * \subsubsection matriz_prepara_func matriz_prepara_producto / matriz_prepara_suma
+ * Solo se leen las dimensiones de A, B y C; pmatriz puede ser NULL.
+ * \return NSDSP_MATH_OK (0) si éxito, NSDSP_MATH_KO (-1) si son incompatibles (PO->filas = 0)
+ *
+ * \subsubsection matriz_ejecuta_func matriz_ejecuta_producto / matriz_ejecuta_suma
+ * \f$ C = A B \f$ o \f$ C = A \pm B \f$ sin ninguna comprobación: PO debe haberse preparado con
+ * éxito y a, b y c deben tener las dimensiones preparadas.
+ *
+ * \subsection precision_math Variantes de precisión
+ * Los núcleos del producto y la suma y sus entradas comprobadas se generan desde la plantilla
+ * nsdsp_math_tipo.h, incluida una vez por precisión con el tipo de los elementos y el del acumulador:
+ * - product, suma: float. Es el camino de versiones anteriores, con el mismo código generado
+ * - product_d, suma_d: matrices MATRIZ_D, con elementos y acumulación en double
+ * - product_m: matrices MATRIZ float con cada producto escalar acumulado en double y un único redondeo
+ *   a float por elemento de C. No usa el recorrido por filas de B del núcleo float, que acumula sobre
+ *   C en float, y por tanto es más lento que product
+ *
+ * Las variantes double y mixta se calculan siempre en el hilo llamante. Las factorizaciones, vistas,
+ * lotes, matrices dispersas y operaciones preparadas solo existen en float.
+ *
  * \author Dr. Carlos Romero
  *
  * \section historial_math Historial de cambios
@@ -157,21 +344,98 @@
  * | 10/09/2025 | Dr. Carlos Romero | 1 | Implementación inicial con multiplicación de matrices |
  * | 10/09/2025 | Dr. Carlos Romero | 2 | Añadida estructura API para acceso a funciones |
  * | 13/09/2025 | Dr. Carlos Romero | 3 | Añadida función de suma/resta de matrices |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Añadidas factorizaciones de Cholesky por bloques, LU y QR, y sustitución triangular |
+ * | 16/10/2026 | Dr. Carlos Romero | 5 | Añadidas vistas con paso y traspuesta, producto con acumulación y suma in situ |
+ * | 16/10/2026 | Dr. Carlos Romero | 6 | Añadidos producto paralelo sobre ejecutor de la aplicación y producto de lotes SoA |
+ * | 16/10/2026 | Dr. Carlos Romero | 7 | Añadidas matrices dispersas CSR por bloques con SpMV y SpMM |
+ * | 16/10/2026 | Dr. Carlos Romero | 8 | Añadidas operaciones preparadas sin validación por llamada |
+ * | 16/10/2026 | Dr. Carlos Romero | 9 | Producto y suma en doble precisión y producto mixto desde nsdsp_math_tipo.h |
+ * | 16/10/2026 | Dr. Carlos Romero | 10 | SpMV 1×4 con sumas parciales por carril y SpMM por grupos de columnas de ancho fijo |
  *
  * \copyright ZGR R&D AIE
  */
 
 #include "nsdsp_math.h"
 #include <stddef.h>
+#include <math.h>
 
 /* Declaración de funciones */
 void nsdsp_math_init(void);
 int matriz_producto(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3);
 int matriz_suma(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3, int signo);
+int matriz_producto_d(MATRIZ_D * PM1, MATRIZ_D * PM2, MATRIZ_D * PM3);
+int matriz_suma_d(MATRIZ_D * PM1, MATRIZ_D * PM2, MATRIZ_D * PM3, int signo);
+int matriz_producto_m(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3);
+int matriz_cholesky(MATRIZ * PA, MATRIZ * PL);
+int matriz_lu(MATRIZ * PA, MATRIZ * PLU, unsigned int * pivotes);
+int matriz_qr(MATRIZ * PA, MATRIZ * PQR, float * workspace);
+int matriz_triangular(MATRIZ * PT, MATRIZ * PB, int tipo);
+int matriz_resuelve_cholesky(MATRIZ * PL, MATRIZ * PB);
+int matriz_resuelve_lu(MATRIZ * PLU, const unsigned int * pivotes, MATRIZ * PB);
+int matriz_resuelve_qr(MATRIZ * PQR, const float * workspace, MATRIZ * PB);
+int matriz_vista(MATRIZ * PM, unsigned int fila, unsigned int columna, unsigned int filas,
+                 unsigned int columnas, int traspuesta, MATRIZ_VISTA * PV);
+int matriz_producto_vista(float alfa, MATRIZ_VISTA * PA, MATRIZ_VISTA * PB, float beta, MATRIZ_VISTA * PC);
+int matriz_suma_vista(float alfa, MATRIZ_VISTA * PA, float beta, MATRIZ_VISTA * PB, MATRIZ_VISTA * PC);
+int matriz_paralelo(NSDSP_MATH_EJECUTOR ejecutor, void * usuario, unsigned int tareas);
+int matriz_producto_lote(MATRIZ_LOTE * PA, MATRIZ_LOTE * PB, MATRIZ_LOTE * PC);
+int matriz_entrelaza_lote(const float * matrices, MATRIZ_LOTE * PL);
+int matriz_separa_lote(MATRIZ_LOTE * PL, float * matrices);
+unsigned int matriz_cuenta_dispersa(MATRIZ * PM, float umbral, unsigned int bloque);
+int matriz_dispersa(MATRIZ * PM, float umbral, unsigned int bloque, MATRIZ_DISPERSA * PS);
+int matriz_producto_disperso(MATRIZ_DISPERSA * PS, MATRIZ * PX, MATRIZ * PY);
+int matriz_prepara_producto(MATRIZ * PA, MATRIZ * PB, MATRIZ * PC, MATRIZ_OPERACION * PO);
+int matriz_prepara_suma(MATRIZ * PA, MATRIZ * PB, MATRIZ * PC, int signo, MATRIZ_OPERACION * PO);
+void matriz_ejecuta_producto(const MATRIZ_OPERACION * PO, const float * a, const float * b, float * c);
+void matriz_ejecuta_suma(const MATRIZ_OPERACION * PO, const float * a, const float * b, float * c);
+static void limpia_matriz(MATRIZ * PM);
+static int pasos_vista(const MATRIZ_VISTA * PV, unsigned int * pf, unsigned int * pc);
+static void limpia_vista(MATRIZ_VISTA * PV);
+static void producto_nucleo(float alfa, const float * a, unsigned int af, unsigned int ac,
+                            const float * b, unsigned int bf, unsigned int bc, float beta,
+                            float * c, unsigned int cf, unsigned int m, unsigned int n, unsigned int p);
+static void suma_nucleo(float alfa, const float * a, unsigned int af, unsigned int ac, float beta,
+                        const float * b, unsigned int bf, unsigned int bc, float * c, unsigned int cf,
+                        unsigned int cc, unsigned int m, unsigned int n);
+static void producto_reparto(float alfa, const float * a, unsigned int af, unsigned int ac,
+                             const float * b, unsigned int bf, unsigned int bc, float beta,
+                             float * c, unsigned int cf, unsigned int m, unsigned int n, unsigned int p);
+static void panel_producto(void * contexto, unsigned int indice);
+static void lote_nucleo(const float * a, const float * b, float * c, unsigned int m, unsigned int p,
+                        unsigned int n, unsigned int lote, unsigned int inicio, unsigned int fin);
+static void panel_lote(void * contexto, unsigned int indice);
+static int lote_valido(const MATRIZ_LOTE * PL);
+static int bloque_nulo(const float * fila, unsigned int columna, unsigned int bloque, unsigned int columnas,
+                       float umbral);
+static float bloques4_disperso(const float * restrict w, const unsigned int * restrict columna,
+                               const float * restrict x, unsigned int n);
+static void fila_disperso(float * restrict y, const float * restrict x, float w, unsigned int k);
+
+/* Definición de objetos internos */
+
+/* Reparto de un producto entre tareas: paneles de filas o de columnas de C */
+typedef struct
+{
+    float alfa;
+    float beta;
+    const float * a;
+    const float * b;
+    float * c;
+    unsigned int af, ac, bf, bc, cf;
+    unsigned int m, n, p;
+    unsigned int tareas;
+    unsigned int por_filas;
+    unsigned int lote;
+} PANEL_MATH;
 
 /* Definición de variables globales */
 NSDSP_MATH_API nsdsp_math_api;
 
+/* Ejecutor registrado con matriz_paralelo (NULL: todo en el hilo llamante) */
+static NSDSP_MATH_EJECUTOR ejecutor_math = NULL;
+static void * usuario_math = NULL;
+static unsigned int tareas_math = 1;
+
 /* Definición de funciones */
 
 void nsdsp_math_init(void)
@@ -179,184 +443,1190 @@ void nsdsp_math_init(void)
     /* Inicializar punteros de la API */
     nsdsp_math_api.product = matriz_producto;
     nsdsp_math_api.suma = matriz_suma;
+    nsdsp_math_api.cholesky = matriz_cholesky;
+    nsdsp_math_api.lu = matriz_lu;
+    nsdsp_math_api.qr = matriz_qr;
+    nsdsp_math_api.triangular = matriz_triangular;
+    nsdsp_math_api.resuelve_cholesky = matriz_resuelve_cholesky;
+    nsdsp_math_api.resuelve_lu = matriz_resuelve_lu;
+    nsdsp_math_api.resuelve_qr = matriz_resuelve_qr;
+    nsdsp_math_api.vista = matriz_vista;
+    nsdsp_math_api.producto_vista = matriz_producto_vista;
+    nsdsp_math_api.suma_vista = matriz_suma_vista;
+    nsdsp_math_api.paralelo = matriz_paralelo;
+    nsdsp_math_api.producto_lote = matriz_producto_lote;
+    nsdsp_math_api.entrelaza_lote = matriz_entrelaza_lote;
+    nsdsp_math_api.separa_lote = matriz_separa_lote;
+    nsdsp_math_api.cuenta_dispersa = matriz_cuenta_dispersa;
+    nsdsp_math_api.dispersa = matriz_dispersa;
+    nsdsp_math_api.producto_disperso = matriz_producto_disperso;
+    nsdsp_math_api.prepara_producto = matriz_prepara_producto;
+    nsdsp_math_api.prepara_suma = matriz_prepara_suma;
+    nsdsp_math_api.ejecuta_producto = matriz_ejecuta_producto;
+    nsdsp_math_api.ejecuta_suma = matriz_ejecuta_suma;
+    nsdsp_math_api.product_d = matriz_producto_d;
+    nsdsp_math_api.suma_d = matriz_suma_d;
+    nsdsp_math_api.product_m = matriz_producto_m;
+
+    /* Cálculo en el hilo llamante hasta que la aplicación registre un ejecutor */
+    ejecutor_math = NULL;
+    usuario_math = NULL;
+    tareas_math = 1;
 }
 
-int matriz_producto(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3)
+/* Productos y sumas en las tres precisiones, generados desde la plantilla nsdsp_math_tipo.h */
+#define MATH_TIPO               float
+#define MATH_ACUMULADOR         float
+#define MATH_MATRIZ             MATRIZ
+#define MATH_NUCLEO_PRODUCTO    producto_nucleo
+#define MATH_PRODUCTO           matriz_producto
+#define MATH_REPARTO            producto_reparto
+#define MATH_NUCLEO_SUMA        suma_nucleo
+#define MATH_SUMA               matriz_suma
+#include "nsdsp_math_tipo.h"
+
+#define MATH_TIPO               double
+#define MATH_ACUMULADOR         double
+#define MATH_MATRIZ             MATRIZ_D
+#define MATH_NUCLEO_PRODUCTO    producto_nucleo_d
+#define MATH_PRODUCTO           matriz_producto_d
+#define MATH_REPARTO            producto_nucleo_d
+#define MATH_NUCLEO_SUMA        suma_nucleo_d
+#define MATH_SUMA               matriz_suma_d
+#include "nsdsp_math_tipo.h"
+
+/* Precisión mixta: matrices float con productos escalares acumulados en double */
+#define MATH_TIPO               float
+#define MATH_ACUMULADOR         double
+#define MATH_MATRIZ             MATRIZ
+#define MATH_NUCLEO_PRODUCTO    producto_nucleo_m
+#define MATH_PRODUCTO           matriz_producto_m
+#define MATH_REPARTO            producto_nucleo_m
+#define MATH_MIXTA
+#include "nsdsp_math_tipo.h"
+
+int matriz_cholesky(MATRIZ * PA, MATRIZ * PL)
 {
-    unsigned int f, c, index;
-    unsigned int filas_m1, columnas_m1;
-    unsigned int filas_m2, columnas_m2;
-    unsigned int filas_m3, columnas_m3;
-    float * p_m1;
-    float * p_m2;
-    float * p_m3;
+    unsigned int n, index, k0, kb, i, j, j0, jfin, p;
+    float * a;
+    float * l;
     float acumulador;
-    unsigned int offset_fila_m1;
-    unsigned int offset_elemento_m3;
+    float diagonal;
 
-    /* Validar punteros de entrada */
-    if (PM1 == NULL || PM2 == NULL || PM3 == NULL)
+    /* Validar punteros y dimensiones: A y L cuadradas del mismo orden */
+    if (PA == NULL || PL == NULL || PA->pmatriz == NULL || PL->pmatriz == NULL ||
+        PA->filas != PA->columnas || PL->filas != PA->filas || PL->columnas != PA->columnas)
     {
-        /* Si PM3 es válido, llenar con ceros */
-        if (PM3 != NULL && PM3->pmatriz != NULL)
+        limpia_matriz(PL);
+        return NSDSP_MATH_KO;
+    }
+
+    n = PA->filas;
+    a = PA->pmatriz;
+    l = PL->pmatriz;
+
+    /* Variante fuera de sitio: copiar A en L y factorizar L */
+    if (l != a)
+    {
+        for (index = 0; index < n * n; index++)
+        {
+            l[index] = a[index];
+        }
+    }
+
+    /* Cholesky por bloques de columnas (right-looking) sobre el triángulo inferior */
+    for (k0 = 0; k0 < n; k0 += NSDSP_MATH_BLOQUE)
+    {
+        kb = (n - k0 < NSDSP_MATH_BLOQUE) ? (n - k0) : NSDSP_MATH_BLOQUE;
+
+        /* 1. Bloque diagonal L11 sin bloques */
+        for (j = k0; j < k0 + kb; j++)
         {
-            p_m3 = PM3->pmatriz;
-            for (index = 0; index < (PM3->filas * PM3->columnas); index++)
+            diagonal = l[j * n + j];
+            for (p = k0; p < j; p++)
             {
-                p_m3[index] = 0.0f;
+                diagonal -= l[j * n + p] * l[j * n + p];
+            }
+            if (!(diagonal > 0.0f))
+            {
+                /* A no es definida positiva */
+                limpia_matriz(PL);
+                return NSDSP_MATH_KO;
+            }
+            diagonal = sqrtf(diagonal);
+            l[j * n + j] = diagonal;
+
+            for (i = j + 1; i < k0 + kb; i++)
+            {
+                acumulador = l[i * n + j];
+                for (p = k0; p < j; p++)
+                {
+                    acumulador -= l[i * n + p] * l[j * n + p];
+                }
+                l[i * n + j] = acumulador / diagonal;
             }
         }
+
+        /* 2. Panel L21 = A21 L11^-T, fila a fila */
+        for (i = k0 + kb; i < n; i++)
+        {
+            for (j = k0; j < k0 + kb; j++)
+            {
+                acumulador = l[i * n + j];
+                for (p = k0; p < j; p++)
+                {
+                    acumulador -= l[i * n + p] * l[j * n + p];
+                }
+                l[i * n + j] = acumulador / l[j * n + j];
+            }
+        }
+
+        /* 3. Actualización A22 -= L21 L21^T del triángulo inferior, por franjas de NSDSP_MATH_BLOQUE
+         * columnas para que las filas j de L21 se reutilicen desde la caché */
+        for (j0 = k0 + kb; j0 < n; j0 += NSDSP_MATH_BLOQUE)
+        {
+            jfin = (n - j0 < NSDSP_MATH_BLOQUE) ? n : (j0 + NSDSP_MATH_BLOQUE);
+            for (i = j0; i < n; i++)
+            {
+                for (j = j0; j < jfin && j <= i; j++)
+                {
+                    acumulador = 0.0f;
+                    for (p = k0; p < k0 + kb; p++)
+                    {
+                        acumulador += l[i * n + p] * l[j * n + p];
+                    }
+                    l[i * n + j] -= acumulador;
+                }
+            }
+        }
+    }
+
+    /* Anular el triángulo superior */
+    for (i = 0; i < n; i++)
+    {
+        for (j = i + 1; j < n; j++)
+        {
+            l[i * n + j] = 0.0f;
+        }
+    }
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_lu(MATRIZ * PA, MATRIZ * PLU, unsigned int * pivotes)
+{
+    unsigned int n, index, i, j, k, p;
+    float * a;
+    float * lu;
+    float maximo;
+    float factor;
+    float temporal;
+
+    /* Validar punteros y dimensiones: A y LU cuadradas del mismo orden */
+    if (PA == NULL || PLU == NULL || pivotes == NULL || PA->pmatriz == NULL || PLU->pmatriz == NULL ||
+        PA->filas != PA->columnas || PLU->filas != PA->filas || PLU->columnas != PA->columnas)
+    {
+        limpia_matriz(PLU);
         return NSDSP_MATH_KO;
     }
 
-    /* Validar punteros a datos */
-    if (PM1->pmatriz == NULL || PM2->pmatriz == NULL || PM3->pmatriz == NULL)
+    n = PA->filas;
+    a = PA->pmatriz;
+    lu = PLU->pmatriz;
+
+    if (lu != a)
+    {
+        for (index = 0; index < n * n; index++)
+        {
+            lu[index] = a[index];
+        }
+    }
+
+    /* Eliminación de Gauss con pivotaje parcial por filas: P A = L U */
+    for (k = 0; k < n; k++)
     {
-        /* Llenar M3 con ceros si es posible */
-        if (PM3->pmatriz != NULL)
+        /* Pivote: mayor |a_ik| con i >= k */
+        p = k;
+        maximo = fabsf(lu[k * n + k]);
+        for (i = k + 1; i < n; i++)
+        {
+            if (fabsf(lu[i * n + k]) > maximo)
+            {
+                maximo = fabsf(lu[i * n + k]);
+                p = i;
+            }
+        }
+        pivotes[k] = p;
+
+        if (!(maximo > 0.0f))
+        {
+            /* Matriz singular */
+            limpia_matriz(PLU);
+            return NSDSP_MATH_KO;
+        }
+
+        if (p != k)
         {
-            p_m3 = PM3->pmatriz;
-            for (index = 0; index < (PM3->filas * PM3->columnas); index++)
+            for (j = 0; j < n; j++)
             {
-                p_m3[index] = 0.0f;
+                temporal = lu[k * n + j];
+                lu[k * n + j] = lu[p * n + j];
+                lu[p * n + j] = temporal;
             }
         }
+
+        /* Multiplicadores en la columna k y actualización de rango 1 por filas contiguas */
+        for (i = k + 1; i < n; i++)
+        {
+            factor = lu[i * n + k] / lu[k * n + k];
+            lu[i * n + k] = factor;
+            for (j = k + 1; j < n; j++)
+            {
+                lu[i * n + j] -= factor * lu[k * n + j];
+            }
+        }
+    }
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_qr(MATRIZ * PA, MATRIZ * PQR, float * workspace)
+{
+    unsigned int m, n, index, i, j, k;
+    float * a;
+    float * qr;
+    float * tau;
+    float * w;
+    float alfa;
+    float sigma;
+    float beta;
+    float escala;
+
+    /* Validar punteros y dimensiones: A y QR de m x n con m >= n */
+    if (PA == NULL || PQR == NULL || workspace == NULL || PA->pmatriz == NULL || PQR->pmatriz == NULL ||
+        PA->filas < PA->columnas || PQR->filas != PA->filas || PQR->columnas != PA->columnas)
+    {
+        limpia_matriz(PQR);
         return NSDSP_MATH_KO;
     }
 
-    /* Obtener dimensiones */
-    filas_m1 = PM1->filas;
-    columnas_m1 = PM1->columnas;
-    filas_m2 = PM2->filas;
-    columnas_m2 = PM2->columnas;
-    filas_m3 = PM3->filas;
-    columnas_m3 = PM3->columnas;
+    m = PA->filas;
+    n = PA->columnas;
+    a = PA->pmatriz;
+    qr = PQR->pmatriz;
+    tau = workspace;
+    w = &workspace[n];
 
-    /* Obtener punteros a datos */
-    p_m1 = PM1->pmatriz;
-    p_m2 = PM2->pmatriz;
-    p_m3 = PM3->pmatriz;
+    if (qr != a)
+    {
+        for (index = 0; index < m * n; index++)
+        {
+            qr[index] = a[index];
+        }
+    }
 
-    /* Verificar compatibilidad de dimensiones */
-    /* M1(a×b) × M2(b×c) = M3(a×c) */
-    if (columnas_m1 != filas_m2 || filas_m1 != filas_m3 || columnas_m2 != columnas_m3)
+    /* Reflexiones de Householder H_k = I - tau_k v v^T con v_k = 1 implícito */
+    for (k = 0; k < n; k++)
     {
-        /* Dimensiones incompatibles, llenar M3 con ceros */
-        for (index = 0; index < (filas_m3 * columnas_m3); index++)
+        alfa = qr[k * n + k];
+        sigma = 0.0f;
+        for (i = k + 1; i < m; i++)
+        {
+            sigma += qr[i * n + k] * qr[i * n + k];
+        }
+
+        if (sigma == 0.0f)
+        {
+            /* La columna ya está alineada con e_k */
+            tau[k] = 0.0f;
+            continue;
+        }
+
+        beta = sqrtf(alfa * alfa + sigma);
+        beta = (alfa >= 0.0f) ? -beta : beta;
+        tau[k] = (beta - alfa) / beta;
+        escala = 1.0f / (alfa - beta);
+        for (i = k + 1; i < m; i++)
         {
-            p_m3[index] = 0.0f;
+            qr[i * n + k] *= escala;
         }
+        qr[k * n + k] = beta;
+
+        /* w^T = v^T A(k:m, k+1:n) recorriendo filas contiguas, y A -= tau v w^T */
+        for (j = k + 1; j < n; j++)
+        {
+            w[j] = qr[k * n + j];
+        }
+        for (i = k + 1; i < m; i++)
+        {
+            for (j = k + 1; j < n; j++)
+            {
+                w[j] += qr[i * n + k] * qr[i * n + j];
+            }
+        }
+        for (j = k + 1; j < n; j++)
+        {
+            w[j] *= tau[k];
+            qr[k * n + j] -= w[j];
+        }
+        for (i = k + 1; i < m; i++)
+        {
+            for (j = k + 1; j < n; j++)
+            {
+                qr[i * n + j] -= qr[i * n + k] * w[j];
+            }
+        }
+    }
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_triangular(MATRIZ * PT, MATRIZ * PB, int tipo)
+{
+    unsigned int n, k, i, j, jinicio, jfin, paso, c;
+    int traspuesta, superior, unidad;
+    float * t;
+    float * b;
+    float coeficiente;
+    float inverso;
+
+    /* Validar punteros y dimensiones: T de n x n y B de n x k */
+    if (PT == NULL || PB == NULL || PT->pmatriz == NULL || PB->pmatriz == NULL ||
+        PT->filas != PT->columnas || PB->filas != PT->filas)
+    {
+        limpia_matriz(PB);
         return NSDSP_MATH_KO;
     }
 
-    /* Realizar multiplicación de matrices */
-    /* Para cada fila de M1 */
-    for (f = 0; f < filas_m1; f++)
+    n = PT->filas;
+    k = PB->columnas;
+    t = PT->pmatriz;
+    b = PB->pmatriz;
+    traspuesta = (tipo & NSDSP_MATH_TRASPUESTA) != 0;
+    superior = (tipo & NSDSP_MATH_SUPERIOR) != 0;
+    unidad = (tipo & NSDSP_MATH_UNIDAD) != 0;
+
+    if (!unidad)
     {
-        /* Calcular offset de la fila actual en M1 */
-        offset_fila_m1 = f * columnas_m1;
+        for (i = 0; i < n; i++)
+        {
+            if (t[i * n + i] == 0.0f)
+            {
+                /* Sistema singular */
+                limpia_matriz(PB);
+                return NSDSP_MATH_KO;
+            }
+        }
+    }
 
-        /* Para cada columna de M2 */
-        for (c = 0; c < columnas_m2; c++)
+    /* El sistema efectivo es inferior (sustitución hacia delante) si T es inferior sin trasponer o
+     * superior traspuesta, y superior (hacia atrás) en los otros dos casos. Cada paso opera sobre
+     * filas completas de B, contiguas en memoria */
+    for (paso = 0; paso < n; paso++)
+    {
+        if (superior != traspuesta)
         {
-            /* Inicializar acumulador para el elemento M3[f,c] */
-            acumulador = 0.0f;
+            i = n - 1 - paso;
+            jinicio = i + 1;
+            jfin = n;
+        }
+        else
+        {
+            i = paso;
+            jinicio = 0;
+            jfin = i;
+        }
 
-            /* Producto punto entre fila f de M1 y columna c de M2 */
-            for (index = 0; index < columnas_m1; index++)
+        for (j = jinicio; j < jfin; j++)
+        {
+            coeficiente = traspuesta ? t[j * n + i] : t[i * n + j];
+            if (coeficiente != 0.0f)
             {
-                /* M3[f,c] += M1[f,index] * M2[index,c] */
-                acumulador += p_m1[offset_fila_m1 + index] * p_m2[index * columnas_m2 + c];
+                for (c = 0; c < k; c++)
+                {
+                    b[i * k + c] -= coeficiente * b[j * k + c];
+                }
             }
+        }
 
-            /* Almacenar resultado en M3[f,c] */
-            offset_elemento_m3 = f * columnas_m3 + c;
-            p_m3[offset_elemento_m3] = acumulador;
+        if (!unidad)
+        {
+            inverso = 1.0f / t[i * n + i];
+            for (c = 0; c < k; c++)
+            {
+                b[i * k + c] *= inverso;
+            }
         }
     }
 
     return NSDSP_MATH_OK;
 }
 
-int matriz_suma(MATRIZ * PM1, MATRIZ * PM2, MATRIZ * PM3, int signo)
+int matriz_resuelve_cholesky(MATRIZ * PL, MATRIZ * PB)
 {
-    unsigned int index;
-    unsigned int total_elementos;
-    float * p_m1;
-    float * p_m2;
-    float * p_m3;
+    /* A X = B con A = L L^T: L Y = B y L^T X = Y, in situ sobre B */
+    if (matriz_triangular(PL, PB, NSDSP_MATH_INFERIOR) != NSDSP_MATH_OK)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    return matriz_triangular(PL, PB, NSDSP_MATH_INFERIOR | NSDSP_MATH_TRASPUESTA);
+}
+
+int matriz_resuelve_lu(MATRIZ * PLU, const unsigned int * pivotes, MATRIZ * PB)
+{
+    unsigned int n, k, i, c;
+    float * b;
+    float temporal;
 
-    /* Validar punteros de entrada */
-    if (PM1 == NULL || PM2 == NULL || PM3 == NULL)
+    if (PLU == NULL || PB == NULL || pivotes == NULL || PB->pmatriz == NULL || PB->filas != PLU->filas)
     {
-        /* Si PM3 es válido, llenar con ceros */
-        if (PM3 != NULL && PM3->pmatriz != NULL)
+        limpia_matriz(PB);
+        return NSDSP_MATH_KO;
+    }
+
+    n = PB->filas;
+    k = PB->columnas;
+    b = PB->pmatriz;
+
+    /* Permutar las filas de B en el orden de la factorización */
+    for (i = 0; i < n; i++)
+    {
+        if (pivotes[i] >= n)
+        {
+            limpia_matriz(PB);
+            return NSDSP_MATH_KO;
+        }
+        if (pivotes[i] != i)
         {
-            p_m3 = PM3->pmatriz;
-            total_elementos = PM3->filas * PM3->columnas;
-            for (index = 0; index < total_elementos; index++)
+            for (c = 0; c < k; c++)
             {
-                p_m3[index] = 0.0f;
+                temporal = b[i * k + c];
+                b[i * k + c] = b[pivotes[i] * k + c];
+                b[pivotes[i] * k + c] = temporal;
             }
         }
+    }
+
+    /* L Y = P B con diagonal unitaria y U X = Y */
+    if (matriz_triangular(PLU, PB, NSDSP_MATH_INFERIOR | NSDSP_MATH_UNIDAD) != NSDSP_MATH_OK)
+    {
         return NSDSP_MATH_KO;
     }
 
-    /* Validar punteros a datos */
-    if (PM1->pmatriz == NULL || PM2->pmatriz == NULL || PM3->pmatriz == NULL)
+    return matriz_triangular(PLU, PB, NSDSP_MATH_SUPERIOR);
+}
+
+int matriz_resuelve_qr(MATRIZ * PQR, const float * workspace, MATRIZ * PB)
+{
+    unsigned int m, n, k, i, j, c;
+    float * qr;
+    float * b;
+    float producto;
+    MATRIZ R;
+    MATRIZ X;
+
+    if (PQR == NULL || PB == NULL || workspace == NULL || PQR->pmatriz == NULL || PB->pmatriz == NULL ||
+        PQR->filas < PQR->columnas || PB->filas != PQR->filas)
     {
-        /* Llenar M3 con ceros si es posible */
-        if (PM3->pmatriz != NULL)
+        limpia_matriz(PB);
+        return NSDSP_MATH_KO;
+    }
+
+    m = PQR->filas;
+    n = PQR->columnas;
+    k = PB->columnas;
+    qr = PQR->pmatriz;
+    b = PB->pmatriz;
+
+    /* B = Q^T B aplicando H_0 ... H_{n-1} columna a columna */
+    for (j = 0; j < n; j++)
+    {
+        if (workspace[j] == 0.0f)
+        {
+            continue;
+        }
+        for (c = 0; c < k; c++)
         {
-            p_m3 = PM3->pmatriz;
-            total_elementos = PM3->filas * PM3->columnas;
-            for (index = 0; index < total_elementos; index++)
+            producto = b[j * k + c];
+            for (i = j + 1; i < m; i++)
             {
-                p_m3[index] = 0.0f;
+                producto += qr[i * n + j] * b[i * k + c];
+            }
+            producto *= workspace[j];
+            b[j * k + c] -= producto;
+            for (i = j + 1; i < m; i++)
+            {
+                b[i * k + c] -= qr[i * n + j] * producto;
             }
         }
+    }
+
+    /* R X = (Q^T B)(0:n, :): las n primeras filas de B son una MATRIZ de n x k contigua. R es el
+     * triángulo superior de las n primeras filas de QR, que también son contiguas */
+    R.filas = n;
+    R.columnas = n;
+    R.pmatriz = qr;
+    X.filas = n;
+    X.columnas = k;
+    X.pmatriz = b;
+
+    return matriz_triangular(&R, &X, NSDSP_MATH_SUPERIOR);
+}
+
+int matriz_vista(MATRIZ * PM, unsigned int fila, unsigned int columna, unsigned int filas,
+                 unsigned int columnas, int traspuesta, MATRIZ_VISTA * PV)
+{
+    if (PV == NULL)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    /* La submatriz de filas x columnas debe estar dentro de M */
+    if (PM == NULL || PM->pmatriz == NULL || filas == 0 || columnas == 0 ||
+        fila >= PM->filas || columna >= PM->columnas ||
+        filas > PM->filas - fila || columnas > PM->columnas - columna)
+    {
+        PV->filas = 0;
+        PV->columnas = 0;
+        PV->paso = 0;
+        PV->traspuesta = 0;
+        PV->pmatriz = NULL;
+        return NSDSP_MATH_KO;
+    }
+
+    PV->filas = traspuesta ? columnas : filas;
+    PV->columnas = traspuesta ? filas : columnas;
+    PV->paso = PM->columnas;
+    PV->traspuesta = traspuesta ? 1 : 0;
+    PV->pmatriz = &PM->pmatriz[fila * PM->columnas + columna];
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_producto_vista(float alfa, MATRIZ_VISTA * PA, MATRIZ_VISTA * PB, float beta, MATRIZ_VISTA * PC)
+{
+    unsigned int af, ac, bf, bc, cf, cc;
+
+    /* A(m×p) × B(p×n) = C(m×n) */
+    if (pasos_vista(PA, &af, &ac) != NSDSP_MATH_OK || pasos_vista(PB, &bf, &bc) != NSDSP_MATH_OK ||
+        pasos_vista(PC, &cf, &cc) != NSDSP_MATH_OK ||
+        PA->columnas != PB->filas || PA->filas != PC->filas || PB->columnas != PC->columnas)
+    {
+        limpia_vista(PC);
         return NSDSP_MATH_KO;
     }
 
-    /* Verificar que todas las matrices tienen las mismas dimensiones */
-    if (PM1->filas != PM2->filas || PM1->filas != PM3->filas ||
-        PM1->columnas != PM2->columnas || PM1->columnas != PM3->columnas)
+    if (PC->traspuesta)
+    {
+        /* C^T = alfa B^T A^T + beta C^T: el núcleo siempre escribe filas contiguas de C */
+        producto_reparto(alfa, PB->pmatriz, bc, bf, PA->pmatriz, ac, af, beta, PC->pmatriz, cc,
+                         PC->columnas, PC->filas, PA->columnas);
+    }
+    else
     {
-        /* Dimensiones incompatibles, llenar M3 con ceros */
-        p_m3 = PM3->pmatriz;
-        total_elementos = PM3->filas * PM3->columnas;
-        for (index = 0; index < total_elementos; index++)
+        producto_reparto(alfa, PA->pmatriz, af, ac, PB->pmatriz, bf, bc, beta, PC->pmatriz, cf,
+                         PC->filas, PC->columnas, PA->columnas);
+    }
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_suma_vista(float alfa, MATRIZ_VISTA * PA, float beta, MATRIZ_VISTA * PB, MATRIZ_VISTA * PC)
+{
+    unsigned int af, ac, bf, bc, cf, cc;
+
+    if (pasos_vista(PA, &af, &ac) != NSDSP_MATH_OK || pasos_vista(PB, &bf, &bc) != NSDSP_MATH_OK ||
+        pasos_vista(PC, &cf, &cc) != NSDSP_MATH_OK ||
+        PA->filas != PB->filas || PA->filas != PC->filas ||
+        PA->columnas != PB->columnas || PA->columnas != PC->columnas)
+    {
+        limpia_vista(PC);
+        return NSDSP_MATH_KO;
+    }
+
+    suma_nucleo(alfa, PA->pmatriz, af, ac, beta, PB->pmatriz, bf, bc, PC->pmatriz, cf, cc,
+                PC->filas, PC->columnas);
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_paralelo(NSDSP_MATH_EJECUTOR ejecutor, void * usuario, unsigned int tareas)
+{
+    if (tareas == 0 || tareas > NSDSP_MATH_TAREAS_MAX || (ejecutor == NULL && tareas > 1))
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    /* Sin ejecutor o con una sola tarea todo se calcula en el hilo llamante */
+    ejecutor_math = (tareas > 1) ? ejecutor : NULL;
+    usuario_math = usuario;
+    tareas_math = tareas;
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_producto_lote(MATRIZ_LOTE * PA, MATRIZ_LOTE * PB, MATRIZ_LOTE * PC)
+{
+    unsigned int tareas, grupos;
+    PANEL_MATH panel;
+
+    /* A_l(m×p) × B_l(p×n) = C_l(m×n) para cada matriz l del lote */
+    if (lote_valido(PA) != NSDSP_MATH_OK || lote_valido(PB) != NSDSP_MATH_OK ||
+        lote_valido(PC) != NSDSP_MATH_OK || PA->lote != PB->lote || PA->lote != PC->lote ||
+        PA->columnas != PB->filas || PA->filas != PC->filas || PB->columnas != PC->columnas)
+    {
+        if (lote_valido(PC) == NSDSP_MATH_OK)
         {
-            p_m3[index] = 0.0f;
+            /* Con p = 0 el núcleo solo llena C con ceros */
+            lote_nucleo(NULL, NULL, PC->pmatriz, PC->filas, 0, PC->columnas, PC->lote, 0, PC->lote);
         }
         return NSDSP_MATH_KO;
     }
 
-    /* Obtener punteros a datos */
-    p_m1 = PM1->pmatriz;
-    p_m2 = PM2->pmatriz;
-    p_m3 = PM3->pmatriz;
+    panel.a = PA->pmatriz;
+    panel.b = PB->pmatriz;
+    panel.c = PC->pmatriz;
+    panel.m = PC->filas;
+    panel.p = PA->columnas;
+    panel.n = PC->columnas;
+    panel.lote = PC->lote;
+
+    /* Reparto por grupos de NSDSP_MATH_CARRILES matrices */
+    grupos = (panel.lote + NSDSP_MATH_CARRILES - 1) / NSDSP_MATH_CARRILES;
+    tareas = (tareas_math < grupos) ? tareas_math : grupos;
+    if (ejecutor_math == NULL || tareas <= 1 ||
+        (double)panel.m * panel.n * panel.p * panel.lote < (double)NSDSP_MATH_PARALELO_MINIMO)
+    {
+        lote_nucleo(panel.a, panel.b, panel.c, panel.m, panel.p, panel.n, panel.lote, 0, panel.lote);
+    }
+    else
+    {
+        panel.tareas = tareas;
+        ejecutor_math(panel_lote, &panel, tareas, usuario_math);
+    }
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_entrelaza_lote(const float * matrices, MATRIZ_LOTE * PL)
+{
+    unsigned int l, e, elementos;
+
+    if (matrices == NULL || lote_valido(PL) != NSDSP_MATH_OK)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    /* Matrices densas consecutivas -> elemento e de la matriz l en [e * lote + l] */
+    elementos = PL->filas * PL->columnas;
+    for (l = 0; l < PL->lote; l++)
+    {
+        for (e = 0; e < elementos; e++)
+        {
+            PL->pmatriz[e * PL->lote + l] = matrices[l * elementos + e];
+        }
+    }
 
-    /* Calcular número total de elementos */
-    total_elementos = PM1->filas * PM1->columnas;
+    return NSDSP_MATH_OK;
+}
+
+int matriz_separa_lote(MATRIZ_LOTE * PL, float * matrices)
+{
+    unsigned int l, e, elementos;
+
+    if (matrices == NULL || lote_valido(PL) != NSDSP_MATH_OK)
+    {
+        return NSDSP_MATH_KO;
+    }
 
-    /* Realizar suma o resta según el signo */
-    if (signo >= 0)
+    elementos = PL->filas * PL->columnas;
+    for (e = 0; e < elementos; e++)
     {
-        /* Suma: M3 = M1 + M2 */
-        for (index = 0; index < total_elementos; index++)
+        for (l = 0; l < PL->lote; l++)
         {
-            p_m3[index] = p_m1[index] + p_m2[index];
+            matrices[l * elementos + e] = PL->pmatriz[e * PL->lote + l];
         }
     }
+
+    return NSDSP_MATH_OK;
+}
+
+unsigned int matriz_cuenta_dispersa(MATRIZ * PM, float umbral, unsigned int bloque)
+{
+    unsigned int i, j, bloques;
+
+    if (PM == NULL || PM->pmatriz == NULL || bloque == 0 || bloque > NSDSP_MATH_DISPERSA_BLOQUE_MAX)
+    {
+        return 0;
+    }
+
+    /* Bloques con algún |valor| > umbral */
+    bloques = 0;
+    for (i = 0; i < PM->filas; i++)
+    {
+        for (j = 0; j < PM->columnas; j += bloque)
+        {
+            if (!bloque_nulo(&PM->pmatriz[i * PM->columnas], j, bloque, PM->columnas, umbral))
+            {
+                bloques++;
+            }
+        }
+    }
+
+    return bloques;
+}
+
+int matriz_dispersa(MATRIZ * PM, float umbral, unsigned int bloque, MATRIZ_DISPERSA * PS)
+{
+    unsigned int i, j, t, e;
+    const float * fila;
+    float valor;
+
+    if (PS == NULL || PS->inicio_fila == NULL)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    if (PM == NULL || PM->pmatriz == NULL || PM->filas == 0 || PM->columnas == 0 ||
+        bloque == 0 || bloque > NSDSP_MATH_DISPERSA_BLOQUE_MAX ||
+        (PS->capacidad > 0 && (PS->columna == NULL || PS->valores == NULL)))
+    {
+        PS->bloques = 0;
+        return NSDSP_MATH_KO;
+    }
+
+    PS->filas = PM->filas;
+    PS->columnas = PM->columnas;
+    PS->bloque = bloque;
+
+    /* Los valores con |w| <= umbral dentro de un bloque almacenado se guardan como 0, de modo que
+     * la matriz dispersa es exactamente la densa podada con el umbral */
+    e = 0;
+    for (i = 0; i < PM->filas; i++)
+    {
+        PS->inicio_fila[i] = e;
+        fila = &PM->pmatriz[i * PM->columnas];
+        for (j = 0; j < PM->columnas; j += bloque)
+        {
+            if (bloque_nulo(fila, j, bloque, PM->columnas, umbral))
+            {
+                continue;
+            }
+            if (e >= PS->capacidad)
+            {
+                PS->bloques = 0;
+                return NSDSP_MATH_KO;
+            }
+
+            PS->columna[e] = j;
+            for (t = 0; t < bloque; t++)
+            {
+                valor = (j + t < PM->columnas) ? fila[j + t] : 0.0f;
+                PS->valores[e * bloque + t] = (fabsf(valor) > umbral) ? valor : 0.0f;
+            }
+            e++;
+        }
+    }
+    PS->inicio_fila[PM->filas] = e;
+    PS->bloques = e;
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_producto_disperso(MATRIZ_DISPERSA * PS, MATRIZ * PX, MATRIZ * PY)
+{
+    unsigned int i, e, t, c, k, bloque, columna, fin, completos;
+    const float * w;
+    const float * x;
+    float * y;
+    float acumulador;
+
+    /* Y(filas×k) = S(filas×columnas) X(columnas×k) */
+    if (PS == NULL || PX == NULL || PY == NULL || PS->inicio_fila == NULL || PX->pmatriz == NULL ||
+        PY->pmatriz == NULL || PS->bloque == 0 || PS->bloque > NSDSP_MATH_DISPERSA_BLOQUE_MAX ||
+        (PS->bloques > 0 && (PS->columna == NULL || PS->valores == NULL)) ||
+        PS->inicio_fila[PS->filas] != PS->bloques ||
+        PX->filas != PS->columnas || PY->filas != PS->filas || PX->columnas != PY->columnas)
+    {
+        limpia_matriz(PY);
+        return NSDSP_MATH_KO;
+    }
+
+    bloque = PS->bloque;
+    k = PX->columnas;
+    x = PX->pmatriz;
+
+    if (k == 1)
+    {
+        /* SpMV: producto escalar de cada fila con x, bloque a bloque */
+        for (i = 0; i < PS->filas; i++)
+        {
+            e = PS->inicio_fila[i];
+            fin = PS->inicio_fila[i + 1];
+            acumulador = 0.0f;
+            if (bloque == 4 && fin > e)
+            {
+                /* Bloques 1x4 completos: una suma parcial por columna del bloque en un vector de 4.
+                 * Solo el último bloque de la fila puede salirse de la matriz */
+                completos = (PS->columna[fin - 1] + 4 <= PS->columnas) ? fin - e : fin - e - 1;
+                acumulador = bloques4_disperso(&PS->valores[e * 4], &PS->columna[e], x, completos);
+                e += completos;
+            }
+            for (; e < fin; e++)
+            {
+                w = &PS->valores[e * bloque];
+                columna = PS->columna[e];
+                /* El último bloque de la fila puede salirse de la matriz: sus ceros no se leen */
+                for (t = 0; t < bloque && columna + t < PS->columnas; t++)
+                {
+                    acumulador += w[t] * x[columna + t];
+                }
+            }
+            PY->pmatriz[i] = acumulador;
+        }
+        return NSDSP_MATH_OK;
+    }
+
+    /* SpMM: cada valor no nulo acumula una fila contigua de X sobre la fila de Y */
+    for (i = 0; i < PS->filas; i++)
+    {
+        y = &PY->pmatriz[i * k];
+        for (c = 0; c < k; c++)
+        {
+            y[c] = 0.0f;
+        }
+        for (e = PS->inicio_fila[i]; e < PS->inicio_fila[i + 1]; e++)
+        {
+            w = &PS->valores[e * bloque];
+            columna = PS->columna[e];
+            for (t = 0; t < bloque && columna + t < PS->columnas; t++)
+            {
+                fila_disperso(y, &x[(columna + t) * k], w[t], k);
+            }
+        }
+    }
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_prepara_producto(MATRIZ * PA, MATRIZ * PB, MATRIZ * PC, MATRIZ_OPERACION * PO)
+{
+    if (PO == NULL)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    /* Solo se validan las dimensiones: los datos se pasan en cada ejecución y pueden cambiar */
+    if (PA == NULL || PB == NULL || PC == NULL || PA->filas == 0 || PA->columnas == 0 || PB->columnas == 0 ||
+        PA->columnas != PB->filas || PC->filas != PA->filas || PC->columnas != PB->columnas)
+    {
+        PO->filas = 0;
+        PO->interna = 0;
+        PO->columnas = 0;
+        PO->signo = 0.0f;
+        return NSDSP_MATH_KO;
+    }
+
+    PO->filas = PA->filas;
+    PO->interna = PA->columnas;
+    PO->columnas = PB->columnas;
+    PO->signo = 1.0f;
+
+    return NSDSP_MATH_OK;
+}
+
+int matriz_prepara_suma(MATRIZ * PA, MATRIZ * PB, MATRIZ * PC, int signo, MATRIZ_OPERACION * PO)
+{
+    if (PO == NULL)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    if (PA == NULL || PB == NULL || PC == NULL || PA->filas == 0 || PA->columnas == 0 ||
+        PA->filas != PB->filas || PA->filas != PC->filas ||
+        PA->columnas != PB->columnas || PA->columnas != PC->columnas)
+    {
+        PO->filas = 0;
+        PO->interna = 0;
+        PO->columnas = 0;
+        PO->signo = 0.0f;
+        return NSDSP_MATH_KO;
+    }
+
+    PO->filas = PA->filas;
+    PO->interna = 0;
+    PO->columnas = PA->columnas;
+    PO->signo = (signo >= 0) ? 1.0f : -1.0f;
+
+    return NSDSP_MATH_OK;
+}
+
+void matriz_ejecuta_producto(const MATRIZ_OPERACION * PO, const float * a, const float * b, float * c)
+{
+    /* Sin comprobaciones: PO viene de matriz_prepara_producto y a, b, c tienen sus dimensiones */
+    producto_reparto(1.0f, a, PO->interna, 1, b, PO->columnas, 1, 0.0f, c, PO->columnas,
+                     PO->filas, PO->columnas, PO->interna);
+}
+
+void matriz_ejecuta_suma(const MATRIZ_OPERACION * PO, const float * a, const float * b, float * c)
+{
+    suma_nucleo(1.0f, a, PO->columnas, 1, PO->signo, b, PO->columnas, 1, c, PO->columnas, 1,
+                PO->filas, PO->columnas);
+}
+
+static int pasos_vista(const MATRIZ_VISTA * PV, unsigned int * pf, unsigned int * pc)
+{
+    unsigned int almacenadas, paso;
+
+    if (PV == NULL || PV->pmatriz == NULL || PV->filas == 0 || PV->columnas == 0)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    /* Columnas de cada fila del almacenamiento y distancia entre filas */
+    almacenadas = PV->traspuesta ? PV->filas : PV->columnas;
+    paso = (PV->paso == 0) ? almacenadas : PV->paso;
+    if (paso < almacenadas)
+    {
+        return NSDSP_MATH_KO;
+    }
+
+    /* Distancia en floats entre filas y entre columnas consecutivas de la vista */
+    *pf = PV->traspuesta ? 1 : paso;
+    *pc = PV->traspuesta ? paso : 1;
+
+    return NSDSP_MATH_OK;
+}
+
+static void limpia_vista(MATRIZ_VISTA * PV)
+{
+    unsigned int i, j, pf, pc;
+
+    /* Llenar la vista con ceros si es válida */
+    if (pasos_vista(PV, &pf, &pc) == NSDSP_MATH_OK)
+    {
+        for (i = 0; i < PV->filas; i++)
+        {
+            for (j = 0; j < PV->columnas; j++)
+            {
+                PV->pmatriz[i * pf + j * pc] = 0.0f;
+            }
+        }
+    }
+}
+
+static void producto_reparto(float alfa, const float * a, unsigned int af, unsigned int ac,
+                             const float * b, unsigned int bf, unsigned int bc, float beta,
+                             float * c, unsigned int cf, unsigned int m, unsigned int n, unsigned int p)
+{
+    unsigned int tareas;
+    PANEL_MATH panel;
+
+    /* Productos pequeños o sin ejecutor: el coste de despertar los hilos supera al del producto */
+    if (ejecutor_math == NULL || (double)m * n * p < (double)NSDSP_MATH_PARALELO_MINIMO)
+    {
+        producto_nucleo(alfa, a, af, ac, b, bf, bc, beta, c, cf, m, n, p);
+        return;
+    }
+
+    panel.alfa = alfa;
+    panel.beta = beta;
+    panel.a = a;
+    panel.af = af;
+    panel.ac = ac;
+    panel.b = b;
+    panel.bf = bf;
+    panel.bc = bc;
+    panel.c = c;
+    panel.cf = cf;
+    panel.m = m;
+    panel.n = n;
+    panel.p = p;
+
+    /* Paneles de filas de C (cada tarea lee todo B) salvo que C tenga menos filas que tareas */
+    panel.por_filas = (m >= tareas_math || m >= n) ? 1 : 0;
+    tareas = panel.por_filas ? m : n;
+    tareas = (tareas_math < tareas) ? tareas_math : tareas;
+    panel.tareas = tareas;
+
+    ejecutor_math(panel_producto, &panel, tareas, usuario_math);
+}
+
+static void panel_producto(void * contexto, unsigned int indice)
+{
+    const PANEL_MATH * panel;
+    unsigned int total, inicio, fin;
+
+    panel = (const PANEL_MATH *)contexto;
+    total = panel->por_filas ? panel->m : panel->n;
+    inicio = (unsigned int)(((unsigned long long)total * indice) / panel->tareas);
+    fin = (unsigned int)(((unsigned long long)total * (indice + 1)) / panel->tareas);
+    if (fin <= inicio)
+    {
+        return;
+    }
+
+    if (panel->por_filas)
+    {
+        producto_nucleo(panel->alfa, &panel->a[inicio * panel->af], panel->af, panel->ac, panel->b, panel->bf,
+                        panel->bc, panel->beta, &panel->c[inicio * panel->cf], panel->cf, fin - inicio,
+                        panel->n, panel->p);
+    }
     else
     {
-        /* Resta: M3 = M1 - M2 */
-        for (index = 0; index < total_elementos; index++)
+        producto_nucleo(panel->alfa, panel->a, panel->af, panel->ac, &panel->b[inicio * panel->bc], panel->bf,
+                        panel->bc, panel->beta, &panel->c[inicio], panel->cf, panel->m, fin - inicio,
+                        panel->p);
+    }
+}
+
+static void lote_nucleo(const float * a, const float * b, float * c, unsigned int m, unsigned int p,
+                        unsigned int n, unsigned int lote, unsigned int inicio, unsigned int fin)
+{
+    unsigned int i, j, k, l, g, carriles;
+    const float * pa;
+    const float * pb;
+    float * pc;
+    float suma[NSDSP_MATH_CARRILES];
+
+    /* Grupos de NSDSP_MATH_CARRILES matrices: el bucle interno recorre la misma posición (i, j) de
+     * matrices consecutivas, contigua en memoria, y el grupo de C queda en caché durante la suma en k */
+    for (g = inicio; g < fin; g += NSDSP_MATH_CARRILES)
+    {
+        carriles = (fin - g < NSDSP_MATH_CARRILES) ? fin - g : NSDSP_MATH_CARRILES;
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+                {
+                    suma[l] = 0.0f;
+                }
+                for (k = 0; k < p; k++)
+                {
+                    pa = &a[(i * p + k) * lote + g];
+                    pb = &b[(k * n + j) * lote + g];
+                    if (carriles == NSDSP_MATH_CARRILES)
+                    {
+                        for (l = 0; l < NSDSP_MATH_CARRILES; l++)
+                        {
+                            suma[l] += pa[l] * pb[l];
+                        }
+                    }
+                    else
+                    {
+                        for (l = 0; l < carriles; l++)
+                        {
+                            suma[l] += pa[l] * pb[l];
+                        }
+                    }
+                }
+                pc = &c[(i * n + j) * lote + g];
+                for (l = 0; l < carriles; l++)
+                {
+                    pc[l] = suma[l];
+                }
+            }
+        }
+    }
+}
+
+static void panel_lote(void * contexto, unsigned int indice)
+{
+    const PANEL_MATH * panel;
+    unsigned int grupos, inicio, fin;
+
+    /* Cada tarea procesa grupos completos de NSDSP_MATH_CARRILES matrices */
+    panel = (const PANEL_MATH *)contexto;
+    grupos = (panel->lote + NSDSP_MATH_CARRILES - 1) / NSDSP_MATH_CARRILES;
+    inicio = (grupos * indice / panel->tareas) * NSDSP_MATH_CARRILES;
+    fin = (grupos * (indice + 1) / panel->tareas) * NSDSP_MATH_CARRILES;
+    fin = (fin < panel->lote) ? fin : panel->lote;
+    if (fin > inicio)
+    {
+        lote_nucleo(panel->a, panel->b, panel->c, panel->m, panel->p, panel->n, panel->lote, inicio, fin);
+    }
+}
+
+static int bloque_nulo(const float * fila, unsigned int columna, unsigned int bloque, unsigned int columnas,
+                       float umbral)
+{
+    unsigned int t;
+
+    for (t = 0; t < bloque && columna + t < columnas; t++)
+    {
+        if (fabsf(fila[columna + t]) > umbral)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static float bloques4_disperso(const float * restrict w, const unsigned int * restrict columna,
+                               const float * restrict x, unsigned int n)
+{
+    unsigned int e, t;
+    const float * xe;
+    float suma[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+    /* Las cuatro columnas de cada bloque son contiguas en w y en x: el bucle interno es una
+     * multiplicación-acumulación de 4 carriles y cada carril suma su columna de todos los bloques */
+    for (e = 0; e < n; e++)
+    {
+        xe = &x[columna[e]];
+        for (t = 0; t < 4; t++)
         {
-            p_m3[index] = p_m1[index] - p_m2[index];
+            suma[t] += w[t] * xe[t];
         }
+        w += 4;
+    }
+
+    return (suma[0] + suma[2]) + (suma[1] + suma[3]);
+}
+
+static void fila_disperso(float * restrict y, const float * restrict x, float w, unsigned int k)
+{
+    unsigned int g, c;
+
+    /* Grupos de NSDSP_MATH_DISPERSA_CARRILES columnas de Y con ancho fijo y columnas restantes */
+    for (g = k / NSDSP_MATH_DISPERSA_CARRILES; g > 0; g--)
+    {
+        for (c = 0; c < NSDSP_MATH_DISPERSA_CARRILES; c++)
+        {
+            y[c] += w * x[c];
+        }
+        y += NSDSP_MATH_DISPERSA_CARRILES;
+        x += NSDSP_MATH_DISPERSA_CARRILES;
+    }
+    for (c = 0; c < k % NSDSP_MATH_DISPERSA_CARRILES; c++)
+    {
+        y[c] += w * x[c];
+    }
+}
+
+static int lote_valido(const MATRIZ_LOTE * PL)
+{
+    if (PL == NULL || PL->pmatriz == NULL || PL->filas == 0 || PL->columnas == 0 || PL->lote == 0)
+    {
+        return NSDSP_MATH_KO;
     }
 
     return NSDSP_MATH_OK;
 }
+
+static void limpia_matriz(MATRIZ * PM)
+{
+    unsigned int index;
+
+    /* Llenar la matriz con ceros si es posible */
+    if (PM != NULL && PM->pmatriz != NULL)
+    {
+        for (index = 0; index < PM->filas * PM->columnas; index++)
+        {
+            PM->pmatriz[index] = 0.0f;
+        }
+    }
+}
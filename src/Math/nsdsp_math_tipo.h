@@ -0,0 +1,303 @@
+/* Plantilla de los productos y sumas de nsdsp_math.c, genérica en el tipo de los elementos.
+ *
+ * nsdsp_math.c la incluye una vez por precisión después de definir:
+ * - MATH_TIPO: tipo de los elementos almacenados (float o double)
+ * - MATH_ACUMULADOR: tipo de los productos escalares (double en la precisión mixta)
+ * - MATH_MATRIZ: objeto matriz con elementos MATH_TIPO (MATRIZ o MATRIZ_D)
+ * - MATH_NUCLEO_PRODUCTO: nombre del núcleo C = alfa A B + beta C sobre almacenamiento con pasos
+ * - MATH_PRODUCTO: nombre del producto comprobado; MATH_REPARTO es la función a la que delega
+ *   (el reparto en tareas en precisión simple, el propio núcleo en el resto)
+ * - MATH_NUCLEO_SUMA, MATH_SUMA: nombres del núcleo y de la suma comprobada (opcionales)
+ * - MATH_MIXTA: definido si MATH_ACUMULADOR es más ancho que MATH_TIPO. El núcleo no acumula
+ *   entonces sobre las filas de C (almacenadas en MATH_TIPO) sino en productos escalares
+ *
+ * Los macros se anulan al final, por lo que no lleva guarda de inclusión.
+ */
+
+static void MATH_NUCLEO_PRODUCTO(MATH_TIPO alfa, const MATH_TIPO * a, unsigned int af, unsigned int ac,
+                                 const MATH_TIPO * b, unsigned int bf, unsigned int bc, MATH_TIPO beta,
+                                 MATH_TIPO * c, unsigned int cf, unsigned int m, unsigned int n, unsigned int p)
+{
+    unsigned int i, j, k;
+    MATH_TIPO * fila;
+    const MATH_TIPO * pa;
+    const MATH_TIPO * pb;
+    MATH_ACUMULADOR escala, acumulador;
+    MATH_ACUMULADOR suma[4];
+
+#ifndef MATH_MIXTA
+    if (bc == 1 && n > 1)
+    {
+        /* Filas de B contiguas: C(i,:) = beta C(i,:) + suma_k (alfa A(i,k)) B(k,:). El bucle interno
+         * recorre una fila de B y una de C, ambas contiguas, y la fila de C permanece en caché */
+        for (i = 0; i < m; i++)
+        {
+            fila = &c[i * cf];
+            pa = &a[i * af];
+            if (beta == (MATH_TIPO)0)
+            {
+                for (j = 0; j < n; j++)
+                {
+                    fila[j] = (MATH_TIPO)0;
+                }
+            }
+            else if (beta != (MATH_TIPO)1)
+            {
+                for (j = 0; j < n; j++)
+                {
+                    fila[j] *= beta;
+                }
+            }
+
+            for (k = 0; k < p; k++)
+            {
+                escala = alfa * pa[k * ac];
+                pb = &b[k * bf];
+                for (j = 0; j < n; j++)
+                {
+                    fila[j] += escala * pb[j];
+                }
+            }
+        }
+        return;
+    }
+#endif
+
+    /* B traspuesta o vector columna: cada C(i,j) es el producto escalar de la fila i de A y la
+     * columna j de B, que en el almacenamiento de B es contigua */
+    for (i = 0; i < m; i++)
+    {
+        fila = &c[i * cf];
+        pa = &a[i * af];
+        j = 0;
+        if (ac == 1 && bf == 1)
+        {
+            /* Cuatro columnas de B a la vez: cada A(i,k) leído se usa en cuatro productos independientes */
+            for (; j + 4 <= n; j += 4)
+            {
+                pb = &b[j * bc];
+                suma[0] = (MATH_ACUMULADOR)0;
+                suma[1] = (MATH_ACUMULADOR)0;
+                suma[2] = (MATH_ACUMULADOR)0;
+                suma[3] = (MATH_ACUMULADOR)0;
+                for (k = 0; k < p; k++)
+                {
+                    escala = pa[k];
+                    suma[0] += escala * pb[k];
+                    suma[1] += escala * pb[bc + k];
+                    suma[2] += escala * pb[2 * bc + k];
+                    suma[3] += escala * pb[3 * bc + k];
+                }
+                for (k = 0; k < 4; k++)
+                {
+                    fila[j + k] = (MATH_TIPO)((beta == (MATH_TIPO)0) ? alfa * suma[k] : alfa * suma[k] + beta * fila[j + k]);
+                }
+            }
+        }
+        for (; j < n; j++)
+        {
+            pb = &b[j * bc];
+            acumulador = (MATH_ACUMULADOR)0;
+            if (ac == 1 && bf == 1)
+            {
+                for (k = 0; k < p; k++)
+                {
+                    acumulador += (MATH_ACUMULADOR)pa[k] * pb[k];
+                }
+            }
+            else
+            {
+                for (k = 0; k < p; k++)
+                {
+                    acumulador += (MATH_ACUMULADOR)pa[k * ac] * pb[k * bf];
+                }
+            }
+            fila[j] = (MATH_TIPO)((beta == (MATH_TIPO)0) ? alfa * acumulador : alfa * acumulador + beta * fila[j]);
+        }
+    }
+}
+
+#ifdef MATH_NUCLEO_SUMA
+static void MATH_NUCLEO_SUMA(MATH_TIPO alfa, const MATH_TIPO * a, unsigned int af, unsigned int ac, MATH_TIPO beta,
+                             const MATH_TIPO * b, unsigned int bf, unsigned int bc, MATH_TIPO * c, unsigned int cf,
+                             unsigned int cc, unsigned int m, unsigned int n)
+{
+    unsigned int i, j;
+    const MATH_TIPO * pa;
+    const MATH_TIPO * pb;
+    MATH_TIPO * pc;
+
+    for (i = 0; i < m; i++)
+    {
+        pa = &a[i * af];
+        pb = &b[i * bf];
+        pc = &c[i * cf];
+
+        if (ac == 1 && bc == 1 && cc == 1)
+        {
+            /* Filas contiguas en las tres matrices */
+            for (j = 0; j < n; j++)
+            {
+                pc[j] = alfa * pa[j] + beta * pb[j];
+            }
+        }
+        else
+        {
+            for (j = 0; j < n; j++)
+            {
+                pc[j * cc] = alfa * pa[j * ac] + beta * pb[j * bc];
+            }
+        }
+    }
+}
+#endif
+
+int MATH_PRODUCTO(MATH_MATRIZ * PM1, MATH_MATRIZ * PM2, MATH_MATRIZ * PM3)
+{
+    unsigned int index;
+    unsigned int filas_m1, columnas_m1;
+    unsigned int filas_m2, columnas_m2;
+    unsigned int filas_m3, columnas_m3;
+    MATH_TIPO * p_m1;
+    MATH_TIPO * p_m2;
+    MATH_TIPO * p_m3;
+
+    /* Validar punteros de entrada */
+    if (PM1 == NULL || PM2 == NULL || PM3 == NULL)
+    {
+        /* Si PM3 es válido, llenar con ceros */
+        if (PM3 != NULL && PM3->pmatriz != NULL)
+        {
+            p_m3 = PM3->pmatriz;
+            for (index = 0; index < (PM3->filas * PM3->columnas); index++)
+            {
+                p_m3[index] = (MATH_TIPO)0;
+            }
+        }
+        return NSDSP_MATH_KO;
+    }
+
+    /* Validar punteros a datos */
+    if (PM1->pmatriz == NULL || PM2->pmatriz == NULL || PM3->pmatriz == NULL)
+    {
+        /* Llenar M3 con ceros si es posible */
+        if (PM3->pmatriz != NULL)
+        {
+            p_m3 = PM3->pmatriz;
+            for (index = 0; index < (PM3->filas * PM3->columnas); index++)
+            {
+                p_m3[index] = (MATH_TIPO)0;
+            }
+        }
+        return NSDSP_MATH_KO;
+    }
+
+    /* Obtener dimensiones */
+    filas_m1 = PM1->filas;
+    columnas_m1 = PM1->columnas;
+    filas_m2 = PM2->filas;
+    columnas_m2 = PM2->columnas;
+    filas_m3 = PM3->filas;
+    columnas_m3 = PM3->columnas;
+
+    /* Obtener punteros a datos */
+    p_m1 = PM1->pmatriz;
+    p_m2 = PM2->pmatriz;
+    p_m3 = PM3->pmatriz;
+
+    /* Verificar compatibilidad de dimensiones */
+    /* M1(a×b) × M2(b×c) = M3(a×c) */
+    if (columnas_m1 != filas_m2 || filas_m1 != filas_m3 || columnas_m2 != columnas_m3)
+    {
+        /* Dimensiones incompatibles, llenar M3 con ceros */
+        for (index = 0; index < (filas_m3 * columnas_m3); index++)
+        {
+            p_m3[index] = (MATH_TIPO)0;
+        }
+        return NSDSP_MATH_KO;
+    }
+
+    /* Realizar multiplicación de matrices: M3 = M1 × M2 con el núcleo de las vistas densas */
+    MATH_REPARTO((MATH_TIPO)1, p_m1, columnas_m1, 1, p_m2, columnas_m2, 1, (MATH_TIPO)0, p_m3, columnas_m3,
+                 filas_m1, columnas_m2, columnas_m1);
+
+    return NSDSP_MATH_OK;
+}
+
+#ifdef MATH_SUMA
+int MATH_SUMA(MATH_MATRIZ * PM1, MATH_MATRIZ * PM2, MATH_MATRIZ * PM3, int signo)
+{
+    unsigned int index;
+    unsigned int total_elementos;
+    MATH_TIPO * p_m1;
+    MATH_TIPO * p_m2;
+    MATH_TIPO * p_m3;
+
+    /* Validar punteros de entrada */
+    if (PM1 == NULL || PM2 == NULL || PM3 == NULL)
+    {
+        /* Si PM3 es válido, llenar con ceros */
+        if (PM3 != NULL && PM3->pmatriz != NULL)
+        {
+            p_m3 = PM3->pmatriz;
+            total_elementos = PM3->filas * PM3->columnas;
+            for (index = 0; index < total_elementos; index++)
+            {
+                p_m3[index] = (MATH_TIPO)0;
+            }
+        }
+        return NSDSP_MATH_KO;
+    }
+
+    /* Validar punteros a datos */
+    if (PM1->pmatriz == NULL || PM2->pmatriz == NULL || PM3->pmatriz == NULL)
+    {
+        /* Llenar M3 con ceros si es posible */
+        if (PM3->pmatriz != NULL)
+        {
+            p_m3 = PM3->pmatriz;
+            total_elementos = PM3->filas * PM3->columnas;
+            for (index = 0; index < total_elementos; index++)
+            {
+                p_m3[index] = (MATH_TIPO)0;
+            }
+        }
+        return NSDSP_MATH_KO;
+    }
+
+    /* Verificar que todas las matrices tienen las mismas dimensiones */
+    if (PM1->filas != PM2->filas || PM1->filas != PM3->filas ||
+        PM1->columnas != PM2->columnas || PM1->columnas != PM3->columnas)
+    {
+        /* Dimensiones incompatibles, llenar M3 con ceros */
+        p_m3 = PM3->pmatriz;
+        total_elementos = PM3->filas * PM3->columnas;
+        for (index = 0; index < total_elementos; index++)
+        {
+            p_m3[index] = (MATH_TIPO)0;
+        }
+        return NSDSP_MATH_KO;
+    }
+
+    /* Obtener punteros a datos */
+    p_m1 = PM1->pmatriz;
+    p_m2 = PM2->pmatriz;
+    p_m3 = PM3->pmatriz;
+
+    /* Realizar suma o resta según el signo: M3 = M1 ± M2 */
+    MATH_NUCLEO_SUMA((MATH_TIPO)1, p_m1, PM1->columnas, 1, (signo >= 0) ? (MATH_TIPO)1 : (MATH_TIPO)-1, p_m2,
+                     PM1->columnas, 1, p_m3, PM1->columnas, 1, PM1->filas, PM1->columnas);
+
+    return NSDSP_MATH_OK;
+}
+#endif
+
+#undef MATH_TIPO
+#undef MATH_ACUMULADOR
+#undef MATH_MATRIZ
+#undef MATH_NUCLEO_PRODUCTO
+#undef MATH_PRODUCTO
+#undef MATH_REPARTO
+#undef MATH_NUCLEO_SUMA
+#undef MATH_SUMA
+#undef MATH_MIXTA
@@ -0,0 +1,61 @@
+/* Plantilla de Dwt, genérica en el tipo de las muestras.
+ *
+ * DWT.c la incluye una vez por tipo después de definir:
+ * - DWT_TIPO: tipo de las muestras (float o int16_t en Q15)
+ * - DWT_OBJETO: objeto DWT con filtros y salidas de ese tipo
+ * - DWT_FILTRO: función de filtrado FIR de la API fir_api para ese tipo
+ * - DWT_FUNCION: nombre de la función generada
+ *
+ * Los macros se anulan al final, por lo que no lleva guarda de inclusión.
+ */
+
+void DWT_FUNCION(DWT_TIPO xin, DWT_OBJETO * dwt_object)
+{
+    unsigned int i;
+    DWT_TIPO xinput;
+    DWT_TIPO yhtemp,yltemp;
+
+
+    for (i=0;i<WAVELET_LEVELS;i++)
+    {
+        if (dwt_object->enabler[i]==0)
+        {
+            if (i==0)
+            {
+                xinput=xin;
+            }
+            else
+            {
+                xinput=dwt_object->yltemp[i-1];
+            }
+
+            yhtemp = DWT_FILTRO(xinput, &dwt_object->filtrohp[i]);
+            yltemp = DWT_FILTRO(xinput, &dwt_object->filtrolp[i]);
+
+
+            dwt_object->enabler[i]=(1<<i);                   /* 2^i -1. El filtrado del nivel i se hace 1 muestra de cada 2^i de la señal
+                                                                    de entrada */
+
+            if (dwt_object->decimator[i]==0)
+            {
+                dwt_object->yhtemp[i]=yhtemp;
+                dwt_object->yltemp[i]=yltemp;
+                dwt_object->decimator[i]=(1<<(i+1));          /* 2^(i+1)-1. La salida de los filtros LP HP del nivel i salen al
+                                                                    siguiente nivel cada 2^(i+1) muestras de la señal de entrada */
+                dwt_object->yout[i]=yhtemp;
+                if (i==(WAVELET_LEVELS-1))
+                {
+                    dwt_object->yout[i+1]=yltemp;
+                }
+            }
+        }
+        dwt_object->enabler[i]-=1;
+        dwt_object->decimator[i]-=1;
+
+    }
+}
+
+#undef DWT_TIPO
+#undef DWT_OBJETO
+#undef DWT_FILTRO
+#undef DWT_FUNCION
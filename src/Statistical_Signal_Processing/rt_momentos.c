@@ -141,6 +141,17 @@
  * \param xn Nueva muestra a procesar
  * \return Valor promedio de las últimas N_MA muestras
  *
+ * \section precision_rt Variantes de precisión
+ *
+ * Las funciones se generan desde la plantilla rt_momentos_tipo.h, incluida una vez por precisión:
+ * - Float (suscribe_rt_momentos, compute_rt_momentos): el camino de versiones anteriores, que actualiza
+ *   la vista nsdsp_statistical_objects
+ * - Double (suscribe_rt_momentos_d, unsuscribe_rt_momentos_d, compute_rt_momentos_d): servicios propios
+ *   en servicios_rt_momentos_d, con buffers y momentos en double. No actualizan la vista
+ * - Mixta (compute_rt_momentos_m): opera sobre un servicio float, con buffers float y medias, diferencias
+ *   y potencias en double. Evita la pérdida de cifras de x(n) - M1 cuando la media es grande frente a
+ *   la desviación, sin duplicar la memoria de los buffers
+ *
  * \author Dr. Carlos Romero
  *
  * \section historial_rt Historial de cambios
@@ -149,6 +160,7 @@
  * | 22/06/2025 | Dr. Carlos Romero | 1 | Primera edición |
  * | 12/07/2025 | Dr. Carlos Romero | 2 | Implementación completa de los 4 momentos |
  * | 03/08/2025 | Dr. Carlos Romero | 3 | Actualización documentación Doxygen según estándar |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Variantes en doble precisión y mixta generadas desde rt_momentos_tipo.h |
  *
  * \copyright ZGR R&D AIE
  */
@@ -162,12 +174,19 @@ RT_MOMENTOS_SERVICE Suscribe_RT_Momentos(void);
 int Unsuscribe_RT_Momentos(RT_MOMENTOS_SERVICE);
 int Compute_RT_Momentos(RT_MOMENTOS_SERVICE, float);
 float MA_Filter(BUFFER_Z *, float);
+RT_MOMENTOS_SERVICE Suscribe_RT_Momentos_D(void);
+int Unsuscribe_RT_Momentos_D(RT_MOMENTOS_SERVICE);
+int Compute_RT_Momentos_D(RT_MOMENTOS_SERVICE, double);
+double MA_Filter_D(BUFFER_Z_D *, double);
+int Compute_RT_Momentos_M(RT_MOMENTOS_SERVICE, float);
+double MA_Filter_M(BUFFER_Z *, double);
 
 // Declaración externa para la vista simplificada
 statistical_object nsdsp_statistical_objects[MAX_RT_MOMENTOS];
 
 // Atributos
 RT_MOMENTOS servicios_rt_momentos[MAX_RT_MOMENTOS] = {0};  // Buffer de objetos RT_MOMENTOS
+RT_MOMENTOS_D servicios_rt_momentos_d[MAX_RT_MOMENTOS] = {0};  // Buffer de objetos RT_MOMENTOS_D
 SSP pse;
 
 // Definición de funciones
@@ -177,193 +196,47 @@ void Init_RT_Momentos(void)
     pse.suscribe_rt_momentos = Suscribe_RT_Momentos;
     pse.unsuscribe_rt_momentos = Unsuscribe_RT_Momentos;
     pse.compute_rt_momentos = Compute_RT_Momentos;
+    pse.suscribe_rt_momentos_d = Suscribe_RT_Momentos_D;
+    pse.unsuscribe_rt_momentos_d = Unsuscribe_RT_Momentos_D;
+    pse.compute_rt_momentos_d = Compute_RT_Momentos_D;
+    pse.compute_rt_momentos_m = Compute_RT_Momentos_M;
 }
 
-RT_MOMENTOS_SERVICE Suscribe_RT_Momentos(void)
-{
-    static RT_MOMENTOS_SERVICE service = 0;
-    RT_MOMENTOS_SERVICE result;
-    unsigned int checked, estado;
-
-    estado = 0;
-    checked = 0;
-
-    while (estado == 0)
-    {
-        if (servicios_rt_momentos[service].status == FREE)
-        {
-            result = service;
-            servicios_rt_momentos[service].status = ASIGNED;
-
-            // Inicializar los índices de escritura de los buffers
-            servicios_rt_momentos[service].z_buffers.mu_z.index_w = 0;
-            servicios_rt_momentos[service].z_buffers.sigma2_z.index_w = 0;
-            servicios_rt_momentos[service].z_buffers.a_z.index_w = 0;
-            servicios_rt_momentos[service].z_buffers.c_z.index_w = 0;
-
-            // Inicializar los buffers a cero
-            for (int i = 0; i < N_MA; i++)
-            {
-                servicios_rt_momentos[service].z_buffers.mu_z.buffer_z[i] = 0.0f;
-                servicios_rt_momentos[service].z_buffers.sigma2_z.buffer_z[i] = 0.0f;
-                servicios_rt_momentos[service].z_buffers.a_z.buffer_z[i] = 0.0f;
-                servicios_rt_momentos[service].z_buffers.c_z.buffer_z[i] = 0.0f;
-            }
-
-            // Inicializar los momentos
-            servicios_rt_momentos[service].mu = 0.0f;
-            servicios_rt_momentos[service].var2 = 0.0f;
-            servicios_rt_momentos[service].A = 0.0f;
-            servicios_rt_momentos[service].C = 0.0f;
-
-            service++;
-            estado = 1;
-        }
-        else
-        {
-            service++;
-        }
-
-        if (service == MAX_RT_MOMENTOS)
-            service = 0;
-
-        checked++;
-        if (checked == MAX_RT_MOMENTOS && estado == 0)
-            estado = 2;
-    }
-
-    if (estado != 1)
-        result = (RT_MOMENTOS_SERVICE)(NONE);
-
-    return (result);
-}
-
-int Unsuscribe_RT_Momentos(RT_MOMENTOS_SERVICE id_service)
-{
-    int result;
-
-    result = RT_MOMENTOS_KO;
-
-    if (id_service >= 0 && id_service < MAX_RT_MOMENTOS &&
-        servicios_rt_momentos[id_service].status == ASIGNED)
-    {
-        servicios_rt_momentos[id_service] = (RT_MOMENTOS){0};
-        result = RT_MOMENTOS_OK;
-    }
-    return (result);
-}
-
-int Compute_RT_Momentos(RT_MOMENTOS_SERVICE id_service, float xn)
-{
-    int result;
-    float mu_out;
-    float diff;
-    float diff2, diff3, diff4;
-    float sigma2_out;
-    float asimetria_input;
-    float curtosis_input;
-    float sqrt_sigma2;
-    float sigma2_cubed;
-    float sigma2_squared;
-
-    result = RT_MOMENTOS_KO;
-
-    if (id_service >= 0 && id_service < MAX_RT_MOMENTOS &&
-        servicios_rt_momentos[id_service].status == ASIGNED)
-    {
-        result = RT_MOMENTOS_OK;
-
-        // M1: Media móvil de x(n)
-        mu_out = MA_Filter(&servicios_rt_momentos[id_service].z_buffers.mu_z, xn);
-        servicios_rt_momentos[id_service].mu = mu_out;
-
-        // Actualizar vista simplificada
-        nsdsp_statistical_objects[id_service].media = mu_out;
-
-        // Calcular (x(n) - M1)
-        diff = xn - mu_out;
-
-        // Calcular potencias de la diferencia
-        diff2 = diff * diff;
-        diff3 = diff2 * diff;
-        diff4 = diff2 * diff2;
-
-        // M2: Varianza = MA((x(n) - M1)²)
-        sigma2_out = MA_Filter(&servicios_rt_momentos[id_service].z_buffers.sigma2_z, diff2);
-        servicios_rt_momentos[id_service].var2 = sigma2_out;
-
-        // Actualizar vista simplificada
-        nsdsp_statistical_objects[id_service].varianza = sigma2_out;
-
-        // M3: Asimetría = MA((x(n) - M1)³ / sqrt(M2)³)
-        // Protección contra división por cero
-        if (sigma2_out > 0.0f)
-        {
-            sqrt_sigma2 = sqrtf(sigma2_out);
-            sigma2_cubed = sqrt_sigma2 * sqrt_sigma2 * sqrt_sigma2;
-
-            if (sigma2_cubed > 0.0f)
-            {
-                asimetria_input = diff3 / sigma2_cubed;
-                servicios_rt_momentos[id_service].A = MA_Filter(&servicios_rt_momentos[id_service].z_buffers.a_z, asimetria_input);
-                nsdsp_statistical_objects[id_service].asimetria = servicios_rt_momentos[id_service].A;
-            }
-            else
-            {
-                servicios_rt_momentos[id_service].A = 0.0f;
-                nsdsp_statistical_objects[id_service].asimetria = 0.0f;
-                result = RT_MOMENTOS_KO;
-            }
-        }
-        else
-        {
-            servicios_rt_momentos[id_service].A = 0.0f;
-            nsdsp_statistical_objects[id_service].asimetria = 0.0f;
-            result = RT_MOMENTOS_KO;
-        }
-
-        // M4: Curtosis = MA((x(n) - M1)⁴ / M2²)
-        // Protección contra división por cero
-        if (sigma2_out > 0.0f)
-        {
-            sigma2_squared = sigma2_out * sigma2_out;
-            curtosis_input = diff4 / sigma2_squared;
-            servicios_rt_momentos[id_service].C = MA_Filter(&servicios_rt_momentos[id_service].z_buffers.c_z, curtosis_input);
-            nsdsp_statistical_objects[id_service].curtosis = servicios_rt_momentos[id_service].C;
-        }
-        else
-        {
-            servicios_rt_momentos[id_service].C = 0.0f;
-            nsdsp_statistical_objects[id_service].curtosis = 0.0f;
-            result = RT_MOMENTOS_KO;
-        }
-    }
-
-    return (result);
-}
-
-float MA_Filter(BUFFER_Z *pz, float xn)
-{
-    float suma;
-    unsigned int i;
-    unsigned int index_w;
-
-    // Obtener el índice de escritura actual
-    index_w = pz->index_w;
-
-    // Escribir el nuevo valor en el buffer circular
-    pz->buffer_z[index_w] = xn;
-
-    // Calcular la suma de todos los elementos del buffer
-    suma = 0.0f;
-    for (i = 0; i < N_MA; i++)
-    {
-        suma += pz->buffer_z[i];
-    }
-
-    // Actualizar el índice de escritura (buffer circular)
-    pz->index_w = (index_w + 1) % N_MA;
-
-    // Retornar el promedio
-    return (suma * INV_N_MA);
-}
+// Precisión simple: el camino rápido, idéntico al de versiones anteriores
+#define RT_TIPO         float
+#define RT_ACUMULADOR   float
+#define RT_RAIZ         sqrtf
+#define RT_OBJETO       RT_MOMENTOS
+#define RT_BUFFER       BUFFER_Z
+#define RT_SERVICIOS    servicios_rt_momentos
+#define RT_SUSCRIBE     Suscribe_RT_Momentos
+#define RT_UNSUSCRIBE   Unsuscribe_RT_Momentos
+#define RT_COMPUTE      Compute_RT_Momentos
+#define RT_MA           MA_Filter
+#define RT_VISTA
+#include "rt_momentos_tipo.h"
+
+// Doble precisión: servicios propios, sin vista simplificada
+#define RT_TIPO         double
+#define RT_ACUMULADOR   double
+#define RT_RAIZ         sqrt
+#define RT_OBJETO       RT_MOMENTOS_D
+#define RT_BUFFER       BUFFER_Z_D
+#define RT_SERVICIOS    servicios_rt_momentos_d
+#define RT_SUSCRIBE     Suscribe_RT_Momentos_D
+#define RT_UNSUSCRIBE   Unsuscribe_RT_Momentos_D
+#define RT_COMPUTE      Compute_RT_Momentos_D
+#define RT_MA           MA_Filter_D
+#include "rt_momentos_tipo.h"
+
+// Precisión mixta: servicios float (suscritos con Suscribe_RT_Momentos) y cálculo en double
+#define RT_TIPO         float
+#define RT_ACUMULADOR   double
+#define RT_RAIZ         sqrt
+#define RT_OBJETO       RT_MOMENTOS
+#define RT_BUFFER       BUFFER_Z
+#define RT_SERVICIOS    servicios_rt_momentos
+#define RT_COMPUTE      Compute_RT_Momentos_M
+#define RT_MA           MA_Filter_M
+#define RT_VISTA
+#include "rt_momentos_tipo.h"
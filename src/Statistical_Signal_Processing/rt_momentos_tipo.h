@@ -0,0 +1,224 @@
+/* Plantilla de las funciones de rt_momentos.c, genérica en el tipo de los buffers y del cálculo.
+ *
+ * rt_momentos.c la incluye una vez por precisión después de definir:
+ * - RT_TIPO: tipo de los buffers de las medias móviles y de los momentos (float o double)
+ * - RT_ACUMULADOR: tipo de las sumas y del cálculo de los momentos (double en la precisión mixta)
+ * - RT_RAIZ: raíz cuadrada en RT_ACUMULADOR (sqrtf o sqrt)
+ * - RT_OBJETO, RT_BUFFER, RT_SERVICIOS: objeto, buffer Z y array de servicios de esa precisión
+ * - RT_SUSCRIBE, RT_UNSUSCRIBE: nombres de la suscripción (sin definir si se reutiliza la de otra precisión)
+ * - RT_COMPUTE, RT_MA: nombres del cálculo de momentos y de la media móvil
+ * - RT_VISTA: definido si se actualiza la vista nsdsp_statistical_objects (servicios float)
+ *
+ * Los macros se anulan al final, por lo que no lleva guarda de inclusión.
+ */
+
+#ifdef RT_VISTA
+#define RT_ACTUALIZA_VISTA(id, campo, valor)    (nsdsp_statistical_objects[id].campo = (float)(valor))
+#else
+#define RT_ACTUALIZA_VISTA(id, campo, valor)    ((void)0)
+#endif
+
+#ifdef RT_SUSCRIBE
+RT_MOMENTOS_SERVICE RT_SUSCRIBE(void)
+{
+    static RT_MOMENTOS_SERVICE service = 0;
+    RT_MOMENTOS_SERVICE result;
+    unsigned int checked, estado;
+
+    estado = 0;
+    checked = 0;
+
+    while (estado == 0)
+    {
+        if (RT_SERVICIOS[service].status == FREE)
+        {
+            result = service;
+            RT_SERVICIOS[service].status = ASIGNED;
+
+            // Inicializar los índices de escritura de los buffers
+            RT_SERVICIOS[service].z_buffers.mu_z.index_w = 0;
+            RT_SERVICIOS[service].z_buffers.sigma2_z.index_w = 0;
+            RT_SERVICIOS[service].z_buffers.a_z.index_w = 0;
+            RT_SERVICIOS[service].z_buffers.c_z.index_w = 0;
+
+            // Inicializar los buffers a cero
+            for (int i = 0; i < N_MA; i++)
+            {
+                RT_SERVICIOS[service].z_buffers.mu_z.buffer_z[i] = (RT_TIPO)0;
+                RT_SERVICIOS[service].z_buffers.sigma2_z.buffer_z[i] = (RT_TIPO)0;
+                RT_SERVICIOS[service].z_buffers.a_z.buffer_z[i] = (RT_TIPO)0;
+                RT_SERVICIOS[service].z_buffers.c_z.buffer_z[i] = (RT_TIPO)0;
+            }
+
+            // Inicializar los momentos
+            RT_SERVICIOS[service].mu = (RT_TIPO)0;
+            RT_SERVICIOS[service].var2 = (RT_TIPO)0;
+            RT_SERVICIOS[service].A = (RT_TIPO)0;
+            RT_SERVICIOS[service].C = (RT_TIPO)0;
+
+            service++;
+            estado = 1;
+        }
+        else
+        {
+            service++;
+        }
+
+        if (service == MAX_RT_MOMENTOS)
+            service = 0;
+
+        checked++;
+        if (checked == MAX_RT_MOMENTOS && estado == 0)
+            estado = 2;
+    }
+
+    if (estado != 1)
+        result = (RT_MOMENTOS_SERVICE)(NONE);
+
+    return (result);
+}
+
+int RT_UNSUSCRIBE(RT_MOMENTOS_SERVICE id_service)
+{
+    int result;
+
+    result = RT_MOMENTOS_KO;
+
+    if (id_service >= 0 && id_service < MAX_RT_MOMENTOS &&
+        RT_SERVICIOS[id_service].status == ASIGNED)
+    {
+        RT_SERVICIOS[id_service] = (RT_OBJETO){0};
+        result = RT_MOMENTOS_OK;
+    }
+    return (result);
+}
+
+#endif
+
+int RT_COMPUTE(RT_MOMENTOS_SERVICE id_service, RT_TIPO xn)
+{
+    int result;
+    RT_ACUMULADOR mu_out;
+    RT_ACUMULADOR diff;
+    RT_ACUMULADOR diff2, diff3, diff4;
+    RT_ACUMULADOR sigma2_out;
+    RT_ACUMULADOR asimetria_input;
+    RT_ACUMULADOR curtosis_input;
+    RT_ACUMULADOR sqrt_sigma2;
+    RT_ACUMULADOR sigma2_cubed;
+    RT_ACUMULADOR sigma2_squared;
+
+    result = RT_MOMENTOS_KO;
+
+    if (id_service >= 0 && id_service < MAX_RT_MOMENTOS &&
+        RT_SERVICIOS[id_service].status == ASIGNED)
+    {
+        result = RT_MOMENTOS_OK;
+
+        // M1: Media móvil de x(n)
+        mu_out = RT_MA(&RT_SERVICIOS[id_service].z_buffers.mu_z, xn);
+        RT_SERVICIOS[id_service].mu = (RT_TIPO)mu_out;
+
+        // Actualizar vista simplificada
+        RT_ACTUALIZA_VISTA(id_service, media, mu_out);
+
+        // Calcular (x(n) - M1)
+        diff = xn - mu_out;
+
+        // Calcular potencias de la diferencia
+        diff2 = diff * diff;
+        diff3 = diff2 * diff;
+        diff4 = diff2 * diff2;
+
+        // M2: Varianza = MA((x(n) - M1)²)
+        sigma2_out = RT_MA(&RT_SERVICIOS[id_service].z_buffers.sigma2_z, diff2);
+        RT_SERVICIOS[id_service].var2 = (RT_TIPO)sigma2_out;
+
+        // Actualizar vista simplificada
+        RT_ACTUALIZA_VISTA(id_service, varianza, sigma2_out);
+
+        // M3: Asimetría = MA((x(n) - M1)³ / sqrt(M2)³)
+        // Protección contra división por cero
+        if (sigma2_out > (RT_ACUMULADOR)0)
+        {
+            sqrt_sigma2 = RT_RAIZ(sigma2_out);
+            sigma2_cubed = sqrt_sigma2 * sqrt_sigma2 * sqrt_sigma2;
+
+            if (sigma2_cubed > (RT_ACUMULADOR)0)
+            {
+                asimetria_input = diff3 / sigma2_cubed;
+                RT_SERVICIOS[id_service].A = (RT_TIPO)RT_MA(&RT_SERVICIOS[id_service].z_buffers.a_z, asimetria_input);
+                RT_ACTUALIZA_VISTA(id_service, asimetria, RT_SERVICIOS[id_service].A);
+            }
+            else
+            {
+                RT_SERVICIOS[id_service].A = (RT_TIPO)0;
+                RT_ACTUALIZA_VISTA(id_service, asimetria, (RT_TIPO)0);
+                result = RT_MOMENTOS_KO;
+            }
+        }
+        else
+        {
+            RT_SERVICIOS[id_service].A = (RT_TIPO)0;
+            RT_ACTUALIZA_VISTA(id_service, asimetria, (RT_TIPO)0);
+            result = RT_MOMENTOS_KO;
+        }
+
+        // M4: Curtosis = MA((x(n) - M1)⁴ / M2²)
+        // Protección contra división por cero
+        if (sigma2_out > (RT_ACUMULADOR)0)
+        {
+            sigma2_squared = sigma2_out * sigma2_out;
+            curtosis_input = diff4 / sigma2_squared;
+            RT_SERVICIOS[id_service].C = (RT_TIPO)RT_MA(&RT_SERVICIOS[id_service].z_buffers.c_z, curtosis_input);
+            RT_ACTUALIZA_VISTA(id_service, curtosis, RT_SERVICIOS[id_service].C);
+        }
+        else
+        {
+            RT_SERVICIOS[id_service].C = (RT_TIPO)0;
+            RT_ACTUALIZA_VISTA(id_service, curtosis, (RT_TIPO)0);
+            result = RT_MOMENTOS_KO;
+        }
+    }
+
+    return (result);
+}
+
+RT_ACUMULADOR RT_MA(RT_BUFFER *pz, RT_ACUMULADOR xn)
+{
+    RT_ACUMULADOR suma;
+    unsigned int i;
+    unsigned int index_w;
+
+    // Obtener el índice de escritura actual
+    index_w = pz->index_w;
+
+    // Escribir el nuevo valor en el buffer circular
+    pz->buffer_z[index_w] = (RT_TIPO)xn;
+
+    // Calcular la suma de todos los elementos del buffer
+    suma = (RT_ACUMULADOR)0;
+    for (i = 0; i < N_MA; i++)
+    {
+        suma += pz->buffer_z[i];
+    }
+
+    // Actualizar el índice de escritura (buffer circular)
+    pz->index_w = (index_w + 1) % N_MA;
+
+    // Retornar el promedio
+    return (suma * ((RT_ACUMULADOR)1 / (RT_ACUMULADOR)N_MA));
+}
+
+#undef RT_ACTUALIZA_VISTA
+#undef RT_TIPO
+#undef RT_ACUMULADOR
+#undef RT_RAIZ
+#undef RT_OBJETO
+#undef RT_BUFFER
+#undef RT_SERVICIOS
+#undef RT_SUSCRIBE
+#undef RT_UNSUSCRIBE
+#undef RT_COMPUTE
+#undef RT_MA
+#undef RT_VISTA
@@ -0,0 +1,545 @@
+/** \page fast_fir FAST FIR - CONVOLUCIÓN RÁPIDA
+ * \brief Módulo de filtrado FIR largo por convolución rápida para la librería NSDSP
+ *
+ * Este módulo filtra señales con respuestas impulsionales largas (filtros adaptados,
+ * respuestas de sala, de miles a decenas de miles de coeficientes) que quedan fuera del
+ * alcance de fir_filter() (limitado a MAX_FIR_LENGTH coeficientes y con coste O(N) por
+ * muestra). get_fir elige automáticamente el algoritmo según el número de coeficientes:
+ * - Hasta FAST_FIR_UMBRAL coeficientes: forma directa con fir_api.fir_filter, sin latencia
+ * - Por encima: overlap-save con particiones uniformes sobre la FFT real del módulo FFT
+ *
+ * Para lazos cerrados que no toleran la latencia de bloque, get_fir_nupc construye una
+ * convolución particionada no uniforme: una cabeza corta en forma directa seguida de
+ * particiones FFT de tamaño creciente, con la latencia de la forma directa (cero muestras).
+ *
+ * \section teoria_fast_fir Teoría
+ *
+ * La respuesta h de N coeficientes se divide en K particiones de B coeficientes
+ * \f$ h_k[m] = h[kB + m] \f$. La entrada se agrupa en bloques de B muestras y, al completar
+ * cada bloque j, se transforma la ventana de 2B muestras formada por los bloques j-1 y j:
+ * \f[
+ * X_j = \mathrm{RFFT}_{2B}\{x[(j-1)B \ldots (j+1)B - 1]\},\qquad
+ * Y_j = \sum_{k=0}^{K-1} H_k \cdot X_{j-k}
+ * \f]
+ * donde \f$ H_k \f$ es la FFT de \f$ h_k \f$ completada con B ceros. Las últimas B muestras de
+ * \f$ \mathrm{IRFFT}_{2B}\{Y_j\} \f$ son exactamente la salida lineal del bloque j
+ * (overlap-save). Los espectros de entrada pasados forman una línea de retardo frecuencial,
+ * por lo que cada bloque cuesta una FFT directa, una inversa y K productos espectrales:
+ * - K = 1 (B >= N): overlap-save clásico, O(log N) operaciones por muestra
+ * - K > 1: menor latencia (B muestras) a cambio de O(K) productos por muestra
+ *
+ * La salida se entrega con una latencia fija de B muestras (la del bloque en formación), sea
+ * cual sea el tamaño de los bloques que entregue el llamante.
+ *
+ * \subsection teoria_nupc_fast_fir Convolución particionada no uniforme
+ *
+ * Una etapa overlap-save de bloque B entrega su salida con B muestras de retraso, por lo que
+ * puede calcular sin latencia cualquier tramo de h que empiece en el coeficiente B. Con una
+ * cabeza directa de \f$ B_0 \f$ coeficientes, la respuesta se reparte como:
+ * \f[
+ * h = \underbrace{h[0, B_0)}_{\text{directa}} + \underbrace{h[B_0, 2B_0)}_{B_0}
+ *   + \underbrace{h[2B_0, 4B_0)}_{2B_0} + \ldots + \underbrace{h[B_{max}, N)}_{B_{max},\ K\ \text{particiones}}
+ * \f]
+ * La etapa i tiene bloque \f$ B_i = B_0 2^i \f$ y empieza en el coeficiente \f$ B_i \f$, de
+ * modo que su latencia coincide exactamente con su desplazamiento y la suma de la cabeza y
+ * las etapas es la convolución completa sin retraso. El coste medio por muestra es el de la
+ * cabeza más O(log N) por etapa, en lugar de O(N).
+ *
+ * \subsection peor_caso_fast_fir Coste de la peor muestra
+ *
+ * Cada etapa calcula su bloque completo (RFFT, K productos espectrales e IRFFT) en la muestra
+ * que lo completa, y como su salida se necesita en la muestra siguiente no hay holgura para
+ * repartir ese trabajo entre las muestras del bloque siguiente. Las muestras múltiplo de
+ * \f$ B_{max} \f$ completan el bloque de todas las etapas a la vez y cuestan:
+ * \f[
+ * C_{peor} = C_{cabeza} + \sum_i \left( C_{RFFT}(2B_i) + C_{IRFFT}(2B_i) + K_i B_i\ C_{MAC} \right)
+ * \f]
+ * Como los bloques se duplican de una etapa a la siguiente, las FFT de todas las etapas previas
+ * suman menos que las de la última: la peor muestra cuesta menos del doble que un bloque de
+ * overlap-save uniforme de \f$ B_{max} \f$ con K particiones. Con 16384 coeficientes, cabeza
+ * de 32 y \f$ B_{max} \f$ = 2048, Test_NUPC_Fast_Fir mide unos 90 us en la peor muestra, del
+ * orden de 600 veces la media. Un sistema de tiempo real debe dimensionarse para \f$ C_{peor} \f$
+ * (o absorberlo con un búfer de salida); reducir \f$ B_{max} \f$ baja el pico a cambio de más
+ * particiones y más productos espectrales por muestra en media.
+ *
+ * \section uso_fast_fir Uso del módulo
+ *
+ * Para utilizar este módulo:
+ * 1. Inicializar con Init_Fast_Fir() (llamado automáticamente por Init_NSDSP())
+ * 2. Crear un plan real de 2B puntos con fft_api.get_rplan()
+ * 3. Crear el filtro con fast_fir_api.get_fir() y un workspace de FAST_FIR_WORKSPACE(N, B) floats
+ * 4. Filtrar muestra a muestra con fir_filter() o por bloques con fir_bloque()
+ *
+ * Para latencia nula, el paso 2 crea un plan por etapa (2B_0, 4B_0, ... 2B_max puntos) y el
+ * paso 3 usa get_fir_nupc() con un workspace de FAST_FIR_NUPC_WORKSPACE(N, B_0, B_max) floats.
+ *
+ * Ejemplo de uso:
+ * \code
+ * #include "fast_fir.h"
+ *
+ * static COMPLEJO twiddle[RFFT_TWIDDLE_SIZE(4096)];
+ * static unsigned int bitrev[RFFT_BITREV_SIZE(4096)];
+ * static float workspace[FAST_FIR_WORKSPACE(2000, 2048)];
+ * static FAST_FIR_OBJECT filtro;
+ * static RFFT_PLAN plan;
+ *
+ * void inicio(const float *h) {      // Filtro adaptado de 2000 coeficientes
+ *     fft_api.get_rplan(4096, twiddle, bitrev, &plan);
+ *     fast_fir_api.get_fir(2000, h, 2048, &plan, workspace, &filtro);
+ * }
+ *
+ * void bloque(const float *x, float *y) {
+ *     fast_fir_api.fir_bloque(x, y, 256, &filtro);    // y retrasada filtro.latencia muestras
+ * }
+ * \endcode
+ *
+ * \section funciones_fast_fir Descripción de funciones
+ *
+ * \subsection init_fast_fir_func Init_Fast_Fir
+ * Inicializa la estructura de punteros a funciones fast_fir_api.
+ *
+ * \subsection get_fast_fir_func get_fir
+ * Selecciona el algoritmo, reparte el workspace, precalcula los espectros de las particiones
+ * y limpia el estado. Requiere que Init_Fir() e Init_FFT() se hayan llamado.
+ * \param ncoef Número de coeficientes (> 0)
+ * \param pcoef Coeficientes h[0..ncoef-1] (se copian en el modo overlap-save)
+ * \param bloque B: tamaño de bloque y partición (potencia de 2; se ignora en forma directa)
+ * \param plan Plan real de 2B puntos (puede ser NULL en forma directa)
+ * \param workspace Buffer de FAST_FIR_WORKSPACE(ncoef, bloque) floats
+ * \param pfir Objeto a inicializar
+ * \return FAST_FIR_OK (0) si éxito, FAST_FIR_KO (-1) si error
+ *
+ * \subsection get_fast_fir_nupc_func get_fir_nupc
+ * Crea un filtro de latencia nula por convolución particionada no uniforme. Si ncoef no
+ * supera la cabeza, el filtro queda en forma directa.
+ * \param ncoef Número de coeficientes (> 0)
+ * \param pcoef Coeficientes h[0..ncoef-1] (la cabeza los usa sin copiar)
+ * \param cabeza B_0: coeficientes en forma directa (potencia de 2, <= MAX_FIR_LENGTH)
+ * \param bloque_max B_max: bloque de la última etapa (potencia de 2, >= cabeza)
+ * \param planes Planes reales de las etapas: planes[i] de 2 B_0 2^i puntos, hasta 2 B_max
+ * \param workspace Buffer de FAST_FIR_NUPC_WORKSPACE(ncoef, cabeza, bloque_max) floats
+ * \param pfir Objeto a inicializar
+ * \return FAST_FIR_OK (0) si éxito, FAST_FIR_KO (-1) si error
+ *
+ * \subsection fast_fir_filter_func fir_filter
+ * Filtra una muestra. Misma semántica que fir_api.fir_filter, con la salida retrasada
+ * pfir->latencia muestras.
+ * \param xin Muestra de entrada
+ * \param pfir Objeto filtro
+ * \return Muestra de salida, o 0.0 si error
+ *
+ * \subsection fast_fir_bloque_func fir_bloque
+ * Filtra un bloque de cualquier longitud (x e y pueden ser el mismo buffer). Las muestras se
+ * copian por tramos hasta completar cada bloque interno de B muestras; en NUPC los tramos
+ * son de como máximo B_0 muestras y cada etapa suma su salida a la de la cabeza.
+ * \param x Muestras de entrada
+ * \param y Muestras de salida
+ * \param nmuestras Número de muestras
+ * \param pfir Objeto filtro
+ * \return FAST_FIR_OK (0) si éxito, FAST_FIR_KO (-1) si error
+ *
+ * \dot
+ * digraph fast_fir_flow {
+ *   rankdir=LR;
+ *   node [shape=box, style=filled];
+ *
+ *   X [label="x[n]", shape=plaintext];
+ *   SEL [label="ncoef <= UMBRAL?", shape=diamond, fillcolor=lightyellow];
+ *   DIR [label="fir_filter\n(forma directa)", fillcolor=lightblue];
+ *   BUF [label="Bloque de B\nmuestras", fillcolor=lightyellow];
+ *   FFT [label="RFFT 2B", fillcolor=lightblue];
+ *   FDL [label="Σ H_k · X_{j-k}\n(línea de retardo\nfrecuencial)", fillcolor=lightcyan];
+ *   IFFT [label="IRFFT 2B\n(últimas B)", fillcolor=lightblue];
+ *   NUPC [label="get_fir_nupc:\ncabeza directa +\netapas B_0, 2B_0, ... B_max", fillcolor=lightcyan];
+ *   SUM [label="Σ", shape=circle, fillcolor=lightyellow];
+ *   Y [label="y[n]", shape=plaintext];
+ *
+ *   X -> SEL;
+ *   SEL -> DIR [label="sí"];
+ *   SEL -> BUF [label="no"];
+ *   BUF -> FFT -> FDL -> IFFT -> Y;
+ *   DIR -> Y;
+ *   X -> NUPC -> SUM -> Y [label="latencia 0"];
+ * }
+ * \enddot
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_fast_fir Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial: overlap-save con particiones uniformes y selección automática |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Convolución particionada no uniforme de latencia nula (get_fir_nupc) |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Documentado el coste de la peor muestra de la convolución no uniforme |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#include "fast_fir.h"
+#include <stddef.h>
+
+/* Declaración de funciones */
+void Init_Fast_Fir(void);
+int get_fast_fir(unsigned int ncoef, const float *pcoef, unsigned int bloque, RFFT_PLAN *plan,
+                 float *workspace, FAST_FIR_OBJECT *pfir);
+int get_fast_fir_nupc(unsigned int ncoef, const float *pcoef, unsigned int cabeza, unsigned int bloque_max,
+                      RFFT_PLAN *planes, float *workspace, FAST_FIR_OBJECT *pfir);
+float fast_fir_filter(float xin, FAST_FIR_OBJECT *pfir);
+int fast_fir_bloque(const float *x, float *y, unsigned int nmuestras, FAST_FIR_OBJECT *pfir);
+static int get_etapa_fast_fir(const float *pcoef, unsigned int ncoef, unsigned int bloque, RFFT_PLAN *plan,
+                              float *workspace, FAST_FIR_ETAPA *petapa);
+static void etapa_bloque_fast_fir(const float *x, float *y, unsigned int nmuestras, int sumar,
+                                  FAST_FIR_ETAPA *petapa);
+static void procesar_etapa_fast_fir(FAST_FIR_ETAPA *petapa);
+
+/* Declaración de objetos */
+FAST_FIR_API fast_fir_api;
+
+/* Definición de funciones */
+
+void Init_Fast_Fir(void)
+{
+    /* Inicializar punteros de la API */
+    fast_fir_api.get_fir = get_fast_fir;
+    fast_fir_api.get_fir_nupc = get_fast_fir_nupc;
+    fast_fir_api.fir_filter = fast_fir_filter;
+    fast_fir_api.fir_bloque = fast_fir_bloque;
+}
+
+int get_fast_fir(unsigned int ncoef, const float *pcoef, unsigned int bloque, RFFT_PLAN *plan,
+                 float *workspace, FAST_FIR_OBJECT *pfir)
+{
+    if (pcoef == NULL || workspace == NULL || pfir == NULL || ncoef == 0)
+    {
+        return FAST_FIR_KO;
+    }
+
+    pfir->ncoef = ncoef;
+
+    /* Filtros cortos: la forma directa es más rápida y no añade latencia */
+    if (ncoef <= FAST_FIR_UMBRAL)
+    {
+        pfir->modo = FAST_FIR_DIRECTO;
+        pfir->latencia = 0;
+        pfir->directo = fir_api.get_fir(ncoef, (float *)pcoef, workspace);
+        return FAST_FIR_OK;
+    }
+
+    if (get_etapa_fast_fir(pcoef, ncoef, bloque, plan, workspace, &pfir->etapas[0]) != FAST_FIR_OK)
+    {
+        return FAST_FIR_KO;
+    }
+
+    pfir->modo = FAST_FIR_OLS;
+    pfir->latencia = bloque;
+    pfir->netapas = 1;
+
+    return FAST_FIR_OK;
+}
+
+int get_fast_fir_nupc(unsigned int ncoef, const float *pcoef, unsigned int cabeza, unsigned int bloque_max,
+                      RFFT_PLAN *planes, float *workspace, FAST_FIR_OBJECT *pfir)
+{
+    unsigned int inicio, bloque, longitud, e;
+
+    if (pcoef == NULL || workspace == NULL || pfir == NULL || ncoef == 0)
+    {
+        return FAST_FIR_KO;
+    }
+
+    /* Cabeza y bloque máximo: potencias de 2 con cabeza <= bloque_max */
+    if (cabeza == 0 || cabeza > MAX_FIR_LENGTH || (cabeza & (cabeza - 1)) != 0 ||
+        bloque_max < cabeza || (bloque_max & (bloque_max - 1)) != 0)
+    {
+        return FAST_FIR_KO;
+    }
+
+    pfir->ncoef = ncoef;
+    pfir->latencia = 0;
+    pfir->netapas = 0;
+
+    /* Cabeza en forma directa */
+    pfir->directo = fir_api.get_fir(ncoef < cabeza ? ncoef : cabeza, (float *)pcoef, workspace);
+    workspace += cabeza;
+
+    if (ncoef <= cabeza)
+    {
+        pfir->modo = FAST_FIR_DIRECTO;
+        return FAST_FIR_OK;
+    }
+
+    if (planes == NULL)
+    {
+        return FAST_FIR_KO;
+    }
+
+    /* Etapa e: bloque B_0 2^e desde el coeficiente B_0 2^e; la última, de bloque_max, hasta el final */
+    inicio = cabeza;
+    bloque = cabeza;
+    for (e = 0; inicio < ncoef; e++)
+    {
+        if (e == FAST_FIR_MAX_ETAPAS)
+        {
+            return FAST_FIR_KO;
+        }
+
+        longitud = ncoef - inicio;
+        if (bloque < bloque_max && longitud > bloque)
+        {
+            longitud = bloque;
+        }
+
+        if (get_etapa_fast_fir(&pcoef[inicio], longitud, bloque, &planes[e], workspace,
+                               &pfir->etapas[e]) != FAST_FIR_OK)
+        {
+            return FAST_FIR_KO;
+        }
+
+        workspace += FAST_FIR_WORKSPACE(longitud, bloque);
+        inicio += longitud;
+        if (bloque < bloque_max)
+        {
+            bloque *= 2;
+        }
+    }
+
+    pfir->modo = FAST_FIR_NUPC;
+    pfir->netapas = e;
+
+    return FAST_FIR_OK;
+}
+
+float fast_fir_filter(float xin, FAST_FIR_OBJECT *pfir)
+{
+    unsigned int e;
+    float y;
+
+    if (pfir == NULL)
+    {
+        return 0.0f;
+    }
+
+    if (pfir->modo == FAST_FIR_OLS)
+    {
+        etapa_bloque_fast_fir(&xin, &y, 1, 0, &pfir->etapas[0]);
+        return y;
+    }
+
+    /* Forma directa, o cabeza directa más la salida de cada etapa en NUPC */
+    y = fir_api.fir_filter(xin, &pfir->directo);
+    if (pfir->modo == FAST_FIR_NUPC)
+    {
+        for (e = 0; e < pfir->netapas; e++)
+        {
+            etapa_bloque_fast_fir(&xin, &y, 1, 1, &pfir->etapas[e]);
+        }
+    }
+
+    return y;
+}
+
+int fast_fir_bloque(const float *x, float *y, unsigned int nmuestras, FAST_FIR_OBJECT *pfir)
+{
+    unsigned int i, e, tramo;
+    float copia[MAX_FIR_LENGTH];
+
+    if (pfir == NULL || ((x == NULL || y == NULL) && nmuestras > 0))
+    {
+        return FAST_FIR_KO;
+    }
+
+    if (pfir->modo == FAST_FIR_DIRECTO)
+    {
+        for (i = 0; i < nmuestras; i++)
+        {
+            y[i] = fir_api.fir_filter(x[i], &pfir->directo);
+        }
+        return FAST_FIR_OK;
+    }
+
+    if (pfir->modo == FAST_FIR_OLS)
+    {
+        etapa_bloque_fast_fir(x, y, nmuestras, 0, &pfir->etapas[0]);
+        return FAST_FIR_OK;
+    }
+
+    /* NUPC: tramos de la longitud de la cabeza, copiados para admitir x == y */
+    while (nmuestras > 0)
+    {
+        tramo = (nmuestras < pfir->directo.ncoef) ? nmuestras : pfir->directo.ncoef;
+        for (i = 0; i < tramo; i++)
+        {
+            copia[i] = x[i];
+            y[i] = fir_api.fir_filter(copia[i], &pfir->directo);
+        }
+
+        for (e = 0; e < pfir->netapas; e++)
+        {
+            etapa_bloque_fast_fir(copia, y, tramo, 1, &pfir->etapas[e]);
+        }
+
+        x += tramo;
+        y += tramo;
+        nmuestras -= tramo;
+    }
+
+    return FAST_FIR_OK;
+}
+
+static int get_etapa_fast_fir(const float *pcoef, unsigned int ncoef, unsigned int bloque, RFFT_PLAN *plan,
+                              float *workspace, FAST_FIR_ETAPA *petapa)
+{
+    unsigned int k, i, particiones;
+    float *segmento;
+
+    if (plan == NULL || bloque == 0 || plan->n != 2 * bloque)
+    {
+        return FAST_FIR_KO;
+    }
+
+    particiones = FAST_FIR_PARTICIONES(ncoef, bloque);
+
+    /* Reparto del workspace */
+    petapa->bloque = bloque;
+    petapa->particiones = particiones;
+    petapa->plan = plan;
+    petapa->H = (COMPLEJO *)workspace;
+    petapa->fdl = (COMPLEJO *)&workspace[2 * particiones * bloque];
+    petapa->entrada = &workspace[4 * particiones * bloque];
+    petapa->acumulador = (COMPLEJO *)&workspace[4 * particiones * bloque + 2 * bloque];
+    petapa->salida = &workspace[4 * particiones * bloque + 4 * bloque];
+
+    /* Espectros de las particiones completadas con B ceros */
+    for (k = 0; k < particiones; k++)
+    {
+        segmento = (float *)&petapa->H[k * bloque];
+        for (i = 0; i < 2 * bloque; i++)
+        {
+            segmento[i] = (i < bloque && k * bloque + i < ncoef) ? pcoef[k * bloque + i] : 0.0f;
+        }
+
+        if (fft_api.rfft(plan, segmento, &petapa->H[k * bloque]) != FFT_OK)
+        {
+            return FAST_FIR_KO;
+        }
+    }
+
+    /* Estado inicial nulo */
+    for (i = 0; i < 2 * particiones * bloque; i++)
+    {
+        workspace[2 * particiones * bloque + i] = 0.0f;
+    }
+    for (i = 0; i < 2 * bloque; i++)
+    {
+        petapa->entrada[i] = 0.0f;
+    }
+    for (i = 0; i < bloque; i++)
+    {
+        petapa->salida[i] = 0.0f;
+    }
+    petapa->p_fdl = 0;
+    petapa->cuenta = 0;
+
+    return FAST_FIR_OK;
+}
+
+static void etapa_bloque_fast_fir(const float *x, float *y, unsigned int nmuestras, int sumar,
+                                  FAST_FIR_ETAPA *petapa)
+{
+    unsigned int i, tramo, B;
+    float *entrada, *salida;
+
+    B = petapa->bloque;
+
+    while (nmuestras > 0)
+    {
+        /* Tramo hasta completar el bloque en curso */
+        tramo = B - petapa->cuenta;
+        if (tramo > nmuestras)
+        {
+            tramo = nmuestras;
+        }
+
+        /* Entrada antes que salida: x e y pueden compartir memoria */
+        entrada = &petapa->entrada[B + petapa->cuenta];
+        salida = &petapa->salida[petapa->cuenta];
+        if (sumar)
+        {
+            for (i = 0; i < tramo; i++)
+            {
+                entrada[i] = x[i];
+                y[i] += salida[i];
+            }
+        }
+        else
+        {
+            for (i = 0; i < tramo; i++)
+            {
+                entrada[i] = x[i];
+                y[i] = salida[i];
+            }
+        }
+
+        petapa->cuenta += tramo;
+        x += tramo;
+        y += tramo;
+        nmuestras -= tramo;
+
+        if (petapa->cuenta == B)
+        {
+            procesar_etapa_fast_fir(petapa);
+            petapa->cuenta = 0;
+        }
+    }
+}
+
+static void procesar_etapa_fast_fir(FAST_FIR_ETAPA *petapa)
+{
+    unsigned int i, k, b, B, K, p;
+    const COMPLEJO *H, *X;
+    COMPLEJO *acc;
+    float *tiempo;
+
+    B = petapa->bloque;
+    K = petapa->particiones;
+
+    /* Espectro de la ventana [bloque anterior | bloque actual] en la posición más reciente */
+    petapa->p_fdl = (petapa->p_fdl + 1 == K) ? 0 : petapa->p_fdl + 1;
+    fft_api.rfft(petapa->plan, petapa->entrada, &petapa->fdl[petapa->p_fdl * B]);
+
+    /* Y = sum_k H_k X_{j-k}, recorriendo la línea de retardo desde el espectro más reciente */
+    acc = petapa->acumulador;
+    for (b = 0; b < B; b++)
+    {
+        acc[b].re = 0.0f;
+        acc[b].im = 0.0f;
+    }
+
+    p = petapa->p_fdl;
+    for (k = 0; k < K; k++)
+    {
+        H = &petapa->H[k * B];
+        X = &petapa->fdl[p * B];
+
+        /* DC y Nyquist empaquetados: productos reales independientes */
+        acc[0].re += H[0].re * X[0].re;
+        acc[0].im += H[0].im * X[0].im;
+
+        for (b = 1; b < B; b++)
+        {
+            acc[b].re += H[b].re * X[b].re - H[b].im * X[b].im;
+            acc[b].im += H[b].re * X[b].im + H[b].im * X[b].re;
+        }
+
+        p = (p == 0) ? K - 1 : p - 1;
+    }
+
+    /* Transformada inversa in-place: las últimas B muestras son la salida lineal */
+    tiempo = (float *)acc;
+    fft_api.irfft(petapa->plan, acc, tiempo);
+    for (i = 0; i < B; i++)
+    {
+        petapa->salida[i] = tiempo[B + i];
+        petapa->entrada[i] = petapa->entrada[B + i];
+    }
+}
@@ -97,7 +97,8 @@
  * \subsection init_fir_func Init_Fir
  * Inicializa la estructura de punteros a funciones fir_api (Public Service Endpoints).
  * Esta función debe ser llamada antes de usar cualquier servicio del módulo.
- * Asigna los punteros a las funciones Get_Fir y fir_filter.
+ * Asigna los punteros a las funciones Get_Fir y fir_filter, a sus variantes double, mixta y Q15, y a
+ * cuantiza_q15.
  *
  * \subsection get_fir_func Get_Fir
  * Crea e inicializa un servicio de filtrado FIR.
@@ -182,6 +183,34 @@
  * - **pcoef**: Puntero al buffer FLOAT32 con los coeficientes del filtro
  * - **pz**: Puntero al buffer circular de retrasos Z del filtro
  *
+ * \section precision_fir Variantes de precisión
+ *
+ * Los tres filtros se generan desde la misma plantilla, fir_filter_tipo.h, que nsdsp incluye una vez por
+ * precisión con el tipo de las muestras y el del acumulador como macros:
+ * - fir_filter: muestras, coeficientes y acumulación en float. Es el camino rápido y su código es el de
+ *   versiones anteriores
+ * - fir_filter_d: objeto FIR_FILTER_OBJECT_D (creado con get_fir_d) con todo en double
+ * - fir_filter_m: el mismo FIR_FILTER_OBJECT de get_fir, con la suma de productos en double y un único
+ *   redondeo a float de la salida. Conviene en filtros largos o con coeficientes de signo alterno, donde la
+ *   suma float pierde las cifras que se cancelan
+ *
+ * Un objeto float puede pasar en cualquier momento de fir_filter a fir_filter_m, ya que comparten buffer Z.
+ *
+ * \section q15_fir Filtro en coma fija Q15
+ *
+ * Para validar en Linux la misma cadena que se ejecuta en destinos sin coma flotante, FIR_FILTER_OBJECT_Q15
+ * filtra muestras Q15 (int16_t, valor/32768) con coeficientes Q15:
+ * - cuantiza_q15 convierte coeficientes o muestras float a Q15 con redondeo al más cercano y saturación
+ *   simétrica a [-Q15_MAX, Q15_MAX], y devuelve cuántos valores saturó
+ * - get_fir_q15 necesita una línea de retardo de FIR_Q15_RETARDO(ncoef) muestras: cada muestra se escribe
+ *   dos veces para que la ventana x(n)..x(n-N+1) sea siempre contigua
+ * - fir_filter_q15 acumula los productos Q30 de forma exacta (parejas en 32 bits, pmaddwd con SSE2, y
+ *   suma en 64 bits), satura el resultado a Q31 y lo redondea a Q15. La salida es la misma bit a bit
+ *   con y sin SSE2 y en cualquier destino con aritmética entera de 64 bits
+ *
+ * Los coeficientes deben estar en [-Q15_MAX, Q15_MAX] (así los deja cuantiza_q15): con -32768 la suma de
+ * una pareja de productos podría desbordar 32 bits.
+ *
  * \section excepciones_fir Manejo de Excepciones
  *
  * Cualquier excepción en la ejecución de la operación de filtrado resultará en una salida y=0.
@@ -196,17 +225,30 @@
  * |:-----:|:-----:|:-------:|:------------|
  * | 18/08/2025 | Dr. Carlos Romero | 1 | Primera edición |
  * | 28/08/2025 | Dr. Carlos Romero | 2 | Documentación Doxygen completa con Graphviz |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Variantes en doble precisión y mixta generadas desde fir_filter_tipo.h |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Filtro en coma fija Q15 con acumulación exacta, saturación Q31 y núcleo SSE2 |
  *
  * \copyright  ZGR R&D AIE
  */
 
  #include "fir_filter.h"
  #include <stdio.h>
+ #include <math.h>
+ #if defined(__SSE2__)
+ #include <emmintrin.h>
+ #endif
 
  /* Declaración de funciones */
  void Init_Fir(void);
  FIR_FILTER_OBJECT Get_Fir(unsigned int, float *, float *);
  float fir_filter (float, FIR_FILTER_OBJECT *);
+ FIR_FILTER_OBJECT_D Get_Fir_D(unsigned int, double *, double *);
+ double fir_filter_d (double, FIR_FILTER_OBJECT_D *);
+ float fir_filter_m (float, FIR_FILTER_OBJECT *);
+ FIR_FILTER_OBJECT_Q15 Get_Fir_Q15(unsigned int, int16_t *, int16_t *);
+ int16_t fir_filter_q15 (int16_t, FIR_FILTER_OBJECT_Q15 *);
+ unsigned int cuantiza_q15 (const float *, unsigned int, int16_t *);
+ static int64_t producto_q15 (const int16_t *, const int16_t *, unsigned int);
 
  /* Definición de Variables globales */
  FIR_FILTER_API fir_api;
@@ -217,70 +259,178 @@
  {
      fir_api.fir_filter=fir_filter;
      fir_api.get_fir=Get_Fir;
+     fir_api.get_fir_d=Get_Fir_D;
+     fir_api.fir_filter_d=fir_filter_d;
+     fir_api.fir_filter_m=fir_filter_m;
+     fir_api.get_fir_q15=Get_Fir_Q15;
+     fir_api.fir_filter_q15=fir_filter_q15;
+     fir_api.cuantiza_q15=cuantiza_q15;
  }
 
- FIR_FILTER_OBJECT Get_Fir(unsigned int ncoef, float * pcoef, float * pz)
+ /* Precisión simple: el camino rápido, idéntico al de versiones anteriores */
+ #define FIR_TIPO        float
+ #define FIR_ACUMULADOR  float
+ #define FIR_OBJETO      FIR_FILTER_OBJECT
+ #define FIR_GET         Get_Fir
+ #define FIR_FILTRO      fir_filter
+ #include "fir_filter_tipo.h"
+
+ /* Doble precisión */
+ #define FIR_TIPO        double
+ #define FIR_ACUMULADOR  double
+ #define FIR_OBJETO      FIR_FILTER_OBJECT_D
+ #define FIR_GET         Get_Fir_D
+ #define FIR_FILTRO      fir_filter_d
+ #include "fir_filter_tipo.h"
+
+ /* Precisión mixta: objetos float (creados con Get_Fir) y acumulación double */
+ #define FIR_TIPO        float
+ #define FIR_ACUMULADOR  double
+ #define FIR_OBJETO      FIR_FILTER_OBJECT
+ #define FIR_FILTRO      fir_filter_m
+ #include "fir_filter_tipo.h"
+
+ /* Coma fija Q15 */
+ FIR_FILTER_OBJECT_Q15 Get_Fir_Q15(unsigned int ncoef, int16_t * pcoef, int16_t * pz)
  {
-     FIR_FILTER_OBJECT objeto;
+     FIR_FILTER_OBJECT_Q15 objeto;
      unsigned int index;
-     float * pw;
 
-     pw=pz;
-     if (pw!=NULL)
+     if (pz!=NULL)
      {
-         for (index=0;index<ncoef;index++)
-            *(pw++)=0;
+         for (index=0;index<FIR_Q15_RETARDO(ncoef);index++)
+            pz[index]=0;
      }
      objeto.ncoef=ncoef;
+     objeto.index_w=0;
      objeto.pcoef=pcoef;
      objeto.pz=pz;
-     objeto.p_write=pz;
      return objeto;
  }
 
- float fir_filter(float xn, FIR_FILTER_OBJECT * pfir)
+ int16_t fir_filter_q15(int16_t xn, FIR_FILTER_OBJECT_Q15 * pfir)
  {
-     unsigned int index, N;
-     float * pmax;
-     float * pmin;
-     float * pinit;
-     float y;
-     float * pcoef_temp;
+     unsigned int N;
+     const int16_t * pcoef;
+     const int16_t * pventana;
+     int64_t y;
+     int32_t q31;
 
-     if (pfir==NULL)
+     if (pfir==NULL || pfir->pcoef==NULL || pfir->pz==NULL)
      {
-         return 0.0f;
+         return 0;
      }
 
-     y=0.0f;
      N=pfir->ncoef;
-     if (N>MAX_FIR_LENGTH)
+     if (N==0 || N>MAX_FIR_LENGTH)
      {
-         return 0.0f;
+         return 0;
      }
 
-     pmin=pfir->pz;
-     pmax=(pfir->pz)+(pfir->ncoef);
-     pinit=pfir->p_write;
-     *(pfir->p_write++)=xn;
+     /* La muestra se escribe en index_w y en index_w+N, y index_w retrocede: pventana[k] es x(n-k)
+        para k=0..N-1 sin vuelta al inicio del buffer */
+     pfir->index_w=(pfir->index_w==0) ? N-1 : pfir->index_w-1;
+     pfir->pz[pfir->index_w]=xn;
+     pfir->pz[pfir->index_w+N]=xn;
+     pventana=&pfir->pz[pfir->index_w];
+     pcoef=pfir->pcoef;
 
-     if (pfir->p_write==pmax)
+     y=producto_q15(pcoef, pventana, N);
+
+     /* Q30 -> Q31 con saturación, y Q31 -> Q15 con redondeo */
+     if (y>(INT32_MAX>>1))
      {
-         pfir->p_write=pfir->pz;
+         q31=INT32_MAX;
      }
+     else if (y<(INT32_MIN>>1))
+     {
+         q31=INT32_MIN;
+     }
+     else
+     {
+         q31=(int32_t)(y*2);
+     }
+     if (q31>=INT32_MAX-0x7FFF)
+     {
+         return Q15_MAX;
+     }
+     return (int16_t)((q31+0x8000)>>16);
+ }
 
+ unsigned int cuantiza_q15(const float * pvalor, unsigned int n, int16_t * pq15)
+ {
+     unsigned int index, saturados;
+     long redondeado;
 
-    pcoef_temp=pfir->pcoef;
-
-     for (index=0;index<N;index++)
+     saturados=0;
+     if (pvalor==NULL || pq15==NULL)
      {
-         y+=(*(pcoef_temp++))*(*(pinit--));
+         return 0;
+     }
 
-         if (pinit<pmin)
+     for (index=0;index<n;index++)
+     {
+         /* Redondeo al más cercano y saturación simétrica: -1.0 se representa como -Q15_MAX */
+         if (!(fabsf(pvalor[index])<2.0f))
          {
-             pinit=pmax;
-             pinit--;
+             redondeado=(pvalor[index]>0.0f) ? Q15_MAX+1 : -Q15_MAX-1;
          }
+         else
+         {
+             redondeado=lrintf(pvalor[index]*32768.0f);
+         }
+         if (redondeado>Q15_MAX)
+         {
+             pq15[index]=Q15_MAX;
+             saturados++;
+         }
+         else if (redondeado<-Q15_MAX)
+         {
+             pq15[index]=-Q15_MAX;
+             saturados++;
+         }
+         else
+         {
+             pq15[index]=(int16_t)redondeado;
+         }
+     }
+     return saturados;
+ }
+
+ /* Producto escalar Q15 x Q15 exacto en Q30. Los productos se suman por parejas en 32 bits (pmaddwd en
+    SSE2) y las parejas se acumulan en 64 bits. Con coeficientes en [-Q15_MAX, Q15_MAX] una pareja no
+    desborda, por lo que el resultado es el mismo con y sin SSE2 y en cualquier orden */
+ static int64_t producto_q15(const int16_t * pcoef, const int16_t * px, unsigned int n)
+ {
+     unsigned int index;
+     int64_t y;
+ #if defined(__SSE2__)
+     __m128i suma, parejas, signo;
+     int64_t parcial[2];
+
+     suma=_mm_setzero_si128();
+     for (index=0;index+8<=n;index+=8)
+     {
+         parejas=_mm_madd_epi16(_mm_loadu_si128((const __m128i *)&pcoef[index]),
+                                _mm_loadu_si128((const __m128i *)&px[index]));
+         signo=_mm_srai_epi32(parejas,31);
+         suma=_mm_add_epi64(suma,_mm_unpacklo_epi32(parejas,signo));
+         suma=_mm_add_epi64(suma,_mm_unpackhi_epi32(parejas,signo));
+     }
+     _mm_storeu_si128((__m128i *)parcial,suma);
+     y=parcial[0]+parcial[1];
+ #else
+     index=0;
+     y=0;
+ #endif
+
+     for (;index+1<n;index+=2)
+     {
+         y+=(int32_t)pcoef[index]*px[index]+(int32_t)pcoef[index+1]*px[index+1];
+     }
+     if (index<n)
+     {
+         y+=(int32_t)pcoef[index]*px[index];
      }
      return y;
  }
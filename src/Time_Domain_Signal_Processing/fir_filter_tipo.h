@@ -0,0 +1,85 @@
+/* Plantilla de las funciones de fir_filter.c, genérica en el tipo de las muestras.
+ *
+ * fir_filter.c la incluye una vez por precisión después de definir:
+ * - FIR_TIPO: tipo de las muestras, coeficientes y retardos (float o double)
+ * - FIR_ACUMULADOR: tipo del acumulador de la convolución (double en la precisión mixta)
+ * - FIR_OBJETO: objeto filtro con punteros a FIR_TIPO
+ * - FIR_GET: nombre de la función de creación (sin definir si se reutiliza la de otra precisión)
+ * - FIR_FILTRO: nombre de la función de filtrado
+ *
+ * Los macros se anulan al final, por lo que no lleva guarda de inclusión.
+ */
+
+#ifdef FIR_GET
+ FIR_OBJETO FIR_GET(unsigned int ncoef, FIR_TIPO * pcoef, FIR_TIPO * pz)
+ {
+     FIR_OBJETO objeto;
+     unsigned int index;
+     FIR_TIPO * pw;
+
+     pw=pz;
+     if (pw!=NULL)
+     {
+         for (index=0;index<ncoef;index++)
+            *(pw++)=0;
+     }
+     objeto.ncoef=ncoef;
+     objeto.pcoef=pcoef;
+     objeto.pz=pz;
+     objeto.p_write=pz;
+     return objeto;
+ }
+#endif
+
+ FIR_TIPO FIR_FILTRO(FIR_TIPO xn, FIR_OBJETO * pfir)
+ {
+     unsigned int index, N;
+     FIR_TIPO * pmax;
+     FIR_TIPO * pmin;
+     FIR_TIPO * pinit;
+     FIR_ACUMULADOR y;
+     FIR_TIPO * pcoef_temp;
+
+     if (pfir==NULL)
+     {
+         return (FIR_TIPO)0;
+     }
+
+     y=(FIR_ACUMULADOR)0;
+     N=pfir->ncoef;
+     if (N>MAX_FIR_LENGTH)
+     {
+         return (FIR_TIPO)0;
+     }
+
+     pmin=pfir->pz;
+     pmax=(pfir->pz)+(pfir->ncoef);
+     pinit=pfir->p_write;
+     *(pfir->p_write++)=xn;
+
+     if (pfir->p_write==pmax)
+     {
+         pfir->p_write=pfir->pz;
+     }
+
+
+    pcoef_temp=pfir->pcoef;
+
+     for (index=0;index<N;index++)
+     {
+         y+=(FIR_ACUMULADOR)(*(pcoef_temp++))*(*(pinit--));
+
+         if (pinit<pmin)
+         {
+             pinit=pmax;
+             pinit--;
+         }
+     }
+     return (FIR_TIPO)y;
+ }
+
+#undef FIR_TIPO
+#undef FIR_ACUMULADOR
+#undef FIR_OBJETO
+#undef FIR_GET
+#undef FIR_FILTRO
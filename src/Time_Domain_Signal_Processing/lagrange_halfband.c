@@ -16,6 +16,15 @@
  * h_m(2n-1) = \frac{(-1)^{n+m-1}}{(m-n)!(m-1+n)!(2n-1)} \cdot \prod_{k=1}^{2m}(m-k+\frac{1}{2})
  * \f]
  *
+ * Los factoriales y el productorio desbordan para m moderado, por lo que los coeficientes se calculan
+ * con la forma equivalente \f$h_m(2n-1) = (-1)^{n-1} c_n / (2n-1)\f$, con
+ * \f[
+ * c_1 = m \prod_{k=1}^{m} \left(\frac{2k-1}{2k}\right)^2, \qquad c_{n+1} = c_n \frac{m-n}{m+n}
+ * \f]
+ * en doble precisión. Todos los factores están acotados, por lo que el error relativo de cada
+ * coeficiente es de unos pocos ulp de double para cualquier m (verificado frente a los valores
+ * racionales exactos hasta m = 128).
+ *
  * El orden del filtro resultante es 4m-2, con 4m-1 coeficientes totales.
  *
  * \section uso_lagrange Uso del módulo
@@ -56,8 +65,8 @@
  *   VALIDATE [label="Validar m >= 1", shape=diamond, fillcolor=lightyellow];
  *   INIT [label="Inicializar array\nh0[2m] = 0.5", fillcolor=lightblue];
  *   LOOP [label="Para l=1 hasta m", shape=diamond, fillcolor=lightcyan];
- *   PRODUCT [label="Calcular productorio\nΠ(m-k+0.5)", fillcolor=lightpink];
- *   COEFF [label="Calcular hm usando\nfórmula de Lagrange", fillcolor=lightpink];
+ *   PRODUCT [label="Calcular c1 =\nm Π((2k-1)/2k)²", fillcolor=lightpink];
+ *   COEFF [label="hm = ±c_l/(2l-1)\nc_(l+1) = c_l (m-l)/(m+l)", fillcolor=lightpink];
  *   ASSIGN [label="h0[2m±(2l-1)] = hm", fillcolor=lightgreen];
  *   NEXT [label="l++", fillcolor=lightcyan];
  *   RETURN_OK [label="return LAGRANGE_OK", fillcolor=lightgreen];
@@ -66,10 +75,9 @@
  *   START -> VALIDATE;
  *   VALIDATE -> INIT [label="m >= 1"];
  *   VALIDATE -> RETURN_ERROR [label="m < 1"];
- *   INIT -> LOOP;
- *   LOOP -> PRODUCT [label="l <= m"];
+ *   INIT -> PRODUCT -> LOOP;
+ *   LOOP -> COEFF [label="l <= m"];
  *   LOOP -> RETURN_OK [label="l > m"];
- *   PRODUCT -> COEFF;
  *   COEFF -> ASSIGN;
  *   ASSIGN -> NEXT;
  *   NEXT -> LOOP;
@@ -112,21 +120,27 @@
  * La funciÃ³n implementa el algoritmo:
  * 1. Inicializa todos los coeficientes a cero
  * 2. Establece el coeficiente central h0[2m] = 0.5
- * 3. Para cada l de 1 a m:
- *    - Calcula el productorio \f$\prod_{k=1}^{2m}(m-k+\frac{1}{2})\f$
- *    - Calcula el coeficiente usando la fórmula de Lagrange
+ * 3. Calcula \f$c_1\f$ en doble precisión
+ * 4. Para cada l de 1 a m:
+ *    - Calcula el coeficiente \f$h_m = (-1)^{l-1} c_l / (2l-1)\f$ y lo redondea a float
  *    - Asigna simétricamente: h0[2m+(2l-1)] = h0[2m-(2l-1)] = hm
+ *    - Actualiza \f$c_{l+1} = c_l (m-l)/(m+l)\f$
+ *
+ * El resultado coincide con la fórmula de Lagrange, que ya no se evalúa con factoriales en
+ * unsigned long: estos desbordaban a partir de m = 11 y limitaban LAGRANGE_M en dwt.h.
  *
  * \param m Parámetro del filtro (entero positivo >= 1)
  * \param h0 Array de salida para los coeficientes (debe tener tamaño 4m-1)
  * \return LAGRANGE_OK si éxito, LAGRANGE_KO si error en parámetros
  *
- * \subsection factorial_func factorial
- * Calcula el factorial de un número entero no negativo.
- * Implementación iterativa para evitar recursión y mejorar eficiencia.
+ * \subsection lagrange_halfband_d_func lagrange_halfband_d
+ * Igual que lagrange_halfband con coeficientes double, para diseñar filtros largos (m de decenas o
+ * centenas) sin el redondeo a float. Los coeficientes extremos de m grandes son menores que el mínimo
+ * normal de float (unos 1e-40 con m = 64), y solo se representan con precisión completa en double.
  *
- * \param n Número entero no negativo
- * \return n! (factorial de n)
+ * \param m Parámetro del filtro (entero positivo >= 1)
+ * \param h0 Array de salida double de tamaño 4m-1
+ * \return LAGRANGE_OK si éxito, LAGRANGE_KO si error en parámetros
  *
  * \author Dr. Carlos Romero
  *
@@ -134,6 +148,7 @@
  * | Fecha | Autor | Versión | Descripción |
  * |:-----:|:-----:|:-------:|:------------|
  * | 04/08/2025 | Dr. Carlos Romero | 1 | Implementación inicial desde Matlab |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Recurrencia en doble precisión sin factoriales y versión double para m grandes |
  *
  * \copyright ZGR R&D AIE
  */
@@ -143,7 +158,8 @@
 
 /* Declaración de funciones */
 int lagrange_halfband(int m, float *h0);
-unsigned long factorial(int n);
+int lagrange_halfband_d(int m, double *h0);
+static double lagrange_c1(int m);
 
 /* Definición de funciones */
 
@@ -151,13 +167,9 @@ int lagrange_halfband(int m, float *h0)
 {
     int orden;
     int l, k;
-    float productorio;
+    double c;
     float hm;
-    unsigned long fact_m_minus_l;
-    unsigned long fact_m_plus_l_minus_1;
-    int sign;
     int center_index;
-    int pos_index, neg_index;
 
     /* Validar parámetros de entrada */
     if (m < 1 || h0 == NULL)
@@ -177,59 +189,66 @@ int lagrange_halfband(int m, float *h0)
     /* Establecer coeficiente central */
     h0[center_index] = 0.5f;
 
-    /* Calcular coeficientes simétricos */
+    /* Coeficientes simétricos: recurrencia en double y un único redondeo a float por coeficiente */
+    c = lagrange_c1(m);
     for (l = 1; l <= m; l++)
     {
-        /* Calcular productorio Π(m-k+1/2) para k=1 hasta 2m */
-        productorio = 1.0f;
-        for (k = 1; k <= 2 * m; k++)
-        {
-            productorio *= (float)(m - k) + 0.5f;
-        }
-
-        /* Calcular factoriales */
-        fact_m_minus_l = factorial(m - l);
-        fact_m_plus_l_minus_1 = factorial(m - 1 + l);
-
-        /* Calcular signo (-1)^(l+m-1) */
-        sign = ((l + m - 1) % 2 == 0) ? 1 : -1;
-
-        /* Calcular coeficiente hm */
-        hm = (float)sign * productorio / 
-             ((float)fact_m_minus_l * (float)fact_m_plus_l_minus_1 * (float)(2 * l - 1));
-
-        /* Asignar simétricamente */
-        pos_index = center_index + (2 * l - 1);
-        neg_index = center_index - (2 * l - 1);
-
-        if (pos_index < orden)
-        {
-            h0[pos_index] = hm;
-        }
-        if (neg_index >= 0)
-        {
-            h0[neg_index] = hm;
-        }
+        hm = (float)(((l & 1) ? c : -c) / (double)(2 * l - 1));
+        h0[center_index + (2 * l - 1)] = hm;
+        h0[center_index - (2 * l - 1)] = hm;
+        c *= (double)(m - l) / (double)(m + l);
     }
 
     return LAGRANGE_OK;
 }
 
-unsigned long factorial(int n)
+int lagrange_halfband_d(int m, double *h0)
 {
-    unsigned long result;
-    int i;
+    int orden;
+    int l, k;
+    double c;
+    double hm;
+    int center_index;
 
-    if (n < 0)
+    /* Validar parámetros de entrada */
+    if (m < 1 || h0 == NULL)
     {
-        return 0;  /* Factorial no definido para negativos */
+        return LAGRANGE_KO;
     }
 
-    result = 1;
-    for (i = 2; i <= n; i++)
+    orden = 4 * m - 1;
+    center_index = 2 * m - 1;
+
+    for (k = 0; k < orden; k++)
     {
-        result *= (unsigned long)i;
+        h0[k] = 0.0;
     }
+    h0[center_index] = 0.5;
 
-    return result;
-}
\ No newline at end of file
+    c = lagrange_c1(m);
+    for (l = 1; l <= m; l++)
+    {
+        hm = ((l & 1) ? c : -c) / (double)(2 * l - 1);
+        h0[center_index + (2 * l - 1)] = hm;
+        h0[center_index - (2 * l - 1)] = hm;
+        c *= (double)(m - l) / (double)(m + l);
+    }
+
+    return LAGRANGE_OK;
+}
+
+/* c_1 = m * prod_{k=1}^{m} ((2k-1)/(2k))^2: cada factor está en [1/4, 1), por lo que el producto no
+   desborda ni pierde precisión para ningún m */
+static double lagrange_c1(int m)
+{
+    int k;
+    double c, factor;
+
+    c = (double)m;
+    for (k = 1; k <= m; k++)
+    {
+        factor = (double)(2 * k - 1) / (double)(2 * k);
+        c *= factor * factor;
+    }
+    return c;
+}
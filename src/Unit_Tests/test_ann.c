@@ -36,6 +36,7 @@
  * - Verificación de dimensiones
  * - Manejo de errores con punteros NULL
  * - Validación de buffers de entrada/salida
+ * - Capas DENSE preparadas: misma salida y coste por inferencia frente a la validación por capa
  *
  * \subsection test_trigger_ann Test_Trigger_ANN
  * Verifica las funciones de activación:
@@ -43,6 +44,48 @@
  * - Manejo de vectores de diferentes tamaños
  * - Validación de parámetros
  *
+ * \subsection test_quantized_ann Test_Quantized_ANN
+ * Verifica la inferencia cuantizada int8:
+ * - Cuantización de una red 16-32-16-4 con escala por neurona
+ * - Informe de precisión (error máximo y SNR) frente a la red en float
+ * - Detección de buffers NULL y dimensiones incompatibles entre capas
+ *
+ * \subsection test_model_ann Test_Model_ANN
+ * Verifica el formato binario de modelo:
+ * - Serialización con build_model y consulta de tamaño
+ * - Escritura a fichero, lectura y carga sin copia con load_model
+ * - Igualdad de resultados con la red construida mediante get_ann
+ * - Detección de modelos truncados, magic incorrecto y punteros desalineados
+ *
+ * \subsection test_train_ann Test_Train_ANN
+ * Verifica el entrenamiento en línea:
+ * - Gradiente analítico frente a diferencias finitas centradas
+ * - Convergencia en el problema XOR con SGD, MOMENTUM y ADAM
+ * - Coste por paso en modo en línea (lote de 1 muestra)
+ * - Detección de workspace insuficiente y mini-lotes inválidos
+ *
+ * \subsection test_conv1d_ann Test_Conv1D_ANN
+ * Verifica las capas convolucionales y de pooling:
+ * - CONV1D de un canal con resultado conocido (diferencia de primer orden)
+ * - Red CONV1D (con stride y dilatación) + MAXPOOL1D + DENSE frente a una referencia directa
+ * - Convolución en streaming frente a la ejecución por bloque
+ * - CONV1D con stride 1 y 38 salidas (grupos de ANN_CARRILES y resto) frente a la suma directa
+ * - Detección de configuraciones y encadenamientos inválidos
+ *
+ * \subsection test_recurrent_ann Test_Recurrent_ANN
+ * Verifica las capas recurrentes GRU y LSTM:
+ * - Red GRU + DENSE frente a una referencia directa durante varios pasos temporales
+ * - Persistencia del estado entre llamadas y reinicio con rnn_reset
+ * - Paso LSTM frente a una referencia directa
+ * - Modo multi-stream frente a capas independientes de un canal y coste por paso
+ * - Detección de dimensiones inválidas
+ *
+ * \subsection test_sparse_ann Test_Sparse_ANN
+ * Verifica las capas SPARSE con pesos podados en CSR:
+ * - Red SPARSE (bloques de 1 y 1x4) frente a la red DENSE con los mismos pesos podados
+ * - Re-poda de la capa con otro umbral desde los pesos densos conservados
+ * - Detección de capacidad insuficiente, parámetros inválidos y capas SPARSE sin pesos dispersos
+ *
  * \author Dr. Carlos Romero
  *
  * \section historial_test_ann Historial de cambios
@@ -51,6 +94,14 @@
  * | 15/09/2025 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
  * | 15/09/2025 | Dr. Carlos Romero | 2 | Añadidos tests para iterate_ann y trigger_ann |
  * | 16/09/2025 | Dr. Carlos Romero | 3 | Actualizado para usar API en trigger_ann |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Añadido test de inferencia cuantizada int8 |
+ * | 16/10/2026 | Dr. Carlos Romero | 5 | Añadido test del formato binario de modelo |
+ * | 16/10/2026 | Dr. Carlos Romero | 6 | Añadido test de entrenamiento en línea |
+ * | 16/10/2026 | Dr. Carlos Romero | 7 | Añadido test de capas CONV1D y pooling |
+ * | 16/10/2026 | Dr. Carlos Romero | 8 | Añadido test de capas recurrentes GRU y LSTM |
+ * | 16/10/2026 | Dr. Carlos Romero | 9 | Añadido test de capas SPARSE podadas |
+ * | 16/10/2026 | Dr. Carlos Romero | 10 | Añadido test de capas preparadas en Test_Iterate_ANN |
+ * | 16/10/2026 | Dr. Carlos Romero | 11 | Añadido test de CONV1D con stride 1 por grupos de carriles |
  *
  * \copyright ZGR R&D AIE
  */
@@ -62,6 +113,7 @@
 #include <math.h>
 #include <time.h>
 #include <stdarg.h>
+#include <string.h>
 #include "ann.h"
 #include "nsdsp_math.h"
 #include "test_ann.h"
@@ -77,11 +129,21 @@ static FILE *ann_test_log_file = NULL;
 int Test_Get_ANN(void);
 int Test_Iterate_ANN(void);
 int Test_Trigger_ANN(void);
+int Test_Quantized_ANN(void);
+int Test_Model_ANN(void);
+int Test_Train_ANN(void);
+int Test_Conv1D_ANN(void);
+int Test_Recurrent_ANN(void);
+int Test_Sparse_ANN(void);
 int Run_All_ANN_Tests(void);
 
 /* Funciones auxiliares */
 void test_ann_printf(const char *format, ...);
 int float_equals_ann(float a, float b, float epsilon);
+float random_uniform_ann(float amplitud);
+float loss_ann(ANN_SERVICE *service, const float *x, const float *d, unsigned int n);
+void rnn_referencia_ann(ANN_LAYER_TYPE tipo, const float *w, const float *u, const float *b,
+                        unsigned int entradas, unsigned int ocultas, const float *x, float *h, float *c);
 
 /* Definición de funciones */
 
@@ -109,6 +171,103 @@ int float_equals_ann(float a, float b, float epsilon)
     return fabs(a - b) < epsilon;
 }
 
+float random_uniform_ann(float amplitud)
+{
+    /* Valor aleatorio uniforme en [-amplitud, amplitud] */
+    return amplitud * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+}
+
+float loss_ann(ANN_SERVICE *service, const float *x, const float *d, unsigned int n)
+{
+    /* Pérdida cuadrática media 1/(2n) * suma ||y - d||^2 calculada con iterate */
+    unsigned int k, i, entradas, salidas;
+    double acumulado;
+    float salida[16];
+    float error;
+
+    entradas = service->x0.filas;
+    salidas = service->y0.filas;
+    service->y0.pmatriz = salida;
+    acumulado = 0.0;
+
+    for (k = 0; k < n; k++)
+    {
+        service->x0.pmatriz = (float *)&x[k * entradas];
+        ann_api.iterate(service);
+        for (i = 0; i < salidas; i++)
+        {
+            error = salida[i] - d[k * salidas + i];
+            acumulado += 0.5 * (double)error * (double)error;
+        }
+    }
+
+    return (float)(acumulado / (double)n);
+}
+
+void rnn_referencia_ann(ANN_LAYER_TYPE tipo, const float *w, const float *u, const float *b,
+                        unsigned int entradas, unsigned int ocultas, const float *x, float *h, float *c)
+{
+    /* Paso GRU/LSTM de un canal calculado puerta a puerta, sin fusionar productos */
+    unsigned int g, j, k, puertas;
+    float a[4 * 16];
+    float r;
+
+    puertas = (tipo == LSTM) ? 4 : 3;
+
+    for (g = 0; g < puertas; g++)
+    {
+        for (j = 0; j < ocultas; j++)
+        {
+            a[g * ocultas + j] = b[g * ocultas + j];
+            for (k = 0; k < entradas; k++)
+            {
+                a[g * ocultas + j] += w[(g * ocultas + j) * entradas + k] * x[k];
+            }
+        }
+    }
+
+    if (tipo == GRU)
+    {
+        for (j = 0; j < ocultas; j++)
+        {
+            float uz = 0.0f, ur = 0.0f, un = 0.0f, z, n;
+            for (k = 0; k < ocultas; k++)
+            {
+                uz += u[j * ocultas + k] * h[k];
+                ur += u[(ocultas + j) * ocultas + k] * h[k];
+                un += u[(2 * ocultas + j) * ocultas + k] * h[k];
+            }
+            z = 1.0f / (1.0f + expf(-(a[j] + uz)));
+            r = 1.0f / (1.0f + expf(-(a[ocultas + j] + ur)));
+            n = tanhf(a[2 * ocultas + j] + r * un);
+            a[j] = z;
+            a[ocultas + j] = n;
+        }
+        for (j = 0; j < ocultas; j++)
+        {
+            h[j] = (1.0f - a[j]) * a[ocultas + j] + a[j] * h[j];
+        }
+    }
+    else
+    {
+        for (g = 0; g < 4; g++)
+        {
+            for (j = 0; j < ocultas; j++)
+            {
+                for (k = 0; k < ocultas; k++)
+                {
+                    a[g * ocultas + j] += u[(g * ocultas + j) * ocultas + k] * h[k];
+                }
+            }
+        }
+        for (j = 0; j < ocultas; j++)
+        {
+            c[j] = c[j] / (1.0f + expf(-a[ocultas + j])) + tanhf(a[2 * ocultas + j]) / (1.0f + expf(-a[j]));
+            h[j] = tanhf(c[j]) / (1.0f + expf(-a[3 * ocultas + j]));
+        }
+    }
+}
+
 int Test_Get_ANN(void)
 {
     int result = TEST_OK;
@@ -272,6 +431,16 @@ int Test_Iterate_ANN(void)
     int result = TEST_OK;
     int ret;
     ANN_SERVICE service;
+    ANN_SERVICE sin_preparar;
+    unsigned int i, l, n;
+    clock_t inicio;
+    double ns[2];
+
+    /* Test 5: red 16-16-16-4 preparada frente a la validada en cada iteración */
+    static float w5[3][16 * 16], b5[3][16];
+    float x5[16], y5[4], y5_ref[4];
+    MATRIZ pesos5[3];
+    MATRIZ bias5[3];
 
     /* Datos para test: Red simple de 1 capa */
     /* 2 entradas, 2 salidas - matriz identidad para test simple */
@@ -422,6 +591,80 @@ int Test_Iterate_ANN(void)
         test_ann_printf("Detección de x0 no configurado: PASSED\n");
     }
 
+    /* Test 5: capas preparadas al construir el servicio */
+    test_ann_printf("\nTest 5: Capas DENSE preparadas frente a la validación por iteración\n");
+
+    srand(47);
+    for (l = 0; l < 3; l++)
+    {
+        pesos5[l].filas = (l == 2) ? 4 : 16;
+        pesos5[l].columnas = 16;
+        pesos5[l].pmatriz = w5[l];
+        bias5[l].filas = pesos5[l].filas;
+        bias5[l].columnas = 1;
+        bias5[l].pmatriz = b5[l];
+        for (i = 0; i < 16 * 16; i++) w5[l][i] = random_uniform_ann(0.5f);
+        for (i = 0; i < 16; i++) b5[l][i] = random_uniform_ann(0.1f);
+    }
+    for (i = 0; i < 16; i++) x5[i] = random_uniform_ann(1.0f);
+
+    service = ann_api.get_ann(3, TANH, pesos5, bias5);
+    service.x0.pmatriz = x5;
+    service.y0.pmatriz = y5;
+    sin_preparar = service;
+    sin_preparar.y0.pmatriz = y5_ref;
+    for (l = 0; l < LMAX; l++)
+    {
+        sin_preparar.net.operacion[l].filas = 0;
+    }
+
+    if (service.net.operacion[0].filas != 16 || service.net.operacion[2].filas != 4 ||
+        ann_api.iterate(&service) != ANN_OK || ann_api.iterate(&sin_preparar) != ANN_OK)
+    {
+        test_ann_printf("ERROR: La red no se preparó o iterate falló\n");
+        result = TEST_KO;
+    }
+    for (i = 0; i < 4; i++)
+    {
+        if (y5[i] != y5_ref[i])
+        {
+            test_ann_printf("ERROR: La salida preparada difiere en %u: %f frente a %f\n", i, y5[i], y5_ref[i]);
+            result = TEST_KO;
+        }
+    }
+
+    /* Coste por inferencia de ambos caminos */
+    n = 200000;
+    inicio = clock();
+    for (i = 0; i < n; i++)
+    {
+        ann_api.iterate(&service);
+    }
+    ns[0] = 1e9 * (double)(clock() - inicio) / CLOCKS_PER_SEC / n;
+    inicio = clock();
+    for (i = 0; i < n; i++)
+    {
+        ann_api.iterate(&sin_preparar);
+    }
+    ns[1] = 1e9 * (double)(clock() - inicio) / CLOCKS_PER_SEC / n;
+    test_ann_printf("  Por inferencia: preparada %.0f ns, validada en cada capa %.0f ns\n", ns[0], ns[1]);
+
+    /* Encadenamiento incompatible: la capa no se prepara y iterate lo sigue detectando */
+    pesos5[1].columnas = 8;
+    pesos5[1].filas = 32;
+    service = ann_api.get_ann(3, TANH, pesos5, bias5);
+    service.x0.pmatriz = x5;
+    service.y0.pmatriz = y5;
+    if (service.net.operacion[1].filas != 0 || ann_api.iterate(&service) != ANN_KO)
+    {
+        test_ann_printf("ERROR: Se preparó una capa incompatible con la anterior\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Capas preparadas: PASSED\n");
+    }
+
     if (result == TEST_OK)
         test_ann_printf("\nTest Iterate_ANN: PASSED\n");
     else
@@ -710,42 +953,1336 @@ int Test_Trigger_ANN(void)
     return result;
 }
 
-int Run_All_ANN_Tests(void)
+int Test_Quantized_ANN(void)
 {
-    int total_result = TEST_OK;
-    int test_result;
-    time_t current_time;
-    char time_string[100];
+    int result = TEST_OK;
+    int ret, ret_q8;
+    ANN_SERVICE service;
+    ANN_Q8_SERVICE service_q8;
+    unsigned int i, n;
 
-    /* Abrir archivo de log */
-    ann_test_log_file = fopen("ANN_Tests_Result.txt", "a");
-    if (ann_test_log_file == NULL)
+    /* Red de 3 capas: 16 entradas -> 32 -> 16 -> 4 salidas */
+    static float w1_data[32 * 16];
+    static float b1_data[32];
+    static float w2_data[16 * 32];
+    static float b2_data[16];
+    static float w3_data[4 * 16];
+    static float b3_data[4];
+    static signed char pesos_q[32 * 16 + 16 * 32 + 4 * 16];
+    static float escalas[32 + 16 + 4];
+
+    float input_data[16];
+    float output_float[4];
+    float output_q8[4];
+
+    MATRIZ pesos[3];
+    MATRIZ bias[3];
+
+    float error, max_error, potencia_senal, potencia_error, snr_db;
+    unsigned int bytes_float, bytes_q8;
+
+    test_ann_printf("\n=== Test Quantized_ANN ===\n");
+
+    Init_ANN();
+    nsdsp_math_init();
+
+    /* Generar pesos pseudoaleatorios reproducibles */
+    srand(1234);
+    for (i = 0; i < 32 * 16; i++) w1_data[i] = random_uniform_ann(0.5f);
+    for (i = 0; i < 32; i++)      b1_data[i] = random_uniform_ann(0.1f);
+    for (i = 0; i < 16 * 32; i++) w2_data[i] = random_uniform_ann(0.3f);
+    for (i = 0; i < 16; i++)      b2_data[i] = random_uniform_ann(0.1f);
+    for (i = 0; i < 4 * 16; i++)  w3_data[i] = random_uniform_ann(0.5f);
+    for (i = 0; i < 4; i++)       b3_data[i] = random_uniform_ann(0.1f);
+
+    pesos[0].filas = 32; pesos[0].columnas = 16; pesos[0].pmatriz = w1_data;
+    pesos[1].filas = 16; pesos[1].columnas = 32; pesos[1].pmatriz = w2_data;
+    pesos[2].filas = 4;  pesos[2].columnas = 16; pesos[2].pmatriz = w3_data;
+    bias[0].filas = 32;  bias[0].columnas = 1;   bias[0].pmatriz = b1_data;
+    bias[1].filas = 16;  bias[1].columnas = 1;   bias[1].pmatriz = b2_data;
+    bias[2].filas = 4;   bias[2].columnas = 1;   bias[2].pmatriz = b3_data;
+
+    /* Test 1: Creación del servicio cuantizado */
+    test_ann_printf("\nTest 1: Cuantización de red 16-32-16-4\n");
+
+    service_q8 = ann_api.get_ann_q8(3, TANH, pesos, bias, pesos_q, escalas);
+
+    if (service_q8.levels != 3 || service_q8.x0.filas != 16 || service_q8.y0.filas != 4)
     {
-        printf("WARNING: No se pudo abrir el archivo de log de ANN\n");
+        test_ann_printf("ERROR: Servicio cuantizado mal configurado (levels=%u, x0=%u, y0=%u)\n",
+                       service_q8.levels, service_q8.x0.filas, service_q8.y0.filas);
+        return TEST_KO;
+    }
+
+    bytes_float = (32 * 16 + 16 * 32 + 4 * 16) * sizeof(float);
+    bytes_q8 = (32 * 16 + 16 * 32 + 4 * 16) * sizeof(signed char) + (32 + 16 + 4) * sizeof(float);
+    test_ann_printf("Memoria de pesos: float %u bytes, int8 %u bytes (%.1f%%)\n",
+                   bytes_float, bytes_q8, 100.0f * (float)bytes_q8 / (float)bytes_float);
+
+    /* Test 2: Informe de precisión frente a la red en float */
+    test_ann_printf("\nTest 2: Precisión int8 frente a float (200 entradas aleatorias)\n");
+
+    service = ann_api.get_ann(3, TANH, pesos, bias);
+    service.x0.pmatriz = input_data;
+    service.y0.pmatriz = output_float;
+    service_q8.x0.pmatriz = input_data;
+    service_q8.y0.pmatriz = output_q8;
+
+    max_error = 0.0f;
+    potencia_senal = 0.0f;
+    potencia_error = 0.0f;
+
+    for (n = 0; n < 200; n++)
+    {
+        for (i = 0; i < 16; i++)
+        {
+            input_data[i] = random_uniform_ann(1.0f);
+        }
+
+        ret = ann_api.iterate(&service);
+        ret_q8 = ann_api.iterate_q8(&service_q8);
+
+        if (ret != ANN_OK || ret_q8 != ANN_OK)
+        {
+            test_ann_printf("ERROR: Fallo en forward pass (float=%d, int8=%d)\n", ret, ret_q8);
+            result = TEST_KO;
+            break;
+        }
+
+        for (i = 0; i < 4; i++)
+        {
+            error = output_q8[i] - output_float[i];
+            if (fabsf(error) > max_error)
+            {
+                max_error = fabsf(error);
+            }
+            potencia_senal += output_float[i] * output_float[i];
+            potencia_error += error * error;
+        }
+    }
+
+    snr_db = (potencia_error > 0.0f) ? 10.0f * log10f(potencia_senal / potencia_error) : 200.0f;
+    test_ann_printf("Error máximo absoluto: %.6f\n", max_error);
+    test_ann_printf("SNR int8 vs float: %.2f dB\n", snr_db);
+
+    if (snr_db < 30.0f || max_error > 0.05f)
+    {
+        test_ann_printf("ERROR: Precisión de la red cuantizada insuficiente\n");
+        result = TEST_KO;
     }
     else
     {
-        /* Escribir encabezado con fecha y hora */
-        time(&current_time);
-        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
-        test_ann_printf("\n\n########################################\n");
-        test_ann_printf("# ANN (Artificial Neural Networks) Unit Tests\n");
-        test_ann_printf("# Fecha y hora: %s\n", time_string);
-        test_ann_printf("########################################\n");
+        test_ann_printf("Precisión de la red cuantizada: PASSED\n");
     }
 
-    test_ann_printf("\n========================================\n");
-    test_ann_printf("    EJECUTANDO TESTS ANN\n");
-    test_ann_printf("========================================\n");
+    /* Test 3: Parámetros inválidos */
+    test_ann_printf("\nTest 3: Parámetros inválidos\n");
 
-    /* Ejecutar tests */
-    test_result = Test_Get_ANN();
-    if (test_result != TEST_OK) total_result = TEST_KO;
+    service_q8 = ann_api.get_ann_q8(3, TANH, pesos, bias, NULL, escalas);
+    if (service_q8.levels != 0)
+    {
+        test_ann_printf("ERROR: No detectó buffer de pesos cuantizados NULL\n");
+        result = TEST_KO;
+    }
 
-    test_result = Test_Iterate_ANN();
-    if (test_result != TEST_OK) total_result = TEST_KO;
+    pesos[1].columnas = 8;  /* Rompe el encadenamiento 32 -> 16 */
+    service_q8 = ann_api.get_ann_q8(3, TANH, pesos, bias, pesos_q, escalas);
+    pesos[1].columnas = 32;
+    if (service_q8.levels != 0)
+    {
+        test_ann_printf("ERROR: No detectó dimensiones incompatibles entre capas\n");
+        result = TEST_KO;
+    }
 
-    test_result = Test_Trigger_ANN();
+    if (ann_api.iterate_q8(NULL) != ANN_KO || ann_api.iterate_q8(&service_q8) != ANN_KO)
+    {
+        test_ann_printf("ERROR: iterate_q8 no detectó servicio inválido\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_ann_printf("\nTest Quantized_ANN: PASSED\n");
+    else
+        test_ann_printf("\nTest Quantized_ANN: FAILED\n");
+
+    return result;
+}
+
+int Test_Model_ANN(void)
+{
+    int result = TEST_OK;
+    int ret;
+    unsigned int i, tamano, escrito, leido;
+    ANN_SERVICE service;
+    static ANN_MODEL modelo;
+    static float buffer_modelo[256];    /* Buffer alineado para el modelo serializado */
+    static float buffer_leido[256];     /* Buffer para el modelo leído del fichero */
+    FILE *fichero;
+    unsigned int magic_original;
+    unsigned int magic_corrupto = 0x12345678u;
+
+    float w1_data[6] = {0.5f, -0.3f,
+                        0.2f, 0.8f,
+                        -0.1f, 0.4f};
+    float b1_data[3] = {0.1f, 0.2f, -0.1f};
+    float w2_data[3] = {0.6f, 0.3f, -0.5f};
+    float b2_data[1] = {0.15f};
+
+    float input_data[2] = {0.5f, 0.8f};
+    float output_ref[1];
+    float output_modelo[1];
+
+    MATRIZ pesos[2];
+    MATRIZ bias[2];
+
+    test_ann_printf("\n=== Test Model_ANN ===\n");
+
+    Init_ANN();
+    nsdsp_math_init();
+
+    pesos[0].filas = 3; pesos[0].columnas = 2; pesos[0].pmatriz = w1_data;
+    pesos[1].filas = 1; pesos[1].columnas = 3; pesos[1].pmatriz = w2_data;
+    bias[0].filas = 3;  bias[0].columnas = 1;  bias[0].pmatriz = b1_data;
+    bias[1].filas = 1;  bias[1].columnas = 1;  bias[1].pmatriz = b2_data;
+
+    /* Test 1: Serialización del modelo */
+    test_ann_printf("\nTest 1: Serialización de red 2-3-1\n");
+
+    tamano = ann_api.build_model(2, SIGMOID, pesos, bias, NULL, 0);
+    escrito = ann_api.build_model(2, SIGMOID, pesos, bias, buffer_modelo, sizeof(buffer_modelo));
+
+    test_ann_printf("Tamaño del modelo: %u bytes\n", tamano);
+    if (tamano == 0 || escrito != tamano || (tamano % ANN_MODEL_ALIGN) != 0)
+    {
+        test_ann_printf("ERROR: Tamaño de modelo incorrecto (consulta %u, escrito %u)\n", tamano, escrito);
+        return TEST_KO;
+    }
+
+    if (ann_api.build_model(2, SIGMOID, pesos, bias, buffer_modelo, tamano - 1) != 0)
+    {
+        test_ann_printf("ERROR: No detectó buffer insuficiente\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: Escritura a fichero, lectura y carga sin copia */
+    test_ann_printf("\nTest 2: Carga del modelo desde fichero\n");
+
+    fichero = fopen("ANN_Model_Test.bin", "wb");
+    if (fichero == NULL)
+    {
+        test_ann_printf("ERROR: No se pudo crear el fichero de modelo\n");
+        return TEST_KO;
+    }
+    fwrite(buffer_modelo, 1, tamano, fichero);
+    fclose(fichero);
+
+    fichero = fopen("ANN_Model_Test.bin", "rb");
+    if (fichero == NULL)
+    {
+        test_ann_printf("ERROR: No se pudo abrir el fichero de modelo\n");
+        return TEST_KO;
+    }
+    leido = (unsigned int)fread(buffer_leido, 1, sizeof(buffer_leido), fichero);
+    fclose(fichero);
+
+    ret = ann_api.load_model(buffer_leido, leido, &modelo);
+    if (ret != ANN_OK)
+    {
+        test_ann_printf("ERROR: load_model falló con un modelo válido\n");
+        return TEST_KO;
+    }
+
+    /* Las matrices deben apuntar dentro del propio modelo */
+    for (i = 0; i < 2; i++)
+    {
+        if ((unsigned char *)modelo.pesos[i].pmatriz < (unsigned char *)buffer_leido ||
+            (unsigned char *)modelo.pesos[i].pmatriz >= (unsigned char *)buffer_leido + leido ||
+            ((size_t)modelo.pesos[i].pmatriz % ANN_MODEL_ALIGN) != 0)
+        {
+            test_ann_printf("ERROR: Pesos de la capa %u no enlazados sin copia\n", i);
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: Resultado idéntico a la red construida con get_ann */
+    test_ann_printf("\nTest 3: Forward pass del modelo cargado\n");
+
+    service = ann_api.get_ann(2, SIGMOID, pesos, bias);
+    service.x0.pmatriz = input_data;
+    service.y0.pmatriz = output_ref;
+    ann_api.iterate(&service);
+
+    modelo.service.x0.pmatriz = input_data;
+    modelo.service.y0.pmatriz = output_modelo;
+    ret = ann_api.iterate(&modelo.service);
+
+    test_ann_printf("Salida referencia: %.6f, salida modelo: %.6f\n", output_ref[0], output_modelo[0]);
+    if (ret != ANN_OK || !float_equals_ann(output_ref[0], output_modelo[0], EPSILON_ANN))
+    {
+        test_ann_printf("ERROR: La salida del modelo cargado no coincide\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: Modelos corruptos */
+    test_ann_printf("\nTest 4: Detección de modelos corruptos\n");
+
+    if (ann_api.load_model(buffer_leido, leido - 8, &modelo) != ANN_KO)
+    {
+        test_ann_printf("ERROR: No detectó modelo truncado\n");
+        result = TEST_KO;
+    }
+
+    memcpy(&magic_original, buffer_leido, sizeof(unsigned int));
+    memcpy(buffer_leido, &magic_corrupto, sizeof(unsigned int));
+    if (ann_api.load_model(buffer_leido, leido, &modelo) != ANN_KO)
+    {
+        test_ann_printf("ERROR: No detectó magic incorrecto\n");
+        result = TEST_KO;
+    }
+    memcpy(buffer_leido, &magic_original, sizeof(unsigned int));
+
+    if (ann_api.load_model((unsigned char *)buffer_leido + 1, leido - 1, &modelo) != ANN_KO ||
+        ann_api.load_model(NULL, leido, &modelo) != ANN_KO)
+    {
+        test_ann_printf("ERROR: No detectó puntero de modelo inválido\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Detección de modelos corruptos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_ann_printf("\nTest Model_ANN: PASSED\n");
+    else
+        test_ann_printf("\nTest Model_ANN: FAILED\n");
+
+    return result;
+}
+
+int Test_Train_ANN(void)
+{
+    int result = TEST_OK;
+    int ret;
+    unsigned int i, k, it, tamano;
+    ANN_SERVICE service;
+    ANN_TRAINER trainer;
+    ANN_OPTIMIZER optimizadores[3] = {SGD, MOMENTUM, ADAM};
+    const char *nombres[3] = {"SGD", "MOMENTUM", "ADAM"};
+    float tasas[3] = {0.2f, 0.05f, 0.02f};
+    static float workspace[4096];
+
+    /* Red 3-5-2 para la verificación del gradiente */
+    float w1_data[15], b1_data[5], w2_data[10], b2_data[2];
+    float x_data[4 * 3], d_data[4 * 2];
+
+    /* Red 2-8-1 para el aprendizaje de XOR */
+    float wx1_data[16], bx1_data[8], wx2_data[8], bx2_data[1];
+    float x_xor[8] = {-1.0f, -1.0f,  -1.0f, 1.0f,  1.0f, -1.0f,  1.0f, 1.0f};
+    float d_xor[4] = {-0.8f, 0.8f, 0.8f, -0.8f};
+
+    MATRIZ pesos[2], bias[2];
+    float perdida, perdida_inicial, original, l_mas, l_menos, numerico, analitico, error_max;
+    clock_t inicio, fin;
+    double segundos;
+
+    test_ann_printf("\n=== Test Train_ANN ===\n");
+
+    Init_ANN();
+    nsdsp_math_init();
+
+    /* Test 1: Verificación del gradiente por diferencias finitas */
+    test_ann_printf("\nTest 1: Gradiente analítico frente a diferencias finitas (red 3-5-2, TANH, lote 4)\n");
+
+    srand(4321);
+    for (i = 0; i < 15; i++) w1_data[i] = random_uniform_ann(0.8f);
+    for (i = 0; i < 5; i++)  b1_data[i] = random_uniform_ann(0.2f);
+    for (i = 0; i < 10; i++) w2_data[i] = random_uniform_ann(0.8f);
+    for (i = 0; i < 2; i++)  b2_data[i] = random_uniform_ann(0.2f);
+    for (i = 0; i < 12; i++) x_data[i] = random_uniform_ann(1.0f);
+    for (i = 0; i < 8; i++)  d_data[i] = random_uniform_ann(0.8f);
+
+    pesos[0].filas = 5; pesos[0].columnas = 3; pesos[0].pmatriz = w1_data;
+    pesos[1].filas = 2; pesos[1].columnas = 5; pesos[1].pmatriz = w2_data;
+    bias[0].filas = 5;  bias[0].columnas = 1;  bias[0].pmatriz = b1_data;
+    bias[1].filas = 2;  bias[1].columnas = 1;  bias[1].pmatriz = b2_data;
+
+    service = ann_api.get_ann(2, TANH, pesos, bias);
+    tamano = ann_api.train_workspace(&service, 4, SGD);
+    test_ann_printf("Workspace necesario: %u floats\n", tamano);
+
+    /* Con tasa 0 el paso calcula gradientes sin modificar la red */
+    ret = ann_api.get_trainer(&service, SGD, 0.0f, 4, workspace, sizeof(workspace) / sizeof(float), &trainer);
+    if (ret != ANN_OK || ann_api.train_step(&trainer, x_data, d_data, 4, &perdida) != ANN_OK)
+    {
+        test_ann_printf("ERROR: No se pudo ejecutar el paso de entrenamiento\n");
+        return TEST_KO;
+    }
+
+    if (!float_equals_ann(perdida, loss_ann(&service, x_data, d_data, 4), 1e-5f))
+    {
+        test_ann_printf("ERROR: Pérdida del paso (%.6f) distinta de la del forward pass\n", perdida);
+        result = TEST_KO;
+    }
+
+    error_max = 0.0f;
+    for (k = 0; k < 2; k++)
+    {
+        for (i = 0; i < pesos[k].filas * pesos[k].columnas; i++)
+        {
+            original = pesos[k].pmatriz[i];
+            pesos[k].pmatriz[i] = original + 1e-2f;
+            l_mas = loss_ann(&service, x_data, d_data, 4);
+            pesos[k].pmatriz[i] = original - 1e-2f;
+            l_menos = loss_ann(&service, x_data, d_data, 4);
+            pesos[k].pmatriz[i] = original;
+
+            numerico = (l_mas - l_menos) / 2e-2f;
+            analitico = trainer.grad_pesos[k][i];
+            if (fabsf(numerico - analitico) > error_max)
+            {
+                error_max = fabsf(numerico - analitico);
+            }
+        }
+        for (i = 0; i < bias[k].filas; i++)
+        {
+            original = bias[k].pmatriz[i];
+            bias[k].pmatriz[i] = original + 1e-2f;
+            l_mas = loss_ann(&service, x_data, d_data, 4);
+            bias[k].pmatriz[i] = original - 1e-2f;
+            l_menos = loss_ann(&service, x_data, d_data, 4);
+            bias[k].pmatriz[i] = original;
+
+            numerico = (l_mas - l_menos) / 2e-2f;
+            analitico = trainer.grad_bias[k][i];
+            if (fabsf(numerico - analitico) > error_max)
+            {
+                error_max = fabsf(numerico - analitico);
+            }
+        }
+    }
+
+    test_ann_printf("Error máximo del gradiente: %.2e\n", error_max);
+    if (error_max > 1e-3f)
+    {
+        test_ann_printf("ERROR: Gradiente analítico incorrecto\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Verificación del gradiente: PASSED\n");
+    }
+
+    /* Test 2: Aprendizaje de XOR con cada optimizador */
+    test_ann_printf("\nTest 2: Aprendizaje de XOR (red 2-8-1, TANH, lote 4)\n");
+
+    pesos[0].filas = 8; pesos[0].columnas = 2; pesos[0].pmatriz = wx1_data;
+    pesos[1].filas = 1; pesos[1].columnas = 8; pesos[1].pmatriz = wx2_data;
+    bias[0].filas = 8;  bias[0].columnas = 1;  bias[0].pmatriz = bx1_data;
+    bias[1].filas = 1;  bias[1].columnas = 1;  bias[1].pmatriz = bx2_data;
+
+    for (k = 0; k < 3; k++)
+    {
+        srand(99);
+        for (i = 0; i < 16; i++) wx1_data[i] = random_uniform_ann(1.0f);
+        for (i = 0; i < 8; i++)  bx1_data[i] = random_uniform_ann(0.1f);
+        for (i = 0; i < 8; i++)  wx2_data[i] = random_uniform_ann(0.5f);
+        bx2_data[0] = 0.0f;
+
+        service = ann_api.get_ann(2, TANH, pesos, bias);
+        ann_api.get_trainer(&service, optimizadores[k], tasas[k], 4, workspace, sizeof(workspace) / sizeof(float), &trainer);
+
+        ann_api.train_step(&trainer, x_xor, d_xor, 4, &perdida_inicial);
+        for (it = 1; it < 1000; it++)
+        {
+            ann_api.train_step(&trainer, x_xor, d_xor, 4, &perdida);
+        }
+
+        test_ann_printf("%-8s: pérdida inicial %.4f, pérdida tras 1000 pasos %.6f\n",
+                       nombres[k], perdida_inicial, perdida);
+        if (perdida > 0.01f || perdida >= perdida_inicial)
+        {
+            test_ann_printf("ERROR: El optimizador %s no converge\n", nombres[k]);
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: Coste por paso en modo en línea (lote 1) */
+    test_ann_printf("\nTest 3: Coste del paso de entrenamiento en línea (red 2-8-1, ADAM, lote 1)\n");
+
+    ann_api.get_trainer(&service, ADAM, 0.001f, 1, workspace, sizeof(workspace) / sizeof(float), &trainer);
+    inicio = clock();
+    for (it = 0; it < 100000; it++)
+    {
+        ann_api.train_step(&trainer, &x_xor[2 * (it & 3)], &d_xor[it & 3], 1, NULL);
+    }
+    fin = clock();
+    segundos = (double)(fin - inicio) / CLOCKS_PER_SEC;
+    test_ann_printf("100000 pasos en %.3f s (%.2f us/paso)\n", segundos, 1e6 * segundos / 100000.0);
+
+    /* Test 4: Parámetros inválidos */
+    test_ann_printf("\nTest 4: Parámetros inválidos\n");
+
+    if (ann_api.get_trainer(&service, ADAM, 0.01f, 4, workspace, 10, &trainer) != ANN_KO)
+    {
+        test_ann_printf("ERROR: No detectó workspace insuficiente\n");
+        result = TEST_KO;
+    }
+
+    ann_api.get_trainer(&service, SGD, 0.01f, 2, workspace, sizeof(workspace) / sizeof(float), &trainer);
+    if (ann_api.train_step(&trainer, x_xor, d_xor, 4, NULL) != ANN_KO ||
+        ann_api.train_step(&trainer, NULL, d_xor, 1, NULL) != ANN_KO)
+    {
+        test_ann_printf("ERROR: No detectó mini-lote inválido\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_ann_printf("\nTest Train_ANN: PASSED\n");
+    else
+        test_ann_printf("\nTest Train_ANN: FAILED\n");
+
+    return result;
+}
+
+int Test_Conv1D_ANN(void)
+{
+    int result = TEST_OK;
+    int ret;
+    unsigned int i, co, ci, k, t, n, producidas;
+    ANN_SERVICE service;
+    CONV1D_STREAM stream;
+
+    /* Test 1: diferencia de primer orden con kernel [-1, 1] */
+    float w_dif[2] = {-1.0f, 1.0f};
+    float b_dif[1] = {0.0f};
+    float x_dif[6] = {1.0f, 3.0f, 6.0f, 10.0f, 15.0f, 21.0f};
+    float y_dif[5];
+    MATRIZ pesos_dif = {1, 2, w_dif};
+    MATRIZ bias_dif = {1, 1, b_dif};
+    CONV1D_CONFIG conv_dif = {1, 1, 6, 2, 1, 1};
+    LAYER capa_dif[1];
+
+    /* Test 2: red CONV1D (2->3 canales, K=3, s=2, d=2) + MAXPOOL1D + DENSE */
+    static float w_conv[3 * 2 * 3];
+    static float b_conv[3];
+    static float w_dense[2 * 3 * 6];
+    static float b_dense[2];
+    static float x_red[2 * 32];
+    static float y_conv_ref[3 * 14];
+    static float y_pool_ref[3 * 6];
+    float y_red[2], y_ref[2];
+    MATRIZ pesos_conv = {3, 6, w_conv};
+    MATRIZ bias_conv = {3, 1, b_conv};
+    MATRIZ pesos_dense = {2, 18, w_dense};
+    MATRIZ bias_dense = {2, 1, b_dense};
+    CONV1D_CONFIG conv_red = {2, 3, 32, 3, 2, 2};     /* L_out = (32 - 5)/2 + 1 = 14 */
+    CONV1D_CONFIG pool_red = {3, 3, 14, 3, 2, 1};     /* L_out = (14 - 3)/2 + 1 = 6 */
+    LAYER capas[3];
+
+    /* Test 3: streaming frente a bloque */
+    static float x_largo[2 * 40];
+    static float y_bloque[3 * 18];
+    static float pz_stream[2 * 5];
+    float y_stream[3];
+    CONV1D_CONFIG conv_largo = {2, 3, 40, 3, 2, 2};   /* L_out = (40 - 5)/2 + 1 = 18 */
+    LAYER capa_larga[1];
+    float muestra[2];
+
+    /* Test 4: stride 1, por grupos de ANN_CARRILES salidas */
+    static float y_paso1[3 * 38];
+    CONV1D_CONFIG conv_paso1 = {2, 3, 40, 3, 1, 1};   /* L_out = 40 - 3 + 1 = 38 */
+    LAYER capa_paso1[1];
+    float acumulador, error_max;
+
+    test_ann_printf("\n=== Test Conv1D_ANN ===\n");
+
+    Init_ANN();
+    nsdsp_math_init();
+
+    /* Test 1 */
+    test_ann_printf("\nTest 1: CONV1D de 1 canal con kernel [-1, 1]\n");
+
+    capa_dif[0].pesos = &pesos_dif;
+    capa_dif[0].bias = &bias_dif;
+    capa_dif[0].tipo = CONV1D;
+    capa_dif[0].conv = &conv_dif;
+
+    service = ann_api.get_ann_layers(1, RELU, capa_dif);
+    service.x0.pmatriz = x_dif;
+    service.y0.pmatriz = y_dif;
+
+    if (service.net.levels != 1 || service.x0.filas != 6 || service.y0.filas != 5 ||
+        ann_api.iterate(&service) != ANN_OK)
+    {
+        test_ann_printf("ERROR: No se pudo ejecutar la red CONV1D (levels=%u, x0=%u, y0=%u)\n",
+                       service.net.levels, service.x0.filas, service.y0.filas);
+        return TEST_KO;
+    }
+
+    test_ann_printf("Output: [%.1f, %.1f, %.1f, %.1f, %.1f]\n", y_dif[0], y_dif[1], y_dif[2], y_dif[3], y_dif[4]);
+    for (t = 0; t < 5; t++)
+    {
+        if (!float_equals_ann(y_dif[t], (float)(t + 2), EPSILON_ANN))
+        {
+            test_ann_printf("ERROR: Salida CONV1D incorrecta en t=%u\n", t);
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 2 */
+    test_ann_printf("\nTest 2: Red CONV1D(2->3, K=3, s=2, d=2) + MAXPOOL1D(3, 2) + DENSE(18->2)\n");
+
+    srand(777);
+    for (i = 0; i < 18; i++) w_conv[i] = random_uniform_ann(0.5f);
+    for (i = 0; i < 3; i++)  b_conv[i] = random_uniform_ann(0.1f);
+    for (i = 0; i < 36; i++) w_dense[i] = random_uniform_ann(0.5f);
+    for (i = 0; i < 2; i++)  b_dense[i] = random_uniform_ann(0.1f);
+    for (i = 0; i < 64; i++) x_red[i] = random_uniform_ann(1.0f);
+
+    capas[0].pesos = &pesos_conv;  capas[0].bias = &bias_conv;  capas[0].tipo = CONV1D;    capas[0].conv = &conv_red;
+    capas[1].pesos = NULL;         capas[1].bias = NULL;        capas[1].tipo = MAXPOOL1D; capas[1].conv = &pool_red;
+    capas[2].pesos = &pesos_dense; capas[2].bias = &bias_dense; capas[2].tipo = DENSE;     capas[2].conv = NULL;
+
+    service = ann_api.get_ann_layers(3, TANH, capas);
+    service.x0.pmatriz = x_red;
+    service.y0.pmatriz = y_red;
+    ret = ann_api.iterate(&service);
+
+    /* Referencia calculada directamente */
+    for (co = 0; co < 3; co++)
+    {
+        for (t = 0; t < 14; t++)
+        {
+            acumulador = b_conv[co];
+            for (ci = 0; ci < 2; ci++)
+            {
+                for (k = 0; k < 3; k++)
+                {
+                    acumulador += w_conv[(co * 2 + ci) * 3 + k] * x_red[ci * 32 + t * 2 + k * 2];
+                }
+            }
+            y_conv_ref[co * 14 + t] = tanhf(acumulador);
+        }
+        for (t = 0; t < 6; t++)
+        {
+            acumulador = y_conv_ref[co * 14 + t * 2];
+            for (k = 1; k < 3; k++)
+            {
+                if (y_conv_ref[co * 14 + t * 2 + k] > acumulador)
+                {
+                    acumulador = y_conv_ref[co * 14 + t * 2 + k];
+                }
+            }
+            y_pool_ref[co * 6 + t] = acumulador;
+        }
+    }
+    for (i = 0; i < 2; i++)
+    {
+        acumulador = b_dense[i];
+        for (k = 0; k < 18; k++)
+        {
+            acumulador += w_dense[i * 18 + k] * y_pool_ref[k];
+        }
+        y_ref[i] = tanhf(acumulador);
+    }
+
+    test_ann_printf("Output: [%.6f, %.6f], referencia: [%.6f, %.6f]\n", y_red[0], y_red[1], y_ref[0], y_ref[1]);
+    if (ret != ANN_OK || service.x0.filas != 64 || service.y0.filas != 2 ||
+        !float_equals_ann(y_red[0], y_ref[0], 1e-5f) || !float_equals_ann(y_red[1], y_ref[1], 1e-5f))
+    {
+        test_ann_printf("ERROR: La red CONV1D+POOL+DENSE no coincide con la referencia\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Red CONV1D+POOL+DENSE: PASSED\n");
+    }
+
+    /* Test 3 */
+    test_ann_printf("\nTest 3: CONV1D en streaming frente a ejecución por bloque\n");
+
+    for (i = 0; i < 80; i++) x_largo[i] = random_uniform_ann(1.0f);
+
+    capa_larga[0].pesos = &pesos_conv;
+    capa_larga[0].bias = &bias_conv;
+    capa_larga[0].tipo = CONV1D;
+    capa_larga[0].conv = &conv_largo;
+
+    service = ann_api.get_ann_layers(1, TANH, capa_larga);
+    service.x0.pmatriz = x_largo;
+    service.y0.pmatriz = y_bloque;
+    ann_api.iterate(&service);
+
+    ret = ann_api.get_conv_stream(&capa_larga[0], TANH, pz_stream, &stream);
+    if (ret != ANN_OK)
+    {
+        test_ann_printf("ERROR: get_conv_stream falló con una capa válida\n");
+        return TEST_KO;
+    }
+
+    producidas = 0;
+    error_max = 0.0f;
+    for (n = 0; n < 40; n++)
+    {
+        muestra[0] = x_largo[n];
+        muestra[1] = x_largo[40 + n];
+        ret = ann_api.conv_stream(muestra, y_stream, &stream);
+
+        if (ret == 1)
+        {
+            for (co = 0; co < 3 && producidas < 18; co++)
+            {
+                acumulador = fabsf(y_stream[co] - y_bloque[co * 18 + producidas]);
+                if (acumulador > error_max)
+                {
+                    error_max = acumulador;
+                }
+            }
+            producidas++;
+        }
+        else if (ret != 0)
+        {
+            test_ann_printf("ERROR: conv_stream devolvió error\n");
+            result = TEST_KO;
+            break;
+        }
+    }
+
+    test_ann_printf("Salidas en streaming: %u (esperadas 18), error máximo: %.2e\n", producidas, error_max);
+    if (producidas != 18 || error_max > 1e-5f)
+    {
+        test_ann_printf("ERROR: El streaming no coincide con la ejecución por bloque\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4 */
+    test_ann_printf("\nTest 4: CONV1D con stride 1 y 38 salidas frente a la suma directa\n");
+
+    capa_paso1[0].pesos = &pesos_conv;
+    capa_paso1[0].bias = &bias_conv;
+    capa_paso1[0].tipo = CONV1D;
+    capa_paso1[0].conv = &conv_paso1;
+
+    service = ann_api.get_ann_layers(1, TANH, capa_paso1);
+    service.x0.pmatriz = x_largo;
+    service.y0.pmatriz = y_paso1;
+    ret = ann_api.iterate(&service);
+
+    error_max = 0.0f;
+    for (co = 0; co < 3; co++)
+    {
+        for (t = 0; t < 38; t++)
+        {
+            acumulador = b_conv[co];
+            for (ci = 0; ci < 2; ci++)
+            {
+                for (k = 0; k < 3; k++)
+                {
+                    acumulador += w_conv[(co * 2 + ci) * 3 + k] * x_largo[ci * 40 + t + k];
+                }
+            }
+            acumulador = fabsf(y_paso1[co * 38 + t] - tanhf(acumulador));
+            if (acumulador > error_max)
+            {
+                error_max = acumulador;
+            }
+        }
+    }
+
+    test_ann_printf("Error máximo: %.2e\n", error_max);
+    if (ret != ANN_OK || service.y0.filas != 3 * 38 || error_max > 1e-5f)
+    {
+        test_ann_printf("ERROR: La CONV1D con stride 1 no coincide con la suma directa\n");
+        result = TEST_KO;
+    }
+
+    /* Test 5: Configuraciones inválidas */
+    test_ann_printf("\nTest 5: Configuraciones inválidas\n");
+
+    conv_dif.kernel = 7;    /* Kernel mayor que la entrada */
+    conv_dif.canales_entrada = 1;
+    service = ann_api.get_ann_layers(1, RELU, capa_dif);
+    conv_dif.kernel = 2;
+    if (service.net.levels != 0)
+    {
+        test_ann_printf("ERROR: No detectó kernel mayor que la entrada\n");
+        result = TEST_KO;
+    }
+
+    pool_red.longitud_entrada = 15;     /* Rompe el encadenamiento CONV1D -> POOL */
+    service = ann_api.get_ann_layers(3, TANH, capas);
+    pool_red.longitud_entrada = 14;
+    if (service.net.levels != 0)
+    {
+        test_ann_printf("ERROR: No detectó dimensiones incompatibles entre capas\n");
+        result = TEST_KO;
+    }
+
+    if (ann_api.get_conv_stream(&capas[1], TANH, pz_stream, &stream) != ANN_KO)
+    {
+        test_ann_printf("ERROR: get_conv_stream aceptó una capa que no es CONV1D\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Detección de configuraciones inválidas: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_ann_printf("\nTest Conv1D_ANN: PASSED\n");
+    else
+        test_ann_printf("\nTest Conv1D_ANN: FAILED\n");
+
+    return result;
+}
+
+int Test_Recurrent_ANN(void)
+{
+    int result = TEST_OK;
+    unsigned int i, j, n, s;
+    ANN_SERVICE service;
+    clock_t inicio, fin;
+    double t_batch, t_individual;
+    float error, error_max;
+
+    /* Test 1 y 2: red GRU (3 -> 4) + DENSE (4 -> 1) */
+    static float w_gru[12 * 3], u_gru[12 * 4], b_gru[12];
+    static float w_out[4], b_out[1];
+    static float ws_gru[ANN_RNN_WORKSPACE(GRU, 4, 1)];
+    static float x_seq[20 * 3];
+    MATRIZ pesos_gru = {12, 3, w_gru};
+    MATRIZ recur_gru = {12, 4, u_gru};
+    MATRIZ bias_gru = {12, 1, b_gru};
+    MATRIZ pesos_out = {1, 4, w_out};
+    MATRIZ bias_out = {1, 1, b_out};
+    RNN_CONFIG rnn_gru;
+    LAYER capas[2];
+    float h_ref[4], c_ref[4], y_red[1], y_ref, y_primera;
+
+    /* Test 3: LSTM (5 -> 6) */
+    static float w_lstm[24 * 5], u_lstm[24 * 6], b_lstm[24];
+    static float ws_lstm[ANN_RNN_WORKSPACE(LSTM, 6, 1)];
+    MATRIZ pesos_lstm = {24, 5, w_lstm};
+    MATRIZ recur_lstm = {24, 6, u_lstm};
+    MATRIZ bias_lstm = {24, 1, b_lstm};
+    RNN_CONFIG rnn_lstm;
+    LAYER capa_lstm;
+    float x_lstm[5], h_lstm[6], h_lstm_ref[6], c_lstm[6];
+    MATRIZ x_paso = {5, 1, x_lstm};
+    MATRIZ y_paso = {6, 1, h_lstm};
+
+    /* Test 4: 16 canales GRU (4 -> 8) en un solo GEMM frente a 16 capas de un canal */
+    static float w_ms[24 * 4], u_ms[24 * 8], b_ms[24];
+    static float ws_ms[ANN_RNN_WORKSPACE(GRU, 8, 16)];
+    static float ws_uno[16][ANN_RNN_WORKSPACE(GRU, 8, 1)];
+    static float x_ms[4 * 16], y_ms[8 * 16];
+    float x_uno[4], y_uno[8];
+    MATRIZ pesos_ms = {24, 4, w_ms};
+    MATRIZ recur_ms = {24, 8, u_ms};
+    MATRIZ bias_ms = {24, 1, b_ms};
+    MATRIZ x_batch = {4, 16, x_ms};
+    MATRIZ y_batch = {8, 16, y_ms};
+    MATRIZ x_canal = {4, 1, x_uno};
+    MATRIZ y_canal = {8, 1, y_uno};
+    RNN_CONFIG rnn_ms, rnn_uno[16];
+    LAYER capa_ms, capa_uno[16];
+
+    test_ann_printf("\n=== Test Recurrent_ANN ===\n");
+
+    Init_ANN();
+    nsdsp_math_init();
+    srand(30);
+
+    /* Test 1: GRU + DENSE frente a la referencia */
+    test_ann_printf("\nTest 1: Red GRU(3->4) + DENSE(4->1) durante 20 pasos\n");
+
+    for (i = 0; i < 12 * 3; i++) w_gru[i] = random_uniform_ann(0.8f);
+    for (i = 0; i < 12 * 4; i++) u_gru[i] = random_uniform_ann(0.8f);
+    for (i = 0; i < 12; i++) b_gru[i] = random_uniform_ann(0.3f);
+    for (i = 0; i < 4; i++) w_out[i] = random_uniform_ann(1.0f);
+    b_out[0] = 0.1f;
+    for (i = 0; i < 20 * 3; i++) x_seq[i] = random_uniform_ann(1.0f);
+
+    if (ann_api.get_rnn(&capas[0], GRU, &pesos_gru, &recur_gru, &bias_gru, 1, ws_gru, &rnn_gru) != ANN_OK)
+    {
+        test_ann_printf("ERROR: get_rnn falló con una configuración válida\n");
+        return TEST_KO;
+    }
+    capas[1].pesos = &pesos_out;
+    capas[1].bias = &bias_out;
+    capas[1].tipo = DENSE;
+    capas[1].conv = NULL;
+    capas[1].rnn = NULL;
+
+    service = ann_api.get_ann_layers(2, TANH, capas);
+    if (service.net.levels != 2 || service.x0.filas != 3 || service.y0.filas != 1)
+    {
+        test_ann_printf("ERROR: get_ann_layers no aceptó la red GRU + DENSE\n");
+        return TEST_KO;
+    }
+    service.y0.pmatriz = y_red;
+
+    for (j = 0; j < 4; j++) h_ref[j] = 0.0f;
+    error_max = 0.0f;
+    y_primera = 0.0f;
+    for (n = 0; n < 20; n++)
+    {
+        service.x0.pmatriz = &x_seq[3 * n];
+        if (ann_api.iterate(&service) != ANN_OK)
+        {
+            test_ann_printf("ERROR: iterate falló en el paso %u\n", n);
+            return TEST_KO;
+        }
+        if (n == 0) y_primera = y_red[0];
+
+        rnn_referencia_ann(GRU, w_gru, u_gru, b_gru, 3, 4, &x_seq[3 * n], h_ref, c_ref);
+        y_ref = b_out[0];
+        for (j = 0; j < 4; j++) y_ref += w_out[j] * h_ref[j];
+        y_ref = tanhf(y_ref);
+
+        error = fabsf(y_red[0] - y_ref);
+        if (error > error_max) error_max = error;
+    }
+
+    test_ann_printf("Error máximo frente a la referencia: %.2e\n", error_max);
+    if (error_max > 1e-5f)
+    {
+        test_ann_printf("ERROR: La red GRU no coincide con la referencia\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: el estado persiste entre llamadas y se reinicia con rnn_reset */
+    test_ann_printf("\nTest 2: Persistencia y reinicio del estado\n");
+
+    service.x0.pmatriz = &x_seq[0];
+    ann_api.iterate(&service);
+    if (float_equals_ann(y_red[0], y_primera, 1e-6f))
+    {
+        test_ann_printf("ERROR: La salida no depende del estado previo\n");
+        result = TEST_KO;
+    }
+
+    ann_api.rnn_reset(&capas[0]);
+    ann_api.iterate(&service);
+    if (!float_equals_ann(y_red[0], y_primera, 1e-6f))
+    {
+        test_ann_printf("ERROR: rnn_reset no devolvió la red al estado inicial\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Persistencia y reinicio del estado: PASSED\n");
+    }
+
+    /* Test 3: LSTM frente a la referencia */
+    test_ann_printf("\nTest 3: Capa LSTM(5->6) durante 20 pasos\n");
+
+    for (i = 0; i < 24 * 5; i++) w_lstm[i] = random_uniform_ann(0.6f);
+    for (i = 0; i < 24 * 6; i++) u_lstm[i] = random_uniform_ann(0.6f);
+    for (i = 0; i < 24; i++) b_lstm[i] = random_uniform_ann(0.3f);
+
+    if (ann_api.get_rnn(&capa_lstm, LSTM, &pesos_lstm, &recur_lstm, &bias_lstm, 1, ws_lstm, &rnn_lstm) != ANN_OK)
+    {
+        test_ann_printf("ERROR: get_rnn falló con una capa LSTM válida\n");
+        return TEST_KO;
+    }
+
+    for (j = 0; j < 6; j++)
+    {
+        h_lstm_ref[j] = 0.0f;
+        c_lstm[j] = 0.0f;
+    }
+
+    error_max = 0.0f;
+    for (n = 0; n < 20; n++)
+    {
+        for (j = 0; j < 5; j++) x_lstm[j] = random_uniform_ann(1.0f);
+
+        if (ann_api.rnn_step(&capa_lstm, &x_paso, &y_paso) != ANN_OK)
+        {
+            test_ann_printf("ERROR: rnn_step falló en el paso %u\n", n);
+            return TEST_KO;
+        }
+        rnn_referencia_ann(LSTM, w_lstm, u_lstm, b_lstm, 5, 6, x_lstm, h_lstm_ref, c_lstm);
+
+        for (j = 0; j < 6; j++)
+        {
+            error = fabsf(h_lstm[j] - h_lstm_ref[j]);
+            if (error > error_max) error_max = error;
+        }
+    }
+
+    test_ann_printf("Error máximo frente a la referencia: %.2e\n", error_max);
+    if (error_max > 1e-5f)
+    {
+        test_ann_printf("ERROR: La capa LSTM no coincide con la referencia\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: modo multi-stream */
+    test_ann_printf("\nTest 4: 16 canales GRU(4->8) en un GEMM frente a 16 capas independientes\n");
+
+    for (i = 0; i < 24 * 4; i++) w_ms[i] = random_uniform_ann(0.7f);
+    for (i = 0; i < 24 * 8; i++) u_ms[i] = random_uniform_ann(0.7f);
+    for (i = 0; i < 24; i++) b_ms[i] = random_uniform_ann(0.3f);
+
+    ann_api.get_rnn(&capa_ms, GRU, &pesos_ms, &recur_ms, &bias_ms, 16, ws_ms, &rnn_ms);
+    for (s = 0; s < 16; s++)
+    {
+        ann_api.get_rnn(&capa_uno[s], GRU, &pesos_ms, &recur_ms, &bias_ms, 1, ws_uno[s], &rnn_uno[s]);
+    }
+
+    error_max = 0.0f;
+    for (n = 0; n < 50; n++)
+    {
+        for (i = 0; i < 4 * 16; i++) x_ms[i] = random_uniform_ann(1.0f);
+
+        if (ann_api.rnn_step(&capa_ms, &x_batch, &y_batch) != ANN_OK)
+        {
+            test_ann_printf("ERROR: rnn_step multi-stream falló en el paso %u\n", n);
+            return TEST_KO;
+        }
+
+        for (s = 0; s < 16; s++)
+        {
+            /* Columna s de la entrada I x S */
+            for (j = 0; j < 4; j++) x_uno[j] = x_ms[j * 16 + s];
+            ann_api.rnn_step(&capa_uno[s], &x_canal, &y_canal);
+            for (j = 0; j < 8; j++)
+            {
+                error = fabsf(y_uno[j] - y_ms[j * 16 + s]);
+                if (error > error_max) error_max = error;
+            }
+        }
+    }
+
+    test_ann_printf("Error máximo entre modos: %.2e\n", error_max);
+    if (error_max > 1e-5f)
+    {
+        test_ann_printf("ERROR: El modo multi-stream no coincide con las capas independientes\n");
+        result = TEST_KO;
+    }
+
+    inicio = clock();
+    for (n = 0; n < 20000; n++)
+    {
+        ann_api.rnn_step(&capa_ms, &x_batch, NULL);
+    }
+    fin = clock();
+    t_batch = (double)(fin - inicio) / CLOCKS_PER_SEC;
+
+    inicio = clock();
+    for (n = 0; n < 20000; n++)
+    {
+        for (s = 0; s < 16; s++)
+        {
+            ann_api.rnn_step(&capa_uno[s], &x_canal, NULL);
+        }
+    }
+    fin = clock();
+    t_individual = (double)(fin - inicio) / CLOCKS_PER_SEC;
+
+    test_ann_printf("Coste por paso de 16 canales: multi-stream %.2f us, capas independientes %.2f us\n",
+                    1e6 * t_batch / 20000.0, 1e6 * t_individual / 20000.0);
+
+    /* Test 5: Dimensiones inválidas */
+    test_ann_printf("\nTest 5: Dimensiones inválidas\n");
+
+    recur_gru.filas = 11;
+    if (ann_api.get_rnn(&capa_lstm, GRU, &pesos_gru, &recur_gru, &bias_gru, 1, ws_gru, &rnn_gru) != ANN_KO)
+    {
+        test_ann_printf("ERROR: get_rnn no detectó pesos recurrentes incompatibles\n");
+        result = TEST_KO;
+    }
+    recur_gru.filas = 12;
+
+    if (ann_api.get_rnn(&capa_lstm, LSTM, &pesos_gru, &recur_gru, &bias_gru, 1, ws_gru, &rnn_gru) != ANN_KO)
+    {
+        test_ann_printf("ERROR: get_rnn aceptó pesos GRU para una capa LSTM\n");
+        result = TEST_KO;
+    }
+
+    capas[0] = capa_ms;
+    service = ann_api.get_ann_layers(1, TANH, capas);
+    if (service.net.levels != 0)
+    {
+        test_ann_printf("ERROR: get_ann_layers aceptó una capa multi-stream\n");
+        result = TEST_KO;
+    }
+
+    if (ann_api.rnn_step(&capa_ms, &x_canal, NULL) != ANN_KO)
+    {
+        test_ann_printf("ERROR: rnn_step no detectó una entrada con canales incorrectos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_ann_printf("Detección de dimensiones inválidas: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_ann_printf("\nTest Recurrent_ANN: PASSED\n");
+    else
+        test_ann_printf("\nTest Recurrent_ANN: FAILED\n");
+
+    return result;
+}
+
+int Test_Sparse_ANN(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n, l;
+    ANN_SERVICE red_dispersa, red_densa;
+    float error, error_max, umbral;
+
+    /* Red 64 -> 32 -> 4 con pesos originales y su copia podada */
+    static float w0[32 * 64], b0[32], w1[4 * 32], b1[4];
+    static float w0_podada[32 * 64], w1_podada[4 * 32];
+    static float x_test[10 * 64];
+    MATRIZ pesos0 = {32, 64, w0};
+    MATRIZ bias0 = {32, 1, b0};
+    MATRIZ pesos1 = {4, 32, w1};
+    MATRIZ bias1 = {4, 1, b1};
+    MATRIZ pesos0_podada = {32, 64, w0_podada};
+    MATRIZ pesos1_podada = {4, 32, w1_podada};
+    LAYER capas[2], capas_densas[2];
+
+    /* Almacenamiento CSR de cada capa */
+    static unsigned int inicio0[32 + 1], columna0[32 * 64], inicio1[4 + 1], columna1[4 * 32];
+    static float valores0[32 * 64], valores1[4 * 32];
+    MATRIZ_DISPERSA dispersa0, dispersa1;
+    float y_dispersa[4], y_densa[4];
+
+    test_ann_printf("\n=== Test Sparse_ANN ===\n");
+
+    Init_ANN();
+    nsdsp_math_init();
+    srand(46);
+
+    dispersa0.inicio_fila = inicio0;
+    dispersa0.columna = columna0;
+    dispersa0.valores = valores0;
+    dispersa0.capacidad = 32 * 64;
+    dispersa1.inicio_fila = inicio1;
+    dispersa1.columna = columna1;
+    dispersa1.valores = valores1;
+    dispersa1.capacidad = 4 * 32;
+
+    umbral = 0.6f;
+    for (i = 0; i < 32 * 64; i++)
+    {
+        w0[i] = random_uniform_ann(0.8f);
+        w0_podada[i] = (fabsf(w0[i]) > umbral) ? w0[i] : 0.0f;
+    }
+    for (i = 0; i < 4 * 32; i++)
+    {
+        w1[i] = random_uniform_ann(0.8f);
+        w1_podada[i] = (fabsf(w1[i]) > umbral) ? w1[i] : 0.0f;
+    }
+    for (i = 0; i < 32; i++) b0[i] = random_uniform_ann(0.2f);
+    for (i = 0; i < 4; i++) b1[i] = random_uniform_ann(0.2f);
+    for (i = 0; i < 10 * 64; i++) x_test[i] = random_uniform_ann(1.0f);
+
+    for (l = 0; l < 2; l++)
+    {
+        capas[l].tipo = DENSE;
+        capas[l].conv = NULL;
+        capas[l].rnn = NULL;
+        capas_densas[l] = capas[l];
+    }
+    capas[0].pesos = &pesos0;
+    capas[0].bias = &bias0;
+    capas[1].pesos = &pesos1;
+    capas[1].bias = &bias1;
+    capas_densas[0].pesos = &pesos0_podada;
+    capas_densas[0].bias = &bias0;
+    capas_densas[1].pesos = &pesos1_podada;
+    capas_densas[1].bias = &bias1;
+
+    /* Test 1: capas podadas en CSR (bloques de 1 y 1x4) frente a la red DENSE con los pesos podados */
+    test_ann_printf("\nTest 1: Red SPARSE(64->32, bloque 1) + SPARSE(32->4, bloque 4) frente a la DENSE podada\n");
+
+    if (ann_api.sparse_layer(&capas[0], umbral, 1, &dispersa0) != ANN_OK ||
+        ann_api.sparse_layer(&capas[1], umbral, 4, &dispersa1) != ANN_OK ||
+        capas[0].tipo != SPARSE || capas[1].tipo != SPARSE)
+    {
+        test_ann_printf("ERROR: sparse_layer falló con una capa válida\n");
+        return TEST_KO;
+    }
+    test_ann_printf("  Capa 0: %u de %u pesos almacenados\n", dispersa0.bloques, 32 * 64);
+    test_ann_printf("  Capa 1: %u bloques 1x4 de %u\n", dispersa1.bloques, 4 * 32 / 4);
+
+    red_dispersa = ann_api.get_ann_layers(2, TANH, capas);
+    red_densa = ann_api.get_ann_layers(2, TANH, capas_densas);
+    if (red_dispersa.net.levels != 2 || red_dispersa.x0.filas != 64 || red_dispersa.y0.filas != 4 ||
+        red_densa.net.levels != 2)
+    {
+        test_ann_printf("ERROR: get_ann_layers no aceptó la red con capas SPARSE\n");
+        return TEST_KO;
+    }
+    red_dispersa.y0.pmatriz = y_dispersa;
+    red_densa.y0.pmatriz = y_densa;
+
+    error_max = 0.0f;
+    for (n = 0; n < 10; n++)
+    {
+        red_dispersa.x0.pmatriz = &x_test[64 * n];
+        red_densa.x0.pmatriz = &x_test[64 * n];
+        if (ann_api.iterate(&red_dispersa) != ANN_OK || ann_api.iterate(&red_densa) != ANN_OK)
+        {
+            test_ann_printf("ERROR: iterate falló en la muestra %u\n", n);
+            return TEST_KO;
+        }
+        for (i = 0; i < 4; i++)
+        {
+            error = fabsf(y_dispersa[i] - y_densa[i]);
+            error_max = (error > error_max) ? error : error_max;
+        }
+    }
+    test_ann_printf("  Error máximo en 10 muestras: %e\n", error_max);
+    if (error_max > 1e-5f)
+    {
+        test_ann_printf("ERROR: La red SPARSE no coincide con la DENSE podada\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: re-poda con umbral 0 desde los pesos densos conservados: coincide con la red original */
+    test_ann_printf("\nTest 2: Re-poda con umbral 0 frente a la red DENSE original\n");
+    capas_densas[0].pesos = &pesos0;
+    capas_densas[1].pesos = &pesos1;
+    if (ann_api.sparse_layer(&capas[0], 0.0f, 1, &dispersa0) != ANN_OK ||
+        ann_api.sparse_layer(&capas[1], 0.0f, 4, &dispersa1) != ANN_OK)
+    {
+        test_ann_printf("ERROR: sparse_layer no permitió volver a podar la capa\n");
+        return TEST_KO;
+    }
+
+    error_max = 0.0f;
+    for (n = 0; n < 10; n++)
+    {
+        red_dispersa.x0.pmatriz = &x_test[64 * n];
+        red_densa.x0.pmatriz = &x_test[64 * n];
+        ann_api.iterate(&red_dispersa);
+        ann_api.iterate(&red_densa);
+        for (i = 0; i < 4; i++)
+        {
+            error = fabsf(y_dispersa[i] - y_densa[i]);
+            error_max = (error > error_max) ? error : error_max;
+        }
+    }
+    test_ann_printf("  %u pesos almacenados, error máximo: %e\n", dispersa0.bloques, error_max);
+    if (error_max > 1e-5f)
+    {
+        test_ann_printf("ERROR: La red re-podada no coincide con la original\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: configuraciones inválidas; la capa no cambia si la conversión falla */
+    test_ann_printf("\nTest 3: Detección de configuraciones inválidas\n");
+    capas_densas[0].tipo = DENSE;
+    dispersa0.capacidad = 10;
+    if (ann_api.sparse_layer(&capas_densas[0], umbral, 1, &dispersa0) != ANN_KO ||
+        capas_densas[0].tipo != DENSE)
+    {
+        test_ann_printf("ERROR: Se aceptó una capacidad CSR insuficiente\n");
+        result = TEST_KO;
+    }
+    dispersa0.capacidad = 32 * 64;
+    if (ann_api.sparse_layer(&capas_densas[0], umbral, 0, &dispersa0) != ANN_KO ||
+        ann_api.sparse_layer(&capas_densas[0], umbral, 1, NULL) != ANN_KO ||
+        ann_api.sparse_layer(NULL, umbral, 1, &dispersa0) != ANN_KO)
+    {
+        test_ann_printf("ERROR: Se aceptaron parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    capas_densas[0].tipo = MAXPOOL1D;
+    if (ann_api.sparse_layer(&capas_densas[0], umbral, 1, &dispersa0) != ANN_KO)
+    {
+        test_ann_printf("ERROR: Se aceptó podar una capa que no es DENSE\n");
+        result = TEST_KO;
+    }
+    capas_densas[0].tipo = DENSE;
+
+    /* Capa SPARSE sin matriz dispersa: get_ann_layers la rechaza */
+    capas[0].dispersa = NULL;
+    red_dispersa = ann_api.get_ann_layers(2, TANH, capas);
+    if (red_dispersa.net.levels != 0)
+    {
+        test_ann_printf("ERROR: get_ann_layers aceptó una capa SPARSE sin pesos dispersos\n");
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_ann_printf("\nTest Sparse_ANN: PASSED\n");
+    else
+        test_ann_printf("\nTest Sparse_ANN: FAILED\n");
+
+    return result;
+}
+
+int Run_All_ANN_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    ann_test_log_file = fopen("ANN_Tests_Result.txt", "a");
+    if (ann_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de ANN\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_ann_printf("\n\n########################################\n");
+        test_ann_printf("# ANN (Artificial Neural Networks) Unit Tests\n");
+        test_ann_printf("# Fecha y hora: %s\n", time_string);
+        test_ann_printf("########################################\n");
+    }
+
+    test_ann_printf("\n========================================\n");
+    test_ann_printf("    EJECUTANDO TESTS ANN\n");
+    test_ann_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Get_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Iterate_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Trigger_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Quantized_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Model_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Train_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Conv1D_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Recurrent_ANN();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Sparse_ANN();
     if (test_result != TEST_OK) total_result = TEST_KO;
 
     test_ann_printf("\n========================================\n");
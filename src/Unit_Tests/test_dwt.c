@@ -62,6 +62,13 @@
  * - Muestras 512-767: Secuencia D1 (detalle nivel 1)
  * - Muestras 768-1023: Secuencia A0 (aproximación)
  *
+ * \subsection test_dwt_q15 Test_DWT_Q15
+ * Compara la DWT en coma fija Q15 con la DWT float sobre la misma señal (suma de senos y ruido con
+ * amplitud de pico 0.5, dentro del margen que dejan las ganancias de los filtros):
+ * - Ningún coeficiente del filtro configurado satura al cuantificar
+ * - SNR de cada salida (detalles y aproximación) frente a la float, superior a 60 dB
+ * - Tiempo por muestra de Dwt y Dwt_Q15
+ *
  * \author Dr. Carlos Romero
  *
  * \section historial_test_dwt Historial de cambios
@@ -70,6 +77,7 @@
  * | 01/09/2025 | Dr. Carlos Romero | 1 | Implementación inicial con test de inicialización |
  * | 02/09/2025 | Dr. Carlos Romero | 2 | Añadido test funcional con comparación CSV |
  * | 02/09/2025 | Dr. Carlos Romero | 3 | Corrección formato CSV para M=2 niveles |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Añadido test de SNR de la DWT en coma fija Q15 |
  *
  * \copyright ZGR R&D AIE
  */
@@ -92,6 +100,7 @@
 #define D2_LENGTH    512
 #define D1_LENGTH    256
 #define A0_LENGTH    256
+#define Q15_LENGTH   8192
 
 /* Variable global para el archivo de log */
 static FILE *dwt_test_log_file = NULL;
@@ -99,6 +108,7 @@ static FILE *dwt_test_log_file = NULL;
 /* Declaración de funciones de test */
 int Test_DWT_Initialization(void);
 int Test_DWT_Functional(void);
+int Test_DWT_Q15(void);
 int Run_All_DWT_Tests(void);
 
 /* Funciones auxiliares */
@@ -537,6 +547,111 @@ int Test_DWT_Functional(void)
     return result;
 }
 
+int Test_DWT_Q15(void)
+{
+    int result = TEST_OK;
+    static DWT_OBJECT dwt_obj;
+    static DWT_OBJECT_Q15 dwt_q15;
+    static float entrada[Q15_LENGTH];
+    static int16_t entrada_q[Q15_LENGTH];
+    double senal[WAVELET_LEVELS + 1];
+    double ruido[WAVELET_LEVELS + 1];
+    double snr, diferencia;
+    clock_t inicio;
+    double t_f, t_q;
+    int i, j;
+
+    test_dwt_printf("\n=== Test DWT Q15 ===\n");
+
+    Init_DWT();
+    dwt_api.get_dwt(&dwt_obj);
+    dwt_api.get_dwt_q15(&dwt_q15);
+
+    /* Test 1: cuantificación de los coeficientes del filtro configurado */
+    test_dwt_printf("\nTest 1: Cuantificación de los coeficientes\n");
+    for (j = 0; j < BUFFER_SIZE; j++)
+    {
+        test_dwt_printf("  LP[%d] = %+.8f -> %6d   HP[%d] = %+.8f -> %6d\n", j, dwt_obj.lp_coef[j],
+                        dwt_q15.lp_coef[j], j, dwt_obj.hp_coef[j], dwt_q15.hp_coef[j]);
+    }
+    if (dwt_q15.saturados != 0)
+    {
+        test_dwt_printf("ERROR: %u coeficientes saturados\n", dwt_q15.saturados);
+        result = TEST_KO;
+    }
+
+    /* Señal de prueba cuantificada; la DWT float recibe exactamente los mismos valores */
+    srand(49);
+    for (i = 0; i < Q15_LENGTH; i++)
+    {
+        entrada[i] = (float)(0.2 * sin(0.01 * i) + 0.15 * sin(0.9 * i) + 0.1 * sin(2.7 * i) +
+                             0.05 * ((double)rand() / RAND_MAX * 2.0 - 1.0));
+        entrada_q[i] = (int16_t)lrintf(entrada[i] * 32768.0f);
+        entrada[i] = entrada_q[i] / 32768.0f;
+    }
+
+    /* Test 2: SNR de cada salida frente a la DWT float */
+    test_dwt_printf("\nTest 2: SNR frente a la DWT float\n");
+    for (j = 0; j <= WAVELET_LEVELS; j++)
+    {
+        senal[j] = 0.0;
+        ruido[j] = 0.0;
+    }
+    for (i = 0; i < Q15_LENGTH; i++)
+    {
+        dwt_api.dwt(entrada[i], &dwt_obj);
+        dwt_api.dwt_q15(entrada_q[i], &dwt_q15);
+        for (j = 0; j <= WAVELET_LEVELS; j++)
+        {
+            diferencia = dwt_obj.yout[j] - dwt_q15.yout[j] / 32768.0;
+            senal[j] += (double)dwt_obj.yout[j] * dwt_obj.yout[j];
+            ruido[j] += diferencia * diferencia;
+        }
+    }
+    for (j = 0; j <= WAVELET_LEVELS; j++)
+    {
+        snr = (ruido[j] > 0.0) ? 10.0 * log10(senal[j] / ruido[j]) : 200.0;
+        if (j < WAVELET_LEVELS)
+            test_dwt_printf("  Detalle D%d: SNR %.1f dB\n", j + 1, snr);
+        else
+            test_dwt_printf("  Aproximación A%d: SNR %.1f dB\n", WAVELET_LEVELS, snr);
+        if (snr < 60.0)
+        {
+            test_dwt_printf("ERROR: SNR inferior a 60 dB\n");
+            result = TEST_KO;
+        }
+    }
+
+    /* Tiempo por muestra (informativo) */
+    inicio = clock();
+    for (j = 0; j < 20; j++)
+    {
+        for (i = 0; i < Q15_LENGTH; i++)
+        {
+            dwt_api.dwt(entrada[i], &dwt_obj);
+        }
+    }
+    t_f = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    inicio = clock();
+    for (j = 0; j < 20; j++)
+    {
+        for (i = 0; i < Q15_LENGTH; i++)
+        {
+            dwt_api.dwt_q15(entrada_q[i], &dwt_q15);
+        }
+    }
+    t_q = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    test_dwt_printf("\nTiempo por muestra: float %.1f ns, Q15 %.1f ns\n", t_f * 1e9 / (20.0 * Q15_LENGTH),
+                    t_q * 1e9 / (20.0 * Q15_LENGTH));
+
+    if (result == TEST_OK)
+        test_dwt_printf("Test DWT Q15: PASSED\n");
+    else
+        test_dwt_printf("Test DWT Q15: FAILED\n");
+
+    return result;
+}
+
 int Run_All_DWT_Tests(void)
 {
     int total_result = TEST_OK;
@@ -583,6 +698,9 @@ int Run_All_DWT_Tests(void)
     test_result = Test_DWT_Functional();
     if (test_result != TEST_OK) total_result = TEST_KO;
 
+    test_result = Test_DWT_Q15();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
     test_dwt_printf("\n========================================\n");
     if (total_result == TEST_OK)
         test_dwt_printf("TODOS LOS TESTS DWT PASARON CORRECTAMENTE\n");
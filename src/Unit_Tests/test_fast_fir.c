@@ -0,0 +1,665 @@
+/** \page test_fast_fir TEST UNITARIOS FAST FIR
+ * \brief Módulo de pruebas unitarias para el filtrado FIR por convolución rápida
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo FAST_FIR. Las pruebas validan la selección automática del
+ * algoritmo, la exactitud del overlap-save con una y varias particiones frente a una
+ * convolución directa en doble precisión, y miden el punto de cruce entre la forma directa y
+ * la convolución rápida. Los tests solo se compilan y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_fast_fir Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en FAST_FIR_Tests_Result.txt
+ *
+ * \section funciones_test_fast_fir Descripción de funciones
+ *
+ * \subsection test_exactitud_fast_fir Test_Exactitud_Fast_Fir
+ * Verifica el filtrado:
+ * - Forma directa por debajo del umbral idéntica a fir_api.fir_filter
+ * - Overlap-save con 2048 y 16384 coeficientes, con una y con varias particiones, frente a la
+ *   convolución directa en doble precisión retrasada la latencia del objeto
+ * - Bloques de tamaño variable in-place idénticos al filtrado muestra a muestra
+ * - Detección de parámetros inválidos
+ *
+ * \subsection test_nupc_fast_fir Test_NUPC_Fast_Fir
+ * Verifica la convolución particionada no uniforme:
+ * - 16384 coeficientes (cabeza 32, B_max 2048) y 5000 coeficientes (cabeza 64, B_max 4096) sin
+ *   latencia frente a la convolución directa en doble precisión
+ * - Bloques de tamaño variable in-place idénticos al filtrado muestra a muestra
+ * - Coste por muestra frente al overlap-save y a la forma directa, y coste de la peor muestra
+ * - Forma directa cuando el filtro cabe en la cabeza y detección de parámetros inválidos
+ *
+ * \subsection test_benchmark_fast_fir Test_Benchmark_Fast_Fir
+ * Mide el coste por muestra de la forma directa y del overlap-save (B = N, una partición)
+ * para N = 8 .. 16384 coeficientes y localiza el punto de cruce. Por encima de
+ * MAX_FIR_LENGTH el coste de la forma directa se extrapola linealmente; por debajo de
+ * FAST_FIR_UMBRAL el overlap-save se mide con el menor bloque que supera el umbral.
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_fast_fir Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Añadido test de la convolución particionada no uniforme |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Coste de la peor muestra de la convolución no uniforme |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "fast_fir.h"
+#include "test_fast_fir.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_MAX_FAST_FIR      16384
+#define L_FAST_FIR_TEST     (3 * N_MAX_FAST_FIR)
+#define PASO_REF_FAST_FIR   5           /* Se compara una de cada PASO_REF_FAST_FIR salidas */
+#define POOL_PLANES_NUPC    16384       /* Elementos de las tablas de los planes de las etapas NUPC */
+
+/* Variable global para el archivo de log */
+static FILE *fast_fir_test_log_file = NULL;
+
+/* Buffers de test */
+static COMPLEJO twiddle_fast_fir_test[RFFT_TWIDDLE_SIZE(2 * N_MAX_FAST_FIR)];
+static unsigned int bitrev_fast_fir_test[RFFT_BITREV_SIZE(2 * N_MAX_FAST_FIR)];
+static float workspace_fast_fir_test[FAST_FIR_WORKSPACE(N_MAX_FAST_FIR, N_MAX_FAST_FIR)];
+static float coef_fast_fir_test[N_MAX_FAST_FIR];
+static float senal_fast_fir_test[L_FAST_FIR_TEST];
+static float salida_fast_fir_test[L_FAST_FIR_TEST];
+static float salida_muestra_test[L_FAST_FIR_TEST];
+static float z_fast_fir_test[MAX_FIR_LENGTH];
+static COMPLEJO twiddle_nupc_test[POOL_PLANES_NUPC];
+static unsigned int bitrev_nupc_test[POOL_PLANES_NUPC];
+static RFFT_PLAN planes_nupc_test[FAST_FIR_MAX_ETAPAS];
+
+/* Declaración de funciones de test */
+int Test_Exactitud_Fast_Fir(void);
+int Test_NUPC_Fast_Fir(void);
+int Test_Benchmark_Fast_Fir(void);
+int Run_All_Fast_Fir_Tests(void);
+
+/* Funciones auxiliares */
+void test_fast_fir_printf(const char *format, ...);
+int planes_nupc_fast_fir(unsigned int cabeza, unsigned int bloque_max);
+double error_referencia_fast_fir(const float *y, unsigned int ncoef, unsigned int latencia, unsigned int nmuestras);
+
+/* Definición de funciones */
+
+void test_fast_fir_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (fast_fir_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(fast_fir_test_log_file, format, args);
+        va_end(args);
+        fflush(fast_fir_test_log_file);
+    }
+}
+
+double error_referencia_fast_fir(const float *y, unsigned int ncoef, unsigned int latencia, unsigned int nmuestras)
+{
+    unsigned int n, m;
+    double ref, error, error_max, escala;
+
+    /* Error máximo relativo a la salida de mayor amplitud, frente a la convolución en doble */
+    error_max = 0.0;
+    escala = 0.0;
+    for (n = latencia; n < nmuestras; n += PASO_REF_FAST_FIR)
+    {
+        ref = 0.0;
+        for (m = 0; m < ncoef && m <= n - latencia; m++)
+        {
+            ref += (double)coef_fast_fir_test[m] * senal_fast_fir_test[n - latencia - m];
+        }
+
+        error = fabs((double)y[n] - ref);
+        if (error > error_max)
+        {
+            error_max = error;
+        }
+        if (fabs(ref) > escala)
+        {
+            escala = fabs(ref);
+        }
+    }
+
+    return error_max / escala;
+}
+
+int planes_nupc_fast_fir(unsigned int cabeza, unsigned int bloque_max)
+{
+    unsigned int e, bloque, p_twiddle, p_bitrev;
+
+    /* Un plan de 2B puntos por etapa, repartidos sobre las tablas comunes */
+    p_twiddle = 0;
+    p_bitrev = 0;
+    for (e = 0, bloque = cabeza; bloque <= bloque_max; e++, bloque *= 2)
+    {
+        if (p_twiddle + RFFT_TWIDDLE_SIZE(2 * bloque) > POOL_PLANES_NUPC ||
+            p_bitrev + RFFT_BITREV_SIZE(2 * bloque) > POOL_PLANES_NUPC ||
+            fft_api.get_rplan(2 * bloque, &twiddle_nupc_test[p_twiddle], &bitrev_nupc_test[p_bitrev],
+                              &planes_nupc_test[e]) != FFT_OK)
+        {
+            return TEST_KO;
+        }
+        p_twiddle += RFFT_TWIDDLE_SIZE(2 * bloque);
+        p_bitrev += RFFT_BITREV_SIZE(2 * bloque);
+    }
+
+    /* Las etapas de bloque_max siguientes reutilizan su plan */
+    for (; e < FAST_FIR_MAX_ETAPAS; e++)
+    {
+        planes_nupc_test[e] = planes_nupc_test[e - 1];
+    }
+
+    return TEST_OK;
+}
+
+int Test_Exactitud_Fast_Fir(void)
+{
+    int result = TEST_OK;
+    unsigned int i, t, posicion, bloque;
+    RFFT_PLAN plan;
+    FAST_FIR_OBJECT obj;
+    FIR_FILTER_OBJECT fir;
+    double error;
+    float diferencia;
+    const unsigned int ncoef[4] = {2048, 2048, 16384, 16384};
+    const unsigned int bloques[4] = {2048, 256, 16384, 1024};
+
+    test_fast_fir_printf("\n=== Test Exactitud_Fast_Fir ===\n");
+
+    Init_Fir();
+    Init_FFT();
+    Init_Fast_Fir();
+    srand(35);
+
+    for (i = 0; i < L_FAST_FIR_TEST; i++)
+    {
+        senal_fast_fir_test[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+    }
+
+    /* Test 1: forma directa por debajo del umbral */
+    test_fast_fir_printf("\nTest 1: Forma directa con %u coeficientes\n", FAST_FIR_UMBRAL);
+
+    for (i = 0; i < FAST_FIR_UMBRAL; i++)
+    {
+        coef_fast_fir_test[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+    }
+
+    if (fast_fir_api.get_fir(FAST_FIR_UMBRAL, coef_fast_fir_test, 0, NULL, workspace_fast_fir_test, &obj) != FAST_FIR_OK)
+    {
+        test_fast_fir_printf("ERROR: get_fir falló en forma directa\n");
+        return TEST_KO;
+    }
+    fir = fir_api.get_fir(FAST_FIR_UMBRAL, coef_fast_fir_test, z_fast_fir_test);
+
+    diferencia = 0.0f;
+    for (i = 0; i < 4096; i++)
+    {
+        diferencia = fmaxf(diferencia, fabsf(fast_fir_api.fir_filter(senal_fast_fir_test[i], &obj) -
+                                             fir_api.fir_filter(senal_fast_fir_test[i], &fir)));
+    }
+
+    test_fast_fir_printf("Modo %s, latencia %u, diferencia con fir_filter: %.2e\n",
+                         obj.modo == FAST_FIR_DIRECTO ? "directo" : "overlap-save", obj.latencia, diferencia);
+    if (obj.modo != FAST_FIR_DIRECTO || obj.latencia != 0 || diferencia != 0.0f)
+    {
+        test_fast_fir_printf("ERROR: La forma directa no coincide con fir_filter\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: overlap-save frente a la convolución directa */
+    test_fast_fir_printf("\nTest 2: Overlap-save frente a la convolución en doble precisión\n");
+
+    for (t = 0; t < 4; t++)
+    {
+        /* Respuesta de sala sintética: ruido con decaimiento exponencial */
+        for (i = 0; i < ncoef[t]; i++)
+        {
+            coef_fast_fir_test[i] = (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f) *
+                                    (float)exp(-4.0 * (double)i / ncoef[t]);
+        }
+
+        fft_api.get_rplan(2 * bloques[t], twiddle_fast_fir_test, bitrev_fast_fir_test, &plan);
+        if (fast_fir_api.get_fir(ncoef[t], coef_fast_fir_test, bloques[t], &plan, workspace_fast_fir_test,
+                                 &obj) != FAST_FIR_OK)
+        {
+            test_fast_fir_printf("ERROR: get_fir falló con N = %u, B = %u\n", ncoef[t], bloques[t]);
+            result = TEST_KO;
+            continue;
+        }
+
+        /* Bloques de tamaño variable, in-place */
+        posicion = 0;
+        while (posicion < L_FAST_FIR_TEST)
+        {
+            bloque = 1 + (unsigned int)rand() % 3000;
+            if (bloque > L_FAST_FIR_TEST - posicion)
+            {
+                bloque = L_FAST_FIR_TEST - posicion;
+            }
+            for (i = 0; i < bloque; i++)
+            {
+                salida_fast_fir_test[posicion + i] = senal_fast_fir_test[posicion + i];
+            }
+            fast_fir_api.fir_bloque(&salida_fast_fir_test[posicion], &salida_fast_fir_test[posicion], bloque, &obj);
+            posicion += bloque;
+        }
+
+        error = error_referencia_fast_fir(salida_fast_fir_test, ncoef[t], obj.latencia, L_FAST_FIR_TEST);
+
+        /* Muestra a muestra con un objeto nuevo */
+        fast_fir_api.get_fir(ncoef[t], coef_fast_fir_test, bloques[t], &plan, workspace_fast_fir_test, &obj);
+        diferencia = 0.0f;
+        for (i = 0; i < L_FAST_FIR_TEST; i++)
+        {
+            salida_muestra_test[i] = fast_fir_api.fir_filter(senal_fast_fir_test[i], &obj);
+            diferencia = fmaxf(diferencia, fabsf(salida_muestra_test[i] - salida_fast_fir_test[i]));
+        }
+
+        test_fast_fir_printf("N = %5u, B = %5u, K = %2u: latencia %5u, error relativo %.2e, bloques vs muestras %.2e\n",
+                             ncoef[t], bloques[t], obj.etapas[0].particiones, obj.latencia, error, diferencia);
+        if (obj.modo != FAST_FIR_OLS || obj.latencia != bloques[t] || error > 1e-5 || diferencia != 0.0f)
+        {
+            test_fast_fir_printf("ERROR: El overlap-save no coincide con la convolución directa\n");
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: parámetros inválidos */
+    test_fast_fir_printf("\nTest 3: Parámetros inválidos\n");
+
+    fft_api.get_rplan(512, twiddle_fast_fir_test, bitrev_fast_fir_test, &plan);
+    if (fast_fir_api.get_fir(0, coef_fast_fir_test, 256, &plan, workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.get_fir(1000, coef_fast_fir_test, 128, &plan, workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.get_fir(1000, coef_fast_fir_test, 256, NULL, workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.get_fir(1000, NULL, 256, &plan, workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.fir_bloque(NULL, salida_fast_fir_test, 10, &obj) != FAST_FIR_KO ||
+        fast_fir_api.fir_filter(1.0f, NULL) != 0.0f)
+    {
+        test_fast_fir_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_fast_fir_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_fast_fir_printf("\nTest Exactitud_Fast_Fir: PASSED\n");
+    else
+        test_fast_fir_printf("\nTest Exactitud_Fast_Fir: FAILED\n");
+
+    return result;
+}
+
+int Test_NUPC_Fast_Fir(void)
+{
+    int result = TEST_OK;
+    unsigned int i, t, posicion, bloque;
+    RFFT_PLAN plan;
+    FAST_FIR_OBJECT obj;
+    clock_t inicio, fin;
+    double error, t_nupc, t_ols, t_directo, t_peor;
+    float diferencia;
+    const unsigned int ncoef[2] = {16384, 5000};
+    const unsigned int cabezas[2] = {32, 64};
+    const unsigned int maximos[2] = {2048, 4096};
+    const unsigned int etapas[2] = {7, 7};
+
+    test_fast_fir_printf("\n=== Test NUPC_Fast_Fir ===\n");
+
+    Init_Fir();
+    Init_FFT();
+    Init_Fast_Fir();
+    srand(36);
+
+    for (i = 0; i < L_FAST_FIR_TEST; i++)
+    {
+        senal_fast_fir_test[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+    }
+
+    /* Test 1: latencia nula frente a la convolución directa */
+    test_fast_fir_printf("\nTest 1: Convolución no uniforme frente a la convolución en doble precisión\n");
+
+    for (t = 0; t < 2; t++)
+    {
+        for (i = 0; i < ncoef[t]; i++)
+        {
+            coef_fast_fir_test[i] = (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f) *
+                                    (float)exp(-4.0 * (double)i / ncoef[t]);
+        }
+
+        if (planes_nupc_fast_fir(cabezas[t], maximos[t]) != TEST_OK ||
+            fast_fir_api.get_fir_nupc(ncoef[t], coef_fast_fir_test, cabezas[t], maximos[t], planes_nupc_test,
+                                      workspace_fast_fir_test, &obj) != FAST_FIR_OK)
+        {
+            test_fast_fir_printf("ERROR: get_fir_nupc falló con N = %u\n", ncoef[t]);
+            result = TEST_KO;
+            continue;
+        }
+
+        for (i = 0; i < L_FAST_FIR_TEST; i++)
+        {
+            salida_muestra_test[i] = fast_fir_api.fir_filter(senal_fast_fir_test[i], &obj);
+        }
+        error = error_referencia_fast_fir(salida_muestra_test, ncoef[t], 0, L_FAST_FIR_TEST);
+
+        /* Bloques de tamaño variable, in-place, con un objeto nuevo */
+        fast_fir_api.get_fir_nupc(ncoef[t], coef_fast_fir_test, cabezas[t], maximos[t], planes_nupc_test,
+                                  workspace_fast_fir_test, &obj);
+        posicion = 0;
+        while (posicion < L_FAST_FIR_TEST)
+        {
+            bloque = 1 + (unsigned int)rand() % 3000;
+            if (bloque > L_FAST_FIR_TEST - posicion)
+            {
+                bloque = L_FAST_FIR_TEST - posicion;
+            }
+            for (i = 0; i < bloque; i++)
+            {
+                salida_fast_fir_test[posicion + i] = senal_fast_fir_test[posicion + i];
+            }
+            fast_fir_api.fir_bloque(&salida_fast_fir_test[posicion], &salida_fast_fir_test[posicion], bloque, &obj);
+            posicion += bloque;
+        }
+
+        diferencia = 0.0f;
+        for (i = 0; i < L_FAST_FIR_TEST; i++)
+        {
+            diferencia = fmaxf(diferencia, fabsf(salida_muestra_test[i] - salida_fast_fir_test[i]));
+        }
+
+        test_fast_fir_printf("N = %5u, cabeza %2u, B_max %4u: %u etapas, latencia %u, error relativo %.2e, "
+                             "bloques vs muestras %.2e\n", ncoef[t], cabezas[t], maximos[t], obj.netapas,
+                             obj.latencia, error, diferencia);
+        if (obj.modo != FAST_FIR_NUPC || obj.netapas != etapas[t] || obj.latencia != 0 || error > 1e-5 ||
+            diferencia != 0.0f)
+        {
+            test_fast_fir_printf("ERROR: La convolución no uniforme no coincide con la convolución directa\n");
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 2: coste por muestra con 16384 coeficientes */
+    test_fast_fir_printf("\nTest 2: Coste por muestra con %u coeficientes\n", N_MAX_FAST_FIR);
+
+    planes_nupc_fast_fir(32, 2048);
+    fast_fir_api.get_fir_nupc(N_MAX_FAST_FIR, coef_fast_fir_test, 32, 2048, planes_nupc_test,
+                              workspace_fast_fir_test, &obj);
+    inicio = clock();
+    fast_fir_api.fir_bloque(senal_fast_fir_test, salida_fast_fir_test, L_FAST_FIR_TEST, &obj);
+    fin = clock();
+    t_nupc = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_FAST_FIR_TEST;
+
+    /* Peor muestra: la que completa el bloque de todas las etapas (una de cada B_max), en media */
+    fast_fir_api.get_fir_nupc(N_MAX_FAST_FIR, coef_fast_fir_test, 32, 2048, planes_nupc_test,
+                              workspace_fast_fir_test, &obj);
+    t_peor = 0.0;
+    for (i = 0; i < L_FAST_FIR_TEST; i++)
+    {
+        if ((i + 1) % 2048 != 0)
+        {
+            salida_fast_fir_test[i] = fast_fir_api.fir_filter(senal_fast_fir_test[i], &obj);
+            continue;
+        }
+        inicio = clock();
+        salida_fast_fir_test[i] = fast_fir_api.fir_filter(senal_fast_fir_test[i], &obj);
+        fin = clock();
+        t_peor += 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)(L_FAST_FIR_TEST / 2048);
+    }
+
+    fft_api.get_rplan(2 * N_MAX_FAST_FIR, twiddle_fast_fir_test, bitrev_fast_fir_test, &plan);
+    fast_fir_api.get_fir(N_MAX_FAST_FIR, coef_fast_fir_test, N_MAX_FAST_FIR, &plan, workspace_fast_fir_test, &obj);
+    inicio = clock();
+    fast_fir_api.fir_bloque(senal_fast_fir_test, salida_fast_fir_test, L_FAST_FIR_TEST, &obj);
+    fin = clock();
+    t_ols = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_FAST_FIR_TEST;
+
+    /* Forma directa extrapolada desde MAX_FIR_LENGTH coeficientes */
+    obj.directo = fir_api.get_fir(MAX_FIR_LENGTH, coef_fast_fir_test, z_fast_fir_test);
+    inicio = clock();
+    for (i = 0; i < L_FAST_FIR_TEST; i++)
+    {
+        salida_fast_fir_test[i] = fir_api.fir_filter(senal_fast_fir_test[i], &obj.directo);
+    }
+    fin = clock();
+    t_directo = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_FAST_FIR_TEST *
+                (double)N_MAX_FAST_FIR / MAX_FIR_LENGTH;
+
+    test_fast_fir_printf("NUPC (latencia 0): %.1f ns/muestra, overlap-save (latencia %u): %.1f ns/muestra, "
+                         "directo (extrapolado): %.1f ns/muestra\n", t_nupc, N_MAX_FAST_FIR, t_ols, t_directo);
+    test_fast_fir_printf("NUPC peor muestra (todas las etapas, cada 2048 muestras): %.1f us, %.0f veces la media\n",
+                         t_peor / 1000.0, t_peor / t_nupc);
+    if (!(t_nupc * 10.0 < t_directo))
+    {
+        test_fast_fir_printf("ERROR: La convolución no uniforme no es un orden de magnitud más rápida que la directa\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: filtro dentro de la cabeza y parámetros inválidos */
+    test_fast_fir_printf("\nTest 3: Forma directa y parámetros inválidos\n");
+
+    if (fast_fir_api.get_fir_nupc(20, coef_fast_fir_test, 32, 2048, NULL, workspace_fast_fir_test,
+                                  &obj) != FAST_FIR_OK || obj.modo != FAST_FIR_DIRECTO || obj.latencia != 0)
+    {
+        test_fast_fir_printf("ERROR: Un filtro dentro de la cabeza no usa la forma directa\n");
+        result = TEST_KO;
+    }
+
+    if (fast_fir_api.get_fir_nupc(1000, coef_fast_fir_test, 48, 2048, planes_nupc_test,
+                                  workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.get_fir_nupc(1000, coef_fast_fir_test, 2 * MAX_FIR_LENGTH, 2048, planes_nupc_test,
+                                  workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.get_fir_nupc(1000, coef_fast_fir_test, 32, 16, planes_nupc_test,
+                                  workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.get_fir_nupc(1000, coef_fast_fir_test, 32, 2048, NULL,
+                                  workspace_fast_fir_test, &obj) != FAST_FIR_KO ||
+        fast_fir_api.get_fir_nupc(1000, coef_fast_fir_test, 64, 2048, planes_nupc_test,
+                                  workspace_fast_fir_test, &obj) != FAST_FIR_KO)
+    {
+        test_fast_fir_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_fast_fir_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_fast_fir_printf("\nTest NUPC_Fast_Fir: PASSED\n");
+    else
+        test_fast_fir_printf("\nTest NUPC_Fast_Fir: FAILED\n");
+
+    return result;
+}
+
+int Test_Benchmark_Fast_Fir(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n, bloque, cruce, nmuestras, ncoef_rapido;
+    RFFT_PLAN plan;
+    FAST_FIR_OBJECT obj;
+    FIR_FILTER_OBJECT fir;
+    clock_t inicio, fin;
+    double t_directo, t_rapido, t_ref;
+    volatile float sumidero;
+
+    test_fast_fir_printf("\n=== Test Benchmark_Fast_Fir ===\n");
+
+    Init_Fir();
+    Init_FFT();
+    Init_Fast_Fir();
+
+    for (i = 0; i < N_MAX_FAST_FIR; i++)
+    {
+        coef_fast_fir_test[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+    }
+
+    test_fast_fir_printf("\n%8s %8s %16s %16s\n", "N", "B", "directo (ns/m)", "rapido (ns/m)");
+
+    cruce = 0;
+    t_ref = 0.0;
+    for (n = 8; n <= N_MAX_FAST_FIR; n *= 2)
+    {
+        nmuestras = L_FAST_FIR_TEST;
+
+        /* Forma directa: medida hasta MAX_FIR_LENGTH, extrapolada por encima */
+        if (n <= MAX_FIR_LENGTH)
+        {
+            fir = fir_api.get_fir(n, coef_fast_fir_test, z_fast_fir_test);
+            sumidero = 0.0f;
+            inicio = clock();
+            for (i = 0; i < nmuestras; i++)
+            {
+                sumidero += fir_api.fir_filter(senal_fast_fir_test[i], &fir);
+            }
+            fin = clock();
+            t_directo = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)nmuestras;
+            t_ref = t_directo / (double)n;
+        }
+        else
+        {
+            t_directo = t_ref * (double)n;
+        }
+
+        /* Overlap-save con una partición (B = N). Por debajo del umbral get_fir elige la forma
+         * directa, así que se mide el bloque más pequeño que la supera: con K = 1 el coste
+         * depende solo de B */
+        ncoef_rapido = n;
+        bloque = n;
+        if (ncoef_rapido <= FAST_FIR_UMBRAL)
+        {
+            ncoef_rapido = FAST_FIR_UMBRAL + 1;
+            while (bloque < ncoef_rapido)
+            {
+                bloque *= 2;
+            }
+        }
+        fft_api.get_rplan(2 * bloque, twiddle_fast_fir_test, bitrev_fast_fir_test, &plan);
+        if (fast_fir_api.get_fir(ncoef_rapido, coef_fast_fir_test, bloque, &plan, workspace_fast_fir_test,
+                                 &obj) != FAST_FIR_OK)
+        {
+            test_fast_fir_printf("ERROR: get_fir falló con N = %u, B = %u\n", ncoef_rapido, bloque);
+            return TEST_KO;
+        }
+
+        inicio = clock();
+        fast_fir_api.fir_bloque(senal_fast_fir_test, salida_fast_fir_test, nmuestras, &obj);
+        fin = clock();
+        t_rapido = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)nmuestras;
+
+        test_fast_fir_printf("%8u %8u %16.1f %16.1f%s\n", n, bloque, t_directo, t_rapido,
+                             n > MAX_FIR_LENGTH ? "  (directo extrapolado)" : "");
+
+        if (cruce == 0 && t_rapido < t_directo)
+        {
+            cruce = n;
+        }
+        if (n == N_MAX_FAST_FIR && !(t_rapido * 10.0 < t_directo))
+        {
+            test_fast_fir_printf("ERROR: El overlap-save no es un orden de magnitud más rápido con %u coeficientes\n", n);
+            result = TEST_KO;
+        }
+    }
+
+    test_fast_fir_printf("\nPrimer N con convolución rápida más barata: %u (FAST_FIR_UMBRAL = %u)\n",
+                         cruce, FAST_FIR_UMBRAL);
+
+    if (result == TEST_OK)
+        test_fast_fir_printf("\nTest Benchmark_Fast_Fir: PASSED\n");
+    else
+        test_fast_fir_printf("\nTest Benchmark_Fast_Fir: FAILED\n");
+
+    return result;
+}
+
+int Run_All_Fast_Fir_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    fast_fir_test_log_file = fopen("FAST_FIR_Tests_Result.txt", "a");
+    if (fast_fir_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de FAST_FIR\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_fast_fir_printf("\n\n########################################\n");
+        test_fast_fir_printf("# FAST_FIR Unit Tests\n");
+        test_fast_fir_printf("# Fecha y hora: %s\n", time_string);
+        test_fast_fir_printf("########################################\n");
+    }
+
+    test_fast_fir_printf("\n========================================\n");
+    test_fast_fir_printf("    EJECUTANDO TESTS FAST_FIR\n");
+    test_fast_fir_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Exactitud_Fast_Fir();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_NUPC_Fast_Fir();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Benchmark_Fast_Fir();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_fast_fir_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_fast_fir_printf("TODOS LOS TESTS FAST_FIR PASARON CORRECTAMENTE\n");
+    else
+        test_fast_fir_printf("ALGUNOS TESTS FAST_FIR FALLARON\n");
+    test_fast_fir_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (fast_fir_test_log_file != NULL)
+    {
+        test_fast_fir_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_fast_fir_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_fast_fir_printf("FAILURE - Algunos tests fallaron\n");
+        test_fast_fir_printf("########################################\n\n");
+
+        fclose(fast_fir_test_log_file);
+        fast_fir_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,462 @@
+/** \page test_fdaf TEST UNITARIOS FDAF
+ * \brief Módulo de pruebas unitarias para el filtro adaptativo en frecuencia
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo FDAF. Las pruebas comparan la convergencia del PBFDAF con la del
+ * NLMS en el tiempo del módulo LMS_Filter en un problema de identificación de sistemas, con
+ * entrada blanca y coloreada, y miden el coste por muestra de ambos. Los tests solo se
+ * compilan y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_fdaf Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en FDAF_Tests_Result.txt
+ *
+ * \section funciones_test_fdaf Descripción de funciones
+ *
+ * \subsection test_interfaz_fdaf Test_Interfaz_FDAF
+ * Verifica la interfaz:
+ * - Salida del filtro con coeficientes fijos igual a la convolución directa retrasada B muestras
+ * - Modo por bloques de cualquier tamaño idéntico al modo muestra a muestra
+ * - Rechazo de parámetros inválidos
+ *
+ * \subsection test_convergencia_fdaf Test_Convergencia_FDAF
+ * Identificación de un camino de 512 coeficientes con K = 4 particiones:
+ * - Entrada blanca: curva de desajuste comparable a la del NLMS con paso μ/2
+ * - Entrada coloreada AR(1): la normalización por bin converge más rápido que el NLMS
+ * - Coste por muestra frente al NLMS para 2048 coeficientes
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_fdaf Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "fdaf.h"
+#include "lms_filter.h"
+#include "test_fdaf.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_FDAF_TEST         512
+#define B_FDAF_TEST         128
+#define L_FDAF_TEST         (64 * 1024)
+#define TRAMO_FDAF_TEST     4096
+#define N_COSTE_FDAF        2048
+#define B_COSTE_FDAF        256
+
+/* Variable global para el archivo de log */
+static FILE *fdaf_test_log_file = NULL;
+
+/* Buffers de test */
+static float x_fdaf_test[L_FDAF_TEST];
+static float d_fdaf_test[L_FDAF_TEST];
+static float e_fdaf_test[L_FDAF_TEST];
+static float h_fdaf_test[N_COSTE_FDAF];
+static float w_fdaf_test[N_COSTE_FDAF];
+static float z_fdaf_test[LMS_RETARDO(N_COSTE_FDAF)];
+static float workspace_fdaf_test[FDAF_WORKSPACE(N_COSTE_FDAF, B_COSTE_FDAF)];
+static float workspace2_fdaf_test[FDAF_WORKSPACE(N_FDAF_TEST, B_FDAF_TEST)];
+static COMPLEJO twiddle_fdaf_test[RFFT_TWIDDLE_SIZE(2 * B_COSTE_FDAF)];
+static unsigned int bitrev_fdaf_test[RFFT_BITREV_SIZE(2 * B_COSTE_FDAF)];
+static COMPLEJO twiddle2_fdaf_test[RFFT_TWIDDLE_SIZE(2 * B_FDAF_TEST)];
+static unsigned int bitrev2_fdaf_test[RFFT_BITREV_SIZE(2 * B_FDAF_TEST)];
+
+/* Declaración de funciones de test */
+int Test_Interfaz_FDAF(void);
+int Test_Convergencia_FDAF(void);
+int Run_All_FDAF_Tests(void);
+
+/* Funciones auxiliares */
+void test_fdaf_printf(const char *format, ...);
+void senal_fdaf(float coloreado, unsigned int ncoef);
+double desajuste_fdaf(const float *w, unsigned int ncoef);
+
+/* Definición de funciones */
+
+void test_fdaf_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (fdaf_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(fdaf_test_log_file, format, args);
+        va_end(args);
+        fflush(fdaf_test_log_file);
+    }
+}
+
+void senal_fdaf(float coloreado, unsigned int ncoef)
+{
+    unsigned int i, k;
+    float anterior, ruido;
+
+    /* Entrada AR(1) de varianza unidad y camino con decaimiento exponencial y signos aleatorios */
+    anterior = 0.0f;
+    for (i = 0; i < L_FDAF_TEST; i++)
+    {
+        ruido = 1.7320508f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+        anterior = coloreado * anterior + sqrtf(1.0f - coloreado * coloreado) * ruido;
+        x_fdaf_test[i] = anterior;
+    }
+
+    for (k = 0; k < ncoef; k++)
+    {
+        h_fdaf_test[k] = (float)exp(-4.0 * k / ncoef) * (((rand() & 1) != 0) ? 0.3f : -0.3f);
+    }
+
+    for (i = 0; i < L_FDAF_TEST; i++)
+    {
+        d_fdaf_test[i] = 1e-3f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+        for (k = 0; k < ncoef && k <= i; k++)
+        {
+            d_fdaf_test[i] += h_fdaf_test[k] * x_fdaf_test[i - k];
+        }
+    }
+}
+
+double desajuste_fdaf(const float *w, unsigned int ncoef)
+{
+    unsigned int k;
+    double error, norma;
+
+    error = 0.0;
+    norma = 0.0;
+    for (k = 0; k < ncoef; k++)
+    {
+        error += ((double)w[k] - h_fdaf_test[k]) * ((double)w[k] - h_fdaf_test[k]);
+        norma += (double)h_fdaf_test[k] * h_fdaf_test[k];
+    }
+
+    return 10.0 * log10(error / norma);
+}
+
+int Test_Interfaz_FDAF(void)
+{
+    int result = TEST_OK;
+    unsigned int i, k, posicion, bloque;
+    RFFT_PLAN plan;
+    FDAF_OBJECT fdaf, bloques;
+    float y, referencia, diferencia;
+    static float ws_bloques[FDAF_WORKSPACE(N_FDAF_TEST, B_FDAF_TEST)];
+
+    test_fdaf_printf("\n=== Test Interfaz_FDAF ===\n");
+
+    Init_FFT();
+    Init_FDAF();
+    srand(39);
+
+    fft_api.get_rplan(2 * B_FDAF_TEST, twiddle2_fdaf_test, bitrev2_fdaf_test, &plan);
+    senal_fdaf(0.0f, N_FDAF_TEST);
+
+    /* Test 1: filtrado con los coeficientes del camino (sin adaptación visible: mu mínimo) */
+    test_fdaf_printf("\nTest 1: Salida con coeficientes fijos frente a la convolución directa\n");
+
+    if (fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 1e-30f, 0.9f, 1.0f, workspace2_fdaf_test, &fdaf) != FDAF_OK)
+    {
+        test_fdaf_printf("ERROR: get_fdaf falló con parámetros válidos\n");
+        return TEST_KO;
+    }
+
+    /* Espectros de las particiones del camino */
+    for (k = 0; k < fdaf.particiones; k++)
+    {
+        for (i = 0; i < 2 * B_FDAF_TEST; i++)
+        {
+            ((float *)&fdaf.W[k * B_FDAF_TEST])[i] = (i < B_FDAF_TEST) ? h_fdaf_test[k * B_FDAF_TEST + i] : 0.0f;
+        }
+        fft_api.rfft(&plan, (float *)&fdaf.W[k * B_FDAF_TEST], &fdaf.W[k * B_FDAF_TEST]);
+    }
+
+    diferencia = 0.0f;
+    for (i = 0; i < 4 * N_FDAF_TEST; i++)
+    {
+        y = fdaf_api.fdaf_filter(x_fdaf_test[i], d_fdaf_test[i], &fdaf);
+
+        referencia = 0.0f;
+        for (k = 0; k < N_FDAF_TEST && i >= B_FDAF_TEST && k <= i - B_FDAF_TEST; k++)
+        {
+            referencia += h_fdaf_test[k] * x_fdaf_test[i - B_FDAF_TEST - k];
+        }
+        diferencia = fmaxf(diferencia, fabsf(y - referencia));
+    }
+
+    test_fdaf_printf("Diferencia máxima: %.2e (latencia %u)\n", diferencia, fdaf.latencia);
+    if (diferencia > 1e-4f)
+    {
+        test_fdaf_printf("ERROR: La salida no es la convolución retrasada B muestras\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: bloques de tamaño variable */
+    test_fdaf_printf("\nTest 2: Modo por bloques frente a muestra a muestra\n");
+
+    fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 0.5f, 0.9f, 1e-3f, workspace2_fdaf_test, &fdaf);
+    fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 0.5f, 0.9f, 1e-3f, ws_bloques, &bloques);
+
+    for (i = 0; i < 8 * N_FDAF_TEST; i++)
+    {
+        fdaf_api.fdaf_filter(x_fdaf_test[i], d_fdaf_test[i], &fdaf);
+        e_fdaf_test[i] = fdaf.error;
+    }
+
+    diferencia = 0.0f;
+    posicion = 0;
+    while (posicion < 8 * N_FDAF_TEST)
+    {
+        bloque = 1 + (unsigned int)rand() % 500;
+        if (bloque > 8 * N_FDAF_TEST - posicion)
+        {
+            bloque = 8 * N_FDAF_TEST - posicion;
+        }
+
+        /* Error in-place sobre la señal deseada */
+        fdaf_api.fdaf_bloque(&x_fdaf_test[posicion], &d_fdaf_test[posicion], NULL, &d_fdaf_test[posicion], bloque,
+                             &bloques);
+        for (i = posicion; i < posicion + bloque; i++)
+        {
+            diferencia = fmaxf(diferencia, fabsf(d_fdaf_test[i] - e_fdaf_test[i]));
+        }
+        posicion += bloque;
+    }
+
+    test_fdaf_printf("Diferencia máxima: %.2e\n", diferencia);
+    if (diferencia != 0.0f)
+    {
+        test_fdaf_printf("ERROR: El modo por bloques no coincide con el modo muestra a muestra\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: parámetros inválidos */
+    test_fdaf_printf("\nTest 3: Parámetros inválidos\n");
+
+    if (fdaf_api.get_fdaf(0, B_FDAF_TEST, &plan, 0.5f, 0.9f, 1e-3f, workspace2_fdaf_test, &fdaf) != FDAF_KO ||
+        fdaf_api.get_fdaf(N_FDAF_TEST, 64, &plan, 0.5f, 0.9f, 1e-3f, workspace2_fdaf_test, &fdaf) != FDAF_KO ||
+        fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, NULL, 0.5f, 0.9f, 1e-3f, workspace2_fdaf_test, &fdaf) != FDAF_KO ||
+        fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 0.0f, 0.9f, 1e-3f, workspace2_fdaf_test, &fdaf) != FDAF_KO ||
+        fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 0.5f, 1.0f, 1e-3f, workspace2_fdaf_test, &fdaf) != FDAF_KO ||
+        fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 0.5f, 0.9f, 0.0f, workspace2_fdaf_test, &fdaf) != FDAF_KO ||
+        fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 0.5f, 0.9f, 1e-3f, NULL, &fdaf) != FDAF_KO ||
+        fdaf_api.fdaf_filter(1.0f, 1.0f, NULL) != 0.0f ||
+        fdaf_api.fdaf_bloque(NULL, d_fdaf_test, NULL, NULL, 4, &bloques) != FDAF_KO ||
+        fdaf_api.coeficientes_fdaf(&bloques, NULL) != FDAF_KO)
+    {
+        test_fdaf_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_fdaf_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_fdaf_printf("\nTest Interfaz_FDAF: PASSED\n");
+    else
+        test_fdaf_printf("\nTest Interfaz_FDAF: FAILED\n");
+
+    return result;
+}
+
+int Test_Convergencia_FDAF(void)
+{
+    int result = TEST_OK;
+    unsigned int c, i, tramo;
+    RFFT_PLAN plan, plan_coste;
+    FDAF_OBJECT fdaf;
+    LMS_OBJECT nlms;
+    double dB_fdaf, dB_nlms, final_fdaf[2], final_nlms[2], cruce_fdaf[2], cruce_nlms[2];
+    clock_t inicio, fin;
+    double t_fdaf, t_nlms;
+    const float coloreado[2] = {0.0f, 0.95f};
+    const char *nombres[2] = {"blanca", "AR(1) 0.95"};
+
+    test_fdaf_printf("\n=== Test Convergencia_FDAF ===\n");
+
+    Init_Fir();
+    Init_FFT();
+    Init_LMS();
+    Init_FDAF();
+    srand(40);
+
+    fft_api.get_rplan(2 * B_FDAF_TEST, twiddle2_fdaf_test, bitrev2_fdaf_test, &plan);
+
+    /* Test 1: curvas de desajuste del FDAF (mu = 1) y del NLMS (mu = 0.5) */
+    for (c = 0; c < 2; c++)
+    {
+        test_fdaf_printf("\nTest %u: Identificación de %u coeficientes con entrada %s (B = %u)\n",
+                         c + 1, N_FDAF_TEST, nombres[c], B_FDAF_TEST);
+        test_fdaf_printf("  Muestras |   FDAF (dB) |   NLMS (dB)\n");
+
+        senal_fdaf(coloreado[c], N_FDAF_TEST);
+
+        for (i = 0; i < N_FDAF_TEST; i++)
+        {
+            w_fdaf_test[i] = 0.0f;
+        }
+        fdaf_api.get_fdaf(N_FDAF_TEST, B_FDAF_TEST, &plan, 1.0f, 0.9f, 1e-2f, workspace2_fdaf_test, &fdaf);
+        lms_api.get_lms(N_FDAF_TEST, w_fdaf_test, z_fdaf_test, LMS_NORMALIZADO, 0.5f, 1e-2f, &nlms);
+
+        cruce_fdaf[c] = 0.0;
+        cruce_nlms[c] = 0.0;
+        for (tramo = 0; tramo < L_FDAF_TEST; tramo += TRAMO_FDAF_TEST)
+        {
+            fdaf_api.fdaf_bloque(&x_fdaf_test[tramo], &d_fdaf_test[tramo], NULL, NULL, TRAMO_FDAF_TEST, &fdaf);
+            lms_api.lms_bloque(&x_fdaf_test[tramo], &d_fdaf_test[tramo], NULL, NULL, TRAMO_FDAF_TEST, &nlms);
+
+            fdaf_api.coeficientes_fdaf(&fdaf, e_fdaf_test);
+            dB_fdaf = desajuste_fdaf(e_fdaf_test, N_FDAF_TEST);
+            dB_nlms = desajuste_fdaf(w_fdaf_test, N_FDAF_TEST);
+            test_fdaf_printf("  %8u | %11.1f | %11.1f\n", tramo + TRAMO_FDAF_TEST, dB_fdaf, dB_nlms);
+
+            /* Muestras hasta bajar de -20 dB */
+            if (cruce_fdaf[c] == 0.0 && dB_fdaf < -20.0)
+            {
+                cruce_fdaf[c] = tramo + TRAMO_FDAF_TEST;
+            }
+            if (cruce_nlms[c] == 0.0 && dB_nlms < -20.0)
+            {
+                cruce_nlms[c] = tramo + TRAMO_FDAF_TEST;
+            }
+        }
+
+        final_fdaf[c] = dB_fdaf;
+        final_nlms[c] = dB_nlms;
+    }
+
+    /* Entrada blanca: misma convergencia que el NLMS; entrada coloreada: más rápida */
+    test_fdaf_printf("\nDesajuste final: blanca %.1f / %.1f dB, coloreada %.1f / %.1f dB (FDAF / NLMS)\n",
+                     final_fdaf[0], final_nlms[0], final_fdaf[1], final_nlms[1]);
+    if (!(final_fdaf[0] < -40.0) || cruce_fdaf[0] == 0.0 || cruce_fdaf[0] > 2.0 * cruce_nlms[0])
+    {
+        test_fdaf_printf("ERROR: Con entrada blanca el FDAF no converge como el NLMS\n");
+        result = TEST_KO;
+    }
+    if (!(final_fdaf[1] < final_nlms[1] - 10.0) || cruce_fdaf[1] == 0.0 ||
+        (cruce_nlms[1] != 0.0 && cruce_fdaf[1] >= cruce_nlms[1]))
+    {
+        test_fdaf_printf("ERROR: Con entrada coloreada la normalización por bin no acelera la convergencia\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: coste por muestra */
+    test_fdaf_printf("\nTest 3: Coste por muestra (%u coeficientes, B = %u)\n", N_COSTE_FDAF, B_COSTE_FDAF);
+
+    fft_api.get_rplan(2 * B_COSTE_FDAF, twiddle_fdaf_test, bitrev_fdaf_test, &plan_coste);
+    fdaf_api.get_fdaf(N_COSTE_FDAF, B_COSTE_FDAF, &plan_coste, 0.5f, 0.9f, 1e-2f, workspace_fdaf_test, &fdaf);
+    for (i = 0; i < N_COSTE_FDAF; i++)
+    {
+        w_fdaf_test[i] = 0.0f;
+    }
+    lms_api.get_lms(N_COSTE_FDAF, w_fdaf_test, z_fdaf_test, LMS_NORMALIZADO, 0.5f, 1e-2f, &nlms);
+
+    inicio = clock();
+    fdaf_api.fdaf_bloque(x_fdaf_test, d_fdaf_test, NULL, e_fdaf_test, L_FDAF_TEST, &fdaf);
+    fin = clock();
+    t_fdaf = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_FDAF_TEST;
+
+    inicio = clock();
+    lms_api.lms_bloque(x_fdaf_test, d_fdaf_test, NULL, e_fdaf_test, L_FDAF_TEST, &nlms);
+    fin = clock();
+    t_nlms = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_FDAF_TEST;
+
+    test_fdaf_printf("FDAF: %.1f ns/muestra, NLMS: %.1f ns/muestra (%.1fx)\n", t_fdaf, t_nlms, t_nlms / t_fdaf);
+    if (!(t_fdaf < t_nlms))
+    {
+        test_fdaf_printf("ERROR: El FDAF no es más barato que el NLMS en el tiempo\n");
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_fdaf_printf("\nTest Convergencia_FDAF: PASSED\n");
+    else
+        test_fdaf_printf("\nTest Convergencia_FDAF: FAILED\n");
+
+    return result;
+}
+
+int Run_All_FDAF_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    fdaf_test_log_file = fopen("FDAF_Tests_Result.txt", "a");
+    if (fdaf_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de FDAF\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_fdaf_printf("\n\n########################################\n");
+        test_fdaf_printf("# FDAF Unit Tests\n");
+        test_fdaf_printf("# Fecha y hora: %s\n", time_string);
+        test_fdaf_printf("########################################\n");
+    }
+
+    test_fdaf_printf("\n========================================\n");
+    test_fdaf_printf("    EJECUTANDO TESTS FDAF\n");
+    test_fdaf_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Interfaz_FDAF();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Convergencia_FDAF();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_fdaf_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_fdaf_printf("TODOS LOS TESTS FDAF PASARON CORRECTAMENTE\n");
+    else
+        test_fdaf_printf("ALGUNOS TESTS FDAF FALLARON\n");
+    test_fdaf_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (fdaf_test_log_file != NULL)
+    {
+        test_fdaf_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_fdaf_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_fdaf_printf("FAILURE - Algunos tests fallaron\n");
+        test_fdaf_printf("########################################\n\n");
+
+        fclose(fdaf_test_log_file);
+        fdaf_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
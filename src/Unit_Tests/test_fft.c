@@ -0,0 +1,716 @@
+/** \page test_fft TEST UNITARIOS FFT
+ * \brief Módulo de pruebas unitarias para la transformada rápida de Fourier
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo FFT. Las pruebas validan la creación de planes, la exactitud
+ * frente a una DFT directa calculada en doble precisión, la transformada inversa y las
+ * variantes in-place y out-of-place, y miden el coste frente a la DFT directa. Los tests
+ * solo se compilan y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_fft Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en FFT_Tests_Result.txt
+ *
+ * \section funciones_test_fft Descripción de funciones
+ *
+ * \subsection test_plan_fft Test_Plan_FFT
+ * Verifica la creación de planes:
+ * - Tabla de inversión de bits para N = 8
+ * - Rechazo de tamaños que no son potencia de 2, demasiado grandes y punteros NULL
+ *
+ * \subsection test_exactitud_fft Test_Exactitud_FFT
+ * Verifica la transformada directa:
+ * - Delta y tono complejo con resultado conocido
+ * - Error relativo frente a la DFT directa para N = 2 .. 4096 (log2 N par e impar)
+ *
+ * \subsection test_inversa_fft Test_Inversa_FFT
+ * Verifica la transformada inversa y las variantes de ejecución:
+ * - Igualdad de fft y fft_out, y de ifft e ifft_out
+ * - Reconstrucción ifft(fft(x)) para N = 2 .. 2^20
+ *
+ * \subsection test_real_fft Test_Real_FFT
+ * Verifica la FFT real:
+ * - Espectro empaquetado frente a la FFT compleja de la misma señal para N = 4 .. 4096
+ * - Reconstrucción irfft(rfft(x)) out-of-place e in-place para N = 4 .. 2^20
+ * - Coste de rfft frente a la FFT compleja del mismo número de puntos
+ *
+ * \subsection test_benchmark_fft Test_Benchmark_FFT
+ * Mide el tiempo de la FFT frente a la DFT directa para N = 64 .. 2^20. Por encima de 4096
+ * puntos la DFT se mide sobre un subconjunto de bins y se extrapola al total, y la exactitud
+ * se comprueba sobre esos mismos bins.
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_fft Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Añadido test de la FFT real |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "fft.h"
+#include "test_fft.h"
+
+#define TEST_OK         0
+#define TEST_KO         -1
+#define EPSILON_FFT     1e-5f
+#define N_MAX_TEST_FFT  (1u << FFT_MAX_LOG2)
+#define BINS_DFT        64          /* Bins de la DFT directa por encima de 4096 puntos */
+
+/* Variable global para el archivo de log */
+static FILE *fft_test_log_file = NULL;
+
+/* Buffers de test */
+static COMPLEJO twiddle_test[FFT_TWIDDLE_SIZE(N_MAX_TEST_FFT)];
+static unsigned int bitrev_test[FFT_BITREV_SIZE(N_MAX_TEST_FFT)];
+static COMPLEJO x_test[N_MAX_TEST_FFT];
+static COMPLEJO y_test[N_MAX_TEST_FFT];
+static COMPLEJO z_test[N_MAX_TEST_FFT];
+static COMPLEJO rtwiddle_test[RFFT_TWIDDLE_SIZE(N_MAX_TEST_FFT)];
+static unsigned int rbitrev_test[RFFT_BITREV_SIZE(N_MAX_TEST_FFT)];
+static float xr_test[N_MAX_TEST_FFT];
+static float zr_test[N_MAX_TEST_FFT];
+static double dft_re[4096];
+static double dft_im[4096];
+
+/* Declaración de funciones de test */
+int Test_Plan_FFT(void);
+int Test_Exactitud_FFT(void);
+int Test_Inversa_FFT(void);
+int Test_Real_FFT(void);
+int Test_Benchmark_FFT(void);
+int Run_All_FFT_Tests(void);
+
+/* Funciones auxiliares */
+void test_fft_printf(const char *format, ...);
+float random_uniform_fft(float amplitud);
+void dft_referencia_fft(const COMPLEJO *x, unsigned int n, unsigned int nbins, unsigned int paso,
+                        double *re, double *im);
+double error_relativo_fft(const COMPLEJO *X, unsigned int nbins, unsigned int paso,
+                          const double *re, const double *im);
+
+/* Definición de funciones */
+
+void test_fft_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (fft_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(fft_test_log_file, format, args);
+        va_end(args);
+        fflush(fft_test_log_file);
+    }
+}
+
+float random_uniform_fft(float amplitud)
+{
+    /* Valor aleatorio uniforme en [-amplitud, amplitud] */
+    return amplitud * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+}
+
+void dft_referencia_fft(const COMPLEJO *x, unsigned int n, unsigned int nbins, unsigned int paso,
+                        double *re, double *im)
+{
+    /* DFT directa en doble precisión de los bins 0, paso, 2*paso, ... con un fasor giratorio */
+    unsigned int b, m;
+    double wr, wi, pr, pi, temp, ar, ai;
+
+    for (b = 0; b < nbins; b++)
+    {
+        wr = cos(-2.0 * FFT_PI * (double)(b * paso) / (double)n);
+        wi = sin(-2.0 * FFT_PI * (double)(b * paso) / (double)n);
+        pr = 1.0;
+        pi = 0.0;
+        ar = 0.0;
+        ai = 0.0;
+
+        for (m = 0; m < n; m++)
+        {
+            ar += (double)x[m].re * pr - (double)x[m].im * pi;
+            ai += (double)x[m].re * pi + (double)x[m].im * pr;
+            temp = pr * wr - pi * wi;
+            pi = pr * wi + pi * wr;
+            pr = temp;
+        }
+
+        re[b] = ar;
+        im[b] = ai;
+    }
+}
+
+double error_relativo_fft(const COMPLEJO *X, unsigned int nbins, unsigned int paso,
+                          const double *re, const double *im)
+{
+    /* Error cuadrático relativo ||X - X_ref|| / ||X_ref|| sobre los bins calculados */
+    unsigned int b;
+    double error, energia, dr, di;
+
+    error = 0.0;
+    energia = 0.0;
+    for (b = 0; b < nbins; b++)
+    {
+        dr = (double)X[b * paso].re - re[b];
+        di = (double)X[b * paso].im - im[b];
+        error += dr * dr + di * di;
+        energia += re[b] * re[b] + im[b] * im[b];
+    }
+
+    return (energia > 0.0) ? sqrt(error / energia) : sqrt(error);
+}
+
+int Test_Plan_FFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i;
+    FFT_PLAN plan;
+    const unsigned int bitrev_8[8] = {0, 4, 2, 6, 1, 5, 3, 7};
+
+    test_fft_printf("\n=== Test Plan_FFT ===\n");
+
+    Init_FFT();
+
+    /* Test 1: Tabla de inversión de bits */
+    test_fft_printf("\nTest 1: Plan de 8 puntos\n");
+
+    if (fft_api.get_plan(8, twiddle_test, bitrev_test, &plan) != FFT_OK || plan.log2n != 3)
+    {
+        test_fft_printf("ERROR: get_plan falló con N = 8\n");
+        return TEST_KO;
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        if (bitrev_test[i] != bitrev_8[i])
+        {
+            test_fft_printf("ERROR: bitrev[%u] = %u, esperado %u\n", i, bitrev_test[i], bitrev_8[i]);
+            result = TEST_KO;
+        }
+    }
+    if (result == TEST_OK)
+    {
+        test_fft_printf("Tabla de inversión de bits: PASSED\n");
+    }
+
+    /* Test 2: Parámetros inválidos */
+    test_fft_printf("\nTest 2: Parámetros inválidos\n");
+
+    if (fft_api.get_plan(12, twiddle_test, bitrev_test, &plan) != FFT_KO ||
+        fft_api.get_plan(1, twiddle_test, bitrev_test, &plan) != FFT_KO ||
+        fft_api.get_plan(2 * N_MAX_TEST_FFT, twiddle_test, bitrev_test, &plan) != FFT_KO)
+    {
+        test_fft_printf("ERROR: get_plan aceptó un tamaño inválido\n");
+        result = TEST_KO;
+    }
+
+    if (fft_api.get_plan(16, NULL, bitrev_test, &plan) != FFT_KO ||
+        fft_api.get_plan(16, twiddle_test, NULL, &plan) != FFT_KO ||
+        fft_api.get_plan(16, twiddle_test, bitrev_test, NULL) != FFT_KO)
+    {
+        test_fft_printf("ERROR: get_plan aceptó punteros NULL\n");
+        result = TEST_KO;
+    }
+
+    plan.twiddle = NULL;
+    if (fft_api.fft(&plan, x_test) != FFT_KO || fft_api.fft(NULL, x_test) != FFT_KO)
+    {
+        test_fft_printf("ERROR: fft aceptó un plan inválido\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_fft_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_fft_printf("\nTest Plan_FFT: PASSED\n");
+    else
+        test_fft_printf("\nTest Plan_FFT: FAILED\n");
+
+    return result;
+}
+
+int Test_Exactitud_FFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n;
+    FFT_PLAN plan;
+    float error_max;
+    double error;
+
+    test_fft_printf("\n=== Test Exactitud_FFT ===\n");
+
+    Init_FFT();
+    srand(31);
+
+    /* Test 1: delta -> espectro constante, tono -> un único bin */
+    test_fft_printf("\nTest 1: Delta y tono complejo (N = 64)\n");
+
+    fft_api.get_plan(64, twiddle_test, bitrev_test, &plan);
+    for (i = 0; i < 64; i++)
+    {
+        x_test[i].re = (i == 0) ? 1.0f : 0.0f;
+        x_test[i].im = 0.0f;
+    }
+    fft_api.fft(&plan, x_test);
+
+    error_max = 0.0f;
+    for (i = 0; i < 64; i++)
+    {
+        error_max = fmaxf(error_max, fabsf(x_test[i].re - 1.0f) + fabsf(x_test[i].im));
+    }
+
+    for (i = 0; i < 64; i++)
+    {
+        x_test[i].re = (float)cos(2.0 * FFT_PI * 5.0 * (double)i / 64.0);
+        x_test[i].im = (float)sin(2.0 * FFT_PI * 5.0 * (double)i / 64.0);
+    }
+    fft_api.fft(&plan, x_test);
+
+    for (i = 0; i < 64; i++)
+    {
+        error_max = fmaxf(error_max, fabsf(x_test[i].re - ((i == 5) ? 64.0f : 0.0f)) + fabsf(x_test[i].im));
+    }
+
+    test_fft_printf("Error máximo: %.2e\n", error_max);
+    if (error_max > 1e-4f)
+    {
+        test_fft_printf("ERROR: La FFT de la delta o del tono no es la esperada\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: frente a la DFT directa */
+    test_fft_printf("\nTest 2: Error relativo frente a la DFT directa\n");
+
+    for (n = 2; n <= 4096; n <<= 1)
+    {
+        fft_api.get_plan(n, twiddle_test, bitrev_test, &plan);
+        for (i = 0; i < n; i++)
+        {
+            x_test[i].re = random_uniform_fft(1.0f);
+            x_test[i].im = random_uniform_fft(1.0f);
+        }
+
+        dft_referencia_fft(x_test, n, n, 1, dft_re, dft_im);
+        fft_api.fft(&plan, x_test);
+        error = error_relativo_fft(x_test, n, 1, dft_re, dft_im);
+
+        test_fft_printf("N = %4u: error relativo %.2e\n", n, error);
+        if (error > EPSILON_FFT)
+        {
+            test_fft_printf("ERROR: La FFT de %u puntos no coincide con la DFT\n", n);
+            result = TEST_KO;
+        }
+    }
+
+    if (result == TEST_OK)
+        test_fft_printf("\nTest Exactitud_FFT: PASSED\n");
+    else
+        test_fft_printf("\nTest Exactitud_FFT: FAILED\n");
+
+    return result;
+}
+
+int Test_Inversa_FFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n;
+    FFT_PLAN plan;
+    float diferencia, error_max;
+
+    test_fft_printf("\n=== Test Inversa_FFT ===\n");
+
+    Init_FFT();
+    srand(32);
+
+    /* Test 1: in-place frente a out-of-place */
+    test_fft_printf("\nTest 1: Variantes in-place y out-of-place (N = 2048)\n");
+
+    fft_api.get_plan(2048, twiddle_test, bitrev_test, &plan);
+    for (i = 0; i < 2048; i++)
+    {
+        x_test[i].re = random_uniform_fft(1.0f);
+        x_test[i].im = random_uniform_fft(1.0f);
+        y_test[i] = x_test[i];
+    }
+
+    fft_api.fft_out(&plan, x_test, z_test);
+    fft_api.fft(&plan, y_test);
+    diferencia = 0.0f;
+    for (i = 0; i < 2048; i++)
+    {
+        diferencia = fmaxf(diferencia, fabsf(y_test[i].re - z_test[i].re) + fabsf(y_test[i].im - z_test[i].im));
+    }
+
+    fft_api.ifft_out(&plan, z_test, x_test);
+    fft_api.ifft(&plan, y_test);
+    for (i = 0; i < 2048; i++)
+    {
+        diferencia = fmaxf(diferencia, fabsf(y_test[i].re - x_test[i].re) + fabsf(y_test[i].im - x_test[i].im));
+    }
+
+    if (diferencia != 0.0f)
+    {
+        test_fft_printf("ERROR: Las variantes in-place y out-of-place difieren (%.2e)\n", diferencia);
+        result = TEST_KO;
+    }
+    else
+    {
+        test_fft_printf("Variantes in-place y out-of-place: PASSED\n");
+    }
+
+    if (fft_api.fft_out(&plan, x_test, x_test) != FFT_KO)
+    {
+        test_fft_printf("ERROR: fft_out aceptó entrada y salida solapadas\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: reconstrucción */
+    test_fft_printf("\nTest 2: Reconstrucción ifft(fft(x))\n");
+
+    for (n = 2; n <= N_MAX_TEST_FFT; n <<= 1)
+    {
+        fft_api.get_plan(n, twiddle_test, bitrev_test, &plan);
+        for (i = 0; i < n; i++)
+        {
+            x_test[i].re = random_uniform_fft(1.0f);
+            x_test[i].im = random_uniform_fft(1.0f);
+        }
+
+        fft_api.fft_out(&plan, x_test, y_test);
+        fft_api.ifft(&plan, y_test);
+
+        error_max = 0.0f;
+        for (i = 0; i < n; i++)
+        {
+            error_max = fmaxf(error_max, fabsf(y_test[i].re - x_test[i].re));
+            error_max = fmaxf(error_max, fabsf(y_test[i].im - x_test[i].im));
+        }
+
+        if (error_max > EPSILON_FFT)
+        {
+            test_fft_printf("ERROR: N = %u, error de reconstrucción %.2e\n", n, error_max);
+            result = TEST_KO;
+        }
+        else if (n == 64 || n == 4096 || n == N_MAX_TEST_FFT)
+        {
+            test_fft_printf("N = %7u: error máximo de reconstrucción %.2e\n", n, error_max);
+        }
+    }
+
+    if (result == TEST_OK)
+        test_fft_printf("\nTest Inversa_FFT: PASSED\n");
+    else
+        test_fft_printf("\nTest Inversa_FFT: FAILED\n");
+
+    return result;
+}
+
+int Test_Real_FFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n, r, repeticiones;
+    FFT_PLAN plan;
+    RFFT_PLAN rplan;
+    COMPLEJO *espectro;
+    float error_max, referencia_max, error_inplace;
+    clock_t inicio, fin;
+    double t_compleja, t_real;
+
+    test_fft_printf("\n=== Test Real_FFT ===\n");
+
+    Init_FFT();
+    srand(34);
+
+    /* Test 1: frente a la FFT compleja */
+    test_fft_printf("\nTest 1: Espectro empaquetado frente a la FFT compleja\n");
+
+    for (n = 4; n <= 4096; n <<= 1)
+    {
+        fft_api.get_plan(n, twiddle_test, bitrev_test, &plan);
+        if (fft_api.get_rplan(n, rtwiddle_test, rbitrev_test, &rplan) != FFT_OK)
+        {
+            test_fft_printf("ERROR: get_rplan falló con N = %u\n", n);
+            return TEST_KO;
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            xr_test[i] = random_uniform_fft(1.0f);
+            x_test[i].re = xr_test[i];
+            x_test[i].im = 0.0f;
+        }
+
+        fft_api.fft(&plan, x_test);
+        fft_api.rfft(&rplan, xr_test, y_test);
+
+        /* y[0] = (X(0), X(N/2)); y[k] = X(k) */
+        error_max = fabsf(y_test[0].re - x_test[0].re) + fabsf(y_test[0].im - x_test[n / 2].re);
+        referencia_max = 0.0f;
+        for (i = 1; i < n / 2; i++)
+        {
+            error_max = fmaxf(error_max, fabsf(y_test[i].re - x_test[i].re) + fabsf(y_test[i].im - x_test[i].im));
+        }
+        for (i = 0; i < n; i++)
+        {
+            referencia_max = fmaxf(referencia_max, fabsf(x_test[i].re) + fabsf(x_test[i].im));
+        }
+
+        if (error_max > EPSILON_FFT * referencia_max)
+        {
+            test_fft_printf("ERROR: N = %u, rfft difiere de la FFT compleja (%.2e)\n", n, error_max);
+            result = TEST_KO;
+        }
+    }
+    if (result == TEST_OK)
+    {
+        test_fft_printf("Espectro empaquetado para N = 4 .. 4096: PASSED\n");
+    }
+
+    /* Test 2: reconstrucción */
+    test_fft_printf("\nTest 2: Reconstrucción irfft(rfft(x)) out-of-place e in-place\n");
+
+    for (n = 4; n <= N_MAX_TEST_FFT; n <<= 1)
+    {
+        fft_api.get_rplan(n, rtwiddle_test, rbitrev_test, &rplan);
+        for (i = 0; i < n; i++)
+        {
+            xr_test[i] = random_uniform_fft(1.0f);
+            zr_test[i] = xr_test[i];
+        }
+
+        fft_api.rfft(&rplan, xr_test, y_test);
+        fft_api.irfft(&rplan, y_test, (float *)z_test);
+
+        /* In-place: el espectro ocupa la misma memoria que la señal */
+        espectro = (COMPLEJO *)zr_test;
+        fft_api.rfft(&rplan, zr_test, espectro);
+        fft_api.irfft(&rplan, espectro, zr_test);
+
+        error_max = 0.0f;
+        error_inplace = 0.0f;
+        for (i = 0; i < n; i++)
+        {
+            error_max = fmaxf(error_max, fabsf(((float *)z_test)[i] - xr_test[i]));
+            error_inplace = fmaxf(error_inplace, fabsf(zr_test[i] - xr_test[i]));
+        }
+
+        if (error_max > EPSILON_FFT || error_inplace > EPSILON_FFT)
+        {
+            test_fft_printf("ERROR: N = %u, error de reconstrucción %.2e / %.2e\n", n, error_max, error_inplace);
+            result = TEST_KO;
+        }
+        else if (n == 64 || n == 4096 || n == N_MAX_TEST_FFT)
+        {
+            test_fft_printf("N = %7u: error máximo out-of-place %.2e, in-place %.2e\n", n, error_max, error_inplace);
+        }
+    }
+
+    /* Test 3: coste frente a la FFT compleja */
+    test_fft_printf("\nTest 3: Coste de rfft frente a la FFT compleja de N puntos\n");
+    test_fft_printf("\n%8s %14s %14s %10s\n", "N", "FFT (us)", "RFFT (us)", "Ganancia");
+
+    for (n = 256; n <= N_MAX_TEST_FFT; n <<= 2)
+    {
+        fft_api.get_plan(n, twiddle_test, bitrev_test, &plan);
+        fft_api.get_rplan(n, rtwiddle_test, rbitrev_test, &rplan);
+        for (i = 0; i < n; i++)
+        {
+            xr_test[i] = random_uniform_fft(1.0f);
+            x_test[i].re = xr_test[i];
+            x_test[i].im = 0.0f;
+        }
+
+        repeticiones = (1u << 22) / n;
+        inicio = clock();
+        for (r = 0; r < repeticiones; r++)
+        {
+            fft_api.fft_out(&plan, x_test, y_test);
+        }
+        fin = clock();
+        t_compleja = 1e6 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)repeticiones;
+
+        inicio = clock();
+        for (r = 0; r < repeticiones; r++)
+        {
+            fft_api.rfft(&rplan, xr_test, y_test);
+        }
+        fin = clock();
+        t_real = 1e6 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)repeticiones;
+
+        test_fft_printf("%8u %14.2f %14.2f %10.2f\n", n, t_compleja, t_real,
+                        (t_real > 0.0) ? t_compleja / t_real : 0.0);
+    }
+
+    if (fft_api.get_rplan(2, rtwiddle_test, rbitrev_test, &rplan) != FFT_KO ||
+        fft_api.rfft(NULL, xr_test, y_test) != FFT_KO)
+    {
+        test_fft_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_fft_printf("\nTest Real_FFT: PASSED\n");
+    else
+        test_fft_printf("\nTest Real_FFT: FAILED\n");
+
+    return result;
+}
+
+int Test_Benchmark_FFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n, r, repeticiones, nbins, paso;
+    FFT_PLAN plan;
+    clock_t inicio, fin;
+    double t_fft, t_dft, error;
+
+    test_fft_printf("\n=== Test Benchmark_FFT ===\n");
+
+    Init_FFT();
+    srand(33);
+
+    test_fft_printf("\n%8s %14s %16s %10s %12s\n", "N", "FFT (us)", "DFT (us)", "Ganancia", "Error rel.");
+
+    for (n = 64; n <= N_MAX_TEST_FFT; n <<= 1)
+    {
+        fft_api.get_plan(n, twiddle_test, bitrev_test, &plan);
+        for (i = 0; i < n; i++)
+        {
+            x_test[i].re = random_uniform_fft(1.0f);
+            x_test[i].im = random_uniform_fft(1.0f);
+        }
+
+        /* FFT: unos 2^22 puntos transformados por tamaño */
+        repeticiones = (1u << 22) / n;
+        inicio = clock();
+        for (r = 0; r < repeticiones; r++)
+        {
+            fft_api.fft_out(&plan, x_test, y_test);
+        }
+        fin = clock();
+        t_fft = 1e6 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)repeticiones;
+
+        /* DFT directa completa hasta 4096 puntos; por encima, BINS_DFT bins y extrapolación */
+        nbins = (n <= 4096) ? n : BINS_DFT;
+        paso = n / nbins;
+        inicio = clock();
+        dft_referencia_fft(x_test, n, nbins, paso, dft_re, dft_im);
+        fin = clock();
+        t_dft = 1e6 * (double)(fin - inicio) / CLOCKS_PER_SEC * (double)paso;
+
+        error = error_relativo_fft(y_test, nbins, paso, dft_re, dft_im);
+
+        test_fft_printf("%8u %14.2f %15.0f%s %10.0f %12.2e\n", n, t_fft, t_dft, (paso > 1) ? "*" : " ",
+                        (t_fft > 0.0) ? t_dft / t_fft : 0.0, error);
+
+        if (error > EPSILON_FFT)
+        {
+            test_fft_printf("ERROR: La FFT de %u puntos no coincide con la DFT\n", n);
+            result = TEST_KO;
+        }
+    }
+    test_fft_printf("(*) Tiempo de DFT extrapolado a partir de %u bins\n", BINS_DFT);
+
+    if (result == TEST_OK)
+        test_fft_printf("\nTest Benchmark_FFT: PASSED\n");
+    else
+        test_fft_printf("\nTest Benchmark_FFT: FAILED\n");
+
+    return result;
+}
+
+int Run_All_FFT_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    fft_test_log_file = fopen("FFT_Tests_Result.txt", "a");
+    if (fft_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de FFT\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_fft_printf("\n\n########################################\n");
+        test_fft_printf("# FFT Unit Tests\n");
+        test_fft_printf("# Fecha y hora: %s\n", time_string);
+        test_fft_printf("########################################\n");
+    }
+
+    test_fft_printf("\n========================================\n");
+    test_fft_printf("    EJECUTANDO TESTS FFT\n");
+    test_fft_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Plan_FFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Exactitud_FFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Inversa_FFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Real_FFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Benchmark_FFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_fft_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_fft_printf("TODOS LOS TESTS FFT PASARON CORRECTAMENTE\n");
+    else
+        test_fft_printf("ALGUNOS TESTS FFT FALLARON\n");
+    test_fft_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (fft_test_log_file != NULL)
+    {
+        test_fft_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_fft_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_fft_printf("FAILURE - Algunos tests fallaron\n");
+        test_fft_printf("########################################\n\n");
+
+        fclose(fft_test_log_file);
+        fft_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
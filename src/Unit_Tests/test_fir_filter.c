@@ -55,12 +55,29 @@
  * - Número de coeficientes excesivo (> MAX_FIR_LENGTH)
  * - Punteros NULL a coeficientes o buffer Z
  *
+ * \subsection test_fir_precision Test_FIR_Precision
+ * Compara fir_filter, fir_filter_m y fir_filter_d con una referencia en long double sobre un filtro de
+ * MAX_FIR_LENGTH coeficientes de signo alterno y una entrada con componente continua grande, donde la suma
+ * float cancela la mayor parte de sus cifras:
+ * - La variante double y la mixta coinciden con la referencia hasta su redondeo final
+ * - La variante mixta no tiene más error que la float
+ * - Se informa del tiempo por muestra de las tres variantes
+ *
+ * \subsection test_fir_q15 Test_FIR_Q15
+ * Verifica el filtro en coma fija:
+ * - Cuantificación Q15 con redondeo y saturación simétrica
+ * - Salida idéntica bit a bit a una referencia entera de 64 bits (con y sin SSE2 el resultado es el mismo)
+ * - Saturación de la salida sin desbordamiento del acumulador
+ * - SNR de un paso bajo de 31 coeficientes frente al filtro float, y tiempo por muestra frente a float
+ *
  * \author Dr. Carlos Romero
  *
  * \section historial_test_fir Historial de cambios
  * | Fecha | Autor | Versión | Descripción |
  * |:-----:|:-----:|:-------:|:------------|
  * | 28/08/2025 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Añadido test de precisión de las variantes double y mixta |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Añadido test del filtro en coma fija Q15 |
  *
  * \copyright ZGR R&D AIE
  */
@@ -70,6 +87,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <float.h>
 #include <time.h>
 #include <stdarg.h>
 #include "fir_filter.h"
@@ -77,6 +95,7 @@
 #define TEST_OK     0
 #define TEST_KO     -1
 #define EPSILON_FIR  1e-6f
+#define MUESTRAS_PRECISION_FIR  2000
 
 /* Variable global para el archivo de log */
 static FILE *fir_test_log_file = NULL;
@@ -85,6 +104,8 @@ static FILE *fir_test_log_file = NULL;
 int Test_FIR_Initialization(void);
 int Test_FIR_Filtering(void);
 int Test_FIR_Error_Handling(void);
+int Test_FIR_Precision(void);
+int Test_FIR_Q15(void);
 int Run_All_FIR_Tests(void);
 
 /* Funciones auxiliares */
@@ -329,6 +350,328 @@ int Test_FIR_Error_Handling(void)
     return result;
 }
 
+int Test_FIR_Precision(void)
+{
+    int result = TEST_OK;
+    FIR_FILTER_OBJECT filter;
+    FIR_FILTER_OBJECT filter_m;
+    FIR_FILTER_OBJECT_D filter_d;
+    static float coefs[MAX_FIR_LENGTH];
+    static float z_buffer[MAX_FIR_LENGTH];
+    static float z_buffer_m[MAX_FIR_LENGTH];
+    static double coefs_d[MAX_FIR_LENGTH];
+    static double z_buffer_d[MAX_FIR_LENGTH];
+    static float entrada[MUESTRAS_PRECISION_FIR];
+    long double referencia;
+    double error_f, error_m, error_d, error;
+    double ulp_max;
+    float y, y_m;
+    double y_d;
+    clock_t inicio;
+    double t_f, t_m, t_d;
+    volatile float sumidero;
+    int i, k, n;
+
+    test_fir_printf("\n=== Test FIR Precision ===\n");
+
+    /* Coeficientes de signo alterno y suma casi nula: con la entrada en torno a 1000 la salida es
+     * pequeña frente a cada producto y la suma float pierde las cifras que se cancelan */
+    for (k = 0; k < MAX_FIR_LENGTH; k++)
+    {
+        coefs[k] = (float)(((k & 1) ? -1.0 : 1.0) * (0.5 + 0.4 * sin(0.37 * k)));
+        coefs_d[k] = coefs[k];
+    }
+    srand(48);
+    for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+    {
+        entrada[i] = 1000.0f + (float)rand() / (float)RAND_MAX;
+    }
+
+    filter = fir_api.get_fir(MAX_FIR_LENGTH, coefs, z_buffer);
+    filter_m = fir_api.get_fir(MAX_FIR_LENGTH, coefs, z_buffer_m);
+    filter_d = fir_api.get_fir_d(MAX_FIR_LENGTH, coefs_d, z_buffer_d);
+
+    error_f = 0.0;
+    error_m = 0.0;
+    error_d = 0.0;
+    ulp_max = 0.0;
+    for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+    {
+        y = fir_api.fir_filter(entrada[i], &filter);
+        y_m = fir_api.fir_filter_m(entrada[i], &filter_m);
+        y_d = fir_api.fir_filter_d((double)entrada[i], &filter_d);
+
+        referencia = 0.0L;
+        n = (i + 1 < MAX_FIR_LENGTH) ? i + 1 : MAX_FIR_LENGTH;
+        for (k = 0; k < n; k++)
+        {
+            referencia += (long double)coefs[k] * (long double)entrada[i - k];
+        }
+
+        error = fabs((double)((long double)y - referencia));
+        if (error > error_f) error_f = error;
+        error = fabs((double)((long double)y_m - referencia));
+        if (error > error_m) error_m = error;
+        error = fabs((double)((long double)y_d - referencia));
+        if (error > error_d) error_d = error;
+        error = fabs((double)referencia) * FLT_EPSILON;
+        if (error > ulp_max) ulp_max = error;
+    }
+
+    test_fir_printf("Error máximo float: %e, mixta: %e, double: %e (ulp float de la salida: %e)\n",
+                    error_f, error_m, error_d, ulp_max);
+
+    /* Test 1: double y mixta solo añaden su redondeo final */
+    test_fir_printf("\nTest 1: Error de las variantes double y mixta\n");
+    if (error_d > 1e-9 || error_m > ulp_max)
+    {
+        test_fir_printf("ERROR: La acumulación en double no alcanza la precisión esperada\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_fir_printf("OK: Double y mixta dentro de su redondeo final\n");
+    }
+
+    /* Test 2: la variante mixta mejora a la float */
+    test_fir_printf("\nTest 2: Mixta frente a float\n");
+    if (error_m > error_f)
+    {
+        test_fir_printf("ERROR: La variante mixta tiene más error que la float\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_fir_printf("OK: La variante mixta reduce el error en un factor %.1f\n",
+                        (error_m > 0.0) ? error_f / error_m : 0.0);
+    }
+
+    /* Tiempo por muestra de las tres variantes (informativo) */
+    sumidero = 0.0f;
+    inicio = clock();
+    for (k = 0; k < 50; k++)
+    {
+        for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+        {
+            sumidero += fir_api.fir_filter(entrada[i], &filter);
+        }
+    }
+    t_f = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    inicio = clock();
+    for (k = 0; k < 50; k++)
+    {
+        for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+        {
+            sumidero += fir_api.fir_filter_m(entrada[i], &filter_m);
+        }
+    }
+    t_m = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    inicio = clock();
+    for (k = 0; k < 50; k++)
+    {
+        for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+        {
+            sumidero += (float)fir_api.fir_filter_d((double)entrada[i], &filter_d);
+        }
+    }
+    t_d = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    test_fir_printf("\nTiempo por muestra (%d coeficientes): float %.1f ns, mixta %.1f ns, double %.1f ns\n",
+                    MAX_FIR_LENGTH, t_f * 1e9 / (50.0 * MUESTRAS_PRECISION_FIR),
+                    t_m * 1e9 / (50.0 * MUESTRAS_PRECISION_FIR), t_d * 1e9 / (50.0 * MUESTRAS_PRECISION_FIR));
+
+    if (result == TEST_OK)
+        test_fir_printf("Test FIR Precision: PASSED\n");
+    else
+        test_fir_printf("Test FIR Precision: FAILED\n");
+
+    return result;
+}
+
+int Test_FIR_Q15(void)
+{
+    int result = TEST_OK;
+    FIR_FILTER_OBJECT filter;
+    FIR_FILTER_OBJECT_Q15 filter_q;
+    static const float valores[6] = {0.5f, -0.25f, 1.0f, -1.0f, 1.5f, 3e-5f};
+    static const int16_t esperados[6] = {16384, -8192, Q15_MAX, -Q15_MAX, Q15_MAX, 1};
+    static float coefs[MAX_FIR_LENGTH];
+    static float z_buffer[MAX_FIR_LENGTH];
+    static int16_t coefs_q[MAX_FIR_LENGTH];
+    static int16_t z_buffer_q[FIR_Q15_RETARDO(MAX_FIR_LENGTH)];
+    static int16_t entrada_q[MUESTRAS_PRECISION_FIR];
+    static const unsigned int longitudes[4] = {1, 7, 31, MAX_FIR_LENGTH};
+    int16_t q[6];
+    int16_t y_q;
+    int64_t acumulador;
+    long referencia;
+    unsigned int saturados, distintos, t, n;
+    double senal, ruido, snr, x, y;
+    clock_t inicio;
+    double t_f, t_q;
+    volatile float sumidero;
+    volatile int sumidero_q;
+    int i, k;
+
+    test_fir_printf("\n=== Test FIR Q15 ===\n");
+
+    /* Test 1: cuantificación */
+    test_fir_printf("\nTest 1: Cuantificación Q15\n");
+    saturados = fir_api.cuantiza_q15(valores, 6, q);
+    for (k = 0; k < 6; k++)
+    {
+        if (q[k] != esperados[k])
+        {
+            test_fir_printf("ERROR: %f cuantificado como %d (esperado %d)\n", valores[k], q[k], esperados[k]);
+            result = TEST_KO;
+        }
+    }
+    if (saturados != 3)
+    {
+        test_fir_printf("ERROR: %u valores saturados (esperados 3)\n", saturados);
+        result = TEST_KO;
+    }
+
+    /* Test 2: salida idéntica a la referencia entera, para longitudes pares, impares y con resto de 8 */
+    test_fir_printf("\nTest 2: Salida frente a la referencia entera exacta\n");
+    srand(49);
+    for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+    {
+        entrada_q[i] = (int16_t)((rand() % 65535) - 32767);
+    }
+    for (t = 0; t < 4; t++)
+    {
+        n = longitudes[t];
+        for (k = 0; k < (int)n; k++)
+        {
+            coefs_q[k] = (int16_t)((rand() % 65535) - 32767);
+        }
+        filter_q = fir_api.get_fir_q15(n, coefs_q, z_buffer_q);
+        distintos = 0;
+        for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+        {
+            y_q = fir_api.fir_filter_q15(entrada_q[i], &filter_q);
+
+            acumulador = 0;
+            for (k = 0; k < (int)n && k <= i; k++)
+            {
+                acumulador += (int64_t)coefs_q[k] * entrada_q[i - k];
+            }
+            referencia = (long)((acumulador + 0x4000) >> 15);
+            if (referencia > Q15_MAX) referencia = Q15_MAX;
+            if (referencia < Q15_MIN) referencia = Q15_MIN;
+            if (y_q != referencia)
+            {
+                distintos++;
+            }
+        }
+        test_fir_printf("  %3u coeficientes: %u salidas distintas de la referencia\n", n, distintos);
+        if (distintos != 0)
+        {
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: saturación. Ocho coeficientes 0.5 con entrada a fondo de escala suman 4.0 */
+    test_fir_printf("\nTest 3: Saturación de la salida\n");
+    for (k = 0; k < 8; k++)
+    {
+        coefs_q[k] = 16384;
+    }
+    filter_q = fir_api.get_fir_q15(8, coefs_q, z_buffer_q);
+    for (i = 0; i < 8; i++)
+    {
+        y_q = fir_api.fir_filter_q15(Q15_MAX, &filter_q);
+    }
+    test_fir_printf("  Entrada +fondo de escala: %d (esperado %d)\n", y_q, Q15_MAX);
+    if (y_q != Q15_MAX)
+    {
+        result = TEST_KO;
+    }
+    for (i = 0; i < 8; i++)
+    {
+        y_q = fir_api.fir_filter_q15(Q15_MIN, &filter_q);
+    }
+    test_fir_printf("  Entrada -fondo de escala: %d (esperado %d)\n", y_q, Q15_MIN);
+    if (y_q != Q15_MIN)
+    {
+        result = TEST_KO;
+    }
+    if (fir_api.fir_filter_q15(1000, NULL) != 0)
+    {
+        test_fir_printf("ERROR: No retornó 0 con puntero NULL\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: SNR frente al filtro float. Paso bajo de 31 coeficientes (sinc con ventana de Hamming,
+     * corte en 0.2) y entrada aleatoria de amplitud 0.5 */
+    test_fir_printf("\nTest 4: SNR frente al filtro float\n");
+    n = 31;
+    for (k = 0; k < (int)n; k++)
+    {
+        x = k - 15.0;
+        coefs[k] = (float)(((k == 15) ? 0.4 : sin(0.4 * M_PI * x) / (M_PI * x)) *
+                           (0.54 - 0.46 * cos(2.0 * M_PI * k / (n - 1))));
+    }
+    saturados = fir_api.cuantiza_q15(coefs, n, coefs_q);
+    filter = fir_api.get_fir(n, coefs, z_buffer);
+    filter_q = fir_api.get_fir_q15(n, coefs_q, z_buffer_q);
+    senal = 0.0;
+    ruido = 0.0;
+    for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+    {
+        x = 0.5 * ((double)rand() / RAND_MAX * 2.0 - 1.0);
+        y = fir_api.fir_filter((float)x, &filter);
+        y_q = fir_api.fir_filter_q15((int16_t)lrint(x * 32768.0), &filter_q);
+        senal += y * y;
+        ruido += (y - y_q / 32768.0) * (y - y_q / 32768.0);
+    }
+    snr = 10.0 * log10(senal / ruido);
+    test_fir_printf("  SNR Q15 frente a float: %.1f dB (%u coeficientes saturados)\n", snr, saturados);
+    if (snr < 70.0 || saturados != 0)
+    {
+        test_fir_printf("ERROR: SNR inferior a 70 dB\n");
+        result = TEST_KO;
+    }
+
+    /* Tiempo por muestra con MAX_FIR_LENGTH coeficientes (informativo) */
+    for (k = 0; k < MAX_FIR_LENGTH; k++)
+    {
+        coefs[k] = 0.5f / MAX_FIR_LENGTH;
+    }
+    fir_api.cuantiza_q15(coefs, MAX_FIR_LENGTH, coefs_q);
+    filter = fir_api.get_fir(MAX_FIR_LENGTH, coefs, z_buffer);
+    filter_q = fir_api.get_fir_q15(MAX_FIR_LENGTH, coefs_q, z_buffer_q);
+    sumidero = 0.0f;
+    sumidero_q = 0;
+    inicio = clock();
+    for (k = 0; k < 50; k++)
+    {
+        for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+        {
+            sumidero += fir_api.fir_filter(entrada_q[i] / 32768.0f, &filter);
+        }
+    }
+    t_f = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    inicio = clock();
+    for (k = 0; k < 50; k++)
+    {
+        for (i = 0; i < MUESTRAS_PRECISION_FIR; i++)
+        {
+            sumidero_q += fir_api.fir_filter_q15(entrada_q[i], &filter_q);
+        }
+    }
+    t_q = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    test_fir_printf("  Tiempo por muestra (%d coeficientes): float %.1f ns, Q15 %.1f ns\n", MAX_FIR_LENGTH,
+                    t_f * 1e9 / (50.0 * MUESTRAS_PRECISION_FIR), t_q * 1e9 / (50.0 * MUESTRAS_PRECISION_FIR));
+
+    if (result == TEST_OK)
+        test_fir_printf("Test FIR Q15: PASSED\n");
+    else
+        test_fir_printf("Test FIR Q15: FAILED\n");
+
+    return result;
+}
+
 int Run_All_FIR_Tests(void)
 {
     int total_result = TEST_OK;
@@ -367,6 +710,12 @@ int Run_All_FIR_Tests(void)
     test_result = Test_FIR_Error_Handling();
     if (test_result != TEST_OK) total_result = TEST_KO;
 
+    test_result = Test_FIR_Precision();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_FIR_Q15();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
     test_fir_printf("\n========================================\n");
     if (total_result == TEST_OK)
         test_fir_printf("TODOS LOS TESTS FIR FILTER PASARON CORRECTAMENTE\n");
@@ -0,0 +1,678 @@
+/** \page test_kalman TEST UNITARIOS KALMAN
+ * \brief Módulo de pruebas unitarias para el filtro de Kalman lineal
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo Kalman. Las pruebas siguen un blanco de velocidad constante,
+ * comparan la ruta desenrollada con la ruta genérica sobre nsdsp_math y el lote SoA con
+ * filtros individuales, comprueban la conservación de la simetría y la definición positiva de
+ * la covarianza y el rechazo de medidas con S no definida positiva, y miden el coste por
+ * actualización de las tres rutas. Los tests solo se compilan y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_kalman Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en KALMAN_Tests_Result.txt
+ *
+ * \section funciones_test_kalman Descripción de funciones
+ *
+ * \subsection test_estimacion_kalman Test_Estimacion_Kalman
+ * - Seguimiento de velocidad constante: error de posición por debajo del ruido de medida y NIS
+ *   medio próximo a la dimensión de la medida
+ * - Ruta desenrollada frente a ruta genérica para n = 2..6
+ * - Covarianza simétrica y definida positiva con R muy pequeña y P inicial muy grande
+ * - Rechazo de una medida con S no definida positiva sin modificar el estado
+ * - Rechazo de parámetros inválidos
+ *
+ * \subsection test_lote_kalman Test_Lote_Kalman
+ * - Lote SoA de 72 filtros (dos grupos completos de carriles y uno parcial) idéntico a 72 filtros
+ *   individuales
+ * - Filtro con S no definida positiva dentro del lote: se rechaza solo ese filtro
+ * - Tabla de coste por filtro y actualización de las rutas genérica, desenrollada y lote. Solo en
+ *   compilaciones optimizadas (__OPTIMIZE__) se exige que el lote sea más barato por filtro que la
+ *   ruta desenrollada y esta más que la genérica; en DEBUG sin optimizar la tabla es informativa
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_kalman Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Lote con grupo parcial de carriles y coste del lote exigido por debajo de la ruta desenrollada |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Las comparaciones de coste solo se exigen en compilaciones optimizadas |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "kalman.h"
+#include "test_kalman.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_MAX_KALMAN_TEST   6
+#define M_MAX_KALMAN_TEST   3
+#define L_KALMAN_TEST       2000
+#define NF_KALMAN_TEST      72
+#define NF_COSTE_KALMAN     256
+#define L_COSTE_KALMAN      200
+#define T_KALMAN_TEST       0.01f
+
+/* Variable global para el archivo de log */
+static FILE *kalman_test_log_file = NULL;
+
+/* Buffers de test */
+static float z_kalman_test[L_KALMAN_TEST][M_MAX_KALMAN_TEST];
+static float verdad_kalman_test[L_KALMAN_TEST][N_MAX_KALMAN_TEST];
+static float zl_kalman_test[M_MAX_KALMAN_TEST * NF_COSTE_KALMAN];
+static float ws_kalman_test[KALMAN_WORKSPACE(N_MAX_KALMAN_TEST, M_MAX_KALMAN_TEST)];
+static float ws2_kalman_test[KALMAN_WORKSPACE(N_MAX_KALMAN_TEST, M_MAX_KALMAN_TEST)];
+static float lote_ws_kalman_test[KALMAN_LOTE_WORKSPACE(N_MAX_KALMAN_TEST, M_MAX_KALMAN_TEST, NF_COSTE_KALMAN)];
+static float filtros_ws_kalman_test[NF_KALMAN_TEST][KALMAN_WORKSPACE(4, 2)];
+static KALMAN_OBJECT filtros_kalman_test[NF_KALMAN_TEST];
+
+/* Declaración de funciones de test */
+int Test_Estimacion_Kalman(void);
+int Test_Lote_Kalman(void);
+int Run_All_Kalman_Tests(void);
+
+/* Funciones auxiliares */
+void test_kalman_printf(const char *format, ...);
+float ruido_kalman(void);
+void modelo_kalman(float *F, float *Q, float *H, float *R, unsigned int n, unsigned int m, float q, float r);
+void trayectoria_kalman(unsigned int n, unsigned int m, float q, float r);
+int definida_positiva_kalman(const float *P, unsigned int n);
+
+/* Definición de funciones */
+
+void test_kalman_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (kalman_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(kalman_test_log_file, format, args);
+        va_end(args);
+        fflush(kalman_test_log_file);
+    }
+}
+
+float ruido_kalman(void)
+{
+    /* Ruido uniforme de varianza unidad */
+    return 1.7320508f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+}
+
+void modelo_kalman(float *F, float *Q, float *H, float *R, unsigned int n, unsigned int m, float q, float r)
+{
+    unsigned int i, j;
+
+    /* Cadena de integradores (posición, velocidad, aceleración...) con ruido de proceso diagonal
+     * y medida de las m primeras componentes */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            F[i * n + j] = (i == j) ? 1.0f : ((j == i + 1) ? T_KALMAN_TEST : 0.0f);
+            Q[i * n + j] = (i == j) ? q : 0.0f;
+        }
+    }
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            H[i * n + j] = (i == j) ? 1.0f : 0.0f;
+        }
+        for (j = 0; j < m; j++)
+        {
+            R[i * m + j] = (i == j) ? r : 0.0f;
+        }
+    }
+}
+
+void trayectoria_kalman(unsigned int n, unsigned int m, float q, float r)
+{
+    unsigned int k, i;
+    float estado[N_MAX_KALMAN_TEST], siguiente[N_MAX_KALMAN_TEST];
+
+    /* Simulación del modelo de modelo_kalman() con ruido uniforme de las varianzas dadas */
+    for (i = 0; i < n; i++)
+    {
+        estado[i] = (i == 0) ? 1.0f : 0.5f;
+    }
+    for (k = 0; k < L_KALMAN_TEST; k++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            siguiente[i] = estado[i] + sqrtf(q) * ruido_kalman();
+            if (i + 1 < n)
+            {
+                siguiente[i] += T_KALMAN_TEST * estado[i + 1];
+            }
+        }
+        for (i = 0; i < n; i++)
+        {
+            estado[i] = siguiente[i];
+            verdad_kalman_test[k][i] = estado[i];
+        }
+        for (i = 0; i < m; i++)
+        {
+            z_kalman_test[k][i] = estado[i] + sqrtf(r) * ruido_kalman();
+        }
+    }
+}
+
+int definida_positiva_kalman(const float *P, unsigned int n)
+{
+    unsigned int i, j, k;
+    double L[N_MAX_KALMAN_TEST * N_MAX_KALMAN_TEST];
+    double d;
+
+    /* Simetría exacta y factorización de Cholesky en doble precisión */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            if (P[i * n + j] != P[j * n + i])
+            {
+                return 0;
+            }
+            L[i * n + j] = P[i * n + j];
+        }
+    }
+    for (j = 0; j < n; j++)
+    {
+        d = L[j * n + j];
+        for (k = 0; k < j; k++)
+        {
+            d -= L[j * n + k] * L[j * n + k];
+        }
+        if (!(d > 0.0))
+        {
+            return 0;
+        }
+        d = sqrt(d);
+        L[j * n + j] = d;
+        for (i = j + 1; i < n; i++)
+        {
+            for (k = 0; k < j; k++)
+            {
+                L[i * n + j] -= L[i * n + k] * L[j * n + k];
+            }
+            L[i * n + j] /= d;
+        }
+    }
+
+    return 1;
+}
+
+int Test_Estimacion_Kalman(void)
+{
+    int result = TEST_OK;
+    unsigned int k, i, n, m;
+    KALMAN_OBJECT kf, generico;
+    double error_medida, error_estimacion, nis_medio, diferencia, maxima;
+    float x_previo[N_MAX_KALMAN_TEST];
+    float z[M_MAX_KALMAN_TEST];
+    int sdp;
+
+    test_kalman_printf("\n=== Test Estimacion_Kalman ===\n");
+
+    nsdsp_math_init();
+    Init_Kalman();
+    srand(42);
+
+    /* Test 1: seguimiento de velocidad constante con medida de posición */
+    test_kalman_printf("\nTest 1: Seguimiento de velocidad constante (n = 2, m = 1)\n");
+
+    trayectoria_kalman(2, 1, 1e-6f, 1e-2f);
+    if (kalman_api.get_kalman(2, 1, ws_kalman_test, &kf) != KALMAN_OK || kf.fijo != 2)
+    {
+        test_kalman_printf("ERROR: get_kalman falló con parámetros válidos\n");
+        return TEST_KO;
+    }
+    modelo_kalman(kf.F.pmatriz, kf.Q.pmatriz, kf.H.pmatriz, kf.R.pmatriz, 2, 1, 1e-6f, 1e-2f);
+
+    error_medida = 0.0;
+    error_estimacion = 0.0;
+    nis_medio = 0.0;
+    for (k = 0; k < L_KALMAN_TEST; k++)
+    {
+        kalman_api.predice(&kf);
+        kalman_api.actualiza(z_kalman_test[k], &kf);
+        if (k >= L_KALMAN_TEST / 2)
+        {
+            error_medida += (z_kalman_test[k][0] - verdad_kalman_test[k][0]) *
+                            (z_kalman_test[k][0] - verdad_kalman_test[k][0]);
+            error_estimacion += (kf.x.pmatriz[0] - verdad_kalman_test[k][0]) *
+                                (kf.x.pmatriz[0] - verdad_kalman_test[k][0]);
+            nis_medio += kf.nis;
+        }
+    }
+    error_medida = 10.0 * log10(error_medida / (L_KALMAN_TEST / 2));
+    error_estimacion = 10.0 * log10(error_estimacion / (L_KALMAN_TEST / 2));
+    nis_medio /= (double)(L_KALMAN_TEST / 2);
+    test_kalman_printf("Error de posición: medida %.1f dB, estimación %.1f dB, NIS medio %.2f\n",
+                       error_medida, error_estimacion, nis_medio);
+    if (!(error_estimacion < error_medida - 6.0) || !(nis_medio > 0.7 && nis_medio < 1.3))
+    {
+        test_kalman_printf("ERROR: El filtro no sigue el blanco o la innovación no es consistente\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: ruta desenrollada frente a ruta genérica */
+    test_kalman_printf("\nTest 2: Ruta desenrollada frente a ruta genérica\n");
+    test_kalman_printf("  n | m | Diferencia máxima\n");
+
+    for (n = KALMAN_FIJO_MIN; n <= KALMAN_FIJO_MAX; n++)
+    {
+        m = (n + 1) / 2;
+        trayectoria_kalman(n, m, 1e-4f, 1e-2f);
+        kalman_api.get_kalman(n, m, ws_kalman_test, &kf);
+        kalman_api.get_kalman(n, m, ws2_kalman_test, &generico);
+        generico.fijo = 0;
+        modelo_kalman(kf.F.pmatriz, kf.Q.pmatriz, kf.H.pmatriz, kf.R.pmatriz, n, m, 1e-4f, 1e-2f);
+        modelo_kalman(generico.F.pmatriz, generico.Q.pmatriz, generico.H.pmatriz, generico.R.pmatriz, n, m,
+                      1e-4f, 1e-2f);
+
+        maxima = 0.0;
+        for (k = 0; k < L_KALMAN_TEST / 4; k++)
+        {
+            kalman_api.predice(&kf);
+            kalman_api.actualiza(z_kalman_test[k], &kf);
+            kalman_api.predice(&generico);
+            kalman_api.actualiza(z_kalman_test[k], &generico);
+            for (i = 0; i < n; i++)
+            {
+                diferencia = fabs(kf.x.pmatriz[i] - generico.x.pmatriz[i]) / (1.0 + fabs(generico.x.pmatriz[i]));
+                maxima = (diferencia > maxima) ? diferencia : maxima;
+            }
+            for (i = 0; i < n * n; i++)
+            {
+                diferencia = fabs(kf.P.pmatriz[i] - generico.P.pmatriz[i]) / (1e-3 + fabs(generico.P.pmatriz[i]));
+                maxima = (diferencia > maxima) ? diferencia : maxima;
+            }
+        }
+        test_kalman_printf("  %u | %u | %.2e\n", n, m, maxima);
+        if (!(maxima < 1e-3))
+        {
+            test_kalman_printf("ERROR: Las rutas desenrollada y genérica difieren para n = %u\n", n);
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: covarianza simétrica y definida positiva con un problema mal condicionado */
+    test_kalman_printf("\nTest 3: Covarianza con R = 1e-6 y P(0) = 1e4 I (forma de Joseph)\n");
+
+    n = 4;
+    m = 2;
+    trayectoria_kalman(n, m, 1e-6f, 1e-6f);
+    kalman_api.get_kalman(n, m, ws_kalman_test, &kf);
+    kalman_api.get_kalman(n, m, ws2_kalman_test, &generico);
+    generico.fijo = 0;
+    modelo_kalman(kf.F.pmatriz, kf.Q.pmatriz, kf.H.pmatriz, kf.R.pmatriz, n, m, 1e-6f, 1e-6f);
+    modelo_kalman(generico.F.pmatriz, generico.Q.pmatriz, generico.H.pmatriz, generico.R.pmatriz, n, m,
+                  1e-6f, 1e-6f);
+    for (i = 0; i < n; i++)
+    {
+        kf.P.pmatriz[i * n + i] = 1e4f;
+        generico.P.pmatriz[i * n + i] = 1e4f;
+    }
+
+    sdp = 1;
+    for (k = 0; k < L_KALMAN_TEST; k++)
+    {
+        kalman_api.predice(&kf);
+        kalman_api.predice(&generico);
+        if (kalman_api.actualiza(z_kalman_test[k], &kf) != KALMAN_OK ||
+            kalman_api.actualiza(z_kalman_test[k], &generico) != KALMAN_OK ||
+            !definida_positiva_kalman(kf.P.pmatriz, n) || !definida_positiva_kalman(generico.P.pmatriz, n))
+        {
+            sdp = 0;
+            break;
+        }
+    }
+    test_kalman_printf("P simétrica y definida positiva en %u actualizaciones: %s (P00 = %.2e)\n",
+                       k, sdp ? "sí" : "no", kf.P.pmatriz[0]);
+    if (!sdp)
+    {
+        test_kalman_printf("ERROR: La covarianza pierde la simetría o la definición positiva\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: medida rechazada con S no definida positiva */
+    test_kalman_printf("\nTest 4: Rechazo de una medida con S no definida positiva\n");
+
+    for (i = 0; i < m * m; i++)
+    {
+        kf.R.pmatriz[i] = (i % (m + 1) == 0) ? -1.0f : 0.0f;
+    }
+    for (i = 0; i < n; i++)
+    {
+        x_previo[i] = kf.x.pmatriz[i];
+    }
+    z[0] = 100.0f;
+    z[1] = 100.0f;
+    if (kalman_api.actualiza(z, &kf) != KALMAN_KO)
+    {
+        test_kalman_printf("ERROR: Se aceptó una medida con S no definida positiva\n");
+        result = TEST_KO;
+    }
+    for (i = 0; i < n; i++)
+    {
+        if (kf.x.pmatriz[i] != x_previo[i])
+        {
+            test_kalman_printf("ERROR: El estado cambió tras rechazar la medida\n");
+            result = TEST_KO;
+            break;
+        }
+    }
+
+    /* Test 5: parámetros inválidos */
+    test_kalman_printf("\nTest 5: Parámetros inválidos\n");
+
+    if (kalman_api.get_kalman(0, 1, ws_kalman_test, &kf) != KALMAN_KO ||
+        kalman_api.get_kalman(2, 0, ws_kalman_test, &kf) != KALMAN_KO ||
+        kalman_api.get_kalman(2, 1, NULL, &kf) != KALMAN_KO ||
+        kalman_api.get_kalman(2, 1, ws_kalman_test, NULL) != KALMAN_KO ||
+        kalman_api.predice(NULL) != KALMAN_KO ||
+        kalman_api.actualiza(NULL, &generico) != KALMAN_KO ||
+        kalman_api.get_lote(2, 1, 0, lote_ws_kalman_test, NULL) != KALMAN_KO)
+    {
+        test_kalman_printf("ERROR: No se rechazaron parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    kalman_api.get_kalman(4, 2, ws_kalman_test, &kf);
+    kf.fijo = 3;
+    if (kalman_api.predice(&kf) != KALMAN_KO)
+    {
+        test_kalman_printf("ERROR: Se aceptó una ruta desenrollada que no coincide con el estado\n");
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_kalman_printf("\nTest Estimacion_Kalman: PASSED\n");
+    else
+        test_kalman_printf("\nTest Estimacion_Kalman: FAILED\n");
+
+    return result;
+}
+
+int Test_Lote_Kalman(void)
+{
+    int result = TEST_OK;
+    unsigned int k, i, a, f, n, m, nf, rep;
+    KALMAN_LOTE_OBJECT lote;
+    KALMAN_OBJECT kf;
+    double diferencia, maxima, t_generico, t_fijo, t_lote;
+    float x_previo[4];
+    clock_t inicio, fin;
+
+    test_kalman_printf("\n=== Test Lote_Kalman ===\n");
+
+    nsdsp_math_init();
+    Init_Kalman();
+    srand(43);
+
+    /* Test 1: lote SoA frente a filtros individuales */
+    test_kalman_printf("\nTest 1: Lote de %u filtros (n = 4, m = 2) frente a filtros individuales\n", NF_KALMAN_TEST);
+
+    n = 4;
+    m = 2;
+    nf = NF_KALMAN_TEST;
+    trayectoria_kalman(n, m, 1e-4f, 1e-2f);
+    if (kalman_api.get_lote(n, m, nf, lote_ws_kalman_test, &lote) != KALMAN_OK)
+    {
+        test_kalman_printf("ERROR: get_lote falló con parámetros válidos\n");
+        return TEST_KO;
+    }
+    modelo_kalman(lote.F.pmatriz, lote.Q.pmatriz, lote.H.pmatriz, lote.R.pmatriz, n, m, 1e-4f, 1e-2f);
+    for (f = 0; f < nf; f++)
+    {
+        kalman_api.get_kalman(n, m, filtros_ws_kalman_test[f], &filtros_kalman_test[f]);
+        modelo_kalman(filtros_kalman_test[f].F.pmatriz, filtros_kalman_test[f].Q.pmatriz,
+                      filtros_kalman_test[f].H.pmatriz, filtros_kalman_test[f].R.pmatriz, n, m, 1e-4f, 1e-2f);
+    }
+
+    /* Cada filtro ve la trayectoria con un desplazamiento y una escala propios */
+    maxima = 0.0;
+    for (k = 0; k < L_KALMAN_TEST / 4; k++)
+    {
+        for (a = 0; a < m; a++)
+        {
+            for (f = 0; f < nf; f++)
+            {
+                zl_kalman_test[a * nf + f] = (1.0f + 0.01f * (float)f) * z_kalman_test[k][a] + 0.1f * (float)f;
+            }
+        }
+        kalman_api.predice_lote(&lote);
+        kalman_api.actualiza_lote(zl_kalman_test, &lote);
+        for (f = 0; f < nf; f++)
+        {
+            float zf[2];
+
+            zf[0] = zl_kalman_test[f];
+            zf[1] = zl_kalman_test[nf + f];
+            kalman_api.predice(&filtros_kalman_test[f]);
+            kalman_api.actualiza(zf, &filtros_kalman_test[f]);
+            for (i = 0; i < n; i++)
+            {
+                diferencia = fabs(lote.x[i * nf + f] - filtros_kalman_test[f].x.pmatriz[i]) /
+                             (1.0 + fabs(filtros_kalman_test[f].x.pmatriz[i]));
+                maxima = (diferencia > maxima) ? diferencia : maxima;
+            }
+            for (i = 0; i < n * n; i++)
+            {
+                diferencia = fabs(lote.P[i * nf + f] - filtros_kalman_test[f].P.pmatriz[i]) /
+                             (1e-3 + fabs(filtros_kalman_test[f].P.pmatriz[i]));
+                maxima = (diferencia > maxima) ? diferencia : maxima;
+            }
+            diferencia = fabs(lote.nis[f] - filtros_kalman_test[f].nis) / (1.0 + filtros_kalman_test[f].nis);
+            maxima = (diferencia > maxima) ? diferencia : maxima;
+        }
+    }
+    test_kalman_printf("Diferencia máxima lote / individual: %.2e\n", maxima);
+    if (!(maxima < 1e-3))
+    {
+        test_kalman_printf("ERROR: El lote no reproduce los filtros individuales\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: un filtro del lote con S no definida positiva */
+    test_kalman_printf("\nTest 2: Filtro con S no definida positiva dentro del lote\n");
+
+    for (i = 0; i < n * n; i++)
+    {
+        lote.P[i * nf + 5] = (i % (n + 1) == 0) ? -1.0f : 0.0f;
+    }
+    for (i = 0; i < n; i++)
+    {
+        x_previo[i] = lote.x[i * nf + 5];
+    }
+    if (kalman_api.actualiza_lote(zl_kalman_test, &lote) != KALMAN_KO || lote.fallos != 1)
+    {
+        test_kalman_printf("ERROR: El lote no detecta el filtro inválido (fallos = %u)\n", lote.fallos);
+        result = TEST_KO;
+    }
+    for (i = 0; i < n; i++)
+    {
+        if (lote.x[i * nf + 5] != x_previo[i] || !(lote.x[i * nf + 6] == lote.x[i * nf + 6]))
+        {
+            test_kalman_printf("ERROR: El filtro rechazado cambió o el resto no es finito\n");
+            result = TEST_KO;
+            break;
+        }
+    }
+    test_kalman_printf("Filtros rechazados: %u\n", lote.fallos);
+
+    /* Test 3: coste por filtro y actualización */
+    test_kalman_printf("\nTest 3: Coste por filtro y ciclo predicción + actualización (%u filtros)\n", NF_COSTE_KALMAN);
+    test_kalman_printf("  n | m | Genérica (ns) | Desenrollada (ns) | Lote (ns)\n");
+
+    t_generico = 0.0;
+    t_fijo = 0.0;
+    nf = NF_COSTE_KALMAN;
+    for (n = 2; n <= N_MAX_KALMAN_TEST; n += 2)
+    {
+        m = n / 2;
+        trayectoria_kalman(n, m, 1e-4f, 1e-2f);
+
+        kalman_api.get_kalman(n, m, ws_kalman_test, &kf);
+        modelo_kalman(kf.F.pmatriz, kf.Q.pmatriz, kf.H.pmatriz, kf.R.pmatriz, n, m, 1e-4f, 1e-2f);
+        kf.fijo = 0;
+        inicio = clock();
+        for (rep = 0; rep < nf; rep++)
+        {
+            for (k = 0; k < L_COSTE_KALMAN; k++)
+            {
+                kalman_api.predice(&kf);
+                kalman_api.actualiza(z_kalman_test[k], &kf);
+            }
+        }
+        fin = clock();
+        t_generico = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)(nf * L_COSTE_KALMAN);
+
+        kalman_api.get_kalman(n, m, ws_kalman_test, &kf);
+        modelo_kalman(kf.F.pmatriz, kf.Q.pmatriz, kf.H.pmatriz, kf.R.pmatriz, n, m, 1e-4f, 1e-2f);
+        inicio = clock();
+        for (rep = 0; rep < nf; rep++)
+        {
+            for (k = 0; k < L_COSTE_KALMAN; k++)
+            {
+                kalman_api.predice(&kf);
+                kalman_api.actualiza(z_kalman_test[k], &kf);
+            }
+        }
+        fin = clock();
+        t_fijo = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)(nf * L_COSTE_KALMAN);
+
+        kalman_api.get_lote(n, m, nf, lote_ws_kalman_test, &lote);
+        modelo_kalman(lote.F.pmatriz, lote.Q.pmatriz, lote.H.pmatriz, lote.R.pmatriz, n, m, 1e-4f, 1e-2f);
+        inicio = clock();
+        for (k = 0; k < L_COSTE_KALMAN; k++)
+        {
+            for (a = 0; a < m; a++)
+            {
+                for (f = 0; f < nf; f++)
+                {
+                    zl_kalman_test[a * nf + f] = z_kalman_test[k][a];
+                }
+            }
+            kalman_api.predice_lote(&lote);
+            kalman_api.actualiza_lote(zl_kalman_test, &lote);
+        }
+        fin = clock();
+        t_lote = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)(nf * L_COSTE_KALMAN);
+
+        test_kalman_printf("  %u | %u | %13.1f | %17.1f | %9.1f\n", n, m, t_generico, t_fijo, t_lote);
+
+        /* Los costes solo se exigen en compilaciones optimizadas: sin optimizar no se desenrolla ni
+         * se vectoriza nada y la tabla queda solo como referencia */
+#ifdef __OPTIMIZE__
+        if (!(t_lote < t_fijo))
+        {
+            test_kalman_printf("ERROR: El lote no es más barato por filtro que la ruta desenrollada para n = %u\n", n);
+            result = TEST_KO;
+        }
+#endif
+    }
+
+#ifdef __OPTIMIZE__
+    if (!(t_fijo < t_generico))
+    {
+        test_kalman_printf("ERROR: La ruta desenrollada no es más barata que la genérica para n = %u\n",
+                           N_MAX_KALMAN_TEST);
+        result = TEST_KO;
+    }
+#else
+    test_kalman_printf("Compilación sin optimizar: la tabla de coste es informativa y no se exige\n");
+#endif
+
+    if (result == TEST_OK)
+        test_kalman_printf("\nTest Lote_Kalman: PASSED\n");
+    else
+        test_kalman_printf("\nTest Lote_Kalman: FAILED\n");
+
+    return result;
+}
+
+int Run_All_Kalman_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    kalman_test_log_file = fopen("KALMAN_Tests_Result.txt", "a");
+    if (kalman_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de Kalman\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_kalman_printf("\n\n########################################\n");
+        test_kalman_printf("# KALMAN Unit Tests\n");
+        test_kalman_printf("# Fecha y hora: %s\n", time_string);
+        test_kalman_printf("########################################\n");
+    }
+
+    test_kalman_printf("\n========================================\n");
+    test_kalman_printf("    EJECUTANDO TESTS KALMAN\n");
+    test_kalman_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Estimacion_Kalman();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Lote_Kalman();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_kalman_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_kalman_printf("TODOS LOS TESTS KALMAN PASARON CORRECTAMENTE\n");
+    else
+        test_kalman_printf("ALGUNOS TESTS KALMAN FALLARON\n");
+    test_kalman_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (kalman_test_log_file != NULL)
+    {
+        test_kalman_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_kalman_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_kalman_printf("FAILURE - Algunos tests fallaron\n");
+        test_kalman_printf("########################################\n\n");
+
+        fclose(kalman_test_log_file);
+        kalman_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
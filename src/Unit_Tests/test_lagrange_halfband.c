@@ -54,10 +54,20 @@
  * }
  * \enddot
  *
+ * \subsection test_lagrange_m_grande Test_Lagrange_M_Grande
+ * Prueba la precisión de la recurrencia de razones para m pequeños y grandes.
+ *
+ * Las pruebas incluyen:
+ * - Coeficientes de lagrange_halfband_d frente a los racionales exactos para m = 1..4 (error relativo < 1e-14)
+ * - Coeficientes de m = 64 y m = 128 frente a valores de referencia en aritmética exacta (error relativo < 1e-13)
+ * - Suma de coeficientes igual a 1, simetría y taps pares nulos hasta m = 128
+ * - La versión float de m = 64 coincide con la double redondeada a float
+ * - Selectividad: |H(0.6π)| < 1e-3 con m = 64, mostrando también m = 3 y m = 10
+ *
  * \subsection run_all_lagrange Run_All_Lagrange_Tests
  * Función principal que ejecuta todos los tests y genera el reporte.
  * - Abre archivo de log con timestamp
- * - Ejecuta Test_Lagrange_Halfband
+ * - Ejecuta Test_Lagrange_Halfband y Test_Lagrange_M_Grande
  * - Genera resumen de resultados
  * - Cierra archivo de log
  *
@@ -72,6 +82,7 @@
  * |:-----:|:-----:|:-------:|:------------|
  * | 04/08/2025 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
  * | 14/08/2025 | Dr. Carlos Romero | 2 | Separación de tests a archivo independiente |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Test_Lagrange_M_Grande: valores exactos y m grandes en double |
  *
  * \copyright ZGR R&D AIE
  */
@@ -95,6 +106,7 @@ static FILE *lagrange_test_log_file = NULL;
 
 /* Declaración de funciones de test */
 int Test_Lagrange_Halfband(void);
+int Test_Lagrange_M_Grande(void);
 int Run_All_Lagrange_Tests(void);
 void test_lagrange_printf(const char *format, ...);
 int float_equals_lagrange(float a, float b, float epsilon);
@@ -274,6 +286,173 @@ int Test_Lagrange_Halfband(void)
     return result;
 }
 
+/* Respuesta en frecuencia de media banda: H(w) = 1/2 + 2 Σ h_l cos((2l-1) w) */
+static double respuesta_lagrange(int m, const double *h0, double w)
+{
+    int l;
+    double suma = h0[2 * m - 1];
+
+    for (l = 1; l <= m; l++)
+    {
+        suma += 2.0 * h0[2 * m - 1 + (2 * l - 1)] * cos((2 * l - 1) * w);
+    }
+    return suma;
+}
+
+int Test_Lagrange_M_Grande(void)
+{
+    /* Valores exactos de h_l para m = 1..4 */
+    static const double exactos[4][4] = {
+        { 1.0 / 4.0 },
+        { 9.0 / 32.0, -1.0 / 32.0 },
+        { 75.0 / 256.0, -25.0 / 512.0, 3.0 / 512.0 },
+        { 1225.0 / 4096.0, -245.0 / 4096.0, 49.0 / 4096.0, -5.0 / 4096.0 }
+    };
+    /* Referencias en aritmética exacta para m = 64 y m = 128: pares (l, h_l) */
+    static const struct { int m; int l; double h; } referencias[] = {
+        { 64,   1,  3.17068926141815366e-01 },
+        { 64,   2, -1.02437653061201894e-01 },
+        { 64,   3,  5.77375862708592522e-02 },
+        { 64,   8, -8.79395260879635605e-03 },
+        { 64,  16, -2.31685729710596068e-04 },
+        { 64,  32, -4.65796036515144042e-10 },
+        { 64,  48, -2.27626950230435279e-20 },
+        { 64,  64, -2.08474844024717165e-40 },
+        { 128,   1,  3.17688795498139942e-01 },
+        { 128,   2, -1.04254462605332748e-01 },
+        { 128,  64, -1.23870615628492483e-17 },
+        { 128, 128, -4.31933470793574183e-79 }
+    };
+    static const int m_selectividad[3] = { 3, 10, 64 };
+    static double hd[4 * 128 - 1];
+    static float hf[4 * 64 - 1];
+    int result = TEST_OK;
+    int m, l, i, n, centro;
+    double error, suma, h_alta;
+
+    test_lagrange_printf("\n=== Test Lagrange M Grande ===\n");
+
+    /* Test 1: Valores exactos para m = 1..4 */
+    test_lagrange_printf("\nTest 1: Valores exactos m=1..4\n");
+    for (m = 1; m <= 4; m++)
+    {
+        if (lagrange_halfband_d(m, hd) != LAGRANGE_OK)
+        {
+            test_lagrange_printf("ERROR: Fallo en cálculo double para m=%d\n", m);
+            result = TEST_KO;
+            continue;
+        }
+        for (l = 1; l <= m; l++)
+        {
+            error = fabs(hd[2 * m - 1 + (2 * l - 1)] - exactos[m - 1][l - 1]) / fabs(exactos[m - 1][l - 1]);
+            if (error > 1e-14)
+            {
+                test_lagrange_printf("ERROR: m=%d l=%d error relativo %.3e\n", m, l, error);
+                result = TEST_KO;
+            }
+        }
+    }
+
+    /* Test 2: Referencias para m = 64 y m = 128 */
+    test_lagrange_printf("\nTest 2: Referencias m=64 y m=128\n");
+    m = 0;
+    for (i = 0; i < (int)(sizeof(referencias) / sizeof(referencias[0])); i++)
+    {
+        if (referencias[i].m != m)
+        {
+            m = referencias[i].m;
+            if (lagrange_halfband_d(m, hd) != LAGRANGE_OK)
+            {
+                test_lagrange_printf("ERROR: Fallo en cálculo double para m=%d\n", m);
+                return TEST_KO;
+            }
+        }
+        l = referencias[i].l;
+        error = fabs(hd[2 * m - 1 + (2 * l - 1)] - referencias[i].h) / fabs(referencias[i].h);
+        test_lagrange_printf("m=%3d l=%3d h=% .17e error relativo %.3e\n", m, l, hd[2 * m - 1 + (2 * l - 1)], error);
+        if (error > 1e-13)
+        {
+            test_lagrange_printf("ERROR: Referencia no alcanzada\n");
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: Suma, simetría y taps pares nulos hasta m = 128 */
+    test_lagrange_printf("\nTest 3: Estructura de media banda m=1..128\n");
+    for (m = 1; m <= 128; m++)
+    {
+        lagrange_halfband_d(m, hd);
+        n = 4 * m - 1;
+        centro = 2 * m - 1;
+        suma = 0.0;
+        for (i = 0; i < n; i++)
+        {
+            suma += hd[i];
+            if (hd[i] != hd[n - 1 - i])
+            {
+                test_lagrange_printf("ERROR: m=%d no simétrico en posición %d\n", m, i);
+                result = TEST_KO;
+                break;
+            }
+            if (i != centro && ((i - centro) & 1) == 0 && hd[i] != 0.0)
+            {
+                test_lagrange_printf("ERROR: m=%d tap par no nulo en posición %d\n", m, i);
+                result = TEST_KO;
+                break;
+            }
+        }
+        if (fabs(suma - 1.0) > 1e-13 || hd[centro] != 0.5)
+        {
+            test_lagrange_printf("ERROR: m=%d suma %.17g centro %.17g\n", m, suma, hd[centro]);
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 4: Versión float frente a double redondeada */
+    test_lagrange_printf("\nTest 4: Float frente a double para m=64\n");
+    m = 64;
+    if (lagrange_halfband(m, hf) != LAGRANGE_OK || lagrange_halfband_d(m, hd) != LAGRANGE_OK)
+    {
+        test_lagrange_printf("ERROR: Fallo en cálculo para m=64\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        for (i = 0; i < 4 * m - 1; i++)
+        {
+            if (hf[i] != (float)hd[i])
+            {
+                test_lagrange_printf("ERROR: Posición %d float %.9g double %.17g\n", i, hf[i], hd[i]);
+                result = TEST_KO;
+                break;
+            }
+        }
+    }
+
+    /* Test 5: Selectividad en la banda de rechazo */
+    test_lagrange_printf("\nTest 5: Selectividad\n");
+    for (i = 0; i < 3; i++)
+    {
+        m = m_selectividad[i];
+        lagrange_halfband_d(m, hd);
+        h_alta = fabs(respuesta_lagrange(m, hd, 0.6 * M_PI));
+        test_lagrange_printf("m=%2d: H(0.4π)=%.6f |H(0.6π)|=%.3e\n", m,
+                             respuesta_lagrange(m, hd, 0.4 * M_PI), h_alta);
+        if (m == 64 && h_alta > 1e-3)
+        {
+            test_lagrange_printf("ERROR: Rechazo insuficiente para m=64\n");
+            result = TEST_KO;
+        }
+    }
+
+    if (result == TEST_OK)
+        test_lagrange_printf("\nTest Lagrange M Grande: PASSED\n");
+    else
+        test_lagrange_printf("\nTest Lagrange M Grande: FAILED\n");
+
+    return result;
+}
+
 int Run_All_Lagrange_Tests(void)
 {
     int total_result = TEST_OK;
@@ -306,6 +485,9 @@ int Run_All_Lagrange_Tests(void)
     test_result = Test_Lagrange_Halfband();
     if (test_result != TEST_OK) total_result = TEST_KO;
 
+    test_result = Test_Lagrange_M_Grande();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
     test_lagrange_printf("\n========================================\n");
     if (total_result == TEST_OK)
         test_lagrange_printf("TODOS LOS TESTS LAGRANGE PASARON CORRECTAMENTE\n");
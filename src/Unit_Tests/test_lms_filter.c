@@ -0,0 +1,481 @@
+/** \page test_lms_filter TEST UNITARIOS LMS FILTER
+ * \brief Módulo de pruebas unitarias para los filtros adaptativos LMS
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo LMS_Filter. Las pruebas comparan el bucle fusionado con una
+ * implementación de referencia de dos pasadas y validan la convergencia de LMS, NLMS y LMS
+ * con fugas en un problema de identificación de sistemas. Los tests solo se compilan y
+ * ejecutan en modo DEBUG.
+ *
+ * \section uso_test_lms Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en LMS_Tests_Result.txt
+ *
+ * \section funciones_test_lms Descripción de funciones
+ *
+ * \subsection test_fusion_lms Test_Fusion_LMS
+ * Verifica el bucle fusionado:
+ * - Salidas y coeficientes frente al LMS clásico de dos pasadas para los tres tipos
+ * - Modo por bloques y sincroniza_lms idénticos al modo muestra a muestra
+ * - Rechazo de parámetros inválidos
+ *
+ * \subsection test_convergencia_lms Test_Convergencia_LMS
+ * Identificación de un sistema FIR de 32 coeficientes:
+ * - LMS: desajuste final por debajo de -30 dB
+ * - NLMS: convergencia con una entrada de potencia 10^4 sin reajustar el paso
+ * - LMS con fugas: convergencia a la solución sesgada \f$ \sigma^2 h / (\sigma^2 + \gamma) \f$
+ * - Coste por muestra frente a la implementación de dos pasadas
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_lms Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "lms_filter.h"
+#include "test_lms_filter.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_LMS_TEST          13          /* Impar para cubrir el resto del bucle por carriles */
+#define L_LMS_TEST          3000
+#define N_SISTEMA_LMS       32
+#define L_SISTEMA_LMS       40000
+#define N_RENDIMIENTO_LMS   128
+
+/* Variable global para el archivo de log */
+static FILE *lms_test_log_file = NULL;
+
+/* Buffers de test */
+static float x_lms_test[L_SISTEMA_LMS];
+static float d_lms_test[L_SISTEMA_LMS];
+static float y_lms_test[L_SISTEMA_LMS];
+static float e_lms_test[L_SISTEMA_LMS];
+static float w_lms_test[N_RENDIMIENTO_LMS];
+static float w_ref_lms_test[N_RENDIMIENTO_LMS];
+static float z_lms_test[LMS_RETARDO(N_RENDIMIENTO_LMS)];
+static float z_ref_lms_test[N_RENDIMIENTO_LMS];
+static float h_lms_test[N_SISTEMA_LMS];
+
+/* Declaración de funciones de test */
+int Test_Fusion_LMS(void);
+int Test_Convergencia_LMS(void);
+int Run_All_LMS_Tests(void);
+
+/* Funciones auxiliares */
+void test_lms_printf(const char *format, ...);
+float referencia_lms(float xn, float dn, unsigned int n, LMS_TIPO tipo, float mu, float parametro,
+                     float *w, float *z);
+double desajuste_lms(const float *w, const float *h, unsigned int n, float escala);
+
+/* Definición de funciones */
+
+void test_lms_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (lms_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(lms_test_log_file, format, args);
+        va_end(args);
+        fflush(lms_test_log_file);
+    }
+}
+
+float referencia_lms(float xn, float dn, unsigned int n, LMS_TIPO tipo, float mu, float parametro,
+                     float *w, float *z)
+{
+    unsigned int i;
+    float y, e, g, energia, alfa;
+
+    /* LMS clásico: desplazamiento de la línea de retardo, filtrado y actualización en pasadas separadas */
+    for (i = n - 1; i > 0; i--)
+    {
+        z[i] = z[i - 1];
+    }
+    z[0] = xn;
+
+    y = 0.0f;
+    energia = 0.0f;
+    for (i = 0; i < n; i++)
+    {
+        y += w[i] * z[i];
+        energia += z[i] * z[i];
+    }
+
+    e = dn - y;
+    alfa = (tipo == LMS_FUGAS) ? 1.0f - mu * parametro : 1.0f;
+    g = (tipo == LMS_NORMALIZADO) ? mu * e / (parametro + energia) : mu * e;
+
+    for (i = 0; i < n; i++)
+    {
+        w[i] = alfa * w[i] + g * z[i];
+    }
+
+    return y;
+}
+
+double desajuste_lms(const float *w, const float *h, unsigned int n, float escala)
+{
+    unsigned int i;
+    double error, norma;
+
+    /* ||w - escala h||^2 / ||escala h||^2 */
+    error = 0.0;
+    norma = 0.0;
+    for (i = 0; i < n; i++)
+    {
+        error += ((double)w[i] - escala * h[i]) * ((double)w[i] - escala * h[i]);
+        norma += (double)escala * h[i] * escala * h[i];
+    }
+
+    return error / norma;
+}
+
+int Test_Fusion_LMS(void)
+{
+    int result = TEST_OK;
+    unsigned int i, t, posicion, bloque;
+    LMS_OBJECT lms, bloques;
+    float y, diferencia_y, diferencia_w, escala;
+    static float w_bloques[N_LMS_TEST];
+    static float z_bloques[LMS_RETARDO(N_LMS_TEST)];
+    const LMS_TIPO tipos[3] = {LMS_ESTANDAR, LMS_NORMALIZADO, LMS_FUGAS};
+    const float mus[3] = {0.02f, 0.3f, 0.02f};
+    const float parametros[3] = {0.0f, 1e-3f, 0.5f};
+    const char *nombres[3] = {"LMS", "NLMS", "LMS con fugas"};
+
+    test_lms_printf("\n=== Test Fusion_LMS ===\n");
+
+    Init_Fir();
+    Init_LMS();
+    srand(38);
+
+    for (i = 0; i < L_LMS_TEST; i++)
+    {
+        x_lms_test[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+        d_lms_test[i] = 0.7f * x_lms_test[i] + ((i > 2) ? 0.3f * x_lms_test[i - 3] : 0.0f) +
+                        0.1f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+    }
+
+    /* Test 1: bucle fusionado frente al LMS clásico */
+    test_lms_printf("\nTest 1: Bucle fusionado frente al LMS de dos pasadas (N = %u)\n", N_LMS_TEST);
+
+    for (t = 0; t < 3; t++)
+    {
+        for (i = 0; i < N_LMS_TEST; i++)
+        {
+            w_lms_test[i] = 0.0f;
+            w_ref_lms_test[i] = 0.0f;
+            z_ref_lms_test[i] = 0.0f;
+        }
+
+        if (lms_api.get_lms(N_LMS_TEST, w_lms_test, z_lms_test, tipos[t], mus[t], parametros[t], &lms) != LMS_OK)
+        {
+            test_lms_printf("ERROR: get_lms falló con parámetros válidos\n");
+            return TEST_KO;
+        }
+
+        diferencia_y = 0.0f;
+        for (i = 0; i < L_LMS_TEST; i++)
+        {
+            y = lms_api.lms_filter(x_lms_test[i], d_lms_test[i], &lms);
+            diferencia_y = fmaxf(diferencia_y, fabsf(y - referencia_lms(x_lms_test[i], d_lms_test[i], N_LMS_TEST,
+                                                                         tipos[t], mus[t], parametros[t],
+                                                                         w_ref_lms_test, z_ref_lms_test)));
+        }
+
+        lms_api.sincroniza_lms(&lms);
+        diferencia_w = 0.0f;
+        escala = 0.0f;
+        for (i = 0; i < N_LMS_TEST; i++)
+        {
+            diferencia_w = fmaxf(diferencia_w, fabsf(w_lms_test[i] - w_ref_lms_test[i]));
+            escala = fmaxf(escala, fabsf(w_ref_lms_test[i]));
+        }
+
+        test_lms_printf("%-14s: diferencia máxima en y %.2e, en w %.2e (|w| máx %.3f)\n",
+                        nombres[t], diferencia_y, diferencia_w, escala);
+        if (diferencia_y > 1e-4f || diferencia_w > 1e-4f * escala)
+        {
+            test_lms_printf("ERROR: El bucle fusionado no coincide con el LMS clásico\n");
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 2: bloques de tamaño variable y sincronizaciones intermedias */
+    test_lms_printf("\nTest 2: Modo por bloques con sincronizaciones intermedias\n");
+
+    for (i = 0; i < N_LMS_TEST; i++)
+    {
+        w_lms_test[i] = 0.0f;
+        w_bloques[i] = 0.0f;
+    }
+
+    lms_api.get_lms(N_LMS_TEST, w_lms_test, z_lms_test, LMS_NORMALIZADO, 0.3f, 1e-3f, &lms);
+    lms_api.get_lms(N_LMS_TEST, w_bloques, z_bloques, LMS_NORMALIZADO, 0.3f, 1e-3f, &bloques);
+
+    for (i = 0; i < L_LMS_TEST; i++)
+    {
+        y_lms_test[i] = lms_api.lms_filter(x_lms_test[i], d_lms_test[i], &lms);
+        e_lms_test[i] = lms.error;
+    }
+
+    diferencia_y = 0.0f;
+    posicion = 0;
+    while (posicion < L_LMS_TEST)
+    {
+        bloque = 1 + (unsigned int)rand() % 300;
+        if (bloque > L_LMS_TEST - posicion)
+        {
+            bloque = L_LMS_TEST - posicion;
+        }
+
+        /* Salida in-place sobre una copia de d */
+        for (i = 0; i < bloque; i++)
+        {
+            d_lms_test[L_LMS_TEST + posicion + i] = d_lms_test[posicion + i];
+        }
+        lms_api.lms_bloque(&x_lms_test[posicion], &d_lms_test[L_LMS_TEST + posicion],
+                           &d_lms_test[L_LMS_TEST + posicion], NULL, bloque, &bloques);
+        lms_api.sincroniza_lms(&bloques);
+
+        for (i = 0; i < bloque; i++)
+        {
+            diferencia_y = fmaxf(diferencia_y, fabsf(d_lms_test[L_LMS_TEST + posicion + i] - y_lms_test[posicion + i]));
+        }
+        posicion += bloque;
+    }
+
+    test_lms_printf("Diferencia máxima: %.2e\n", diferencia_y);
+    if (diferencia_y > 1e-5f || fabsf(bloques.error - e_lms_test[L_LMS_TEST - 1]) > 1e-5f)
+    {
+        test_lms_printf("ERROR: El modo por bloques no coincide con el modo muestra a muestra\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: parámetros inválidos */
+    test_lms_printf("\nTest 3: Parámetros inválidos\n");
+
+    if (lms_api.get_lms(0, w_lms_test, z_lms_test, LMS_ESTANDAR, 0.1f, 0.0f, &lms) != LMS_KO ||
+        lms_api.get_lms(8, NULL, z_lms_test, LMS_ESTANDAR, 0.1f, 0.0f, &lms) != LMS_KO ||
+        lms_api.get_lms(8, w_lms_test, NULL, LMS_ESTANDAR, 0.1f, 0.0f, &lms) != LMS_KO ||
+        lms_api.get_lms(8, w_lms_test, z_lms_test, LMS_ESTANDAR, 0.0f, 0.0f, &lms) != LMS_KO ||
+        lms_api.get_lms(8, w_lms_test, z_lms_test, LMS_NORMALIZADO, 0.1f, -1.0f, &lms) != LMS_KO ||
+        lms_api.get_lms(8, w_lms_test, z_lms_test, LMS_FUGAS, 0.1f, 10.0f, &lms) != LMS_KO ||
+        lms_api.get_lms(8, w_lms_test, z_lms_test, LMS_ESTANDAR, 0.1f, 0.0f, NULL) != LMS_KO ||
+        lms_api.lms_filter(1.0f, 1.0f, NULL) != 0.0f ||
+        lms_api.lms_bloque(NULL, d_lms_test, NULL, NULL, 4, &lms) != LMS_KO ||
+        lms_api.sincroniza_lms(NULL) != LMS_KO)
+    {
+        test_lms_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_lms_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_lms_printf("\nTest Fusion_LMS: PASSED\n");
+    else
+        test_lms_printf("\nTest Fusion_LMS: FAILED\n");
+
+    return result;
+}
+
+int Test_Convergencia_LMS(void)
+{
+    int result = TEST_OK;
+    unsigned int i, k, t;
+    LMS_OBJECT lms;
+    double desajuste, limite;
+    float escala_x, esperado, varianza;
+    clock_t inicio, fin;
+    double t_fusion, t_referencia;
+    const LMS_TIPO tipos[3] = {LMS_ESTANDAR, LMS_NORMALIZADO, LMS_FUGAS};
+    const float mus[3] = {0.01f, 0.2f, 0.005f};
+    const float entradas[3] = {1.0f, 100.0f, 1.0f};
+    const char *nombres[3] = {"LMS", "NLMS", "LMS con fugas"};
+
+    test_lms_printf("\n=== Test Convergencia_LMS ===\n");
+
+    Init_Fir();
+    Init_LMS();
+    srand(39);
+
+    /* Sistema desconocido: respuesta exponencial con signos aleatorios */
+    for (k = 0; k < N_SISTEMA_LMS; k++)
+    {
+        h_lms_test[k] = (float)exp(-0.1 * k) * (((rand() & 1) != 0) ? 1.0f : -1.0f);
+    }
+
+    /* Entrada uniforme en [-1, 1): varianza 1/3 */
+    varianza = 1.0f / 3.0f;
+
+    /* Test 1: identificación del sistema */
+    test_lms_printf("\nTest 1: Identificación de un sistema de %u coeficientes (%u muestras)\n",
+                    N_SISTEMA_LMS, L_SISTEMA_LMS);
+
+    for (t = 0; t < 3; t++)
+    {
+        escala_x = entradas[t];
+        for (i = 0; i < L_SISTEMA_LMS; i++)
+        {
+            x_lms_test[i] = escala_x * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+        }
+        for (i = 0; i < L_SISTEMA_LMS; i++)
+        {
+            d_lms_test[i] = 1e-3f * escala_x * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+            for (k = 0; k < N_SISTEMA_LMS && k <= i; k++)
+            {
+                d_lms_test[i] += h_lms_test[k] * x_lms_test[i - k];
+            }
+        }
+
+        for (k = 0; k < N_SISTEMA_LMS; k++)
+        {
+            w_lms_test[k] = 0.0f;
+        }
+
+        /* LMS con fugas: gamma = varianza / 4, la solución es 0.8 h */
+        lms_api.get_lms(N_SISTEMA_LMS, w_lms_test, z_lms_test, tipos[t], mus[t],
+                        (tipos[t] == LMS_FUGAS) ? 0.25f * varianza : 1e-6f, &lms);
+        lms_api.lms_bloque(x_lms_test, d_lms_test, NULL, e_lms_test, L_SISTEMA_LMS, &lms);
+        lms_api.sincroniza_lms(&lms);
+
+        esperado = (tipos[t] == LMS_FUGAS) ? varianza / (varianza + 0.25f * varianza) : 1.0f;
+        desajuste = desajuste_lms(w_lms_test, h_lms_test, N_SISTEMA_LMS, esperado);
+        limite = (tipos[t] == LMS_FUGAS) ? 1e-2 : 1e-3;
+
+        test_lms_printf("%-14s (entrada x%-5.0f): desajuste %.1f dB frente a %.2f h (límite %.0f dB)\n",
+                        nombres[t], escala_x, 10.0 * log10(desajuste), esperado, 10.0 * log10(limite));
+        if (!(desajuste < limite))
+        {
+            test_lms_printf("ERROR: %s no converge a la solución esperada\n", nombres[t]);
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 2: coste del bucle fusionado frente a dos pasadas */
+    test_lms_printf("\nTest 2: Coste por muestra (N = %u)\n", N_RENDIMIENTO_LMS);
+
+    for (k = 0; k < N_RENDIMIENTO_LMS; k++)
+    {
+        w_lms_test[k] = 0.0f;
+        w_ref_lms_test[k] = 0.0f;
+        z_ref_lms_test[k] = 0.0f;
+    }
+    lms_api.get_lms(N_RENDIMIENTO_LMS, w_lms_test, z_lms_test, LMS_NORMALIZADO, 0.1f, 1e-6f, &lms);
+
+    inicio = clock();
+    lms_api.lms_bloque(x_lms_test, d_lms_test, y_lms_test, NULL, L_SISTEMA_LMS, &lms);
+    fin = clock();
+    t_fusion = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_SISTEMA_LMS;
+
+    inicio = clock();
+    for (i = 0; i < L_SISTEMA_LMS; i++)
+    {
+        y_lms_test[i] = referencia_lms(x_lms_test[i], d_lms_test[i], N_RENDIMIENTO_LMS, LMS_NORMALIZADO, 0.1f,
+                                       1e-6f, w_ref_lms_test, z_ref_lms_test);
+    }
+    fin = clock();
+    t_referencia = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_SISTEMA_LMS;
+
+    test_lms_printf("Fusionado: %.1f ns/muestra, dos pasadas: %.1f ns/muestra\n", t_fusion, t_referencia);
+
+    if (result == TEST_OK)
+        test_lms_printf("\nTest Convergencia_LMS: PASSED\n");
+    else
+        test_lms_printf("\nTest Convergencia_LMS: FAILED\n");
+
+    return result;
+}
+
+int Run_All_LMS_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    lms_test_log_file = fopen("LMS_Tests_Result.txt", "a");
+    if (lms_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de LMS\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_lms_printf("\n\n########################################\n");
+        test_lms_printf("# LMS Unit Tests\n");
+        test_lms_printf("# Fecha y hora: %s\n", time_string);
+        test_lms_printf("########################################\n");
+    }
+
+    test_lms_printf("\n========================================\n");
+    test_lms_printf("    EJECUTANDO TESTS LMS\n");
+    test_lms_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Fusion_LMS();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Convergencia_LMS();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_lms_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_lms_printf("TODOS LOS TESTS LMS PASARON CORRECTAMENTE\n");
+    else
+        test_lms_printf("ALGUNOS TESTS LMS FALLARON\n");
+    test_lms_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (lms_test_log_file != NULL)
+    {
+        test_lms_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_lms_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_lms_printf("FAILURE - Algunos tests fallaron\n");
+        test_lms_printf("########################################\n\n");
+
+        fclose(lms_test_log_file);
+        lms_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
@@ -12,7 +12,7 @@
  * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
  * \code
  * // Compilar en modo DEBUG
- * gcc -DDEBUG -o test_nsdsp *.c -lm
+ * gcc -DDEBUG -pthread -o test_nsdsp *.c -lm
  *
  * // Ejecutar tests
  * ./test_nsdsp
@@ -76,11 +76,68 @@
  * }
  * \enddot
  *
+ * \subsection test_factorizaciones_math Test_Factorizaciones
+ * Verifica las factorizaciones y resoluciones sobre matrices aleatorias:
+ * - Cholesky de 100×100 (no múltiplo del bloque): reconstrucción, residuo y variante in situ idéntica
+ * - LU con pivotaje parcial: reconstrucción de P^T L U, residuo y detección de matriz singular
+ * - QR de 120×50: recuperación de la solución exacta y R^T R = A^T A
+ * - Las ocho variantes de la sustitución triangular
+ * - Dimensiones incompatibles, punteros NULL y diagonal nula
+ *
+ * \subsection test_rendimiento_math Test_Rendimiento_Factorizaciones
+ * Tabla de MFLOP/s de Cholesky, LU, QR y sustitución triangular para órdenes 32..256.
+ *
+ * \subsection test_vistas_math Test_Vistas
+ * - Producto alfa A B + beta C con las ocho combinaciones de vistas traspuestas sobre submatrices,
+ *   comprobando que no se modifica nada fuera de la vista de C
+ * - beta = 0 no lee C y product coincide exactamente con el producto sobre vistas densas
+ * - Acumulación C += A B y suma in situ sobre una ventana deslizante
+ * - Vistas fuera de rango, paso insuficiente y dimensiones incompatibles
+ * - MFLOP/s de A B^T con vista traspuesta frente a copia traspuesta y product
+ *
+ * \subsection test_paralelo_math Test_Producto_Paralelo
+ * - El producto repartido en 2..8 tareas (filas, columnas, vistas traspuestas) es idéntico al serie
+ * - Configuración paralela inválida
+ * - MFLOP/s del producto 256×256 de 1 a N hilos (tiempo real); con un solo núcleo se indica en
+ *   la salida y solo se mide 1 hilo
+ *
+ * El ejecutor de prueba usa hilos POSIX donde están disponibles (compilar con -pthread) y ejecuta
+ * en serie en el resto. Los hilos se crean una vez y se reutilizan en todas las llamadas, de modo
+ * que las medidas no incluyen la creación de hilos; se detienen al final de
+ * Run_All_NSDSP_Math_Tests.
+ *
+ * \subsection test_lote_math Test_Producto_Lote
+ * - Lotes de matrices de 4×4 a 32×32: resultado y MFLOP/s frente a un product por matriz
+ * - Mismo resultado repartido en tareas
+ * - MFLOP/s del lote de 8×8 de 1 a N hilos, o solo con 1 hilo y el aviso si hay un único núcleo
+ * - Lotes de tamaño o dimensiones incompatibles
+ *
+ * \subsection test_dispersa_math Test_Matriz_Dispersa
+ * - SpMV y SpMM en CSR de bloques 1, 2, 3, 4 y 8 frente a la densa podada (columnas no múltiplo del bloque,
+ *   X de 19 columnas: dos grupos de NSDSP_MATH_DISPERSA_CARRILES y tres restantes)
+ * - Capacidad insuficiente, bloques fuera de rango y dimensiones incompatibles
+ * - Tiempo de W x de 256×256 densa, CSR y CSR 1×4 entre el 1% y el 100% de densidad, y densidad de cruce
+ *
+ * \subsection test_preparada_math Test_Operacion_Preparada
+ * - Producto y suma preparados idénticos a product y suma, de 1×1 a 64×64
+ * - Dimensiones incompatibles detectadas al preparar sin modificar C
+ * - Coste por llamada de W x de orden 4 a 64 con product y con ejecuta_producto
+ *
+ * \subsection test_precision_math Test_Precision_Producto
+ * - product_d y suma_d (MATRIZ_D) frente a una referencia en long double, de 1×1 a 64×64
+ * - Dimensiones incompatibles en product_d y suma_d
+ * - product_m frente a product en un producto de 256 términos con cancelación: error dentro del redondeo
+ *   final a float y nunca mayor que el de product
+ * - Tiempo de un producto 64×64 con product, product_m y product_d
+ *
  * \subsection run_all_math_tests Run_All_NSDSP_Math_Tests
  * Función principal que ejecuta todos los tests y genera el reporte.
  * - Abre archivo de log con timestamp
  * - Ejecuta Test_Matriz_Producto
  * - Ejecuta Test_Matriz_Suma
+ * - Ejecuta Test_Factorizaciones y Test_Rendimiento_Factorizaciones
+ * - Ejecuta Test_Vistas, Test_Producto_Paralelo y Test_Producto_Lote
+ * - Ejecuta Test_Matriz_Dispersa, Test_Operacion_Preparada y Test_Precision_Producto
  * - Genera resumen de resultados
  * - Cierra archivo de log
  *
@@ -96,6 +153,14 @@
  * |:-----:|:-----:|:-------:|:------------|
  * | 10/09/2025 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
  * | 13/09/2025 | Dr. Carlos Romero | 2 | Añadidos tests para suma/resta de matrices |
+ * | 16/10/2026 | Dr. Carlos Romero | 3 | Añadidos tests y medidas de rendimiento de las factorizaciones |
+ * | 16/10/2026 | Dr. Carlos Romero | 4 | Añadidos tests de vistas, acumulación y suma in situ |
+ * | 16/10/2026 | Dr. Carlos Romero | 5 | Añadidos tests y medidas de escalado del producto paralelo y de lotes |
+ * | 16/10/2026 | Dr. Carlos Romero | 6 | Añadidos tests y densidad de cruce de las matrices dispersas |
+ * | 16/10/2026 | Dr. Carlos Romero | 7 | Añadidos tests y coste por llamada de las operaciones preparadas |
+ * | 16/10/2026 | Dr. Carlos Romero | 8 | Añadidos tests de precisión y tiempos de las variantes double y mixta |
+ * | 16/10/2026 | Dr. Carlos Romero | 9 | Ejecutor de prueba con hilos persistentes y aviso de un solo núcleo en lugar de tablas de escalado |
+ * | 16/10/2026 | Dr. Carlos Romero | 10 | SpMM dispersa con X de 19 columnas para cubrir los grupos de ancho fijo y el resto |
  *
  * \copyright ZGR R&D AIE
  */
@@ -105,27 +170,102 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <float.h>
 #include <time.h>
 #include <stdarg.h>
 #include "nsdsp_math.h"
 #include "test_nsdsp_math.h"
 
+/* El ejecutor de prueba usa hilos POSIX donde existen; en el resto las tareas se ejecutan en serie */
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <unistd.h>
+#define HILOS_MATH_TEST     1
+#endif
+
 #define TEST_OK     0
 #define TEST_KO     -1
 #define EPSILON_MATH  1e-6f
+#define N_FACT_MATH         100
+#define N_MAX_MATH          256
+#define K_FACT_MATH         4
+#define FLOPS_MINIMOS_MATH  (64.0 * 1024.0 * 1024.0)
+#define HILOS_MAX_MATH      16
+#define N_PRECISION_MATH    64
+#define P_PRECISION_MATH    256
 
 /* Variable global para el archivo de log */
 static FILE *math_test_log_file = NULL;
 
+/* Buffers de test de las factorizaciones */
+static float a_math_test[N_MAX_MATH * N_MAX_MATH];
+static float f_math_test[N_MAX_MATH * N_MAX_MATH];
+static float f2_math_test[N_MAX_MATH * N_MAX_MATH];
+static float b_math_test[N_MAX_MATH * N_MAX_MATH];
+static float x_math_test[N_MAX_MATH * N_MAX_MATH];
+static float qr_ws_math_test[NSDSP_MATH_QR_WORKSPACE(N_MAX_MATH)];
+static unsigned int pivotes_math_test[N_MAX_MATH];
+static float l_math_test[N_MAX_MATH * N_MAX_MATH];
+static unsigned int inicio_math_test[N_MAX_MATH + 1];
+static unsigned int columna_math_test[N_MAX_MATH * N_MAX_MATH];
+
+/* Buffers de test de las variantes en doble precisión */
+static double ad_math_test[N_PRECISION_MATH * P_PRECISION_MATH];
+static double bd_math_test[N_PRECISION_MATH * P_PRECISION_MATH];
+static double cd_math_test[N_PRECISION_MATH * N_PRECISION_MATH];
+
+/* Ejecutor de prueba: el hilo h ejecuta las tareas h, h + hilos, ... Los hilos se crean la primera
+ * vez que hacen falta y esperan la siguiente llamada en lugar de terminar */
+typedef struct
+{
+    NSDSP_MATH_TAREA tarea;
+    void *contexto;
+    unsigned int tareas;
+    unsigned int hilos;         /* Hilos que participan en la llamada en curso, incluido el llamante */
+    unsigned int lanzados;      /* Hilos persistentes creados, sin contar el llamante */
+    unsigned int pendientes;    /* Hilos que aún no han terminado su parte de la llamada en curso */
+    unsigned int generacion;    /* Se incrementa en cada llamada para despertar a los hilos */
+    int fin;                    /* Los hilos terminan al verlo activo */
+} EJECUTOR_MATH_TEST;
+
+static EJECUTOR_MATH_TEST ejecutor_math;
+
+#ifdef HILOS_MATH_TEST
+static pthread_mutex_t cerrojo_math_test = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t trabajo_math_test = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t terminado_math_test = PTHREAD_COND_INITIALIZER;
+static pthread_t hilos_math_test[HILOS_MAX_MATH];
+static unsigned int indices_math_test[HILOS_MAX_MATH];
+static unsigned int vistos_math_test[HILOS_MAX_MATH];
+#endif
+
 /* Declaración de funciones de test */
 int Test_Matriz_Producto(void);
 int Test_Matriz_Suma(void);
+int Test_Factorizaciones(void);
+int Test_Rendimiento_Factorizaciones(void);
+int Test_Vistas(void);
+int Test_Producto_Paralelo(void);
+int Test_Producto_Lote(void);
+int Test_Matriz_Dispersa(void);
+int Test_Operacion_Preparada(void);
+int Test_Precision_Producto(void);
 int Run_All_NSDSP_Math_Tests(void);
 
 /* Funciones auxiliares */
 void test_math_printf(const char *format, ...);
 int float_equals_math(float a, float b, float epsilon);
 void print_matriz(const char *nombre, MATRIZ *m);
+float aleatorio_math(void);
+void aleatoria_math(float *p, unsigned int filas, unsigned int columnas);
+void definida_positiva_math(float *p, unsigned int n);
+float elemento_vista_math(const MATRIZ_VISTA *v, unsigned int i, unsigned int j);
+void ejecutor_math_test(NSDSP_MATH_TAREA tarea, void *contexto, unsigned int tareas, void *usuario);
+void detiene_ejecutor_math_test(void);
+unsigned int nucleos_math(void);
+double reloj_math(void);
+double residuo_math(const float *a, const float *x, const float *b, unsigned int filas, unsigned int n,
+                    unsigned int k);
 
 /* Definición de funciones */
 
@@ -713,40 +853,1960 @@ int Test_Matriz_Suma(void)
     return result;
 }
 
-int Run_All_NSDSP_Math_Tests(void)
+float aleatorio_math(void)
 {
-    int total_result = TEST_OK;
-    int test_result;
-    time_t current_time;
-    char time_string[100];
+    /* Uniforme en [-1, 1] */
+    return 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+}
 
-    /* Abrir archivo de log */
-    math_test_log_file = fopen("NSDSP_Math_Tests_Result.txt", "a");
-    if (math_test_log_file == NULL)
+void aleatoria_math(float *p, unsigned int filas, unsigned int columnas)
+{
+    unsigned int i;
+
+    for (i = 0; i < filas * columnas; i++)
     {
-        printf("WARNING: No se pudo abrir el archivo de log de NSDSP Math\n");
+        p[i] = aleatorio_math();
+    }
+}
+
+void definida_positiva_math(float *p, unsigned int n)
+{
+    unsigned int i, j, k;
+    float acumulador;
+
+    /* A = G G^T / n + I con G aleatoria, generada en x_math_test */
+    aleatoria_math(x_math_test, n, n);
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            acumulador = (i == j) ? 1.0f : 0.0f;
+            for (k = 0; k < n; k++)
+            {
+                acumulador += x_math_test[i * n + k] * x_math_test[j * n + k] / (float)n;
+            }
+            p[i * n + j] = acumulador;
+        }
+    }
+}
+
+double residuo_math(const float *a, const float *x, const float *b, unsigned int filas, unsigned int n,
+                    unsigned int k)
+{
+    unsigned int i, j, c;
+    double acumulador, residuo, norma;
+
+    /* |A X - B| / |B| en norma de Frobenius, con A de filas x n, X de n x k y B de filas x k */
+    residuo = 0.0;
+    norma = 0.0;
+    for (i = 0; i < filas; i++)
+    {
+        for (c = 0; c < k; c++)
+        {
+            acumulador = -(double)b[i * k + c];
+            for (j = 0; j < n; j++)
+            {
+                acumulador += (double)a[i * n + j] * (double)x[j * k + c];
+            }
+            residuo += acumulador * acumulador;
+            norma += (double)b[i * k + c] * (double)b[i * k + c];
+        }
+    }
+
+    return sqrt(residuo / norma);
+}
+
+int Test_Factorizaciones(void)
+{
+    int result = TEST_OK;
+    unsigned int i, j, k, p, n, m, tipo, diferentes;
+    double error, maximo, acumulador;
+    float temporal;
+    MATRIZ A, F, F2, B, X;
+
+    test_math_printf("\n=== Test Factorizaciones ===\n");
+
+    nsdsp_math_init();
+    srand(43);
+
+    n = N_FACT_MATH;
+    A.filas = n;
+    A.columnas = n;
+    A.pmatriz = a_math_test;
+    F.filas = n;
+    F.columnas = n;
+    F.pmatriz = f_math_test;
+    F2.filas = n;
+    F2.columnas = n;
+    F2.pmatriz = f2_math_test;
+    B.filas = n;
+    B.columnas = K_FACT_MATH;
+    B.pmatriz = b_math_test;
+
+    /* Test 1: Cholesky por bloques (n no múltiplo del bloque) */
+    test_math_printf("\nTest 1: Cholesky de %u x %u (bloque %u)\n", n, n, NSDSP_MATH_BLOQUE);
+
+    definida_positiva_math(a_math_test, n);
+    for (i = 0; i < n * n; i++)
+    {
+        f2_math_test[i] = a_math_test[i];
+    }
+    if (nsdsp_math_api.cholesky(&A, &F) != NSDSP_MATH_OK || nsdsp_math_api.cholesky(&F2, &F2) != NSDSP_MATH_OK)
+    {
+        test_math_printf("ERROR: cholesky falló con una matriz definida positiva\n");
+        result = TEST_KO;
+    }
+    maximo = 0.0;
+    diferentes = 0;
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            acumulador = 0.0;
+            for (k = 0; k < n; k++)
+            {
+                acumulador += (double)f_math_test[i * n + k] * (double)f_math_test[j * n + k];
+            }
+            error = fabs(acumulador - a_math_test[i * n + j]);
+            maximo = (error > maximo) ? error : maximo;
+            if (j > i && f_math_test[i * n + j] != 0.0f)
+            {
+                diferentes++;
+            }
+            if (f_math_test[i * n + j] != f2_math_test[i * n + j])
+            {
+                diferentes++;
+            }
+        }
+    }
+    aleatoria_math(b_math_test, n, K_FACT_MATH);
+    for (i = 0; i < n * K_FACT_MATH; i++)
+    {
+        x_math_test[i] = b_math_test[i];
+    }
+    X.filas = n;
+    X.columnas = K_FACT_MATH;
+    X.pmatriz = x_math_test;
+    nsdsp_math_api.resuelve_cholesky(&F, &X);
+    error = residuo_math(a_math_test, x_math_test, b_math_test, n, n, K_FACT_MATH);
+    test_math_printf("max|L L^T - A| = %.2e, residuo relativo %.2e, in situ idéntico: %s\n",
+                     maximo, error, (diferentes == 0) ? "sí" : "no");
+    if (!(maximo < 1e-4) || !(error < 1e-4) || diferentes != 0)
+    {
+        test_math_printf("ERROR: Factorización de Cholesky incorrecta\n");
+        result = TEST_KO;
+    }
+
+    a_math_test[5 * n + 5] = -1.0f;
+    if (nsdsp_math_api.cholesky(&A, &F) != NSDSP_MATH_KO || f_math_test[0] != 0.0f)
+    {
+        test_math_printf("ERROR: Se aceptó una matriz no definida positiva\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: LU con pivotaje parcial */
+    test_math_printf("\nTest 2: LU con pivotaje parcial de %u x %u\n", n, n);
+
+    aleatoria_math(a_math_test, n, n);
+    if (nsdsp_math_api.lu(&A, &F, pivotes_math_test) != NSDSP_MATH_OK)
+    {
+        test_math_printf("ERROR: lu falló con una matriz regular\n");
+        result = TEST_KO;
+    }
+    /* P A = L U: se reconstruye L U y se deshacen las permutaciones en orden inverso */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            acumulador = 0.0;
+            for (k = 0; k <= i && k <= j; k++)
+            {
+                acumulador += ((k == i) ? 1.0 : (double)f_math_test[i * n + k]) * (double)f_math_test[k * n + j];
+            }
+            f2_math_test[i * n + j] = (float)acumulador;
+        }
+    }
+    for (k = n; k-- > 0;)
+    {
+        for (j = 0; j < n && pivotes_math_test[k] != k; j++)
+        {
+            temporal = f2_math_test[k * n + j];
+            f2_math_test[k * n + j] = f2_math_test[pivotes_math_test[k] * n + j];
+            f2_math_test[pivotes_math_test[k] * n + j] = temporal;
+        }
+    }
+    maximo = 0.0;
+    for (i = 0; i < n * n; i++)
+    {
+        error = fabs(f2_math_test[i] - a_math_test[i]);
+        maximo = (error > maximo) ? error : maximo;
+    }
+    for (i = 0; i < n * K_FACT_MATH; i++)
+    {
+        x_math_test[i] = b_math_test[i];
+    }
+    nsdsp_math_api.resuelve_lu(&F, pivotes_math_test, &X);
+    error = residuo_math(a_math_test, x_math_test, b_math_test, n, n, K_FACT_MATH);
+    test_math_printf("max|P^T L U - A| = %.2e, residuo relativo %.2e\n", maximo, error);
+    if (!(maximo < 1e-4) || !(error < 1e-3))
+    {
+        test_math_printf("ERROR: Factorización LU incorrecta\n");
+        result = TEST_KO;
+    }
+
+    for (j = 0; j < n; j++)
+    {
+        a_math_test[7 * n + j] = 2.0f * a_math_test[3 * n + j];
+    }
+    if (nsdsp_math_api.lu(&A, &F, pivotes_math_test) != NSDSP_MATH_KO)
+    {
+        /* Con redondeo el pivote puede no ser exactamente cero: se acepta si U tiene un pivote ínfimo */
+        maximo = fabs(f_math_test[0]);
+        for (i = 1; i < n; i++)
+        {
+            maximo = (fabs(f_math_test[i * n + i]) < maximo) ? fabs(f_math_test[i * n + i]) : maximo;
+        }
+        if (!(maximo < 1e-4))
+        {
+            test_math_printf("ERROR: No se detectó una matriz singular\n");
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: mínimos cuadrados por QR de Householder */
+    m = n + n / 5;
+    k = n / 2;
+    test_math_printf("\nTest 3: Mínimos cuadrados por QR de %u x %u\n", m, k);
+
+    A.filas = m;
+    A.columnas = k;
+    F.filas = m;
+    F.columnas = k;
+    aleatoria_math(a_math_test, m, k);
+    aleatoria_math(x_math_test, k, 1);
+    for (i = 0; i < m; i++)
+    {
+        acumulador = 0.0;
+        for (j = 0; j < k; j++)
+        {
+            acumulador += (double)a_math_test[i * k + j] * (double)x_math_test[j];
+        }
+        b_math_test[i] = (float)acumulador;
+        f2_math_test[i] = (float)acumulador;
+    }
+    B.filas = m;
+    B.columnas = 1;
+    B.pmatriz = f2_math_test;
+    if (nsdsp_math_api.qr(&A, &F, qr_ws_math_test) != NSDSP_MATH_OK ||
+        nsdsp_math_api.resuelve_qr(&F, qr_ws_math_test, &B) != NSDSP_MATH_OK)
+    {
+        test_math_printf("ERROR: qr/resuelve_qr fallaron con parámetros válidos\n");
+        result = TEST_KO;
+    }
+    maximo = 0.0;
+    for (j = 0; j < k; j++)
+    {
+        error = fabs(f2_math_test[j] - x_math_test[j]);
+        maximo = (error > maximo) ? error : maximo;
+    }
+    /* R^T R = A^T A */
+    error = 0.0;
+    for (i = 0; i < k; i++)
+    {
+        for (j = 0; j < k; j++)
+        {
+            acumulador = 0.0;
+            for (p = 0; p < m; p++)
+            {
+                acumulador -= (double)a_math_test[p * k + i] * (double)a_math_test[p * k + j];
+            }
+            for (p = 0; p <= i && p <= j; p++)
+            {
+                acumulador += (double)f_math_test[p * k + i] * (double)f_math_test[p * k + j];
+            }
+            error = (fabs(acumulador) > error) ? fabs(acumulador) : error;
+        }
+    }
+    test_math_printf("max|x - x0| = %.2e, max|R^T R - A^T A| = %.2e\n", maximo, error);
+    if (!(maximo < 1e-3) || !(error < 1e-3))
+    {
+        test_math_printf("ERROR: Factorización QR incorrecta\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: las ocho variantes de la sustitución triangular */
+    test_math_printf("\nTest 4: Sistemas triangulares (inferior/superior, traspuesta, diagonal unidad)\n");
+
+    A.filas = n;
+    A.columnas = n;
+    B.filas = n;
+    B.columnas = K_FACT_MATH;
+    B.pmatriz = b_math_test;
+    for (tipo = 0; tipo < 8; tipo++)
+    {
+        aleatoria_math(a_math_test, n, n);
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                if (((tipo & NSDSP_MATH_SUPERIOR) != 0) ? (j < i) : (j > i))
+                {
+                    a_math_test[i * n + j] = 0.0f;
+                }
+                else if (i != j)
+                {
+                    a_math_test[i * n + j] *= 2.0f / (float)n;
+                }
+            }
+            a_math_test[i * n + i] = ((tipo & NSDSP_MATH_UNIDAD) != 0) ? 1.0f : 2.0f + aleatorio_math();
+        }
+        /* Matriz efectiva op(T) en f_math_test */
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                f_math_test[i * n + j] = ((tipo & NSDSP_MATH_TRASPUESTA) != 0) ? a_math_test[j * n + i] :
+                                                                                 a_math_test[i * n + j];
+            }
+        }
+        if ((tipo & NSDSP_MATH_UNIDAD) != 0)
+        {
+            for (i = 0; i < n; i++)
+            {
+                a_math_test[i * n + i] = 1e30f;    /* No debe leerse */
+            }
+        }
+        aleatoria_math(b_math_test, n, K_FACT_MATH);
+        for (i = 0; i < n * K_FACT_MATH; i++)
+        {
+            x_math_test[i] = b_math_test[i];
+        }
+        if (nsdsp_math_api.triangular(&A, &X, (int)tipo) != NSDSP_MATH_OK)
+        {
+            test_math_printf("ERROR: triangular falló para el tipo %u\n", tipo);
+            result = TEST_KO;
+            continue;
+        }
+        error = residuo_math(f_math_test, x_math_test, b_math_test, n, n, K_FACT_MATH);
+        test_math_printf("  %s%s%s: residuo %.2e\n", ((tipo & NSDSP_MATH_SUPERIOR) != 0) ? "superior" : "inferior",
+                         ((tipo & NSDSP_MATH_TRASPUESTA) != 0) ? " traspuesta" : "",
+                         ((tipo & NSDSP_MATH_UNIDAD) != 0) ? " unidad" : "", error);
+        if (!(error < 1e-5))
+        {
+            test_math_printf("ERROR: Sustitución triangular incorrecta\n");
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 5: parámetros inválidos */
+    test_math_printf("\nTest 5: Parámetros inválidos\n");
+
+    A.filas = n;
+    A.columnas = n - 1;
+    F.filas = n;
+    F.columnas = n - 1;
+    if (nsdsp_math_api.cholesky(&A, &F) != NSDSP_MATH_KO || nsdsp_math_api.lu(&A, &F, pivotes_math_test) != NSDSP_MATH_KO ||
+        nsdsp_math_api.cholesky(NULL, &F) != NSDSP_MATH_KO || nsdsp_math_api.lu(&A, &F, NULL) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptó una matriz no cuadrada en cholesky/lu\n");
+        result = TEST_KO;
+    }
+    A.filas = n / 2;
+    A.columnas = n;
+    F.filas = n / 2;
+    F.columnas = n;
+    if (nsdsp_math_api.qr(&A, &F, qr_ws_math_test) != NSDSP_MATH_KO || nsdsp_math_api.qr(&A, &F, NULL) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptó una QR con menos filas que columnas\n");
+        result = TEST_KO;
+    }
+    A.filas = n;
+    A.columnas = n;
+    aleatoria_math(a_math_test, n, n);
+    a_math_test[4 * n + 4] = 0.0f;
+    X.filas = n - 1;
+    if (nsdsp_math_api.triangular(&A, &X, NSDSP_MATH_INFERIOR) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptó un sistema triangular de dimensiones incompatibles\n");
+        result = TEST_KO;
+    }
+    X.filas = n;
+    if (nsdsp_math_api.triangular(&A, &X, NSDSP_MATH_INFERIOR) != NSDSP_MATH_KO ||
+        nsdsp_math_api.triangular(&A, &X, NSDSP_MATH_INFERIOR | NSDSP_MATH_UNIDAD) != NSDSP_MATH_OK)
+    {
+        test_math_printf("ERROR: Tratamiento incorrecto de la diagonal nula\n");
+        result = TEST_KO;
     }
+
+    if (result == TEST_OK)
+        test_math_printf("\nTest Factorizaciones: PASSED\n");
     else
+        test_math_printf("\nTest Factorizaciones: FAILED\n");
+
+    return result;
+}
+
+int Test_Rendimiento_Factorizaciones(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n, rep, repeticiones;
+    double flops[4], mflops[4], segundos;
+    clock_t inicio, fin;
+    MATRIZ A, F, X;
+
+    test_math_printf("\n=== Test Rendimiento_Factorizaciones ===\n");
+
+    nsdsp_math_init();
+    srand(44);
+
+    /* Cada medida repite la operación hasta acumular FLOPS_MINIMOS_MATH operaciones */
+    test_math_printf("\nTest 1: MFLOP/s frente al orden (Cholesky n^3/3, LU 2n^3/3, QR 4n^3/3, triangular n^3)\n");
+    test_math_printf("    n | Cholesky |       LU |       QR | Triangular\n");
+
+    for (n = 32; n <= N_MAX_MATH; n *= 2)
     {
-        /* Escribir encabezado con fecha y hora */
-        time(&current_time);
-        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
-        test_math_printf("\n\n########################################\n");
-        test_math_printf("# NSDSP Math Unit Tests\n");
-        test_math_printf("# Fecha y hora: %s\n", time_string);
-        test_math_printf("########################################\n");
+        A.filas = n;
+        A.columnas = n;
+        A.pmatriz = a_math_test;
+        F.filas = n;
+        F.columnas = n;
+        F.pmatriz = f_math_test;
+        X.filas = n;
+        X.columnas = n;
+        X.pmatriz = x_math_test;
+
+        flops[0] = (double)n * n * n / 3.0;
+        flops[1] = 2.0 * (double)n * n * n / 3.0;
+        flops[2] = 4.0 * (double)n * n * n / 3.0;
+        flops[3] = (double)n * n * n;
+        repeticiones = (unsigned int)(FLOPS_MINIMOS_MATH / flops[0]) + 1;
+
+        definida_positiva_math(a_math_test, n);
+        aleatoria_math(b_math_test, n, n);
+
+        inicio = clock();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            nsdsp_math_api.cholesky(&A, &F);
+        }
+        fin = clock();
+        segundos = (double)(fin - inicio) / CLOCKS_PER_SEC;
+        mflops[0] = (segundos > 0.0) ? 1e-6 * flops[0] * repeticiones / segundos : 0.0;
+
+        inicio = clock();
+        for (rep = 0; rep < repeticiones / 2 + 1; rep++)
+        {
+            nsdsp_math_api.lu(&A, &F, pivotes_math_test);
+        }
+        fin = clock();
+        segundos = (double)(fin - inicio) / CLOCKS_PER_SEC;
+        mflops[1] = (segundos > 0.0) ? 1e-6 * flops[1] * (repeticiones / 2 + 1) / segundos : 0.0;
+
+        inicio = clock();
+        for (rep = 0; rep < repeticiones / 4 + 1; rep++)
+        {
+            nsdsp_math_api.qr(&A, &F, qr_ws_math_test);
+        }
+        fin = clock();
+        segundos = (double)(fin - inicio) / CLOCKS_PER_SEC;
+        mflops[2] = (segundos > 0.0) ? 1e-6 * flops[2] * (repeticiones / 4 + 1) / segundos : 0.0;
+
+        /* Sistema triangular inferior con n segundos miembros sobre el factor de Cholesky */
+        nsdsp_math_api.cholesky(&A, &F);
+        inicio = clock();
+        for (rep = 0; rep < repeticiones / 3 + 1; rep++)
+        {
+            for (i = 0; i < n * n; i++)
+            {
+                x_math_test[i] = b_math_test[i];
+            }
+            nsdsp_math_api.triangular(&F, &X, NSDSP_MATH_INFERIOR);
+        }
+        fin = clock();
+        segundos = (double)(fin - inicio) / CLOCKS_PER_SEC;
+        mflops[3] = (segundos > 0.0) ? 1e-6 * flops[3] * (repeticiones / 3 + 1) / segundos : 0.0;
+
+        test_math_printf("  %3u | %8.0f | %8.0f | %8.0f | %10.0f\n", n, mflops[0], mflops[1], mflops[2], mflops[3]);
+        for (i = 0; i < 4; i++)
+        {
+            if (!(mflops[i] > 0.0))
+            {
+                result = TEST_KO;
+            }
+        }
     }
 
-    test_math_printf("\n========================================\n");
-    test_math_printf("    EJECUTANDO TESTS NSDSP MATH\n");
-    test_math_printf("========================================\n");
+    if (result != TEST_OK)
+    {
+        test_math_printf("ERROR: Medida de rendimiento inválida\n");
+    }
 
-    /* Ejecutar tests */
-    test_result = Test_Matriz_Producto();
-    if (test_result != TEST_OK) total_result = TEST_KO;
+    if (result == TEST_OK)
+        test_math_printf("\nTest Rendimiento_Factorizaciones: PASSED\n");
+    else
+        test_math_printf("\nTest Rendimiento_Factorizaciones: FAILED\n");
 
-    test_result = Test_Matriz_Suma();
-    if (test_result != TEST_OK) total_result = TEST_KO;
+    return result;
+}
+
+float elemento_vista_math(const MATRIZ_VISTA *v, unsigned int i, unsigned int j)
+{
+    unsigned int paso;
+
+    /* Acceso directo al almacenamiento, independiente de la implementación */
+    paso = (v->paso != 0) ? v->paso : (v->traspuesta ? v->filas : v->columnas);
+    return v->traspuesta ? v->pmatriz[j * paso + i] : v->pmatriz[i * paso + j];
+}
+
+int Test_Vistas(void)
+{
+    int result = TEST_OK;
+    unsigned int i, j, k, ta, tb, tc, rep, repeticiones, fuera;
+    unsigned int m, n, p;
+    double error, maximo, acumulador, segundos, mflops[2];
+    float alfa, beta;
+    clock_t inicio, fin;
+    MATRIZ SA, SB, SC, A, B, C;
+    MATRIZ_VISTA VA, VB, VC;
+
+    test_math_printf("\n=== Test Vistas ===\n");
+
+    nsdsp_math_init();
+    srand(45);
+
+    /* Almacenamientos de 64 x 64 de los que se toman submatrices y traspuestas */
+    SA.filas = 64;
+    SA.columnas = 64;
+    SA.pmatriz = a_math_test;
+    SB.filas = 64;
+    SB.columnas = 64;
+    SB.pmatriz = f_math_test;
+    SC.filas = 64;
+    SC.columnas = 64;
+    SC.pmatriz = b_math_test;
+    aleatoria_math(a_math_test, 64, 64);
+    aleatoria_math(f_math_test, 64, 64);
+
+    /* Test 1: C = alfa A B + beta C con las ocho combinaciones de traspuestas */
+    test_math_printf("\nTest 1: Producto con vistas de submatrices y traspuestas\n");
+    m = 13;
+    n = 21;
+    p = 17;
+    alfa = 0.5f;
+    beta = -1.5f;
+    for (ta = 0; ta < 2; ta++)
+    {
+        for (tb = 0; tb < 2; tb++)
+        {
+            for (tc = 0; tc < 2; tc++)
+            {
+                /* Las vistas traspuestas se toman sobre la submatriz de dimensiones intercambiadas */
+                nsdsp_math_api.vista(&SA, 3, 5, ta ? p : m, ta ? m : p, (int)ta, &VA);
+                nsdsp_math_api.vista(&SB, 7, 2, tb ? n : p, tb ? p : n, (int)tb, &VB);
+                nsdsp_math_api.vista(&SC, 4, 9, tc ? n : m, tc ? m : n, (int)tc, &VC);
+                aleatoria_math(b_math_test, 64, 64);
+                for (i = 0; i < 64 * 64; i++)
+                {
+                    f2_math_test[i] = b_math_test[i];
+                }
+
+                if (nsdsp_math_api.producto_vista(alfa, &VA, &VB, beta, &VC) != NSDSP_MATH_OK)
+                {
+                    test_math_printf("ERROR: Producto rechazado (ta=%u, tb=%u, tc=%u)\n", ta, tb, tc);
+                    result = TEST_KO;
+                    continue;
+                }
+
+                maximo = 0.0;
+                for (i = 0; i < m; i++)
+                {
+                    for (j = 0; j < n; j++)
+                    {
+                        acumulador = 0.0;
+                        for (k = 0; k < p; k++)
+                        {
+                            acumulador += (double)elemento_vista_math(&VA, i, k) * (double)elemento_vista_math(&VB, k, j);
+                        }
+                        /* Valor previo de C(i,j) en la copia */
+                        acumulador = alfa * acumulador + beta * (double)f2_math_test[(VC.pmatriz - b_math_test) +
+                                     (tc ? j * 64 + i : i * 64 + j)];
+                        error = fabs(acumulador - (double)elemento_vista_math(&VC, i, j));
+                        if (error > maximo)
+                        {
+                            maximo = error;
+                        }
+                    }
+                }
+
+                /* Los elementos fuera de la vista de C no se modifican */
+                fuera = 0;
+                for (i = 0; i < 64; i++)
+                {
+                    for (j = 0; j < 64; j++)
+                    {
+                        if ((i < 4 || i >= 4 + (tc ? n : m) || j < 9 || j >= 9 + (tc ? m : n)) &&
+                            b_math_test[i * 64 + j] != f2_math_test[i * 64 + j])
+                        {
+                            fuera++;
+                        }
+                    }
+                }
+
+                test_math_printf("  A%s B%s -> C%s: error máximo = %.3e, fuera de la vista = %u\n",
+                                 ta ? "^T" : "  ", tb ? "^T" : "  ", tc ? "^T" : "  ", maximo, fuera);
+                if (maximo > 1e-4 || fuera != 0)
+                {
+                    result = TEST_KO;
+                }
+            }
+        }
+    }
+
+    /* Test 2: beta = 0 no lee C (un NaN previo no se propaga) y product coincide con la vista densa */
+    test_math_printf("\nTest 2: beta = 0 y compatibilidad con product\n");
+    A.filas = m;
+    A.columnas = p;
+    A.pmatriz = a_math_test;
+    B.filas = p;
+    B.columnas = n;
+    B.pmatriz = f_math_test;
+    C.filas = m;
+    C.columnas = n;
+    C.pmatriz = x_math_test;
+    nsdsp_math_api.product(&A, &B, &C);
+    nsdsp_math_api.vista(&A, 0, 0, m, p, 0, &VA);
+    nsdsp_math_api.vista(&B, 0, 0, p, n, 0, &VB);
+    C.pmatriz = b_math_test;
+    nsdsp_math_api.vista(&C, 0, 0, m, n, 0, &VC);
+    for (i = 0; i < m * n; i++)
+    {
+        b_math_test[i] = NAN;
+    }
+    nsdsp_math_api.producto_vista(1.0f, &VA, &VB, 0.0f, &VC);
+    for (i = 0; i < m * n; i++)
+    {
+        if (b_math_test[i] != x_math_test[i])
+        {
+            test_math_printf("ERROR: product y producto_vista difieren en el elemento %u\n", i);
+            result = TEST_KO;
+            break;
+        }
+    }
+
+    /* Test 3: acumulación C += A B y suma in situ C = 2 C - A sobre una ventana deslizante de filas */
+    test_math_printf("\nTest 3: Acumulación y suma in situ sobre ventanas deslizantes\n");
+    for (i = 0; i < m * n; i++)
+    {
+        f2_math_test[i] = b_math_test[i];
+    }
+    nsdsp_math_api.producto_vista(1.0f, &VA, &VB, 1.0f, &VC);
+    maximo = 0.0;
+    for (i = 0; i < m * n; i++)
+    {
+        error = fabs((double)b_math_test[i] - 2.0 * (double)f2_math_test[i]);
+        maximo = (error > maximo) ? error : maximo;
+    }
+    for (k = 0; k < 8; k++)
+    {
+        /* Ventana de m x n que avanza una fila por paso sobre SA */
+        nsdsp_math_api.vista(&SA, k, 0, m, n, 0, &VA);
+        for (i = 0; i < m * n; i++)
+        {
+            f2_math_test[i] = b_math_test[i];
+        }
+        nsdsp_math_api.suma_vista(2.0f, &VC, -1.0f, &VA, &VC);
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                error = fabs((double)b_math_test[i * n + j] -
+                             (2.0 * (double)f2_math_test[i * n + j] - (double)a_math_test[(k + i) * 64 + j]));
+                maximo = (error > maximo) ? error : maximo;
+            }
+        }
+    }
+    test_math_printf("  Error máximo = %.3e\n", maximo);
+    if (maximo > 1e-3)
+    {
+        result = TEST_KO;
+    }
+
+    /* Test 4: Parámetros inválidos */
+    test_math_printf("\nTest 4: Vistas fuera de rango, paso insuficiente y dimensiones incompatibles\n");
+    if (nsdsp_math_api.vista(&SA, 60, 0, 5, 4, 0, &VA) != NSDSP_MATH_KO || VA.pmatriz != NULL ||
+        nsdsp_math_api.vista(NULL, 0, 0, 1, 1, 0, &VA) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptó una vista fuera de la matriz\n");
+        result = TEST_KO;
+    }
+    nsdsp_math_api.vista(&A, 0, 0, m, p, 0, &VA);
+    VB.filas = p;
+    VB.columnas = n;
+    VB.paso = n - 1;
+    VB.traspuesta = 0;
+    VB.pmatriz = f_math_test;
+    if (nsdsp_math_api.producto_vista(1.0f, &VA, &VB, 0.0f, &VC) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptó un paso menor que el número de columnas\n");
+        result = TEST_KO;
+    }
+    VB.paso = 0;
+    VB.filas = p + 1;
+    if (nsdsp_math_api.producto_vista(1.0f, &VA, &VB, 1.0f, &VC) != NSDSP_MATH_KO ||
+        nsdsp_math_api.suma_vista(1.0f, &VA, 1.0f, &VB, &VC) != NSDSP_MATH_KO ||
+        nsdsp_math_api.suma_vista(1.0f, NULL, 1.0f, &VB, &VC) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptaron dimensiones incompatibles\n");
+        result = TEST_KO;
+    }
+    for (i = 0; i < m * n; i++)
+    {
+        if (b_math_test[i] != 0.0f)
+        {
+            test_math_printf("ERROR: C no se llenó con ceros tras el error\n");
+            result = TEST_KO;
+            break;
+        }
+    }
+
+    /* Test 5: Rendimiento de A B^T con la vista traspuesta frente a trasponer y multiplicar */
+    test_math_printf("\nTest 5: MFLOP/s de A B^T (n = 128): vista traspuesta frente a copia traspuesta\n");
+    n = 128;
+    A.filas = n;
+    A.columnas = n;
+    A.pmatriz = a_math_test;
+    B.filas = n;
+    B.columnas = n;
+    B.pmatriz = f_math_test;
+    C.filas = n;
+    C.columnas = n;
+    C.pmatriz = x_math_test;
+    aleatoria_math(a_math_test, n, n);
+    aleatoria_math(f_math_test, n, n);
+    nsdsp_math_api.vista(&A, 0, 0, n, n, 0, &VA);
+    nsdsp_math_api.vista(&B, 0, 0, n, n, 1, &VB);
+    nsdsp_math_api.vista(&C, 0, 0, n, n, 0, &VC);
+    repeticiones = (unsigned int)(FLOPS_MINIMOS_MATH / (2.0 * n * n * n)) + 1;
+
+    inicio = clock();
+    for (rep = 0; rep < repeticiones; rep++)
+    {
+        nsdsp_math_api.producto_vista(1.0f, &VA, &VB, 0.0f, &VC);
+    }
+    fin = clock();
+    segundos = (double)(fin - inicio) / CLOCKS_PER_SEC;
+    mflops[0] = (segundos > 0.0) ? 1e-6 * 2.0 * n * n * n * repeticiones / segundos : 0.0;
+
+    C.pmatriz = f2_math_test;
+    inicio = clock();
+    for (rep = 0; rep < repeticiones; rep++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                b_math_test[j * n + i] = f_math_test[i * n + j];
+            }
+        }
+        B.pmatriz = b_math_test;
+        nsdsp_math_api.product(&A, &B, &C);
+        B.pmatriz = f_math_test;
+    }
+    fin = clock();
+    segundos = (double)(fin - inicio) / CLOCKS_PER_SEC;
+    mflops[1] = (segundos > 0.0) ? 1e-6 * 2.0 * n * n * n * repeticiones / segundos : 0.0;
+
+    maximo = 0.0;
+    for (i = 0; i < n * n; i++)
+    {
+        error = fabs((double)x_math_test[i] - (double)f2_math_test[i]);
+        maximo = (error > maximo) ? error : maximo;
+    }
+    test_math_printf("  Vista: %.0f MFLOP/s, copia + product: %.0f MFLOP/s, diferencia máxima = %.3e\n",
+                     mflops[0], mflops[1], maximo);
+    if (maximo > 1e-4 || !(mflops[0] > 0.0) || !(mflops[1] > 0.0))
+    {
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_math_printf("\nTest Vistas: PASSED\n");
+    else
+        test_math_printf("\nTest Vistas: FAILED\n");
+
+    return result;
+}
+
+static void reparte_math_test(unsigned int hilo)
+{
+    unsigned int indice;
+
+    for (indice = hilo; indice < ejecutor_math.tareas; indice += ejecutor_math.hilos)
+    {
+        ejecutor_math.tarea(ejecutor_math.contexto, indice);
+    }
+}
+
+#ifdef HILOS_MATH_TEST
+static void *hilo_math_test(void *argumento)
+{
+    unsigned int hilo, generacion;
+
+    /* La generación vista la fija el creador, para no perder una llamada publicada antes de que el
+     * hilo llegue a esperar */
+    hilo = *(unsigned int *)argumento;
+    pthread_mutex_lock(&cerrojo_math_test);
+    generacion = vistos_math_test[hilo];
+    for (;;)
+    {
+        while (!ejecutor_math.fin && ejecutor_math.generacion == generacion)
+        {
+            pthread_cond_wait(&trabajo_math_test, &cerrojo_math_test);
+        }
+        if (ejecutor_math.fin)
+        {
+            break;
+        }
+        generacion = ejecutor_math.generacion;
+        if (hilo < ejecutor_math.hilos)
+        {
+            pthread_mutex_unlock(&cerrojo_math_test);
+            reparte_math_test(hilo);
+            pthread_mutex_lock(&cerrojo_math_test);
+            ejecutor_math.pendientes--;
+            if (ejecutor_math.pendientes == 0)
+            {
+                pthread_cond_signal(&terminado_math_test);
+            }
+        }
+    }
+    pthread_mutex_unlock(&cerrojo_math_test);
+
+    return NULL;
+}
+#endif
+
+void ejecutor_math_test(NSDSP_MATH_TAREA tarea, void *contexto, unsigned int tareas, void *usuario)
+{
+    unsigned int h, hilos;
+
+    /* usuario apunta al número de hilos; el hilo llamante es el hilo 0 */
+    hilos = *(unsigned int *)usuario;
+    hilos = (hilos < tareas) ? hilos : tareas;
+    hilos = (hilos < HILOS_MAX_MATH) ? hilos : HILOS_MAX_MATH;
+    hilos = (hilos > 0) ? hilos : 1;
+
+#ifdef HILOS_MATH_TEST
+    pthread_mutex_lock(&cerrojo_math_test);
+
+    /* Solo se crean los hilos que aún no existen; si la creación falla se trabaja con los que hay */
+    while (ejecutor_math.lanzados + 1 < hilos)
+    {
+        h = ejecutor_math.lanzados + 1;
+        indices_math_test[h] = h;
+        vistos_math_test[h] = ejecutor_math.generacion;
+        if (pthread_create(&hilos_math_test[h], NULL, hilo_math_test, &indices_math_test[h]) != 0)
+        {
+            break;
+        }
+        ejecutor_math.lanzados++;
+    }
+    hilos = (hilos < ejecutor_math.lanzados + 1) ? hilos : ejecutor_math.lanzados + 1;
+
+    ejecutor_math.tarea = tarea;
+    ejecutor_math.contexto = contexto;
+    ejecutor_math.tareas = tareas;
+    ejecutor_math.hilos = hilos;
+    ejecutor_math.pendientes = hilos - 1;
+    ejecutor_math.generacion++;
+    pthread_cond_broadcast(&trabajo_math_test);
+    pthread_mutex_unlock(&cerrojo_math_test);
+
+    reparte_math_test(0);
+
+    pthread_mutex_lock(&cerrojo_math_test);
+    while (ejecutor_math.pendientes > 0)
+    {
+        pthread_cond_wait(&terminado_math_test, &cerrojo_math_test);
+    }
+    pthread_mutex_unlock(&cerrojo_math_test);
+#else
+    ejecutor_math.tarea = tarea;
+    ejecutor_math.contexto = contexto;
+    ejecutor_math.tareas = tareas;
+    ejecutor_math.hilos = hilos;
+    for (h = 0; h < hilos; h++)
+    {
+        reparte_math_test(h);
+    }
+#endif
+}
+
+void detiene_ejecutor_math_test(void)
+{
+#ifdef HILOS_MATH_TEST
+    unsigned int h;
+
+    pthread_mutex_lock(&cerrojo_math_test);
+    ejecutor_math.fin = 1;
+    pthread_cond_broadcast(&trabajo_math_test);
+    pthread_mutex_unlock(&cerrojo_math_test);
+    for (h = 1; h <= ejecutor_math.lanzados; h++)
+    {
+        pthread_join(hilos_math_test[h], NULL);
+    }
+    ejecutor_math.lanzados = 0;
+    ejecutor_math.fin = 0;
+#endif
+}
+
+unsigned int nucleos_math(void)
+{
+    long nucleos = 1;
+
+#ifdef HILOS_MATH_TEST
+    nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (nucleos < 1)
+    {
+        nucleos = 1;
+    }
+
+    return (nucleos > HILOS_MAX_MATH) ? HILOS_MAX_MATH : (unsigned int)nucleos;
+}
+
+double reloj_math(void)
+{
+    /* Tiempo real en segundos: con varios hilos el tiempo de CPU de clock() los suma */
+#ifdef HILOS_MATH_TEST
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return (double)ahora.tv_sec + 1e-9 * (double)ahora.tv_nsec;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+int Test_Producto_Paralelo(void)
+{
+    int result = TEST_OK;
+    unsigned int i, t, rep, repeticiones, hilos, nucleos, diferentes;
+    unsigned int dimensiones[3][3] = {{200, 150, 170}, {3, 96, 250}, {256, 256, 256}};
+    double segundos, mflops, referencia;
+    MATRIZ A, B, C;
+    MATRIZ_VISTA VA, VB, VC;
+
+    test_math_printf("\n=== Test Producto_Paralelo ===\n");
+
+    nsdsp_math_init();
+    srand(46);
+    nucleos = nucleos_math();
+    aleatoria_math(a_math_test, N_MAX_MATH, N_MAX_MATH);
+    aleatoria_math(f_math_test, N_MAX_MATH, N_MAX_MATH);
+
+    /* Test 1: El reparto en paneles no cambia el orden de acumulación: resultado idéntico al serie */
+    test_math_printf("\nTest 1: Producto repartido en 1..8 tareas frente al producto en serie\n");
+    for (i = 0; i < 3; i++)
+    {
+        A.filas = dimensiones[i][0];
+        A.columnas = dimensiones[i][1];
+        A.pmatriz = a_math_test;
+        B.filas = dimensiones[i][1];
+        B.columnas = dimensiones[i][2];
+        B.pmatriz = f_math_test;
+        C.filas = dimensiones[i][0];
+        C.columnas = dimensiones[i][2];
+        C.pmatriz = x_math_test;
+        nsdsp_math_api.paralelo(NULL, NULL, 1);
+        nsdsp_math_api.product(&A, &B, &C);
+
+        for (t = 2; t <= 8; t++)
+        {
+            hilos = t;
+            nsdsp_math_api.paralelo(ejecutor_math_test, &hilos, t);
+            C.pmatriz = b_math_test;
+            nsdsp_math_api.product(&A, &B, &C);
+
+            /* También con B traspuesta y C traspuesta sobre vistas */
+            nsdsp_math_api.vista(&A, 0, 0, A.filas, A.columnas, 0, &VA);
+            B.filas = dimensiones[i][2];
+            B.columnas = dimensiones[i][1];
+            nsdsp_math_api.vista(&B, 0, 0, B.filas, B.columnas, 1, &VB);
+            C.filas = dimensiones[i][2];
+            C.columnas = dimensiones[i][0];
+            C.pmatriz = l_math_test;
+            nsdsp_math_api.vista(&C, 0, 0, C.filas, C.columnas, 1, &VC);
+            nsdsp_math_api.producto_vista(1.0f, &VA, &VB, 0.0f, &VC);
+            B.filas = dimensiones[i][1];
+            B.columnas = dimensiones[i][2];
+            C.filas = dimensiones[i][0];
+            C.columnas = dimensiones[i][2];
+            C.pmatriz = x_math_test;
+
+            diferentes = 0;
+            for (rep = 0; rep < C.filas * C.columnas; rep++)
+            {
+                if (b_math_test[rep] != x_math_test[rep])
+                {
+                    diferentes++;
+                }
+            }
+            if (diferentes != 0)
+            {
+                test_math_printf("ERROR: %ux%ux%u con %u tareas: %u elementos distintos\n",
+                                 dimensiones[i][0], dimensiones[i][1], dimensiones[i][2], t, diferentes);
+                result = TEST_KO;
+            }
+        }
+    }
+
+    /* Test 2: Parámetros inválidos */
+    test_math_printf("\nTest 2: Configuración inválida\n");
+    if (nsdsp_math_api.paralelo(NULL, NULL, 4) != NSDSP_MATH_KO ||
+        nsdsp_math_api.paralelo(ejecutor_math_test, &hilos, 0) != NSDSP_MATH_KO ||
+        nsdsp_math_api.paralelo(ejecutor_math_test, &hilos, NSDSP_MATH_TAREAS_MAX + 1) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptó una configuración paralela inválida\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: Escalado de 1 a N núcleos (tiempo real, no tiempo de CPU) */
+    test_math_printf("\nTest 3: MFLOP/s del producto 256x256 frente al número de hilos (%u núcleos)\n", nucleos);
+    if (nucleos < 2)
+    {
+        test_math_printf("  Un solo núcleo disponible: el escalado con el número de hilos no se puede medir aquí\n");
+    }
+    else
+    {
+        test_math_printf("  Hilos |   MFLOP/s | Aceleración\n");
+    }
+    A.filas = N_MAX_MATH;
+    A.columnas = N_MAX_MATH;
+    A.pmatriz = a_math_test;
+    B.filas = N_MAX_MATH;
+    B.columnas = N_MAX_MATH;
+    B.pmatriz = f_math_test;
+    C.filas = N_MAX_MATH;
+    C.columnas = N_MAX_MATH;
+    C.pmatriz = x_math_test;
+    repeticiones = (unsigned int)(4.0 * FLOPS_MINIMOS_MATH / (2.0 * N_MAX_MATH * N_MAX_MATH * N_MAX_MATH)) + 1;
+    referencia = 0.0;
+    for (hilos = 1; ; hilos *= 2)
+    {
+        hilos = (hilos < nucleos) ? hilos : nucleos;
+        nsdsp_math_api.paralelo(ejecutor_math_test, &hilos, hilos);
+        segundos = reloj_math();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            nsdsp_math_api.product(&A, &B, &C);
+        }
+        segundos = reloj_math() - segundos;
+        mflops = (segundos > 0.0) ? 1e-6 * 2.0 * N_MAX_MATH * N_MAX_MATH * N_MAX_MATH * repeticiones / segundos : 0.0;
+        referencia = (hilos == 1) ? mflops : referencia;
+        if (nucleos < 2)
+        {
+            test_math_printf("  MFLOP/s con 1 hilo: %.0f\n", mflops);
+        }
+        else
+        {
+            test_math_printf("  %5u | %9.0f | %10.2fx\n", hilos, mflops, (referencia > 0.0) ? mflops / referencia : 0.0);
+        }
+        if (!(mflops > 0.0))
+        {
+            result = TEST_KO;
+        }
+        if (hilos == nucleos)
+        {
+            break;
+        }
+    }
+
+    /* El ejecutor se retira para no afectar al resto de tests */
+    nsdsp_math_api.paralelo(NULL, NULL, 1);
+
+    if (result == TEST_OK)
+        test_math_printf("\nTest Producto_Paralelo: PASSED\n");
+    else
+        test_math_printf("\nTest Producto_Paralelo: FAILED\n");
+
+    return result;
+}
+
+int Test_Producto_Lote(void)
+{
+    int result = TEST_OK;
+    unsigned int i, l, s, rep, repeticiones, lote, elementos, hilos, nucleos;
+    double error, maximo, segundos, flops, mflops[2], referencia;
+    MATRIZ A, B, C;
+    MATRIZ_LOTE LA, LB, LC;
+
+    test_math_printf("\n=== Test Producto_Lote ===\n");
+
+    nsdsp_math_init();
+    srand(47);
+    nucleos = nucleos_math();
+
+    /* Test 1: Lotes de matrices cuadradas de 4 a 32, en SoA frente a un product por matriz */
+    test_math_printf("\nTest 1: Producto de lotes SoA frente a un product por matriz\n");
+    test_math_printf("   s |  Lote | Error máx. | Por matriz (MFLOP/s) | Lote SoA (MFLOP/s)\n");
+    for (s = 4; s <= 32; s *= 2)
+    {
+        elementos = s * s;
+        lote = (N_MAX_MATH * N_MAX_MATH) / elementos;
+        LA.filas = s;
+        LA.columnas = s;
+        LA.lote = lote;
+        LA.pmatriz = a_math_test;
+        LB = LA;
+        LB.pmatriz = f_math_test;
+        LC = LA;
+        LC.pmatriz = b_math_test;
+        A.filas = s;
+        A.columnas = s;
+        B.filas = s;
+        B.columnas = s;
+        C.filas = s;
+        C.columnas = s;
+
+        /* Matrices densas consecutivas (AoS) en x y f2, entrelazadas en a y f */
+        aleatoria_math(x_math_test, lote, elementos);
+        aleatoria_math(f2_math_test, lote, elementos);
+        nsdsp_math_api.entrelaza_lote(x_math_test, &LA);
+        nsdsp_math_api.entrelaza_lote(f2_math_test, &LB);
+
+        flops = 2.0 * (double)elementos * s * lote;
+        repeticiones = (unsigned int)(FLOPS_MINIMOS_MATH / flops) + 1;
+
+        segundos = reloj_math();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            for (l = 0; l < lote; l++)
+            {
+                A.pmatriz = &x_math_test[l * elementos];
+                B.pmatriz = &f2_math_test[l * elementos];
+                C.pmatriz = &l_math_test[l * elementos];
+                nsdsp_math_api.product(&A, &B, &C);
+            }
+        }
+        segundos = reloj_math() - segundos;
+        mflops[0] = (segundos > 0.0) ? 1e-6 * flops * repeticiones / segundos : 0.0;
+
+        segundos = reloj_math();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            nsdsp_math_api.producto_lote(&LA, &LB, &LC);
+        }
+        segundos = reloj_math() - segundos;
+        mflops[1] = (segundos > 0.0) ? 1e-6 * flops * repeticiones / segundos : 0.0;
+
+        /* El resultado separado en AoS debe coincidir con el de product (en l) */
+        nsdsp_math_api.separa_lote(&LC, f_math_test);
+        maximo = 0.0;
+        for (i = 0; i < lote * elementos; i++)
+        {
+            error = fabs((double)f_math_test[i] - (double)l_math_test[i]);
+            maximo = (error > maximo) ? error : maximo;
+        }
+        nsdsp_math_api.entrelaza_lote(f2_math_test, &LB);
+
+        test_math_printf("  %2u | %5u | %10.3e | %20.0f | %18.0f\n", s, lote, maximo, mflops[0], mflops[1]);
+        if (maximo > 1e-5 || !(mflops[0] > 0.0) || !(mflops[1] > 0.0))
+        {
+            result = TEST_KO;
+        }
+
+        /* Repartido en 4 tareas: mismo resultado */
+        hilos = 4;
+        nsdsp_math_api.paralelo(ejecutor_math_test, &hilos, 4);
+        nsdsp_math_api.producto_lote(&LA, &LB, &LC);
+        nsdsp_math_api.paralelo(NULL, NULL, 1);
+        nsdsp_math_api.separa_lote(&LC, f_math_test);
+        for (i = 0; i < lote * elementos; i++)
+        {
+            if (fabs((double)f_math_test[i] - (double)l_math_test[i]) > 1e-5)
+            {
+                test_math_printf("ERROR: El lote repartido en tareas difiere en el elemento %u\n", i);
+                result = TEST_KO;
+                break;
+            }
+        }
+        nsdsp_math_api.entrelaza_lote(f2_math_test, &LB);
+    }
+
+    /* Test 2: Escalado del lote de 8x8 de 1 a N núcleos */
+    test_math_printf("\nTest 2: MFLOP/s del lote de 1024 matrices 8x8 frente al número de hilos (%u núcleos)\n",
+                     nucleos);
+    if (nucleos < 2)
+    {
+        test_math_printf("  Un solo núcleo disponible: el escalado con el número de hilos no se puede medir aquí\n");
+    }
+    else
+    {
+        test_math_printf("  Hilos |   MFLOP/s | Aceleración\n");
+    }
+    LA.filas = 8;
+    LA.columnas = 8;
+    LA.lote = 1024;
+    LA.pmatriz = a_math_test;
+    LB = LA;
+    LB.pmatriz = f_math_test;
+    LC = LA;
+    LC.pmatriz = b_math_test;
+    flops = 2.0 * 8.0 * 8.0 * 8.0 * 1024.0;
+    repeticiones = (unsigned int)(4.0 * FLOPS_MINIMOS_MATH / flops) + 1;
+    referencia = 0.0;
+    for (hilos = 1; ; hilos *= 2)
+    {
+        hilos = (hilos < nucleos) ? hilos : nucleos;
+        nsdsp_math_api.paralelo(ejecutor_math_test, &hilos, hilos);
+        segundos = reloj_math();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            nsdsp_math_api.producto_lote(&LA, &LB, &LC);
+        }
+        segundos = reloj_math() - segundos;
+        mflops[0] = (segundos > 0.0) ? 1e-6 * flops * repeticiones / segundos : 0.0;
+        referencia = (hilos == 1) ? mflops[0] : referencia;
+        if (nucleos < 2)
+        {
+            test_math_printf("  MFLOP/s con 1 hilo: %.0f\n", mflops[0]);
+        }
+        else
+        {
+            test_math_printf("  %5u | %9.0f | %10.2fx\n", hilos, mflops[0],
+                             (referencia > 0.0) ? mflops[0] / referencia : 0.0);
+        }
+        if (!(mflops[0] > 0.0))
+        {
+            result = TEST_KO;
+        }
+        if (hilos == nucleos)
+        {
+            break;
+        }
+    }
+    nsdsp_math_api.paralelo(NULL, NULL, 1);
+
+    /* Test 3: Parámetros inválidos */
+    test_math_printf("\nTest 3: Lotes de tamaño o dimensiones incompatibles\n");
+    LB.lote = 512;
+    if (nsdsp_math_api.producto_lote(&LA, &LB, &LC) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptaron lotes de distinto tamaño\n");
+        result = TEST_KO;
+    }
+    LB.lote = 1024;
+    LB.filas = 7;
+    if (nsdsp_math_api.producto_lote(&LA, &LB, &LC) != NSDSP_MATH_KO ||
+        nsdsp_math_api.producto_lote(&LA, NULL, &LC) != NSDSP_MATH_KO ||
+        nsdsp_math_api.entrelaza_lote(NULL, &LA) != NSDSP_MATH_KO ||
+        nsdsp_math_api.separa_lote(&LA, NULL) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptaron parámetros incompatibles\n");
+        result = TEST_KO;
+    }
+    for (i = 0; i < 8 * 8 * 1024; i++)
+    {
+        if (b_math_test[i] != 0.0f)
+        {
+            test_math_printf("ERROR: C no se llenó con ceros tras el error\n");
+            result = TEST_KO;
+            break;
+        }
+    }
+
+    if (result == TEST_OK)
+        test_math_printf("\nTest Producto_Lote: PASSED\n");
+    else
+        test_math_printf("\nTest Producto_Lote: FAILED\n");
+
+    return result;
+}
+
+int Test_Matriz_Dispersa(void)
+{
+    int result = TEST_OK;
+    unsigned int i, j, c, b, d, rep, repeticiones, filas, columnas, k, cuenta, cruce[2];
+    static const unsigned int bloques[5] = {1, 2, 3, 4, 8};
+    static const unsigned int densidades[9] = {1, 2, 5, 10, 20, 30, 50, 75, 100};
+    double error, maximo, acumulador, segundos, ns[3];
+    float umbral;
+    MATRIZ A, X, Y;
+    MATRIZ_DISPERSA S;
+
+    test_math_printf("\n=== Test Matriz_Dispersa ===\n");
+
+    nsdsp_math_init();
+    srand(46);
+
+    S.inicio_fila = inicio_math_test;
+    S.columna = columna_math_test;
+    S.valores = l_math_test;
+    S.capacidad = N_MAX_MATH * N_MAX_MATH;
+
+    /* Test 1: 40x37 podada con |w| <= 0.5, bloques de 1 a 8 (37 no es múltiplo de ninguno > 1) */
+    test_math_printf("\nTest 1: SpMV y SpMM de 40x37 frente a la densa podada\n");
+    test_math_printf("  Bloque | Bloques | Error SpMV | Error SpMM (k = 19)\n");
+    filas = 40;
+    columnas = 37;
+    k = 19;
+    umbral = 0.5f;
+    aleatoria_math(a_math_test, filas, columnas);
+    aleatoria_math(x_math_test, columnas, k);
+    for (i = 0; i < filas * columnas; i++)
+    {
+        f2_math_test[i] = (fabsf(a_math_test[i]) > umbral) ? a_math_test[i] : 0.0f;
+    }
+    A.filas = filas;
+    A.columnas = columnas;
+    A.pmatriz = a_math_test;
+
+    for (b = 0; b < 5; b++)
+    {
+        cuenta = nsdsp_math_api.cuenta_dispersa(&A, umbral, bloques[b]);
+        if (nsdsp_math_api.dispersa(&A, umbral, bloques[b], &S) != NSDSP_MATH_OK || S.bloques != cuenta ||
+            S.filas != filas || S.columnas != columnas)
+        {
+            test_math_printf("ERROR: Conversión con bloque %u (%u bloques contados)\n", bloques[b], cuenta);
+            result = TEST_KO;
+            continue;
+        }
+
+        /* SpMV (k = 1) sobre la primera columna de X copiada en b y SpMM sobre X completa */
+        for (j = 0; j < columnas; j++)
+        {
+            b_math_test[j] = x_math_test[j * k];
+        }
+        X.filas = columnas;
+        X.columnas = 1;
+        X.pmatriz = b_math_test;
+        Y.filas = filas;
+        Y.columnas = 1;
+        Y.pmatriz = f_math_test;
+        nsdsp_math_api.producto_disperso(&S, &X, &Y);
+        maximo = 0.0;
+        for (i = 0; i < filas; i++)
+        {
+            acumulador = 0.0;
+            for (j = 0; j < columnas; j++)
+            {
+                acumulador += (double)f2_math_test[i * columnas + j] * (double)b_math_test[j];
+            }
+            error = fabs(acumulador - f_math_test[i]);
+            maximo = (error > maximo) ? error : maximo;
+        }
+        ns[0] = maximo;
+
+        X.columnas = k;
+        X.pmatriz = x_math_test;
+        Y.columnas = k;
+        nsdsp_math_api.producto_disperso(&S, &X, &Y);
+        maximo = 0.0;
+        for (i = 0; i < filas; i++)
+        {
+            for (c = 0; c < k; c++)
+            {
+                acumulador = 0.0;
+                for (j = 0; j < columnas; j++)
+                {
+                    acumulador += (double)f2_math_test[i * columnas + j] * (double)x_math_test[j * k + c];
+                }
+                error = fabs(acumulador - f_math_test[i * k + c]);
+                maximo = (error > maximo) ? error : maximo;
+            }
+        }
+
+        test_math_printf("  %6u | %7u | %10.3e | %10.3e\n", bloques[b], S.bloques, ns[0], maximo);
+        if (ns[0] > 1e-5 || maximo > 1e-5)
+        {
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 2: Capacidad insuficiente, bloques fuera de rango y dimensiones incompatibles */
+    test_math_printf("\nTest 2: Capacidad insuficiente y parámetros inválidos\n");
+    cuenta = nsdsp_math_api.cuenta_dispersa(&A, umbral, 4);
+    S.capacidad = cuenta - 1;
+    if (nsdsp_math_api.dispersa(&A, umbral, 4, &S) != NSDSP_MATH_KO || S.bloques != 0)
+    {
+        test_math_printf("ERROR: Se aceptó una capacidad de %u bloques para %u\n", cuenta - 1, cuenta);
+        result = TEST_KO;
+    }
+    S.capacidad = cuenta;
+    if (nsdsp_math_api.dispersa(&A, umbral, 4, &S) != NSDSP_MATH_OK ||
+        nsdsp_math_api.dispersa(&A, umbral, 0, &S) != NSDSP_MATH_KO ||
+        nsdsp_math_api.dispersa(&A, umbral, NSDSP_MATH_DISPERSA_BLOQUE_MAX + 1, &S) != NSDSP_MATH_KO ||
+        nsdsp_math_api.cuenta_dispersa(&A, umbral, 0) != 0 ||
+        nsdsp_math_api.dispersa(NULL, umbral, 4, &S) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Capacidad exacta rechazada o bloque inválido aceptado\n");
+        result = TEST_KO;
+    }
+    S.capacidad = N_MAX_MATH * N_MAX_MATH;
+    nsdsp_math_api.dispersa(&A, umbral, 4, &S);
+    X.filas = columnas + 1;
+    X.columnas = 1;
+    X.pmatriz = b_math_test;
+    Y.filas = filas;
+    Y.columnas = 1;
+    Y.pmatriz = f_math_test;
+    if (nsdsp_math_api.producto_disperso(&S, &X, &Y) != NSDSP_MATH_KO ||
+        nsdsp_math_api.producto_disperso(NULL, &X, &Y) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: Se aceptaron dimensiones incompatibles\n");
+        result = TEST_KO;
+    }
+    for (i = 0; i < filas; i++)
+    {
+        if (f_math_test[i] != 0.0f)
+        {
+            test_math_printf("ERROR: Y no se llenó con ceros tras el error\n");
+            result = TEST_KO;
+            break;
+        }
+    }
+
+    /* Test 3: Densidad de cruce de 256x256 con poda no estructurada */
+    test_math_printf("\nTest 3: Tiempo de W x de 256x256 frente a la densidad (poda no estructurada)\n");
+    test_math_printf("  Densidad | Densa (ns) | CSR 1 (ns) | CSR 1x4 (ns) | Error máx.\n");
+    filas = N_MAX_MATH;
+    columnas = N_MAX_MATH;
+    A.filas = filas;
+    A.columnas = columnas;
+    X.filas = columnas;
+    X.columnas = 1;
+    X.pmatriz = x_math_test;
+    Y.filas = filas;
+    Y.columnas = 1;
+    aleatoria_math(x_math_test, columnas, 1);
+    cruce[0] = 0;
+    cruce[1] = 0;
+    for (d = 0; d < 9; d++)
+    {
+        for (i = 0; i < filas * columnas; i++)
+        {
+            a_math_test[i] = ((unsigned int)(rand() % 100) < densidades[d]) ? aleatorio_math() : 0.0f;
+        }
+        repeticiones = (unsigned int)(FLOPS_MINIMOS_MATH / (2.0 * filas * columnas)) + 1;
+
+        Y.pmatriz = b_math_test;
+        segundos = reloj_math();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            nsdsp_math_api.product(&A, &X, &Y);
+        }
+        ns[0] = 1e9 * (reloj_math() - segundos) / repeticiones;
+
+        maximo = 0.0;
+        Y.pmatriz = f_math_test;
+        for (b = 0; b < 2; b++)
+        {
+            nsdsp_math_api.dispersa(&A, 0.0f, (b == 0) ? 1 : 4, &S);
+            segundos = reloj_math();
+            for (rep = 0; rep < repeticiones; rep++)
+            {
+                nsdsp_math_api.producto_disperso(&S, &X, &Y);
+            }
+            ns[1 + b] = 1e9 * (reloj_math() - segundos) / repeticiones;
+            for (i = 0; i < filas; i++)
+            {
+                error = fabs((double)f_math_test[i] - (double)b_math_test[i]);
+                maximo = (error > maximo) ? error : maximo;
+            }
+        }
+
+        test_math_printf("  %7u%% | %10.0f | %10.0f | %12.0f | %10.3e\n", densidades[d], ns[0], ns[1], ns[2],
+                         maximo);
+        if (maximo > 1e-4 || !(ns[0] > 0.0) || !(ns[1] > 0.0) || !(ns[2] > 0.0))
+        {
+            result = TEST_KO;
+        }
+        for (b = 0; b < 2; b++)
+        {
+            cruce[b] = (cruce[b] == 0 && ns[1 + b] >= ns[0]) ? densidades[d] : cruce[b];
+        }
+    }
+    for (b = 0; b < 2; b++)
+    {
+        if (cruce[b] > 0)
+            test_math_printf("  %s: la densa es más rápida a partir de una densidad del %u%%\n",
+                             (b == 0) ? "CSR 1" : "CSR 1x4", cruce[b]);
+        else
+            test_math_printf("  %s: más rápida que la densa en todo el rango medido\n",
+                             (b == 0) ? "CSR 1" : "CSR 1x4");
+    }
+
+    if (result == TEST_OK)
+        test_math_printf("\nTest Matriz_Dispersa: PASSED\n");
+    else
+        test_math_printf("\nTest Matriz_Dispersa: FAILED\n");
+
+    return result;
+}
+
+int Test_Operacion_Preparada(void)
+{
+    int result = TEST_OK;
+    unsigned int i, t, rep, repeticiones, m, p, n;
+    static const unsigned int formas[5][3] = {{1, 1, 1}, {7, 5, 1}, {16, 16, 1}, {33, 20, 9}, {64, 64, 64}};
+    static const unsigned int ordenes[5] = {4, 8, 16, 32, 64};
+    double segundos, ns[2];
+    MATRIZ A, B, C, D;
+    MATRIZ_OPERACION O;
+
+    test_math_printf("\n=== Test Operacion_Preparada ===\n");
+
+    nsdsp_math_init();
+    srand(48);
+
+    /* Test 1: ejecuta_producto y ejecuta_suma dan exactamente el resultado de product y suma */
+    test_math_printf("\nTest 1: Operaciones preparadas frente a product y suma\n");
+    for (t = 0; t < 5; t++)
+    {
+        m = formas[t][0];
+        p = formas[t][1];
+        n = formas[t][2];
+        A.filas = m;
+        A.columnas = p;
+        A.pmatriz = a_math_test;
+        B.filas = p;
+        B.columnas = n;
+        B.pmatriz = b_math_test;
+        C.filas = m;
+        C.columnas = n;
+        C.pmatriz = f_math_test;
+        aleatoria_math(a_math_test, m, p);
+        aleatoria_math(b_math_test, p, n);
+
+        /* Se prepara solo con las dimensiones: los datos se pasan al ejecutar */
+        D = C;
+        D.pmatriz = NULL;
+        if (nsdsp_math_api.prepara_producto(&A, &B, &D, &O) != NSDSP_MATH_OK ||
+            O.filas != m || O.interna != p || O.columnas != n)
+        {
+            test_math_printf("ERROR: prepara_producto rechazó %ux%u por %ux%u\n", m, p, p, n);
+            result = TEST_KO;
+            continue;
+        }
+        nsdsp_math_api.product(&A, &B, &C);
+        nsdsp_math_api.ejecuta_producto(&O, a_math_test, b_math_test, f2_math_test);
+        for (i = 0; i < m * n; i++)
+        {
+            if (f_math_test[i] != f2_math_test[i])
+            {
+                test_math_printf("ERROR: Producto preparado %ux%ux%u difiere en %u\n", m, p, n, i);
+                result = TEST_KO;
+                break;
+            }
+        }
+
+        /* A - A B en la suma preparada (m x n = m x p solo si p == n) */
+        B.filas = m;
+        B.pmatriz = x_math_test;
+        aleatoria_math(x_math_test, m, n);
+        A.columnas = n;
+        if (nsdsp_math_api.prepara_suma(&A, &B, &C, -1, &O) != NSDSP_MATH_OK || O.signo != -1.0f)
+        {
+            test_math_printf("ERROR: prepara_suma rechazó matrices de %ux%u\n", m, n);
+            result = TEST_KO;
+            continue;
+        }
+        nsdsp_math_api.suma(&A, &B, &C, -1);
+        nsdsp_math_api.ejecuta_suma(&O, a_math_test, x_math_test, f2_math_test);
+        for (i = 0; i < m * n; i++)
+        {
+            if (f_math_test[i] != f2_math_test[i])
+            {
+                test_math_printf("ERROR: Suma preparada %ux%u difiere en %u\n", m, n, i);
+                result = TEST_KO;
+                break;
+            }
+        }
+    }
+
+    /* Test 2: Dimensiones incompatibles detectadas al preparar, sin tocar los datos */
+    test_math_printf("\nTest 2: Preparación con dimensiones incompatibles\n");
+    A.filas = 4;
+    A.columnas = 3;
+    A.pmatriz = a_math_test;
+    B.filas = 4;
+    B.columnas = 2;
+    B.pmatriz = b_math_test;
+    C.filas = 4;
+    C.columnas = 2;
+    C.pmatriz = f_math_test;
+    f_math_test[0] = 5.0f;
+    if (nsdsp_math_api.prepara_producto(&A, &B, &C, &O) != NSDSP_MATH_KO || O.filas != 0 ||
+        nsdsp_math_api.prepara_suma(&A, &B, &C, 1, &O) != NSDSP_MATH_KO || O.filas != 0 ||
+        nsdsp_math_api.prepara_producto(NULL, &B, &C, &O) != NSDSP_MATH_KO ||
+        nsdsp_math_api.prepara_producto(&A, &B, &C, NULL) != NSDSP_MATH_KO || f_math_test[0] != 5.0f)
+    {
+        test_math_printf("ERROR: Se prepararon dimensiones incompatibles o se modificó C\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: Coste por llamada del producto matriz-vector comprobado y preparado */
+    test_math_printf("\nTest 3: Coste por llamada de W x (ns)\n");
+    test_math_printf("    n | product | ejecuta_producto | Aceleración\n");
+    for (t = 0; t < 5; t++)
+    {
+        n = ordenes[t];
+        A.filas = n;
+        A.columnas = n;
+        A.pmatriz = a_math_test;
+        B.filas = n;
+        B.columnas = 1;
+        B.pmatriz = b_math_test;
+        C.filas = n;
+        C.columnas = 1;
+        C.pmatriz = f_math_test;
+        aleatoria_math(a_math_test, n, n);
+        aleatoria_math(b_math_test, n, 1);
+        nsdsp_math_api.prepara_producto(&A, &B, &C, &O);
+        repeticiones = (unsigned int)(FLOPS_MINIMOS_MATH / (2.0 * n * n)) + 1;
+
+        segundos = reloj_math();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            nsdsp_math_api.product(&A, &B, &C);
+        }
+        ns[0] = 1e9 * (reloj_math() - segundos) / repeticiones;
+
+        segundos = reloj_math();
+        for (rep = 0; rep < repeticiones; rep++)
+        {
+            nsdsp_math_api.ejecuta_producto(&O, a_math_test, b_math_test, f_math_test);
+        }
+        ns[1] = 1e9 * (reloj_math() - segundos) / repeticiones;
+
+        test_math_printf("  %3u | %7.1f | %16.1f | %10.2fx\n", n, ns[0], ns[1], (ns[1] > 0.0) ? ns[0] / ns[1] : 0.0);
+        if (!(ns[0] > 0.0) || !(ns[1] > 0.0))
+        {
+            result = TEST_KO;
+        }
+    }
+
+    if (result == TEST_OK)
+        test_math_printf("\nTest Operacion_Preparada: PASSED\n");
+    else
+        test_math_printf("\nTest Operacion_Preparada: FAILED\n");
+
+    return result;
+}
+
+int Test_Precision_Producto(void)
+{
+    int result = TEST_OK;
+    unsigned int i, j, k, t, rep, repeticiones, m, p, n;
+    static const unsigned int formas[5][3] = {{1, 1, 1}, {7, 5, 1}, {16, 16, 1}, {33, 20, 9}, {64, 64, 64}};
+    long double referencia, escala;
+    double error, error_max, error_f, error_m, ulp_max, segundos, ns[3];
+    MATRIZ A, B, C;
+    MATRIZ_D AD, BD, CD;
+
+    test_math_printf("\n=== Test Precision_Producto ===\n");
+
+    nsdsp_math_init();
+    srand(48);
+
+    /* Test 1: product_d y suma_d frente a la referencia en long double */
+    test_math_printf("\nTest 1: product_d y suma_d frente a long double\n");
+    for (t = 0; t < 5; t++)
+    {
+        m = formas[t][0];
+        p = formas[t][1];
+        n = formas[t][2];
+        AD.filas = m;
+        AD.columnas = p;
+        AD.pmatriz = ad_math_test;
+        BD.filas = p;
+        BD.columnas = n;
+        BD.pmatriz = bd_math_test;
+        CD.filas = m;
+        CD.columnas = n;
+        CD.pmatriz = cd_math_test;
+        for (i = 0; i < m * p; i++)
+        {
+            ad_math_test[i] = (double)aleatorio_math() + (double)aleatorio_math() * 1e-8;
+        }
+        for (i = 0; i < p * n; i++)
+        {
+            bd_math_test[i] = (double)aleatorio_math() + (double)aleatorio_math() * 1e-8;
+        }
+
+        error_max = 0.0;
+        if (nsdsp_math_api.product_d(&AD, &BD, &CD) != NSDSP_MATH_OK)
+        {
+            error_max = 1.0;
+        }
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                referencia = 0.0L;
+                escala = 0.0L;
+                for (k = 0; k < p; k++)
+                {
+                    referencia += (long double)ad_math_test[i * p + k] * bd_math_test[k * n + j];
+                    escala += fabsl((long double)ad_math_test[i * p + k] * bd_math_test[k * n + j]);
+                }
+                error = (double)(fabsl((long double)cd_math_test[i * n + j] - referencia) / (escala + 1e-300L));
+                if (error > error_max) error_max = error;
+            }
+        }
+        test_math_printf("  product_d %2ux%2u por %2ux%2u: error relativo %e\n", m, p, p, n, error_max);
+        if (error_max > 1e-14 * p)
+        {
+            test_math_printf("ERROR: product_d fuera de la precisión double\n");
+            result = TEST_KO;
+        }
+
+        /* Suma y resta de A consigo misma desplazada: A + A = 2A y A - A = 0 exactos en double */
+        BD.filas = m;
+        BD.columnas = p;
+        BD.pmatriz = ad_math_test;
+        CD.filas = m;
+        CD.columnas = p;
+        CD.pmatriz = bd_math_test;
+        if (nsdsp_math_api.suma_d(&AD, &BD, &CD, 1) != NSDSP_MATH_OK)
+        {
+            result = TEST_KO;
+        }
+        for (i = 0; i < m * p; i++)
+        {
+            if (bd_math_test[i] != 2.0 * ad_math_test[i])
+            {
+                test_math_printf("ERROR: suma_d incorrecta en el elemento %u\n", i);
+                result = TEST_KO;
+                break;
+            }
+        }
+        if (nsdsp_math_api.suma_d(&AD, &BD, &CD, -1) != NSDSP_MATH_OK)
+        {
+            result = TEST_KO;
+        }
+        for (i = 0; i < m * p; i++)
+        {
+            if (bd_math_test[i] != 0.0)
+            {
+                test_math_printf("ERROR: resta con suma_d incorrecta en el elemento %u\n", i);
+                result = TEST_KO;
+                break;
+            }
+        }
+    }
+
+    /* Test 2: dimensiones incompatibles */
+    test_math_printf("\nTest 2: Dimensiones incompatibles en doble precisión\n");
+    AD.filas = 3;
+    AD.columnas = 4;
+    AD.pmatriz = ad_math_test;
+    BD.filas = 3;
+    BD.columnas = 4;
+    BD.pmatriz = bd_math_test;
+    CD.filas = 3;
+    CD.columnas = 4;
+    CD.pmatriz = cd_math_test;
+    cd_math_test[0] = 1.0;
+    if (nsdsp_math_api.product_d(&AD, &BD, &CD) != NSDSP_MATH_KO || cd_math_test[0] != 0.0)
+    {
+        test_math_printf("ERROR: product_d aceptó 3x4 por 3x4\n");
+        result = TEST_KO;
+    }
+    CD.columnas = 3;
+    if (nsdsp_math_api.suma_d(&AD, &BD, &CD, 1) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: suma_d aceptó una salida 3x3\n");
+        result = TEST_KO;
+    }
+    if (nsdsp_math_api.product_d(NULL, &BD, &CD) != NSDSP_MATH_KO)
+    {
+        test_math_printf("ERROR: product_d aceptó un puntero NULL\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: product_m frente a product con cancelación. Cada C(i,j) suma 256 productos de orden 1000
+     * con signos alternos y resultado de orden 10 */
+    test_math_printf("\nTest 3: product_m frente a product (256 términos con cancelación)\n");
+    m = 4;
+    p = P_PRECISION_MATH;
+    n = 5;
+    A.filas = m;
+    A.columnas = p;
+    A.pmatriz = a_math_test;
+    B.filas = p;
+    B.columnas = n;
+    B.pmatriz = b_math_test;
+    C.filas = m;
+    C.columnas = n;
+    for (i = 0; i < m * p; i++)
+    {
+        a_math_test[i] = 1000.0f + aleatorio_math();
+    }
+    for (k = 0; k < p; k++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            b_math_test[k * n + j] = ((k & 1) ? -1.0f : 1.0f) * (1.0f + 0.01f * aleatorio_math());
+        }
+    }
+    C.pmatriz = f_math_test;
+    nsdsp_math_api.product(&A, &B, &C);
+    C.pmatriz = f2_math_test;
+    if (nsdsp_math_api.product_m(&A, &B, &C) != NSDSP_MATH_OK)
+    {
+        result = TEST_KO;
+    }
+    error_f = 0.0;
+    error_m = 0.0;
+    ulp_max = 0.0;
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            referencia = 0.0L;
+            for (k = 0; k < p; k++)
+            {
+                referencia += (long double)a_math_test[i * p + k] * b_math_test[k * n + j];
+            }
+            error = (double)fabsl((long double)f_math_test[i * n + j] - referencia);
+            if (error > error_f) error_f = error;
+            error = (double)fabsl((long double)f2_math_test[i * n + j] - referencia);
+            if (error > error_m) error_m = error;
+            error = (double)fabsl(referencia) * 0.5 * FLT_EPSILON;
+            if (error > ulp_max) ulp_max = error;
+        }
+    }
+    test_math_printf("  Error máximo product: %e, product_m: %e (medio ulp float del resultado: %e)\n",
+                     error_f, error_m, ulp_max);
+    if (error_m > ulp_max || error_m > error_f)
+    {
+        test_math_printf("ERROR: product_m no acumula en doble precisión\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: tiempo de un producto 64x64 en las tres precisiones */
+    test_math_printf("\nTest 4: Tiempo de un producto %ux%u\n", N_PRECISION_MATH, N_PRECISION_MATH);
+    n = N_PRECISION_MATH;
+    A.filas = n;
+    A.columnas = n;
+    B.filas = n;
+    B.columnas = n;
+    C.filas = n;
+    C.columnas = n;
+    C.pmatriz = f_math_test;
+    AD.filas = n;
+    AD.columnas = n;
+    BD.filas = n;
+    BD.columnas = n;
+    CD.filas = n;
+    CD.columnas = n;
+    aleatoria_math(a_math_test, n, n);
+    aleatoria_math(b_math_test, n, n);
+    for (i = 0; i < n * n; i++)
+    {
+        ad_math_test[i] = a_math_test[i];
+        bd_math_test[i] = b_math_test[i];
+    }
+    repeticiones = (unsigned int)(FLOPS_MINIMOS_MATH / (2.0 * n * n * n)) + 1;
+
+    segundos = reloj_math();
+    for (rep = 0; rep < repeticiones; rep++)
+    {
+        nsdsp_math_api.product(&A, &B, &C);
+    }
+    ns[0] = 1e9 * (reloj_math() - segundos) / repeticiones;
+
+    segundos = reloj_math();
+    for (rep = 0; rep < repeticiones; rep++)
+    {
+        nsdsp_math_api.product_m(&A, &B, &C);
+    }
+    ns[1] = 1e9 * (reloj_math() - segundos) / repeticiones;
+
+    segundos = reloj_math();
+    for (rep = 0; rep < repeticiones; rep++)
+    {
+        nsdsp_math_api.product_d(&AD, &BD, &CD);
+    }
+    ns[2] = 1e9 * (reloj_math() - segundos) / repeticiones;
+
+    test_math_printf("  product: %.0f ns, product_m: %.0f ns, product_d: %.0f ns\n", ns[0], ns[1], ns[2]);
+    if (!(ns[0] > 0.0) || !(ns[1] > 0.0) || !(ns[2] > 0.0))
+    {
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_math_printf("\nTest Precision_Producto: PASSED\n");
+    else
+        test_math_printf("\nTest Precision_Producto: FAILED\n");
+
+    return result;
+}
+
+int Run_All_NSDSP_Math_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    math_test_log_file = fopen("NSDSP_Math_Tests_Result.txt", "a");
+    if (math_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de NSDSP Math\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_math_printf("\n\n########################################\n");
+        test_math_printf("# NSDSP Math Unit Tests\n");
+        test_math_printf("# Fecha y hora: %s\n", time_string);
+        test_math_printf("########################################\n");
+    }
+
+    test_math_printf("\n========================================\n");
+    test_math_printf("    EJECUTANDO TESTS NSDSP MATH\n");
+    test_math_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Matriz_Producto();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Matriz_Suma();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Factorizaciones();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Rendimiento_Factorizaciones();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Vistas();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Producto_Paralelo();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Producto_Lote();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Matriz_Dispersa();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Operacion_Preparada();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Precision_Producto();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    /* Los hilos persistentes del ejecutor de prueba terminan con los tests */
+    detiene_ejecutor_math_test();
 
     test_math_printf("\n========================================\n");
     if (total_result == TEST_OK)
@@ -0,0 +1,528 @@
+/** \page test_rls TEST UNITARIOS RLS
+ * \brief Módulo de pruebas unitarias para los filtros adaptativos RLS
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo RLS. Las pruebas identifican un camino con entrada coloreada,
+ * comparan el RLS por QR inverso con el RLS en celosía y con el NLMS del módulo LMS_Filter,
+ * comprueban el seguimiento de un cambio de planta y la estabilidad en ejecuciones largas, y
+ * miden el coste por muestra de ambas formas en función del orden. Los tests solo se compilan
+ * y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_rls Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en RLS_Tests_Result.txt
+ *
+ * \section funciones_test_rls Descripción de funciones
+ *
+ * \subsection test_identificacion_rls Test_Identificacion_RLS
+ * Identificación de un camino de 16 coeficientes con entrada AR(1) de polo 0.95:
+ * - El QR-RLS alcanza el suelo de ruido en pocas veces N muestras, frente al NLMS
+ * - Los errores a priori del QR-RLS y de la celosía coinciden tras el transitorio
+ * - Seguimiento de un cambio brusco de la planta con λ < 1
+ * - Modo por bloques idéntico al modo muestra a muestra
+ * - Rechazo de parámetros inválidos
+ *
+ * \subsection test_coste_rls Test_Coste_RLS
+ * - Estabilidad de ambas formas durante 10⁶ muestras con λ = 0.99
+ * - Tabla de coste por muestra frente al orden (8..128): O(N²) frente a O(N)
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_rls Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "rls.h"
+#include "lms_filter.h"
+#include "test_rls.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_RLS_TEST          16
+#define L_RLS_TEST          (16 * 1024)
+#define L_LARGA_RLS         (1024 * 1024)
+#define N_MAX_COSTE_RLS     128
+#define L_COSTE_RLS         8192
+#define RUIDO_RLS_TEST      1e-3f
+
+/* Variable global para el archivo de log */
+static FILE *rls_test_log_file = NULL;
+
+/* Buffers de test */
+static float x_rls_test[L_RLS_TEST];
+static float d_rls_test[L_RLS_TEST];
+static float e_rls_test[L_RLS_TEST];
+static float e2_rls_test[L_RLS_TEST];
+static float h_rls_test[2][N_MAX_COSTE_RLS];
+static float w_rls_test[N_MAX_COSTE_RLS];
+static float w2_rls_test[N_MAX_COSTE_RLS];
+static float z_rls_test[LMS_RETARDO(N_MAX_COSTE_RLS)];
+static float qr_ws_rls_test[RLS_QR_WORKSPACE(N_MAX_COSTE_RLS)];
+static float qr2_ws_rls_test[RLS_QR_WORKSPACE(N_MAX_COSTE_RLS)];
+static float lattice_ws_rls_test[RLS_LATTICE_WORKSPACE(N_MAX_COSTE_RLS)];
+static float lattice2_ws_rls_test[RLS_LATTICE_WORKSPACE(N_MAX_COSTE_RLS)];
+
+/* Declaración de funciones de test */
+int Test_Identificacion_RLS(void);
+int Test_Coste_RLS(void);
+int Run_All_RLS_Tests(void);
+
+/* Funciones auxiliares */
+void test_rls_printf(const char *format, ...);
+float ruido_rls(void);
+void senal_rls(float coloreado, unsigned int ncoef, unsigned int cambio);
+double desajuste_rls(const float *w, const float *h, unsigned int ncoef);
+double potencia_rls(const float *e, unsigned int inicio, unsigned int fin);
+
+/* Definición de funciones */
+
+void test_rls_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (rls_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(rls_test_log_file, format, args);
+        va_end(args);
+        fflush(rls_test_log_file);
+    }
+}
+
+float ruido_rls(void)
+{
+    /* Ruido uniforme de varianza unidad */
+    return 1.7320508f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+}
+
+void senal_rls(float coloreado, unsigned int ncoef, unsigned int cambio)
+{
+    unsigned int i, k, c;
+    float anterior;
+
+    /* Entrada AR(1) de varianza unidad y dos caminos aleatorios: el segundo actúa desde 'cambio' */
+    anterior = 0.0f;
+    for (i = 0; i < L_RLS_TEST; i++)
+    {
+        anterior = coloreado * anterior + sqrtf(1.0f - coloreado * coloreado) * ruido_rls();
+        x_rls_test[i] = anterior;
+    }
+
+    for (c = 0; c < 2; c++)
+    {
+        for (k = 0; k < ncoef; k++)
+        {
+            h_rls_test[c][k] = (float)exp(-3.0 * k / ncoef) * 0.5f * ruido_rls();
+        }
+    }
+
+    for (i = 0; i < L_RLS_TEST; i++)
+    {
+        c = (i < cambio) ? 0 : 1;
+        d_rls_test[i] = RUIDO_RLS_TEST * ruido_rls();
+        for (k = 0; k < ncoef && k <= i; k++)
+        {
+            d_rls_test[i] += h_rls_test[c][k] * x_rls_test[i - k];
+        }
+    }
+}
+
+double desajuste_rls(const float *w, const float *h, unsigned int ncoef)
+{
+    unsigned int k;
+    double error, norma;
+
+    error = 0.0;
+    norma = 0.0;
+    for (k = 0; k < ncoef; k++)
+    {
+        error += ((double)w[k] - h[k]) * ((double)w[k] - h[k]);
+        norma += (double)h[k] * h[k];
+    }
+
+    return 10.0 * log10(error / norma);
+}
+
+double potencia_rls(const float *e, unsigned int inicio, unsigned int fin)
+{
+    unsigned int i;
+    double suma;
+
+    suma = 0.0;
+    for (i = inicio; i < fin; i++)
+    {
+        suma += (double)e[i] * e[i];
+    }
+
+    return 10.0 * log10(suma / (fin - inicio) + 1e-30);
+}
+
+int Test_Identificacion_RLS(void)
+{
+    int result = TEST_OK;
+    unsigned int i, posicion, bloque, cruce_qr, cruce_nlms;
+    RLS_QR_OBJECT qr, qr_bloques;
+    RLS_LATTICE_OBJECT lattice, lattice_bloques;
+    LMS_OBJECT nlms;
+    double dB_qr, dB_nlms, dB_diferencia, dB_lattice, dB_cambio;
+    float diferencia;
+
+    test_rls_printf("\n=== Test Identificacion_RLS ===\n");
+
+    Init_Fir();
+    Init_LMS();
+    Init_RLS();
+    srand(40);
+
+    senal_rls(0.95f, N_RLS_TEST, L_RLS_TEST);
+
+    /* Test 1: convergencia del QR-RLS frente al NLMS con entrada coloreada */
+    test_rls_printf("\nTest 1: Identificación de %u coeficientes con entrada AR(1) 0.95\n", N_RLS_TEST);
+    test_rls_printf("  Muestras | QR-RLS (dB) |   NLMS (dB)\n");
+
+    for (i = 0; i < N_RLS_TEST; i++)
+    {
+        w_rls_test[i] = 0.0f;
+        w2_rls_test[i] = 0.0f;
+    }
+    if (rls_api.get_qr(N_RLS_TEST, 1.0f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr) != RLS_OK ||
+        rls_api.get_lattice(N_RLS_TEST, 1.0f, 1e-2f, lattice_ws_rls_test, &lattice) != RLS_OK)
+    {
+        test_rls_printf("ERROR: get_qr/get_lattice fallaron con parámetros válidos\n");
+        return TEST_KO;
+    }
+    lms_api.get_lms(N_RLS_TEST, w2_rls_test, z_rls_test, LMS_NORMALIZADO, 0.5f, 1e-2f, &nlms);
+
+    cruce_qr = 0;
+    cruce_nlms = 0;
+    for (i = 0; i < L_RLS_TEST; i++)
+    {
+        rls_api.qr_filter(x_rls_test[i], d_rls_test[i], &qr);
+        e_rls_test[i] = qr.error;
+        rls_api.lattice_filter(x_rls_test[i], d_rls_test[i], &lattice);
+        e2_rls_test[i] = lattice.error;
+        lms_api.lms_filter(x_rls_test[i], d_rls_test[i], &nlms);
+
+        if (cruce_qr == 0 && desajuste_rls(w_rls_test, h_rls_test[0], N_RLS_TEST) < -40.0)
+        {
+            cruce_qr = i + 1;
+        }
+        if ((i + 1) % 2048 == 0)
+        {
+            lms_api.sincroniza_lms(&nlms);
+            dB_qr = desajuste_rls(w_rls_test, h_rls_test[0], N_RLS_TEST);
+            dB_nlms = desajuste_rls(w2_rls_test, h_rls_test[0], N_RLS_TEST);
+            test_rls_printf("  %8u | %11.1f | %11.1f\n", i + 1, dB_qr, dB_nlms);
+            if (cruce_nlms == 0 && dB_nlms < -40.0)
+            {
+                cruce_nlms = i + 1;
+            }
+        }
+    }
+
+    dB_qr = desajuste_rls(w_rls_test, h_rls_test[0], N_RLS_TEST);
+    test_rls_printf("Muestras hasta -40 dB: QR-RLS %u, NLMS %u\n", cruce_qr, cruce_nlms);
+    if (!(dB_qr < -50.0) || cruce_qr == 0 || cruce_qr > 20 * N_RLS_TEST ||
+        (cruce_nlms != 0 && cruce_nlms <= cruce_qr))
+    {
+        test_rls_printf("ERROR: El QR-RLS no converge más rápido que el NLMS\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: la celosía produce los mismos errores a priori que el QR-RLS */
+    test_rls_printf("\nTest 2: Errores a priori del QR-RLS frente a la celosía\n");
+
+    for (i = 0; i < L_RLS_TEST; i++)
+    {
+        e2_rls_test[i] -= e_rls_test[i];
+    }
+    dB_diferencia = potencia_rls(e2_rls_test, 20 * N_RLS_TEST, L_RLS_TEST);
+    dB_qr = potencia_rls(e_rls_test, 20 * N_RLS_TEST, L_RLS_TEST);
+    test_rls_printf("Error QR-RLS: %.1f dB, diferencia con la celosía: %.1f dB\n", dB_qr, dB_diferencia);
+    if (!(dB_diferencia < dB_qr - 20.0))
+    {
+        test_rls_printf("ERROR: La celosía no reproduce el error del RLS transversal\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: seguimiento de un cambio de planta con lambda = 0.99 */
+    test_rls_printf("\nTest 3: Seguimiento de un cambio de planta (lambda = 0.99)\n");
+
+    senal_rls(0.95f, N_RLS_TEST, L_RLS_TEST / 2);
+    for (i = 0; i < N_RLS_TEST; i++)
+    {
+        w_rls_test[i] = 0.0f;
+    }
+    rls_api.get_qr(N_RLS_TEST, 0.99f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr);
+    rls_api.get_lattice(N_RLS_TEST, 0.99f, 1e-2f, lattice_ws_rls_test, &lattice);
+    rls_api.qr_bloque(x_rls_test, d_rls_test, NULL, e_rls_test, L_RLS_TEST, &qr);
+    rls_api.lattice_bloque(x_rls_test, d_rls_test, NULL, e2_rls_test, L_RLS_TEST, &lattice);
+
+    dB_cambio = desajuste_rls(w_rls_test, h_rls_test[1], N_RLS_TEST);
+    dB_qr = potencia_rls(e_rls_test, L_RLS_TEST / 2 + 1000, L_RLS_TEST);
+    dB_lattice = potencia_rls(e2_rls_test, L_RLS_TEST / 2 + 1000, L_RLS_TEST);
+    test_rls_printf("Desajuste tras el cambio: %.1f dB; error QR-RLS %.1f dB, celosía %.1f dB (ruido %.1f dB)\n",
+                    dB_cambio, dB_qr, dB_lattice, 20.0 * log10(RUIDO_RLS_TEST));
+    if (!(dB_cambio < -40.0) || !(dB_qr < 20.0 * log10(RUIDO_RLS_TEST) + 3.0) ||
+        !(dB_lattice < 20.0 * log10(RUIDO_RLS_TEST) + 3.0))
+    {
+        test_rls_printf("ERROR: El RLS no sigue el cambio de planta\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: bloques de tamaño variable */
+    test_rls_printf("\nTest 4: Modo por bloques frente a muestra a muestra\n");
+
+    for (i = 0; i < N_RLS_TEST; i++)
+    {
+        w_rls_test[i] = 0.0f;
+        w2_rls_test[i] = 0.0f;
+    }
+    rls_api.get_qr(N_RLS_TEST, 0.99f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr);
+    rls_api.get_qr(N_RLS_TEST, 0.99f, 1e-2f, w2_rls_test, qr2_ws_rls_test, &qr_bloques);
+    rls_api.get_lattice(N_RLS_TEST, 0.99f, 1e-2f, lattice_ws_rls_test, &lattice);
+    rls_api.get_lattice(N_RLS_TEST, 0.99f, 1e-2f, lattice2_ws_rls_test, &lattice_bloques);
+
+    for (i = 0; i < L_RLS_TEST / 4; i++)
+    {
+        rls_api.qr_filter(x_rls_test[i], d_rls_test[i], &qr);
+        e_rls_test[i] = qr.error;
+        rls_api.lattice_filter(x_rls_test[i], d_rls_test[i], &lattice);
+        e2_rls_test[i] = lattice.error;
+    }
+
+    diferencia = 0.0f;
+    posicion = 0;
+    while (posicion < L_RLS_TEST / 4)
+    {
+        bloque = 1 + (unsigned int)rand() % 300;
+        if (bloque > L_RLS_TEST / 4 - posicion)
+        {
+            bloque = L_RLS_TEST / 4 - posicion;
+        }
+
+        rls_api.qr_bloque(&x_rls_test[posicion], &d_rls_test[posicion], NULL, &e_rls_test[L_RLS_TEST / 2 + posicion],
+                          bloque, &qr_bloques);
+        rls_api.lattice_bloque(&x_rls_test[posicion], &d_rls_test[posicion], NULL,
+                               &e2_rls_test[L_RLS_TEST / 2 + posicion], bloque, &lattice_bloques);
+        posicion += bloque;
+    }
+    for (i = 0; i < L_RLS_TEST / 4; i++)
+    {
+        diferencia = fmaxf(diferencia, fabsf(e_rls_test[i] - e_rls_test[L_RLS_TEST / 2 + i]));
+        diferencia = fmaxf(diferencia, fabsf(e2_rls_test[i] - e2_rls_test[L_RLS_TEST / 2 + i]));
+    }
+
+    test_rls_printf("Diferencia máxima: %.2e\n", diferencia);
+    if (diferencia != 0.0f)
+    {
+        test_rls_printf("ERROR: El modo por bloques no coincide con el modo muestra a muestra\n");
+        result = TEST_KO;
+    }
+
+    /* Test 5: parámetros inválidos */
+    test_rls_printf("\nTest 5: Parámetros inválidos\n");
+
+    if (rls_api.get_qr(0, 0.99f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr) != RLS_KO ||
+        rls_api.get_qr(N_RLS_TEST, 0.0f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr) != RLS_KO ||
+        rls_api.get_qr(N_RLS_TEST, 1.01f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr) != RLS_KO ||
+        rls_api.get_qr(N_RLS_TEST, 0.99f, 0.0f, w_rls_test, qr_ws_rls_test, &qr) != RLS_KO ||
+        rls_api.get_qr(N_RLS_TEST, 0.99f, 1e-2f, NULL, qr_ws_rls_test, &qr) != RLS_KO ||
+        rls_api.get_qr(N_RLS_TEST, 0.99f, 1e-2f, w_rls_test, NULL, &qr) != RLS_KO ||
+        rls_api.get_lattice(0, 0.99f, 1e-2f, lattice_ws_rls_test, &lattice) != RLS_KO ||
+        rls_api.get_lattice(N_RLS_TEST, -0.5f, 1e-2f, lattice_ws_rls_test, &lattice) != RLS_KO ||
+        rls_api.get_lattice(N_RLS_TEST, 0.99f, -1.0f, lattice_ws_rls_test, &lattice) != RLS_KO ||
+        rls_api.get_lattice(N_RLS_TEST, 0.99f, 1e-2f, NULL, &lattice) != RLS_KO ||
+        rls_api.qr_filter(1.0f, 1.0f, NULL) != 0.0f ||
+        rls_api.lattice_filter(1.0f, 1.0f, NULL) != 0.0f ||
+        rls_api.qr_bloque(NULL, d_rls_test, NULL, NULL, 4, &qr_bloques) != RLS_KO ||
+        rls_api.lattice_bloque(x_rls_test, NULL, NULL, NULL, 4, &lattice_bloques) != RLS_KO)
+    {
+        test_rls_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_rls_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_rls_printf("\nTest Identificacion_RLS: PASSED\n");
+    else
+        test_rls_printf("\nTest Identificacion_RLS: FAILED\n");
+
+    return result;
+}
+
+int Test_Coste_RLS(void)
+{
+    int result = TEST_OK;
+    unsigned int i, n, vuelta;
+    RLS_QR_OBJECT qr;
+    RLS_LATTICE_OBJECT lattice;
+    double dB_qr, dB_lattice, t_qr, t_lattice;
+    clock_t inicio, fin;
+
+    test_rls_printf("\n=== Test Coste_RLS ===\n");
+
+    Init_RLS();
+    srand(41);
+
+    /* Test 1: estabilidad durante 10^6 muestras con entrada coloreada y lambda = 0.99 */
+    test_rls_printf("\nTest 1: Estabilidad en %u muestras (N = %u, lambda = 0.99)\n", L_LARGA_RLS, N_RLS_TEST);
+
+    senal_rls(0.95f, N_RLS_TEST, L_RLS_TEST);
+    for (i = 0; i < N_RLS_TEST; i++)
+    {
+        w_rls_test[i] = 0.0f;
+    }
+    rls_api.get_qr(N_RLS_TEST, 0.99f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr);
+    rls_api.get_lattice(N_RLS_TEST, 0.99f, 1e-2f, lattice_ws_rls_test, &lattice);
+
+    for (vuelta = 0; vuelta < L_LARGA_RLS / L_RLS_TEST; vuelta++)
+    {
+        rls_api.qr_bloque(x_rls_test, d_rls_test, NULL, e_rls_test, L_RLS_TEST, &qr);
+        rls_api.lattice_bloque(x_rls_test, d_rls_test, NULL, e2_rls_test, L_RLS_TEST, &lattice);
+    }
+
+    /* La señal se repite cada L_RLS_TEST muestras: se mide la segunda mitad de la última vuelta, lejos
+     * del transitorio que provoca la discontinuidad al volver al principio */
+    dB_qr = potencia_rls(e_rls_test, L_RLS_TEST / 2, L_RLS_TEST);
+    dB_lattice = potencia_rls(e2_rls_test, L_RLS_TEST / 2, L_RLS_TEST);
+    test_rls_printf("Error final: QR-RLS %.1f dB, celosía %.1f dB (ruido %.1f dB), desajuste %.1f dB\n",
+                    dB_qr, dB_lattice, 20.0 * log10(RUIDO_RLS_TEST),
+                    desajuste_rls(w_rls_test, h_rls_test[0], N_RLS_TEST));
+    if (!(dB_qr < 20.0 * log10(RUIDO_RLS_TEST) + 3.0) || !(dB_lattice < 20.0 * log10(RUIDO_RLS_TEST) + 3.0))
+    {
+        test_rls_printf("ERROR: El RLS pierde la estabilidad en ejecuciones largas\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: coste por muestra frente al orden */
+    test_rls_printf("\nTest 2: Coste por muestra frente al orden\n");
+    test_rls_printf("     N | QR-RLS (ns) | Celosía (ns)\n");
+
+    t_qr = 0.0;
+    t_lattice = 0.0;
+    for (n = 8; n <= N_MAX_COSTE_RLS; n *= 2)
+    {
+        for (i = 0; i < n; i++)
+        {
+            w_rls_test[i] = 0.0f;
+        }
+        rls_api.get_qr(n, 0.999f, 1e-2f, w_rls_test, qr_ws_rls_test, &qr);
+        rls_api.get_lattice(n, 0.999f, 1e-2f, lattice_ws_rls_test, &lattice);
+
+        inicio = clock();
+        rls_api.qr_bloque(x_rls_test, d_rls_test, NULL, e_rls_test, L_COSTE_RLS, &qr);
+        fin = clock();
+        t_qr = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_COSTE_RLS;
+
+        inicio = clock();
+        rls_api.lattice_bloque(x_rls_test, d_rls_test, NULL, e_rls_test, L_COSTE_RLS, &lattice);
+        fin = clock();
+        t_lattice = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_COSTE_RLS;
+
+        test_rls_printf("  %4u | %11.1f | %12.1f\n", n, t_qr, t_lattice);
+    }
+
+    if (!(t_lattice < t_qr))
+    {
+        test_rls_printf("ERROR: La celosía no es más barata que el QR-RLS para N = %u\n", N_MAX_COSTE_RLS);
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_rls_printf("\nTest Coste_RLS: PASSED\n");
+    else
+        test_rls_printf("\nTest Coste_RLS: FAILED\n");
+
+    return result;
+}
+
+int Run_All_RLS_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    rls_test_log_file = fopen("RLS_Tests_Result.txt", "a");
+    if (rls_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de RLS\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_rls_printf("\n\n########################################\n");
+        test_rls_printf("# RLS Unit Tests\n");
+        test_rls_printf("# Fecha y hora: %s\n", time_string);
+        test_rls_printf("########################################\n");
+    }
+
+    test_rls_printf("\n========================================\n");
+    test_rls_printf("    EJECUTANDO TESTS RLS\n");
+    test_rls_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Identificacion_RLS();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Coste_RLS();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_rls_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_rls_printf("TODOS LOS TESTS RLS PASARON CORRECTAMENTE\n");
+    else
+        test_rls_printf("ALGUNOS TESTS RLS FALLARON\n");
+    test_rls_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (rls_test_log_file != NULL)
+    {
+        test_rls_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_rls_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_rls_printf("FAILURE - Algunos tests fallaron\n");
+        test_rls_printf("########################################\n\n");
+
+        fclose(rls_test_log_file);
+        rls_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
@@ -67,6 +67,14 @@
  * 3. Señal gaussiana con media=-5, std=0.5 (con offset negativo)
  * 4. Señal gaussiana con media=0, std=3 (mayor dispersión)
  *
+ * \subsection test_precision Test_Precision_RT_Momentos
+ * Alimenta con la misma señal gaussiana de media 1e5 y desviación 1 un servicio float, uno mixto
+ * (compute_rt_momentos_m) y uno double (compute_rt_momentos_d). La media y la varianza se comparan con
+ * una referencia en long double que sigue el mismo algoritmo de medias móviles:
+ * - La variante double coincide con la referencia (error relativo de la varianza < 1e-9)
+ * - La variante mixta solo añade el redondeo a float de sus buffers (error relativo < 1e-5)
+ * - La variante mixta tiene menos error en la varianza que la float, que pierde las cifras de x(n) - M1
+ *
  * \subsection test_all Run_All_RT_Momentos_Tests
  * Función principal que ejecuta todos los tests y genera el reporte.
  *
@@ -105,6 +113,7 @@
  * | 02/08/2025 | Dr. Carlos Romero | 4 | Eliminados tests con señales constantes (división por cero) |
  * | 03/08/2025 | Dr. Carlos Romero | 5 | Versión simplificada con solo tests gaussianos |
  * | 03/08/2025 | Dr. Carlos Romero | 6 | Actualización documentación Doxygen según estándar |
+ * | 16/10/2026 | Dr. Carlos Romero | 7 | Añadido test de precisión de las variantes double y mixta |
  *
  * \copyright ZGR R&D AIE
  */
@@ -130,6 +139,7 @@ static FILE *test_log_file = NULL;
 int Test_Init_RT_Momentos(void);
 int Test_Suscribe_RT_Momentos(void);
 int Test_Gaussian_Signals(void);
+int Test_Precision_RT_Momentos(void);
 int Run_All_RT_Momentos_Tests(void);
 
 /* Función para escribir tanto en pantalla como en archivo */
@@ -419,6 +429,108 @@ int Test_Gaussian_Signals(void)
     return result;
 }
 
+int Test_Precision_RT_Momentos(void)
+{
+    int result = TEST_OK;
+    RT_MOMENTOS_SERVICE service_f, service_m, service_d;
+    static float senal[8 * N_MA];
+    static long double media_ref[N_MA];
+    static long double dif2_ref[N_MA];
+    long double suma, mu_ref, var_ref;
+    double error_mu_f, error_mu_m, error_var_f, error_var_m, error_var_d;
+    int i, k;
+
+    test_printf("\n=== Test Precision RT_Momentos ===\n");
+
+    Init_RT_Momentos();
+    service_f = pse.suscribe_rt_momentos();
+    service_m = pse.suscribe_rt_momentos();
+    service_d = pse.suscribe_rt_momentos_d();
+    if (service_f == NONE || service_m == NONE || service_d == NONE)
+    {
+        test_printf("ERROR: No se pudieron suscribir los servicios\n");
+        return TEST_KO;
+    }
+
+    /* Media grande frente a la desviación: x(n) - M1 cancela casi todas las cifras de x(n) */
+    srand(48);
+    for (i = 0; i < 8 * N_MA; i++)
+    {
+        senal[i] = 100000.0f + generate_gaussian_noise(0.0f, 1.0f);
+    }
+
+    /* Referencia en long double del mismo algoritmo: MA de x(n) y MA de (x(n) - M1(n))² */
+    for (k = 0; k < N_MA; k++)
+    {
+        media_ref[k] = 0.0L;
+        dif2_ref[k] = 0.0L;
+    }
+    mu_ref = 0.0L;
+    var_ref = 0.0L;
+    for (i = 0; i < 8 * N_MA; i++)
+    {
+        pse.compute_rt_momentos(service_f, senal[i]);
+        pse.compute_rt_momentos_m(service_m, senal[i]);
+        pse.compute_rt_momentos_d(service_d, (double)senal[i]);
+
+        media_ref[i % N_MA] = (long double)senal[i];
+        suma = 0.0L;
+        for (k = 0; k < N_MA; k++)
+        {
+            suma += media_ref[k];
+        }
+        mu_ref = suma / N_MA;
+        dif2_ref[i % N_MA] = ((long double)senal[i] - mu_ref) * ((long double)senal[i] - mu_ref);
+        suma = 0.0L;
+        for (k = 0; k < N_MA; k++)
+        {
+            suma += dif2_ref[k];
+        }
+        var_ref = suma / N_MA;
+    }
+
+    error_mu_f = fabs((double)((long double)servicios_rt_momentos[service_f].mu - mu_ref));
+    error_mu_m = fabs((double)((long double)servicios_rt_momentos[service_m].mu - mu_ref));
+    error_var_f = fabs((double)(((long double)servicios_rt_momentos[service_f].var2 - var_ref) / var_ref));
+    error_var_m = fabs((double)(((long double)servicios_rt_momentos[service_m].var2 - var_ref) / var_ref));
+    error_var_d = fabs((double)(((long double)servicios_rt_momentos_d[service_d].var2 - var_ref) / var_ref));
+
+    test_printf("Referencia: media %.9f, varianza %.9f\n", (double)mu_ref, (double)var_ref);
+    test_printf("Float:  media %.9f (error %e), varianza %.9f (error relativo %e)\n",
+                servicios_rt_momentos[service_f].mu, error_mu_f, servicios_rt_momentos[service_f].var2, error_var_f);
+    test_printf("Mixta:  media %.9f (error %e), varianza %.9f (error relativo %e)\n",
+                servicios_rt_momentos[service_m].mu, error_mu_m, servicios_rt_momentos[service_m].var2, error_var_m);
+    test_printf("Double: media %.9f, varianza %.9f (error relativo %e)\n",
+                servicios_rt_momentos_d[service_d].mu, servicios_rt_momentos_d[service_d].var2, error_var_d);
+
+    /* Test 1: la variante double sigue a la referencia */
+    test_printf("\nTest 1: Variante double\n");
+    if (error_var_d > 1e-9)
+    {
+        test_printf("ERROR: La varianza en doble precisión se aparta de la referencia\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: la variante mixta solo añade el redondeo de sus buffers float */
+    test_printf("\nTest 2: Variante mixta\n");
+    if (error_var_m > 1e-5 || error_var_m > error_var_f)
+    {
+        test_printf("ERROR: La varianza mixta no mejora a la float\n");
+        result = TEST_KO;
+    }
+
+    pse.unsuscribe_rt_momentos(service_f);
+    pse.unsuscribe_rt_momentos(service_m);
+    pse.unsuscribe_rt_momentos_d(service_d);
+
+    if (result == TEST_OK)
+        test_printf("\nTest Precision RT_Momentos: PASSED\n");
+    else
+        test_printf("\nTest Precision RT_Momentos: FAILED\n");
+
+    return result;
+}
+
 int Run_All_RT_Momentos_Tests(void)
 {
     int total_result = TEST_OK;
@@ -457,6 +569,9 @@ int Run_All_RT_Momentos_Tests(void)
     test_result = Test_Gaussian_Signals();
     if (test_result != TEST_OK) total_result = TEST_KO;
 
+    test_result = Test_Precision_RT_Momentos();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
     test_printf("\n========================================\n");
     if (total_result == TEST_OK)
         test_printf("TODOS LOS TESTS PASARON CORRECTAMENTE\n");
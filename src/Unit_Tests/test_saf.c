@@ -0,0 +1,470 @@
+/** \page test_saf TEST UNITARIOS SAF
+ * \brief Módulo de pruebas unitarias para el filtro adaptativo en subbandas
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo SAF. Las pruebas verifican que las bandas del SAF son las del
+ * análisis DWT, comparan la convergencia del SAF con la del NLMS en banda completa del módulo
+ * LMS_Filter con entrada coloreada, y miden el coste por muestra de ambos. Los tests
+ * solo se compilan y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_saf Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en SAF_Tests_Result.txt
+ *
+ * \section funciones_test_saf Descripción de funciones
+ *
+ * \subsection test_interfaz_saf Test_Interfaz_SAF
+ * Verifica la interfaz:
+ * - Las bandas de la referencia a tasa completa coinciden con las salidas decimadas de Dwt
+ * - Modo por bloques de cualquier tamaño idéntico al modo muestra a muestra
+ * - Rechazo de parámetros inválidos
+ *
+ * \subsection test_convergencia_saf Test_Convergencia_SAF
+ * - Identificación de un camino de 256 coeficientes con entrada AR(1) de polo 0.95: curva de
+ *   error frente al NLMS en banda completa y error final de cada banda. Se exige que el SAF
+ *   llegue a -40 dB en la mitad de muestras o menos que el NLMS y que su error final no supere
+ *   en más de 3 dB al del NLMS
+ * - Coste por muestra frente al NLMS para 1024 coeficientes (mínimo de 3 repeticiones) y coste
+ *   hasta llegar a -40 dB. Se exige que el coste hasta converger sea menor que el del NLMS y que
+ *   el coste por muestra no lo supere en más de 1.5 veces, para tolerar la carga del sistema
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_saf Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ * | 16/10/2026 | Dr. Carlos Romero | 2 | Bandas frente a Dwt y convergencia exigida frente al NLMS para la estructura multibanda |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "saf.h"
+#include "test_saf.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_SAF_TEST          256
+#define L_SAF_TEST          (64 * 1024)
+#define TRAMO_SAF_TEST      4096
+#define N_COSTE_SAF         1024
+
+/* Variable global para el archivo de log */
+static FILE *saf_test_log_file = NULL;
+
+/* Buffers de test */
+static float x_saf_test[L_SAF_TEST];
+static float d_saf_test[L_SAF_TEST];
+static float e_saf_test[L_SAF_TEST];
+static float e2_saf_test[L_SAF_TEST];
+static float h_saf_test[N_SAF_TEST];
+static float w_saf_test[N_COSTE_SAF];
+static float z_saf_test[LMS_RETARDO(N_COSTE_SAF)];
+static float workspace_saf_test[SAF_WORKSPACE(N_COSTE_SAF)];
+static float workspace2_saf_test[SAF_WORKSPACE(N_SAF_TEST)];
+
+/* Declaración de funciones de test */
+int Test_Interfaz_SAF(void);
+int Test_Convergencia_SAF(void);
+int Run_All_SAF_Tests(void);
+
+/* Funciones auxiliares */
+void test_saf_printf(const char *format, ...);
+float ruido_saf(void);
+void senal_saf(float coloreado);
+
+/* Definición de funciones */
+
+void test_saf_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (saf_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(saf_test_log_file, format, args);
+        va_end(args);
+        fflush(saf_test_log_file);
+    }
+}
+
+float ruido_saf(void)
+{
+    /* Ruido uniforme de varianza unidad */
+    return 1.7320508f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+}
+
+void senal_saf(float coloreado)
+{
+    unsigned int i, k;
+    float anterior;
+
+    /* Entrada AR(1) de varianza unidad y camino con decaimiento exponencial y amplitudes aleatorias */
+    anterior = 0.0f;
+    for (i = 0; i < L_SAF_TEST; i++)
+    {
+        anterior = coloreado * anterior + sqrtf(1.0f - coloreado * coloreado) * ruido_saf();
+        x_saf_test[i] = anterior;
+    }
+
+    for (k = 0; k < N_SAF_TEST; k++)
+    {
+        h_saf_test[k] = expf(-4.0f * k / N_SAF_TEST) * 0.3f * ruido_saf();
+    }
+
+    for (i = 0; i < L_SAF_TEST; i++)
+    {
+        d_saf_test[i] = 1e-3f * ruido_saf();
+        for (k = 0; k < N_SAF_TEST && k <= i; k++)
+        {
+            d_saf_test[i] += h_saf_test[k] * x_saf_test[i - k];
+        }
+    }
+}
+
+int Test_Interfaz_SAF(void)
+{
+    int result = TEST_OK;
+    unsigned int b, i, posicion, bloque;
+    SAF_OBJECT saf, bloques;
+    DWT_OBJECT dwt;
+    float diferencia, pico;
+    static float ws_bloques[SAF_WORKSPACE(N_SAF_TEST)];
+
+    test_saf_printf("\n=== Test Interfaz_SAF ===\n");
+
+    Init_Fir();
+    Init_DWT();
+    Init_LMS();
+    Init_SAF();
+    srand(41);
+
+    /* Test 1: las bandas de la referencia son las de la DWT en los instantes en que Dwt entrega muestra */
+    test_saf_printf("\nTest 1: Bandas a tasa completa frente a las salidas decimadas de Dwt\n");
+
+    if (saf_api.get_saf(N_SAF_TEST, 0.5f, 1e-3f, workspace2_saf_test, &saf) != SAF_OK)
+    {
+        test_saf_printf("ERROR: get_saf falló con parámetros válidos\n");
+        return TEST_KO;
+    }
+    dwt_api.get_dwt(&dwt);
+
+    diferencia = 0.0f;
+    for (i = 0; i < 4096; i++)
+    {
+        x_saf_test[i] = ruido_saf();
+        saf_api.saf_filter(x_saf_test[i], 0.0f, &saf);
+        dwt_api.dwt(x_saf_test[i], &dwt);
+        for (b = 0; b < SAF_BANDAS; b++)
+        {
+            if ((i & (SAF_DECIMACION(b) - 1)) == 0)
+            {
+                diferencia = fmaxf(diferencia, fabsf(saf.pbanda[b][saf.p_write] - dwt.yout[b]));
+            }
+        }
+    }
+
+    test_saf_printf("Diferencia máxima con Dwt: %.2e\n", diferencia);
+    if (diferencia > 1e-5f)
+    {
+        test_saf_printf("ERROR: Las bandas del SAF no coinciden con las de la DWT\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: bloques de tamaño variable */
+    test_saf_printf("\nTest 2: Modo por bloques frente a muestra a muestra\n");
+
+    senal_saf(0.9f);
+    saf_api.get_saf(N_SAF_TEST, 0.5f, 1e-3f, workspace2_saf_test, &saf);
+    saf_api.get_saf(N_SAF_TEST, 0.5f, 1e-3f, ws_bloques, &bloques);
+
+    for (i = 0; i < 16 * N_SAF_TEST; i++)
+    {
+        e2_saf_test[i] = saf_api.saf_filter(x_saf_test[i], d_saf_test[i], &saf);
+        e_saf_test[i] = saf.error;
+    }
+
+    diferencia = 0.0f;
+    pico = 0.0f;
+    posicion = 0;
+    while (posicion < 16 * N_SAF_TEST)
+    {
+        bloque = 1 + (unsigned int)rand() % 300;
+        if (bloque > 16 * N_SAF_TEST - posicion)
+        {
+            bloque = 16 * N_SAF_TEST - posicion;
+        }
+
+        /* Error in-place sobre la señal deseada */
+        saf_api.saf_bloque(&x_saf_test[posicion], &d_saf_test[posicion], &x_saf_test[posicion],
+                           &d_saf_test[posicion], bloque, &bloques);
+        for (i = posicion; i < posicion + bloque; i++)
+        {
+            diferencia = fmaxf(diferencia, fabsf(d_saf_test[i] - e_saf_test[i]));
+            pico = fmaxf(pico, fabsf(x_saf_test[i] - e2_saf_test[i]));
+        }
+        posicion += bloque;
+    }
+
+    test_saf_printf("Diferencia máxima: error %.2e, salida %.2e\n", diferencia, pico);
+    if (diferencia != 0.0f || pico != 0.0f)
+    {
+        test_saf_printf("ERROR: El modo por bloques no coincide con el modo muestra a muestra\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: parámetros inválidos */
+    test_saf_printf("\nTest 3: Parámetros inválidos\n");
+
+    if (saf_api.get_saf(0, 0.5f, 1e-3f, workspace2_saf_test, &saf) != SAF_KO ||
+        saf_api.get_saf(N_SAF_TEST, 0.0f, 1e-3f, workspace2_saf_test, &saf) != SAF_KO ||
+        saf_api.get_saf(N_SAF_TEST, 0.5f, -1.0f, workspace2_saf_test, &saf) != SAF_KO ||
+        saf_api.get_saf(N_SAF_TEST, 0.5f, 1e-3f, NULL, &saf) != SAF_KO ||
+        saf_api.get_saf(N_SAF_TEST, 0.5f, 1e-3f, workspace2_saf_test, NULL) != SAF_KO ||
+        saf_api.saf_filter(1.0f, 1.0f, NULL) != 0.0f ||
+        saf_api.saf_bloque(NULL, d_saf_test, NULL, NULL, 4, &bloques) != SAF_KO)
+    {
+        test_saf_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_saf_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_saf_printf("\nTest Interfaz_SAF: PASSED\n");
+    else
+        test_saf_printf("\nTest Interfaz_SAF: FAILED\n");
+
+    return result;
+}
+
+int Test_Convergencia_SAF(void)
+{
+    int result = TEST_OK;
+    unsigned int b, i, tramo, cruce_saf, cruce_nlms, repeticion;
+    SAF_OBJECT saf;
+    LMS_OBJECT nlms;
+    double potencia_d, error_saf, error_nlms, dB_saf, dB_nlms, t, t_saf, t_nlms;
+    double error_banda[SAF_BANDAS], potencia_banda[SAF_BANDAS];
+    clock_t inicio, fin;
+
+    test_saf_printf("\n=== Test Convergencia_SAF ===\n");
+
+    Init_Fir();
+    Init_DWT();
+    Init_LMS();
+    Init_SAF();
+    srand(42);
+
+    /* Test 1: error a priori del SAF frente al del NLMS en banda completa (mu = 0.5 en ambos) */
+    test_saf_printf("\nTest 1: Identificación de %u coeficientes con entrada AR(1) 0.95 (%u bandas)\n",
+                    N_SAF_TEST, SAF_BANDAS);
+    test_saf_printf("  Muestras |    SAF (dB) |   NLMS (dB)\n");
+
+    senal_saf(0.95f);
+    for (i = 0; i < N_SAF_TEST; i++)
+    {
+        w_saf_test[i] = 0.0f;
+    }
+    saf_api.get_saf(N_SAF_TEST, 0.5f, 1e-3f, workspace2_saf_test, &saf);
+    lms_api.get_lms(N_SAF_TEST, w_saf_test, z_saf_test, LMS_NORMALIZADO, 0.5f, 1e-3f, &nlms);
+
+    for (b = 0; b < SAF_BANDAS; b++)
+    {
+        error_banda[b] = 0.0;
+        potencia_banda[b] = 0.0;
+    }
+
+    cruce_saf = 0;
+    cruce_nlms = 0;
+    dB_saf = 0.0;
+    dB_nlms = 0.0;
+    for (tramo = 0; tramo < L_SAF_TEST; tramo += TRAMO_SAF_TEST)
+    {
+        potencia_d = 0.0;
+        error_saf = 0.0;
+        error_nlms = 0.0;
+        for (i = tramo; i < tramo + TRAMO_SAF_TEST; i++)
+        {
+            saf_api.saf_filter(x_saf_test[i], d_saf_test[i], &saf);
+            e_saf_test[i] = saf.error;
+            lms_api.lms_filter(x_saf_test[i], d_saf_test[i], &nlms);
+            e2_saf_test[i] = nlms.error;
+
+            /* Error de cada banda en las adaptaciones del último tramo, relativo a la potencia de la deseada
+             * en la banda */
+            for (b = 0; b < SAF_BANDAS && tramo + TRAMO_SAF_TEST == L_SAF_TEST && (i & (SAF_PERIODO - 1)) == 0; b++)
+            {
+                error_banda[b] += (double)saf.error_banda[b] * saf.error_banda[b];
+                potencia_banda[b] += (double)saf.deseada.yout[b] * saf.deseada.yout[b];
+            }
+
+            potencia_d += (double)d_saf_test[i] * d_saf_test[i];
+            error_saf += (double)e_saf_test[i] * e_saf_test[i];
+            error_nlms += (double)e2_saf_test[i] * e2_saf_test[i];
+        }
+        dB_saf = 10.0 * log10(error_saf / potencia_d);
+        dB_nlms = 10.0 * log10(error_nlms / potencia_d);
+        test_saf_printf("  %8u | %11.1f | %11.1f\n", tramo + TRAMO_SAF_TEST, dB_saf, dB_nlms);
+
+        if (cruce_saf == 0 && dB_saf < -40.0)
+        {
+            cruce_saf = tramo + TRAMO_SAF_TEST;
+        }
+        if (cruce_nlms == 0 && dB_nlms < -40.0)
+        {
+            cruce_nlms = tramo + TRAMO_SAF_TEST;
+        }
+    }
+
+    test_saf_printf("Error final por banda (D1..D%u, A%u):", WAVELET_LEVELS, WAVELET_LEVELS);
+    for (b = 0; b < SAF_BANDAS; b++)
+    {
+        test_saf_printf(" %.1f", 10.0 * log10(error_banda[b] / potencia_banda[b]));
+    }
+    test_saf_printf(" dB\n");
+
+    /* El SAF debe llegar a -40 dB con la mitad de muestras que el NLMS y terminar en su mismo error */
+    test_saf_printf("Muestras hasta -40 dB: SAF %u, NLMS %u\n", cruce_saf, cruce_nlms);
+    test_saf_printf("Error final: SAF %.1f dB, NLMS %.1f dB\n", dB_saf, dB_nlms);
+    if (cruce_saf == 0 || (cruce_nlms != 0 && 2 * cruce_saf > cruce_nlms))
+    {
+        test_saf_printf("ERROR: El SAF no converge más deprisa que el NLMS en banda completa\n");
+        result = TEST_KO;
+    }
+    if (!(dB_saf < dB_nlms + 3.0))
+    {
+        test_saf_printf("ERROR: El error final del SAF no alcanza al del NLMS\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: coste por muestra */
+    test_saf_printf("\nTest 2: Coste por muestra (%u coeficientes)\n", N_COSTE_SAF);
+
+    saf_api.get_saf(N_COSTE_SAF, 0.5f, 1e-3f, workspace_saf_test, &saf);
+    for (i = 0; i < N_COSTE_SAF; i++)
+    {
+        w_saf_test[i] = 0.0f;
+    }
+    lms_api.get_lms(N_COSTE_SAF, w_saf_test, z_saf_test, LMS_NORMALIZADO, 0.5f, 1e-3f, &nlms);
+
+    /* Mínimo de 3 repeticiones para descontar interrupciones del sistema */
+    t_saf = 0.0;
+    t_nlms = 0.0;
+    for (repeticion = 0; repeticion < 3; repeticion++)
+    {
+        inicio = clock();
+        saf_api.saf_bloque(x_saf_test, d_saf_test, NULL, e_saf_test, L_SAF_TEST, &saf);
+        fin = clock();
+        t = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_SAF_TEST;
+        t_saf = (repeticion == 0 || t < t_saf) ? t : t_saf;
+
+        inicio = clock();
+        lms_api.lms_bloque(x_saf_test, d_saf_test, NULL, e_saf_test, L_SAF_TEST, &nlms);
+        fin = clock();
+        t = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_SAF_TEST;
+        t_nlms = (repeticion == 0 || t < t_nlms) ? t : t_nlms;
+    }
+
+    /* El coste hasta converger usa las muestras hasta -40 dB del test 1 (NLMS: longitud total si no llega) */
+    test_saf_printf("SAF: %.1f ns/muestra, NLMS: %.1f ns/muestra (%.1fx)\n", t_saf, t_nlms, t_nlms / t_saf);
+    test_saf_printf("Coste hasta -40 dB: SAF %.1f ms, NLMS %.1f ms\n", 1e-6 * t_saf * cruce_saf,
+                    1e-6 * t_nlms * ((cruce_nlms != 0) ? cruce_nlms : L_SAF_TEST));
+    if (!(t_saf < 1.5 * t_nlms) || !(t_saf * cruce_saf < t_nlms * ((cruce_nlms != 0) ? cruce_nlms : L_SAF_TEST)))
+    {
+        test_saf_printf("ERROR: El coste del SAF supera al del NLMS en banda completa\n");
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_saf_printf("\nTest Convergencia_SAF: PASSED\n");
+    else
+        test_saf_printf("\nTest Convergencia_SAF: FAILED\n");
+
+    return result;
+}
+
+int Run_All_SAF_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    saf_test_log_file = fopen("SAF_Tests_Result.txt", "a");
+    if (saf_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de SAF\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_saf_printf("\n\n########################################\n");
+        test_saf_printf("# SAF Unit Tests\n");
+        test_saf_printf("# Fecha y hora: %s\n", time_string);
+        test_saf_printf("########################################\n");
+    }
+
+    test_saf_printf("\n========================================\n");
+    test_saf_printf("    EJECUTANDO TESTS SAF\n");
+    test_saf_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Interfaz_SAF();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Convergencia_SAF();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_saf_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_saf_printf("TODOS LOS TESTS SAF PASARON CORRECTAMENTE\n");
+    else
+        test_saf_printf("ALGUNOS TESTS SAF FALLARON\n");
+    test_saf_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (saf_test_log_file != NULL)
+    {
+        test_saf_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_saf_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_saf_printf("FAILURE - Algunos tests fallaron\n");
+        test_saf_printf("########################################\n\n");
+
+        fclose(saf_test_log_file);
+        saf_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,513 @@
+/** \page test_sdft TEST UNITARIOS SDFT
+ * \brief Módulo de pruebas unitarias para el banco de DFT deslizante
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo SDFT. Las pruebas validan el modelo de suscripción, los bins
+ * (enteros y fraccionarios) frente a una DFT directa calculada en doble precisión, la
+ * estimación de amplitud de tonos y la estabilidad en ejecuciones largas con y sin
+ * reanclaje. Los tests solo se compilan y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_sdft Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en SDFT_Tests_Result.txt
+ *
+ * \section funciones_test_sdft Descripción de funciones
+ *
+ * \subsection test_suscripcion_sdft Test_Suscripcion_SDFT
+ * Verifica el modelo de suscripción:
+ * - Asignación de MAX_SDFT servicios y SDFT_NONE cuando no quedan libres
+ * - Liberación y reasignación, y rechazo de servicios no asignados
+ * - Rechazo de parámetros inválidos
+ *
+ * \subsection test_exactitud_sdft Test_Exactitud_SDFT
+ * Verifica los bins:
+ * - Bins enteros y fraccionarios frente a la DFT directa en varios instantes
+ * - Amplitud de tonos fuera del centro del bin con ventana completa
+ * - Modo por bloques idéntico al modo muestra a muestra
+ *
+ * \subsection test_estabilidad_sdft Test_Estabilidad_SDFT
+ * Ejecuta unas 2·10^6 muestras con y sin reanclaje y compara el error final frente a la DFT
+ * directa. Mide además el coste por muestra del banco frente a una rfft por muestra.
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_sdft Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "sdft.h"
+#include "test_sdft.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_SDFT_TEST         1024
+#define K_SDFT_TEST         32
+#define L_LARGA_SDFT        (2000 * N_SDFT_TEST)
+
+/* Variable global para el archivo de log */
+static FILE *sdft_test_log_file = NULL;
+
+/* Buffers de test */
+static float senal_sdft_test[4 * N_SDFT_TEST];
+static float bins_sdft_test[K_SDFT_TEST];
+static float historia_sdft_test[N_SDFT_TEST];
+static COMPLEJO twiddle_sdft_test[RFFT_TWIDDLE_SIZE(N_SDFT_TEST)];
+static unsigned int bitrev_sdft_test[RFFT_BITREV_SIZE(N_SDFT_TEST)];
+static COMPLEJO espectro_sdft_test[N_SDFT_TEST / 2];
+
+/* Declaración de funciones de test */
+int Test_Suscripcion_SDFT(void);
+int Test_Exactitud_SDFT(void);
+int Test_Estabilidad_SDFT(void);
+int Run_All_SDFT_Tests(void);
+
+/* Funciones auxiliares */
+void test_sdft_printf(const char *format, ...);
+double error_dft_sdft(SDFT_SERVICE service, const float *ventana);
+
+/* Definición de funciones */
+
+void test_sdft_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (sdft_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(sdft_test_log_file, format, args);
+        va_end(args);
+        fflush(sdft_test_log_file);
+    }
+}
+
+double error_dft_sdft(SDFT_SERVICE service, const float *ventana)
+{
+    unsigned int k, m, n;
+    double fase, ref_re, ref_im, error, error_max, norma;
+    SDFT *ps;
+
+    /* Error máximo de los bins relativo a la norma de la ventana (ventana[0] es la muestra más antigua) */
+    ps = &servicios_sdft[service];
+    n = ps->n;
+
+    norma = 0.0;
+    for (m = 0; m < n; m++)
+    {
+        norma += (double)ventana[m] * ventana[m];
+    }
+    norma = sqrt(norma * n);
+
+    error_max = 0.0;
+    for (k = 0; k < ps->nbins; k++)
+    {
+        ref_re = 0.0;
+        ref_im = 0.0;
+        for (m = 0; m < n; m++)
+        {
+            fase = -2.0 * FFT_PI * (double)ps->bin[k] * (double)m / (double)n;
+            ref_re += ventana[m] * cos(fase);
+            ref_im += ventana[m] * sin(fase);
+        }
+
+        error = sqrt((ps->re[k] - ref_re) * (ps->re[k] - ref_re) + (ps->im[k] - ref_im) * (ps->im[k] - ref_im));
+        if (error > error_max)
+        {
+            error_max = error;
+        }
+    }
+
+    return error_max / norma;
+}
+
+int Test_Suscripcion_SDFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i;
+    SDFT_SERVICE servicios[MAX_SDFT];
+    SDFT_SERVICE extra;
+    const float bins[2] = {10.0f, 20.5f};
+
+    test_sdft_printf("\n=== Test Suscripcion_SDFT ===\n");
+
+    Init_SDFT();
+
+    /* Test 1: asignación de todos los servicios */
+    test_sdft_printf("\nTest 1: Asignación de %u servicios\n", MAX_SDFT);
+
+    for (i = 0; i < MAX_SDFT; i++)
+    {
+        servicios[i] = sdft_api.suscribe_sdft(64, bins, 2, 1);
+        if (servicios[i] == SDFT_NONE)
+        {
+            test_sdft_printf("ERROR: No se pudo asignar el servicio %u\n", i);
+            result = TEST_KO;
+        }
+    }
+
+    extra = sdft_api.suscribe_sdft(64, bins, 2, 1);
+    if (extra != SDFT_NONE)
+    {
+        test_sdft_printf("ERROR: Se asignó un servicio con todos ocupados\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_sdft_printf("Sin servicios libres: SDFT_NONE (PASSED)\n");
+    }
+
+    /* Test 2: liberación y reasignación */
+    test_sdft_printf("\nTest 2: Liberación y reasignación\n");
+
+    if (sdft_api.unsuscribe_sdft(servicios[1]) != SDFT_OK ||
+        sdft_api.unsuscribe_sdft(servicios[1]) != SDFT_KO ||
+        sdft_api.compute_sdft(servicios[1], 1.0f) != SDFT_KO)
+    {
+        test_sdft_printf("ERROR: La liberación del servicio no es correcta\n");
+        result = TEST_KO;
+    }
+
+    extra = sdft_api.suscribe_sdft(64, bins, 2, 1);
+    if (extra != servicios[1])
+    {
+        test_sdft_printf("ERROR: No se reasignó el servicio liberado\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_sdft_printf("Servicio %d reasignado (PASSED)\n", extra);
+    }
+
+    for (i = 0; i < MAX_SDFT; i++)
+    {
+        sdft_api.unsuscribe_sdft(servicios[i]);
+    }
+
+    /* Test 3: parámetros inválidos */
+    test_sdft_printf("\nTest 3: Parámetros inválidos\n");
+
+    if (sdft_api.suscribe_sdft(0, bins, 2, 1) != SDFT_NONE ||
+        sdft_api.suscribe_sdft(MAX_SDFT_LONGITUD + 1, bins, 2, 1) != SDFT_NONE ||
+        sdft_api.suscribe_sdft(64, NULL, 2, 1) != SDFT_NONE ||
+        sdft_api.suscribe_sdft(64, bins, 0, 1) != SDFT_NONE ||
+        sdft_api.suscribe_sdft(64, bins, MAX_SDFT_BINS + 1, 1) != SDFT_NONE ||
+        sdft_api.suscribe_sdft(40, bins, 2, 1) != SDFT_NONE ||
+        sdft_api.compute_sdft(-1, 1.0f) != SDFT_KO ||
+        sdft_api.compute_sdft(MAX_SDFT, 1.0f) != SDFT_KO ||
+        sdft_api.amplitud_sdft(0, NULL) != SDFT_KO)
+    {
+        test_sdft_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_sdft_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_sdft_printf("\nTest Suscripcion_SDFT: PASSED\n");
+    else
+        test_sdft_printf("\nTest Suscripcion_SDFT: FAILED\n");
+
+    return result;
+}
+
+int Test_Exactitud_SDFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i, k, posicion, bloque;
+    SDFT_SERVICE service, bloques;
+    double error, error_max;
+    float amplitud[4], diferencia;
+    const float bins_tono[4] = {0.0f, 37.0f, 80.3f, 150.75f};
+    const float amp_tono[4] = {0.5f, 1.0f, 0.25f, 2.0f};
+
+    test_sdft_printf("\n=== Test Exactitud_SDFT ===\n");
+
+    Init_SDFT();
+    srand(37);
+
+    /* Bins enteros y fraccionarios repartidos por la banda */
+    for (k = 0; k < K_SDFT_TEST; k++)
+    {
+        bins_sdft_test[k] = (k % 2 == 0) ? (float)(16 * k) : 16.0f * k + 0.37f;
+    }
+
+    for (i = 0; i < 4 * N_SDFT_TEST; i++)
+    {
+        senal_sdft_test[i] = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+    }
+
+    /* Test 1: bins frente a la DFT directa */
+    test_sdft_printf("\nTest 1: %u bins frente a la DFT directa (N = %u)\n", K_SDFT_TEST, N_SDFT_TEST);
+
+    service = sdft_api.suscribe_sdft(N_SDFT_TEST, bins_sdft_test, K_SDFT_TEST, 1);
+    if (service == SDFT_NONE)
+    {
+        test_sdft_printf("ERROR: suscribe_sdft falló con parámetros válidos\n");
+        return TEST_KO;
+    }
+
+    error_max = 0.0;
+    for (i = 0; i < 4 * N_SDFT_TEST; i++)
+    {
+        sdft_api.compute_sdft(service, senal_sdft_test[i]);
+
+        /* Instantes a mitad de periodo de reanclaje y justo en el reanclaje */
+        if (i + 1 >= N_SDFT_TEST && ((i + 1) % N_SDFT_TEST == 0 || (i + 1) % N_SDFT_TEST == 333))
+        {
+            error = error_dft_sdft(service, &senal_sdft_test[i + 1 - N_SDFT_TEST]);
+            if (error > error_max)
+            {
+                error_max = error;
+            }
+        }
+    }
+
+    test_sdft_printf("Error relativo máximo: %.2e\n", error_max);
+    if (error_max > 1e-5)
+    {
+        test_sdft_printf("ERROR: Los bins no coinciden con la DFT directa\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: modo por bloques */
+    test_sdft_printf("\nTest 2: Modo por bloques frente a muestra a muestra\n");
+
+    bloques = sdft_api.suscribe_sdft(N_SDFT_TEST, bins_sdft_test, K_SDFT_TEST, 1);
+    posicion = 0;
+    while (posicion < 4 * N_SDFT_TEST)
+    {
+        bloque = 1 + (unsigned int)rand() % 700;
+        if (bloque > 4 * N_SDFT_TEST - posicion)
+        {
+            bloque = 4 * N_SDFT_TEST - posicion;
+        }
+        sdft_api.compute_bloque_sdft(bloques, &senal_sdft_test[posicion], bloque);
+        posicion += bloque;
+    }
+
+    diferencia = 0.0f;
+    for (k = 0; k < K_SDFT_TEST; k++)
+    {
+        diferencia = fmaxf(diferencia, fabsf(servicios_sdft[bloques].re[k] - servicios_sdft[service].re[k]));
+        diferencia = fmaxf(diferencia, fabsf(servicios_sdft[bloques].im[k] - servicios_sdft[service].im[k]));
+    }
+
+    test_sdft_printf("Diferencia máxima: %.2e\n", diferencia);
+    if (diferencia != 0.0f)
+    {
+        test_sdft_printf("ERROR: El modo por bloques no coincide con el modo muestra a muestra\n");
+        result = TEST_KO;
+    }
+
+    sdft_api.unsuscribe_sdft(service);
+    sdft_api.unsuscribe_sdft(bloques);
+
+    /* Test 3: amplitud de tonos en sus bins */
+    test_sdft_printf("\nTest 3: Amplitud de tonos en bins enteros y fraccionarios\n");
+
+    service = sdft_api.suscribe_sdft(N_SDFT_TEST, bins_tono, 4, 4);
+    for (i = 0; i < 3 * N_SDFT_TEST; i++)
+    {
+        senal_sdft_test[i] = 0.0f;
+        for (k = 0; k < 4; k++)
+        {
+            senal_sdft_test[i] += amp_tono[k] * (float)cos(2.0 * FFT_PI * bins_tono[k] * i / N_SDFT_TEST + 0.3 * k);
+        }
+    }
+    sdft_api.compute_bloque_sdft(service, senal_sdft_test, 3 * N_SDFT_TEST);
+    sdft_api.amplitud_sdft(service, amplitud);
+
+    for (k = 0; k < 4; k++)
+    {
+        test_sdft_printf("Bin %7.2f: amplitud %.4f (esperada %.4f)\n", bins_tono[k], amplitud[k], amp_tono[k]);
+
+        /* Con ventana rectangular las fugas de los otros tonos quedan por debajo de 0.02 */
+        if (fabsf(amplitud[k] - amp_tono[k]) > 0.02f)
+        {
+            test_sdft_printf("ERROR: Amplitud del bin %.2f incorrecta\n", bins_tono[k]);
+            result = TEST_KO;
+        }
+    }
+
+    sdft_api.unsuscribe_sdft(service);
+
+    if (result == TEST_OK)
+        test_sdft_printf("\nTest Exactitud_SDFT: PASSED\n");
+    else
+        test_sdft_printf("\nTest Exactitud_SDFT: FAILED\n");
+
+    return result;
+}
+
+int Test_Estabilidad_SDFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i, k, n;
+    SDFT_SERVICE ancla, libre;
+    double error_ancla, error_libre;
+    RFFT_PLAN plan;
+    clock_t inicio, fin;
+    double t_sdft, t_rfft;
+    float x;
+
+    test_sdft_printf("\n=== Test Estabilidad_SDFT ===\n");
+
+    Init_FFT();
+    Init_SDFT();
+    srand(38);
+
+    for (k = 0; k < K_SDFT_TEST; k++)
+    {
+        bins_sdft_test[k] = 3.0f + 15.0f * k + 0.21f * (k % 3);
+    }
+
+    /* Test 1: deriva en ejecuciones largas */
+    test_sdft_printf("\nTest 1: %u muestras con y sin reanclaje\n", L_LARGA_SDFT);
+
+    ancla = sdft_api.suscribe_sdft(N_SDFT_TEST, bins_sdft_test, K_SDFT_TEST, 8);
+    libre = sdft_api.suscribe_sdft(N_SDFT_TEST, bins_sdft_test, K_SDFT_TEST, 0);
+
+    inicio = clock();
+    for (i = 0; i < L_LARGA_SDFT; i++)
+    {
+        x = 2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f;
+        historia_sdft_test[i % N_SDFT_TEST] = x;
+        sdft_api.compute_sdft(ancla, x);
+        sdft_api.compute_sdft(libre, x);
+    }
+    fin = clock();
+    t_sdft = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)L_LARGA_SDFT / 2.0;
+
+    /* Ventana en orden cronológico: L es múltiplo de N, la más antigua está en la posición 0 */
+    error_ancla = error_dft_sdft(ancla, historia_sdft_test);
+    error_libre = error_dft_sdft(libre, historia_sdft_test);
+
+    test_sdft_printf("Error relativo final: con reanclaje %.2e, sin reanclaje %.2e\n", error_ancla, error_libre);
+    if (error_ancla > 1e-5 || !(error_libre > error_ancla))
+    {
+        test_sdft_printf("ERROR: El reanclaje no mantiene acotado el error\n");
+        result = TEST_KO;
+    }
+
+    sdft_api.unsuscribe_sdft(ancla);
+    sdft_api.unsuscribe_sdft(libre);
+
+    /* Test 2: coste frente a una rfft por muestra */
+    test_sdft_printf("\nTest 2: Coste por muestra (%u bins, N = %u)\n", K_SDFT_TEST, N_SDFT_TEST);
+
+    fft_api.get_rplan(N_SDFT_TEST, twiddle_sdft_test, bitrev_sdft_test, &plan);
+    n = 2000;
+    inicio = clock();
+    for (i = 0; i < n; i++)
+    {
+        fft_api.rfft(&plan, historia_sdft_test, espectro_sdft_test);
+    }
+    fin = clock();
+    t_rfft = 1e9 * (double)(fin - inicio) / CLOCKS_PER_SEC / (double)n;
+
+    test_sdft_printf("SDFT con reanclaje: %.1f ns/muestra, rfft de %u puntos: %.1f ns/muestra (%.1fx)\n",
+                     t_sdft, N_SDFT_TEST, t_rfft, t_rfft / t_sdft);
+    if (!(t_sdft < t_rfft))
+    {
+        test_sdft_printf("ERROR: El banco SDFT no es más barato que una rfft por muestra\n");
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_sdft_printf("\nTest Estabilidad_SDFT: PASSED\n");
+    else
+        test_sdft_printf("\nTest Estabilidad_SDFT: FAILED\n");
+
+    return result;
+}
+
+int Run_All_SDFT_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    sdft_test_log_file = fopen("SDFT_Tests_Result.txt", "a");
+    if (sdft_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de SDFT\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_sdft_printf("\n\n########################################\n");
+        test_sdft_printf("# SDFT Unit Tests\n");
+        test_sdft_printf("# Fecha y hora: %s\n", time_string);
+        test_sdft_printf("########################################\n");
+    }
+
+    test_sdft_printf("\n========================================\n");
+    test_sdft_printf("    EJECUTANDO TESTS SDFT\n");
+    test_sdft_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Suscripcion_SDFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Exactitud_SDFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Estabilidad_SDFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_sdft_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_sdft_printf("TODOS LOS TESTS SDFT PASARON CORRECTAMENTE\n");
+    else
+        test_sdft_printf("ALGUNOS TESTS SDFT FALLARON\n");
+    test_sdft_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (sdft_test_log_file != NULL)
+    {
+        test_sdft_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_sdft_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_sdft_printf("FAILURE - Algunos tests fallaron\n");
+        test_sdft_printf("########################################\n\n");
+
+        fclose(sdft_test_log_file);
+        sdft_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
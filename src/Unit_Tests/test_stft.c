@@ -0,0 +1,441 @@
+/** \page test_stft TEST UNITARIOS STFT
+ * \brief Módulo de pruebas unitarias para la transformada de Fourier de tiempo corto
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo STFT. Las pruebas validan las ventanas precalculadas, la
+ * emisión de tramas en streaming frente a un cálculo directo y la equivalencia entre el
+ * modo muestra a muestra y el modo por bloques. Los tests solo se compilan y ejecutan en
+ * modo DEBUG.
+ *
+ * \section uso_test_stft Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en STFT_Tests_Result.txt
+ *
+ * \section funciones_test_stft Descripción de funciones
+ *
+ * \subsection test_ventanas_stft Test_Ventanas_STFT
+ * Verifica las ventanas precalculadas:
+ * - Valores en los extremos y en el centro de Hann, Hamming y Blackman
+ * - Suma constante con solapamiento (COLA): Hann y Hamming con hop N/2, Blackman con hop N/3
+ * - Detección de parámetros inválidos
+ *
+ * \subsection test_stream_stft Test_Stream_STFT
+ * Verifica la emisión de tramas:
+ * - Instantes de emisión (primera trama con la muestra N y después cada hop)
+ * - Tramas muestra a muestra frente a ventana + rfft calculadas directamente
+ * - Tono en el centro de un bin: pico en el bin esperado
+ * - Modo por bloques de tamaño variable idéntico al modo muestra a muestra
+ * - Rechazo de bloques cuyas tramas no caben en el destino
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_stft Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "stft.h"
+#include "test_stft.h"
+
+#define TEST_OK         0
+#define TEST_KO         -1
+#define EPSILON_STFT    1e-5f
+#define N_STFT_TEST     256
+#define HOP_STFT_TEST   96
+#define L_STFT_TEST     2048
+#define MAX_TRAMAS_TEST ((L_STFT_TEST - N_STFT_TEST) / HOP_STFT_TEST + 1)
+
+/* Variable global para el archivo de log */
+static FILE *stft_test_log_file = NULL;
+
+/* Buffers de test */
+static COMPLEJO twiddle_stft_test[RFFT_TWIDDLE_SIZE(N_STFT_TEST)];
+static unsigned int bitrev_stft_test[RFFT_BITREV_SIZE(N_STFT_TEST)];
+static float ventana_test[N_STFT_TEST];
+static float anillo_test[N_STFT_TEST];
+static float senal_test[L_STFT_TEST];
+static COMPLEJO tramas_muestra[MAX_TRAMAS_TEST * N_STFT_TEST / 2];
+static COMPLEJO tramas_bloque[MAX_TRAMAS_TEST * N_STFT_TEST / 2];
+static COMPLEJO trama_ref[N_STFT_TEST / 2];
+
+/* Declaración de funciones de test */
+int Test_Ventanas_STFT(void);
+int Test_Stream_STFT(void);
+int Run_All_STFT_Tests(void);
+
+/* Funciones auxiliares */
+void test_stft_printf(const char *format, ...);
+int float_equals_stft(float a, float b, float epsilon);
+
+/* Definición de funciones */
+
+void test_stft_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (stft_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(stft_test_log_file, format, args);
+        va_end(args);
+        fflush(stft_test_log_file);
+    }
+}
+
+int float_equals_stft(float a, float b, float epsilon)
+{
+    return fabs(a - b) < epsilon;
+}
+
+int Test_Ventanas_STFT(void)
+{
+    int result = TEST_OK;
+    unsigned int i, r, hop;
+    float suma, suma_min, suma_max;
+    const STFT_VENTANA tipos[3] = {HANN, HAMMING, BLACKMAN};
+    const char *nombres[3] = {"Hann", "Hamming", "Blackman"};
+    const float extremo[3] = {0.0f, 0.08f, 0.0f};
+    const float cola[3] = {1.0f, 1.08f, 1.26f};
+    unsigned int t;
+
+    test_stft_printf("\n=== Test Ventanas_STFT ===\n");
+
+    Init_STFT();
+
+    /* Test 1: valores conocidos */
+    test_stft_printf("\nTest 1: Valores en w[0] y w[N/2]\n");
+
+    for (t = 0; t < 3; t++)
+    {
+        if (stft_api.get_ventana(tipos[t], 240, ventana_test) != STFT_OK)
+        {
+            test_stft_printf("ERROR: get_ventana falló para %s\n", nombres[t]);
+            return TEST_KO;
+        }
+
+        if (!float_equals_stft(ventana_test[0], extremo[t], EPSILON_STFT) ||
+            !float_equals_stft(ventana_test[120], 1.0f, EPSILON_STFT))
+        {
+            test_stft_printf("ERROR: %s: w[0] = %f, w[N/2] = %f\n", nombres[t], ventana_test[0], ventana_test[120]);
+            result = TEST_KO;
+        }
+    }
+    if (result == TEST_OK)
+    {
+        test_stft_printf("Valores de las ventanas: PASSED\n");
+    }
+
+    /* Test 2: suma constante con solapamiento */
+    test_stft_printf("\nTest 2: Condición COLA\n");
+
+    for (t = 0; t < 3; t++)
+    {
+        stft_api.get_ventana(tipos[t], 240, ventana_test);
+        hop = (tipos[t] == BLACKMAN) ? 80 : 120;
+
+        suma_min = 1e9f;
+        suma_max = -1e9f;
+        for (i = 0; i < hop; i++)
+        {
+            suma = 0.0f;
+            for (r = i; r < 240; r += hop)
+            {
+                suma += ventana_test[r];
+            }
+            suma_min = fminf(suma_min, suma);
+            suma_max = fmaxf(suma_max, suma);
+        }
+
+        test_stft_printf("%-8s hop %3u: suma en [%.6f, %.6f]\n", nombres[t], hop, suma_min, suma_max);
+        if (!float_equals_stft(suma_min, cola[t], 1e-4f) || !float_equals_stft(suma_max, cola[t], 1e-4f))
+        {
+            test_stft_printf("ERROR: %s no cumple COLA con hop %u\n", nombres[t], hop);
+            result = TEST_KO;
+        }
+    }
+
+    /* Test 3: parámetros inválidos */
+    test_stft_printf("\nTest 3: Parámetros inválidos\n");
+
+    if (stft_api.get_ventana(HANN, 0, ventana_test) != STFT_KO ||
+        stft_api.get_ventana(HANN, 16, NULL) != STFT_KO ||
+        stft_api.get_ventana((STFT_VENTANA)17, 16, ventana_test) != STFT_KO)
+    {
+        test_stft_printf("ERROR: get_ventana aceptó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_stft_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_stft_printf("\nTest Ventanas_STFT: PASSED\n");
+    else
+        test_stft_printf("\nTest Ventanas_STFT: FAILED\n");
+
+    return result;
+}
+
+int Test_Stream_STFT(void)
+{
+    int result = TEST_OK;
+    int ret;
+    unsigned int i, k, m, emitidas, posicion, bloque, total, pico;
+    RFFT_PLAN plan;
+    STFT_OBJECT obj;
+    float error, error_max, modulo, modulo_max;
+    float segmento[N_STFT_TEST];
+
+    test_stft_printf("\n=== Test Stream_STFT ===\n");
+
+    Init_FFT();
+    Init_STFT();
+    srand(33);
+
+    fft_api.get_rplan(N_STFT_TEST, twiddle_stft_test, bitrev_stft_test, &plan);
+    stft_api.get_ventana(HANN, N_STFT_TEST, ventana_test);
+
+    /* Chirp más ruido */
+    for (i = 0; i < L_STFT_TEST; i++)
+    {
+        senal_test[i] = (float)sin(2.0 * FFT_PI * (0.01 + 0.2 * (double)i / L_STFT_TEST) * (double)i) +
+                        0.1f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+    }
+
+    /* Test 1: muestra a muestra frente al cálculo directo */
+    test_stft_printf("\nTest 1: Tramas muestra a muestra (N = %u, hop = %u)\n", N_STFT_TEST, HOP_STFT_TEST);
+
+    if (stft_api.get_stft(N_STFT_TEST, HOP_STFT_TEST, &plan, ventana_test, anillo_test, &obj) != STFT_OK)
+    {
+        test_stft_printf("ERROR: get_stft falló con parámetros válidos\n");
+        return TEST_KO;
+    }
+
+    emitidas = 0;
+    error_max = 0.0f;
+    for (i = 0; i < L_STFT_TEST; i++)
+    {
+        ret = stft_api.stft(senal_test[i], &tramas_muestra[emitidas * N_STFT_TEST / 2], &obj);
+        if (ret == STFT_KO)
+        {
+            test_stft_printf("ERROR: stft devolvió error en la muestra %u\n", i);
+            return TEST_KO;
+        }
+        if (ret == 1)
+        {
+            /* La trama m debe emitirse con la muestra N - 1 + m*hop */
+            if (i != N_STFT_TEST - 1 + emitidas * HOP_STFT_TEST)
+            {
+                test_stft_printf("ERROR: trama %u emitida en la muestra %u\n", emitidas, i);
+                result = TEST_KO;
+            }
+
+            for (k = 0; k < N_STFT_TEST; k++)
+            {
+                segmento[k] = ventana_test[k] * senal_test[i + 1 - N_STFT_TEST + k];
+            }
+            fft_api.rfft(&plan, segmento, trama_ref);
+
+            for (k = 0; k < N_STFT_TEST / 2; k++)
+            {
+                error = fabsf(tramas_muestra[emitidas * N_STFT_TEST / 2 + k].re - trama_ref[k].re) +
+                        fabsf(tramas_muestra[emitidas * N_STFT_TEST / 2 + k].im - trama_ref[k].im);
+                error_max = fmaxf(error_max, error);
+            }
+            emitidas++;
+        }
+    }
+
+    test_stft_printf("Tramas emitidas: %u (esperadas %u), error máximo: %.2e\n", emitidas, MAX_TRAMAS_TEST, error_max);
+    if (emitidas != MAX_TRAMAS_TEST || obj.tramas != MAX_TRAMAS_TEST || error_max > EPSILON_STFT)
+    {
+        test_stft_printf("ERROR: Las tramas en streaming no coinciden con el cálculo directo\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: tono en el centro del bin 20 */
+    test_stft_printf("\nTest 2: Tono en el bin 20\n");
+
+    stft_api.get_stft(N_STFT_TEST, HOP_STFT_TEST, &plan, ventana_test, anillo_test, &obj);
+    for (i = 0; i < N_STFT_TEST; i++)
+    {
+        stft_api.stft((float)cos(2.0 * FFT_PI * 20.0 * (double)i / N_STFT_TEST), trama_ref, &obj);
+    }
+
+    pico = 0;
+    modulo_max = 0.0f;
+    for (k = 1; k < N_STFT_TEST / 2; k++)
+    {
+        modulo = sqrtf(trama_ref[k].re * trama_ref[k].re + trama_ref[k].im * trama_ref[k].im);
+        if (modulo > modulo_max)
+        {
+            modulo_max = modulo;
+            pico = k;
+        }
+    }
+
+    /* Con Hann el pico vale A*N/4 */
+    test_stft_printf("Pico en el bin %u con módulo %.3f (esperado %.3f)\n", pico, modulo_max, N_STFT_TEST / 4.0f);
+    if (pico != 20 || !float_equals_stft(modulo_max, N_STFT_TEST / 4.0f, 1e-3f))
+    {
+        test_stft_printf("ERROR: El pico del tono no es el esperado\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: modo por bloques de tamaño variable */
+    test_stft_printf("\nTest 3: Modo por bloques frente a muestra a muestra\n");
+
+    stft_api.get_stft(N_STFT_TEST, HOP_STFT_TEST, &plan, ventana_test, anillo_test, &obj);
+    posicion = 0;
+    total = 0;
+    while (posicion < L_STFT_TEST)
+    {
+        bloque = 1 + (unsigned int)rand() % 300;
+        if (bloque > L_STFT_TEST - posicion)
+        {
+            bloque = L_STFT_TEST - posicion;
+        }
+
+        ret = stft_api.stft_bloque(&senal_test[posicion], bloque, &tramas_bloque[total * N_STFT_TEST / 2],
+                                   MAX_TRAMAS_TEST - total, &obj);
+        if (ret < 0)
+        {
+            test_stft_printf("ERROR: stft_bloque devolvió error\n");
+            return TEST_KO;
+        }
+        total += (unsigned int)ret;
+        posicion += bloque;
+    }
+
+    error_max = 0.0f;
+    for (m = 0; m < total * N_STFT_TEST / 2; m++)
+    {
+        error_max = fmaxf(error_max, fabsf(tramas_bloque[m].re - tramas_muestra[m].re) +
+                                     fabsf(tramas_bloque[m].im - tramas_muestra[m].im));
+    }
+
+    test_stft_printf("Tramas por bloques: %u, diferencia máxima: %.2e\n", total, error_max);
+    if (total != MAX_TRAMAS_TEST || error_max != 0.0f)
+    {
+        test_stft_printf("ERROR: El modo por bloques no coincide con el modo muestra a muestra\n");
+        result = TEST_KO;
+    }
+
+    /* Test 4: destino insuficiente y parámetros inválidos */
+    test_stft_printf("\nTest 4: Destino insuficiente y parámetros inválidos\n");
+
+    stft_api.get_stft(N_STFT_TEST, HOP_STFT_TEST, &plan, ventana_test, anillo_test, &obj);
+    if (stft_api.stft_bloque(senal_test, N_STFT_TEST + HOP_STFT_TEST, tramas_bloque, 1, &obj) != STFT_KO ||
+        obj.llenas != 0)
+    {
+        test_stft_printf("ERROR: stft_bloque aceptó un destino insuficiente o modificó el objeto\n");
+        result = TEST_KO;
+    }
+
+    if (stft_api.get_stft(N_STFT_TEST, 0, &plan, ventana_test, anillo_test, &obj) != STFT_KO ||
+        stft_api.get_stft(N_STFT_TEST, N_STFT_TEST + 1, &plan, ventana_test, anillo_test, &obj) != STFT_KO ||
+        stft_api.get_stft(128, 64, &plan, ventana_test, anillo_test, &obj) != STFT_KO ||
+        stft_api.stft(0.0f, trama_ref, NULL) != STFT_KO)
+    {
+        test_stft_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_stft_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_stft_printf("\nTest Stream_STFT: PASSED\n");
+    else
+        test_stft_printf("\nTest Stream_STFT: FAILED\n");
+
+    return result;
+}
+
+int Run_All_STFT_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    stft_test_log_file = fopen("STFT_Tests_Result.txt", "a");
+    if (stft_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de STFT\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_stft_printf("\n\n########################################\n");
+        test_stft_printf("# STFT Unit Tests\n");
+        test_stft_printf("# Fecha y hora: %s\n", time_string);
+        test_stft_printf("########################################\n");
+    }
+
+    test_stft_printf("\n========================================\n");
+    test_stft_printf("    EJECUTANDO TESTS STFT\n");
+    test_stft_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Ventanas_STFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Stream_STFT();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_stft_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_stft_printf("TODOS LOS TESTS STFT PASARON CORRECTAMENTE\n");
+    else
+        test_stft_printf("ALGUNOS TESTS STFT FALLARON\n");
+    test_stft_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (stft_test_log_file != NULL)
+    {
+        test_stft_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_stft_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_stft_printf("FAILURE - Algunos tests fallaron\n");
+        test_stft_printf("########################################\n\n");
+
+        fclose(stft_test_log_file);
+        stft_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,478 @@
+/** \page test_welch TEST UNITARIOS WELCH
+ * \brief Módulo de pruebas unitarias para el estimador de PSD de Welch
+ *
+ * Este módulo contiene las funciones de test unitario para verificar el correcto
+ * funcionamiento del módulo Welch. Las pruebas validan la escala de la PSD unilateral
+ * frente a la potencia conocida de ruido blanco y de un tono, el promedio de los segmentos
+ * frente a un cálculo directo, el olvido exponencial y la equivalencia entre la ejecución
+ * multicanal y la de un canal. Los tests solo se compilan y ejecutan en modo DEBUG.
+ *
+ * \section uso_test_welch Uso del módulo
+ *
+ * Las pruebas se ejecutan automáticamente desde main() cuando se compila en modo DEBUG:
+ * \code
+ * // Compilar en modo DEBUG
+ * gcc -DDEBUG -o test_nsdsp *.c -lm
+ *
+ * // Ejecutar tests
+ * ./test_nsdsp
+ * \endcode
+ *
+ * Los resultados se muestran en pantalla y se guardan en Welch_Tests_Result.txt
+ *
+ * \section funciones_test_welch Descripción de funciones
+ *
+ * \subsection test_escala_welch Test_Escala_Welch
+ * Verifica la escala de la PSD:
+ * - Media aritmética de los segmentos frente a periodogramas calculados directamente
+ * - Ruido blanco de varianza conocida: nivel medio 2·sigma²/fs
+ * - Tono de amplitud A: potencia integrada A²/2 (Parseval)
+ *
+ * \subsection test_multicanal_welch Test_Multicanal_Welch
+ * Verifica el modo multicanal y el olvido:
+ * - Cuatro canales con un plan compartido frente a cuatro objetos de un canal
+ * - Olvido exponencial: seguimiento de un cambio de nivel que la media aritmética no sigue
+ * - Reinicio de la estimación y detección de parámetros inválidos
+ *
+ * \author Dr. Carlos Romero
+ *
+ * \section historial_test_welch Historial de cambios
+ * | Fecha | Autor | Versión | Descripción |
+ * |:-----:|:-----:|:-------:|:------------|
+ * | 16/10/2026 | Dr. Carlos Romero | 1 | Implementación inicial de tests |
+ *
+ * \copyright ZGR R&D AIE
+ */
+
+#ifdef DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <stdarg.h>
+#include "welch.h"
+#include "test_welch.h"
+
+#define TEST_OK             0
+#define TEST_KO             -1
+#define N_WELCH_TEST        256
+#define HOP_WELCH_TEST      128
+#define CANALES_WELCH_TEST  4
+#define L_WELCH_TEST        32768
+#define FS_WELCH_TEST       1000.0f
+
+/* Variable global para el archivo de log */
+static FILE *welch_test_log_file = NULL;
+
+/* Buffers de test */
+static COMPLEJO twiddle_welch_test[RFFT_TWIDDLE_SIZE(N_WELCH_TEST)];
+static unsigned int bitrev_welch_test[RFFT_BITREV_SIZE(N_WELCH_TEST)];
+static float ventana_welch_test[N_WELCH_TEST];
+static float workspace_welch_test[WELCH_WORKSPACE(N_WELCH_TEST, CANALES_WELCH_TEST)];
+static float workspace_canal_test[CANALES_WELCH_TEST][WELCH_WORKSPACE(N_WELCH_TEST, 1)];
+static float senal_welch_test[CANALES_WELCH_TEST * L_WELCH_TEST];
+static float psd_ref_test[N_WELCH_TEST / 2 + 1];
+
+/* Declaración de funciones de test */
+int Test_Escala_Welch(void);
+int Test_Multicanal_Welch(void);
+int Run_All_Welch_Tests(void);
+
+/* Funciones auxiliares */
+void test_welch_printf(const char *format, ...);
+float ruido_welch(void);
+
+/* Definición de funciones */
+
+void test_welch_printf(const char *format, ...)
+{
+    va_list args;
+
+    /* Escribir en pantalla */
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    /* Escribir en archivo si está abierto */
+    if (welch_test_log_file != NULL)
+    {
+        va_start(args, format);
+        vfprintf(welch_test_log_file, format, args);
+        va_end(args);
+        fflush(welch_test_log_file);
+    }
+}
+
+float ruido_welch(void)
+{
+    /* Ruido uniforme de media nula y varianza 1 */
+    return 1.7320508f * (2.0f * ((float)rand() / (float)RAND_MAX) - 1.0f);
+}
+
+int Test_Escala_Welch(void)
+{
+    int result = TEST_OK;
+    int ret;
+    unsigned int i, k, m, segmentos;
+    RFFT_PLAN plan;
+    WELCH_OBJECT obj;
+    float segmento[N_WELCH_TEST];
+    COMPLEJO espectro[N_WELCH_TEST / 2];
+    double energia, potencia, nivel, error, error_max, periodograma;
+
+    test_welch_printf("\n=== Test Escala_Welch ===\n");
+
+    Init_FFT();
+    Init_STFT();
+    Init_Welch();
+    srand(34);
+
+    fft_api.get_rplan(N_WELCH_TEST, twiddle_welch_test, bitrev_welch_test, &plan);
+    stft_api.get_ventana(HANN, N_WELCH_TEST, ventana_welch_test);
+
+    energia = 0.0;
+    for (i = 0; i < N_WELCH_TEST; i++)
+    {
+        energia += (double)ventana_welch_test[i] * ventana_welch_test[i];
+    }
+
+    for (i = 0; i < L_WELCH_TEST; i++)
+    {
+        senal_welch_test[i] = ruido_welch();
+    }
+
+    /* Test 1: media aritmética frente a periodogramas directos */
+    test_welch_printf("\nTest 1: Media de %u segmentos frente al cálculo directo\n", 8);
+
+    if (welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 1, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                            workspace_welch_test, &obj) != WELCH_OK)
+    {
+        test_welch_printf("ERROR: get_welch falló con parámetros válidos\n");
+        return TEST_KO;
+    }
+
+    /* 8 segmentos: N + 7 hop muestras, entregadas en dos bloques irregulares */
+    ret = welch_api.welch(senal_welch_test, 333, &obj);
+    ret += welch_api.welch(&senal_welch_test[333], N_WELCH_TEST + 7 * HOP_WELCH_TEST - 333, &obj);
+
+    for (k = 0; k <= N_WELCH_TEST / 2; k++)
+    {
+        psd_ref_test[k] = 0.0f;
+    }
+    for (m = 0; m < 8; m++)
+    {
+        for (i = 0; i < N_WELCH_TEST; i++)
+        {
+            segmento[i] = ventana_welch_test[i] * senal_welch_test[m * HOP_WELCH_TEST + i];
+        }
+        fft_api.rfft(&plan, segmento, espectro);
+
+        psd_ref_test[0] += (float)((double)espectro[0].re * espectro[0].re / (FS_WELCH_TEST * energia) / 8.0);
+        psd_ref_test[N_WELCH_TEST / 2] += (float)((double)espectro[0].im * espectro[0].im /
+                                                  (FS_WELCH_TEST * energia) / 8.0);
+        for (k = 1; k < N_WELCH_TEST / 2; k++)
+        {
+            periodograma = 2.0 * ((double)espectro[k].re * espectro[k].re + (double)espectro[k].im * espectro[k].im);
+            psd_ref_test[k] += (float)(periodograma / (FS_WELCH_TEST * energia) / 8.0);
+        }
+    }
+
+    error_max = 0.0;
+    for (k = 0; k <= N_WELCH_TEST / 2; k++)
+    {
+        error = fabs((double)obj.psd[k] - psd_ref_test[k]) / (psd_ref_test[k] + 1e-6);
+        if (error > error_max)
+        {
+            error_max = error;
+        }
+    }
+
+    test_welch_printf("Segmentos: %d, error relativo máximo: %.2e\n", ret, error_max);
+    if (ret != 8 || obj.segmentos[0] != 8 || error_max > 1e-4)
+    {
+        test_welch_printf("ERROR: La media de Welch no coincide con el cálculo directo\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: nivel de ruido blanco */
+    test_welch_printf("\nTest 2: Nivel de ruido blanco de varianza 1\n");
+
+    welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 1, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                        workspace_welch_test, &obj);
+    segmentos = (unsigned int)welch_api.welch(senal_welch_test, L_WELCH_TEST, &obj);
+
+    nivel = 0.0;
+    for (k = 1; k < N_WELCH_TEST / 2; k++)
+    {
+        nivel += obj.psd[k];
+    }
+    nivel /= (double)(N_WELCH_TEST / 2 - 1);
+
+    test_welch_printf("Segmentos: %u, nivel medio: %.6f (esperado %.6f)\n", segmentos, nivel, 2.0 / FS_WELCH_TEST);
+    if (fabs(nivel * FS_WELCH_TEST / 2.0 - 1.0) > 0.03)
+    {
+        test_welch_printf("ERROR: El nivel de la PSD del ruido blanco no es el esperado\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: potencia de un tono (Parseval) */
+    test_welch_printf("\nTest 3: Potencia integrada de un tono de amplitud 3\n");
+
+    for (i = 0; i < L_WELCH_TEST; i++)
+    {
+        senal_welch_test[i] = 3.0f * (float)sin(2.0 * FFT_PI * 123.4 * (double)i / FS_WELCH_TEST);
+    }
+
+    welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 1, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                        workspace_welch_test, &obj);
+    welch_api.welch(senal_welch_test, L_WELCH_TEST, &obj);
+
+    potencia = 0.0;
+    for (k = 0; k <= N_WELCH_TEST / 2; k++)
+    {
+        potencia += obj.psd[k] * (FS_WELCH_TEST / N_WELCH_TEST);
+    }
+
+    test_welch_printf("Potencia integrada: %.4f (esperada %.4f)\n", potencia, 4.5);
+    if (fabs(potencia - 4.5) > 0.05)
+    {
+        test_welch_printf("ERROR: La potencia integrada del tono no es la esperada\n");
+        result = TEST_KO;
+    }
+
+    if (result == TEST_OK)
+        test_welch_printf("\nTest Escala_Welch: PASSED\n");
+    else
+        test_welch_printf("\nTest Escala_Welch: FAILED\n");
+
+    return result;
+}
+
+int Test_Multicanal_Welch(void)
+{
+    int result = TEST_OK;
+    unsigned int i, c, k, posicion, bloque;
+    RFFT_PLAN plan;
+    WELCH_OBJECT multi, olvido, media;
+    static WELCH_OBJECT canal[CANALES_WELCH_TEST];
+    static float bloque_test[CANALES_WELCH_TEST * 500];
+    float diferencia;
+    double nivel_olvido, nivel_media;
+
+    test_welch_printf("\n=== Test Multicanal_Welch ===\n");
+
+    Init_FFT();
+    Init_STFT();
+    Init_Welch();
+    srand(35);
+
+    fft_api.get_rplan(N_WELCH_TEST, twiddle_welch_test, bitrev_welch_test, &plan);
+    stft_api.get_ventana(HAMMING, N_WELCH_TEST, ventana_welch_test);
+
+    /* Canales con tono y ruido de distinta amplitud, dispuestos canal a canal */
+    for (c = 0; c < CANALES_WELCH_TEST; c++)
+    {
+        for (i = 0; i < L_WELCH_TEST; i++)
+        {
+            senal_welch_test[c * L_WELCH_TEST + i] =
+                (float)(c + 1) * (float)cos(2.0 * FFT_PI * (50.0 + 40.0 * c) * (double)i / FS_WELCH_TEST) +
+                0.2f * ruido_welch();
+        }
+    }
+
+    /* Test 1: cuatro canales con plan compartido frente a objetos de un canal */
+    test_welch_printf("\nTest 1: %u canales frente a %u objetos independientes\n", CANALES_WELCH_TEST,
+                      CANALES_WELCH_TEST);
+
+    welch_api.get_welch(N_WELCH_TEST, 100, CANALES_WELCH_TEST, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                        workspace_welch_test, &multi);
+    for (c = 0; c < CANALES_WELCH_TEST; c++)
+    {
+        welch_api.get_welch(N_WELCH_TEST, 100, 1, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                            workspace_canal_test[c], &canal[c]);
+    }
+
+    posicion = 0;
+    while (posicion < L_WELCH_TEST)
+    {
+        bloque = 1 + (unsigned int)rand() % 500;
+        if (bloque > L_WELCH_TEST - posicion)
+        {
+            bloque = L_WELCH_TEST - posicion;
+        }
+
+        for (c = 0; c < CANALES_WELCH_TEST; c++)
+        {
+            for (i = 0; i < bloque; i++)
+            {
+                bloque_test[c * bloque + i] = senal_welch_test[c * L_WELCH_TEST + posicion + i];
+            }
+            welch_api.welch(&senal_welch_test[c * L_WELCH_TEST + posicion], bloque, &canal[c]);
+        }
+        welch_api.welch(bloque_test, bloque, &multi);
+        posicion += bloque;
+    }
+
+    diferencia = 0.0f;
+    for (c = 0; c < CANALES_WELCH_TEST; c++)
+    {
+        for (k = 0; k <= N_WELCH_TEST / 2; k++)
+        {
+            diferencia = fmaxf(diferencia, fabsf(multi.psd[c * (N_WELCH_TEST / 2 + 1) + k] - canal[c].psd[k]));
+        }
+        if (multi.segmentos[c] != canal[c].segmentos[0])
+        {
+            diferencia = 1.0f;
+        }
+    }
+
+    test_welch_printf("Segmentos por canal: %u, diferencia máxima: %.2e\n", multi.segmentos[0], diferencia);
+    if (multi.segmentos[0] != (L_WELCH_TEST - N_WELCH_TEST) / 100 + 1 || diferencia != 0.0f)
+    {
+        test_welch_printf("ERROR: La ejecución multicanal no coincide con la de un canal\n");
+        result = TEST_KO;
+    }
+
+    /* Test 2: olvido exponencial ante un cambio de nivel */
+    test_welch_printf("\nTest 2: Olvido exponencial (lambda = 0.9) ante un cambio de nivel\n");
+
+    for (i = 0; i < L_WELCH_TEST; i++)
+    {
+        senal_welch_test[i] = (i < L_WELCH_TEST / 2 ? 1.0f : 4.0f) * ruido_welch();
+    }
+
+    welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 1, FS_WELCH_TEST, 0.9f, &plan, ventana_welch_test,
+                        workspace_canal_test[0], &olvido);
+    welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 1, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                        workspace_canal_test[1], &media);
+    welch_api.welch(senal_welch_test, L_WELCH_TEST, &olvido);
+    welch_api.welch(senal_welch_test, L_WELCH_TEST, &media);
+
+    nivel_olvido = 0.0;
+    nivel_media = 0.0;
+    for (k = 1; k < N_WELCH_TEST / 2; k++)
+    {
+        nivel_olvido += olvido.psd[k];
+        nivel_media += media.psd[k];
+    }
+    nivel_olvido *= FS_WELCH_TEST / 2.0 / (double)(N_WELCH_TEST / 2 - 1);
+    nivel_media *= FS_WELCH_TEST / 2.0 / (double)(N_WELCH_TEST / 2 - 1);
+
+    /* La varianza final es 16; la media aritmética de ambas mitades es 8.5 */
+    test_welch_printf("Varianza estimada: olvido %.3f, media %.3f (final 16, media global 8.5)\n",
+                      nivel_olvido, nivel_media);
+    if (fabs(nivel_olvido / 16.0 - 1.0) > 0.1 || fabs(nivel_media / 8.5 - 1.0) > 0.05)
+    {
+        test_welch_printf("ERROR: El olvido exponencial no sigue el cambio de nivel\n");
+        result = TEST_KO;
+    }
+
+    /* Test 3: reinicio y parámetros inválidos */
+    test_welch_printf("\nTest 3: Reinicio y parámetros inválidos\n");
+
+    welch_api.reset(&media);
+    welch_api.welch(&senal_welch_test[L_WELCH_TEST / 2], L_WELCH_TEST / 2, &media);
+    nivel_media = 0.0;
+    for (k = 1; k < N_WELCH_TEST / 2; k++)
+    {
+        nivel_media += media.psd[k];
+    }
+    nivel_media *= FS_WELCH_TEST / 2.0 / (double)(N_WELCH_TEST / 2 - 1);
+
+    test_welch_printf("Varianza tras el reinicio: %.3f (esperada 16)\n", nivel_media);
+    if (fabs(nivel_media / 16.0 - 1.0) > 0.05)
+    {
+        test_welch_printf("ERROR: El reinicio no descarta la estimación anterior\n");
+        result = TEST_KO;
+    }
+
+    if (welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 0, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                            workspace_welch_test, &multi) != WELCH_KO ||
+        welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, MAX_WELCH_CANALES + 1, FS_WELCH_TEST, 0.0f, &plan,
+                            ventana_welch_test, workspace_welch_test, &multi) != WELCH_KO ||
+        welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 1, 0.0f, 0.0f, &plan, ventana_welch_test,
+                            workspace_welch_test, &multi) != WELCH_KO ||
+        welch_api.get_welch(N_WELCH_TEST, HOP_WELCH_TEST, 1, FS_WELCH_TEST, 1.0f, &plan, ventana_welch_test,
+                            workspace_welch_test, &multi) != WELCH_KO ||
+        welch_api.get_welch(128, 64, 1, FS_WELCH_TEST, 0.0f, &plan, ventana_welch_test,
+                            workspace_welch_test, &multi) != WELCH_KO ||
+        welch_api.welch(NULL, 10, &media) != WELCH_KO ||
+        welch_api.reset(NULL) != WELCH_KO)
+    {
+        test_welch_printf("ERROR: No detectó parámetros inválidos\n");
+        result = TEST_KO;
+    }
+    else
+    {
+        test_welch_printf("Detección de parámetros inválidos: PASSED\n");
+    }
+
+    if (result == TEST_OK)
+        test_welch_printf("\nTest Multicanal_Welch: PASSED\n");
+    else
+        test_welch_printf("\nTest Multicanal_Welch: FAILED\n");
+
+    return result;
+}
+
+int Run_All_Welch_Tests(void)
+{
+    int total_result = TEST_OK;
+    int test_result;
+    time_t current_time;
+    char time_string[100];
+
+    /* Abrir archivo de log */
+    welch_test_log_file = fopen("Welch_Tests_Result.txt", "a");
+    if (welch_test_log_file == NULL)
+    {
+        printf("WARNING: No se pudo abrir el archivo de log de Welch\n");
+    }
+    else
+    {
+        /* Escribir encabezado con fecha y hora */
+        time(&current_time);
+        strftime(time_string, sizeof(time_string), "%Y-%m-%d %H:%M:%S", localtime(&current_time));
+        test_welch_printf("\n\n########################################\n");
+        test_welch_printf("# Welch Unit Tests\n");
+        test_welch_printf("# Fecha y hora: %s\n", time_string);
+        test_welch_printf("########################################\n");
+    }
+
+    test_welch_printf("\n========================================\n");
+    test_welch_printf("    EJECUTANDO TESTS WELCH\n");
+    test_welch_printf("========================================\n");
+
+    /* Ejecutar tests */
+    test_result = Test_Escala_Welch();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_result = Test_Multicanal_Welch();
+    if (test_result != TEST_OK) total_result = TEST_KO;
+
+    test_welch_printf("\n========================================\n");
+    if (total_result == TEST_OK)
+        test_welch_printf("TODOS LOS TESTS WELCH PASARON CORRECTAMENTE\n");
+    else
+        test_welch_printf("ALGUNOS TESTS WELCH FALLARON\n");
+    test_welch_printf("========================================\n\n");
+
+    /* Escribir resumen final en el archivo */
+    if (welch_test_log_file != NULL)
+    {
+        test_welch_printf("\n# Resumen Final: ");
+        if (total_result == TEST_OK)
+            test_welch_printf("SUCCESS - Todos los tests pasaron\n");
+        else
+            test_welch_printf("FAILURE - Algunos tests fallaron\n");
+        test_welch_printf("########################################\n\n");
+
+        fclose(welch_test_log_file);
+        welch_test_log_file = NULL;
+    }
+
+    return total_result;
+}
+
+#endif /* DEBUG */
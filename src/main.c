@@ -160,6 +160,76 @@ int main(int argc, char *argv[])
         result = -1;
     }
 
+    /* Ejecutar tests de FFT */
+    test_result = Run_All_FFT_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de STFT */
+    test_result = Run_All_STFT_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de Welch */
+    test_result = Run_All_Welch_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de FAST_FIR */
+    test_result = Run_All_Fast_Fir_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de SDFT */
+    test_result = Run_All_SDFT_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de LMS */
+    test_result = Run_All_LMS_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de FDAF */
+    test_result = Run_All_FDAF_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de RLS */
+    test_result = Run_All_RLS_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de SAF */
+    test_result = Run_All_SAF_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
+    /* Ejecutar tests de Kalman */
+    test_result = Run_All_Kalman_Tests();
+    if (test_result != 0)
+    {
+        result = -1;
+    }
+
     /* Aquí se pueden añadir más tests de otros módulos cuando estén disponibles */
 
     if (result == 0)
@@ -190,6 +260,16 @@ int main(int argc, char *argv[])
     printf("  - Lagrange Halfband: Filtros de media banda de Lagrange\n");
     printf("  - FIR_Filter: Filtrado FIR general\n");
     printf("  - DWT: Transformada Wavelet Discreta\n");
+    printf("  - FFT: Transformada Rápida de Fourier\n");
+    printf("  - STFT: Transformada de Fourier de Tiempo Corto\n");
+    printf("  - Welch: Densidad espectral de potencia promediada\n");
+    printf("  - FAST_FIR: Filtrado FIR largo por convolución rápida\n");
+    printf("  - SDFT: Banco de DFT deslizante para seguimiento de tonos\n");
+    printf("  - LMS: Filtros adaptativos LMS, NLMS y LMS con fugas\n");
+    printf("  - FDAF: Filtros adaptativos por bloques en el dominio de la frecuencia\n");
+    printf("  - RLS: Filtros adaptativos RLS por QR inverso y en celosía\n");
+    printf("  - SAF: Filtros adaptativos en subbandas sobre el banco DWT\n");
+    printf("  - Kalman: Filtro de Kalman lineal, desenrollado para estados pequeños y por lotes\n");
 
 #endif
 
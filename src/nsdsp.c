@@ -41,6 +41,17 @@
  * - Llama a Init_RT_Momentos() para inicializar el módulo de cálculo de momentos
  * - Llama a Init_Fir() para inicializar el módulo de filtrado FIR
  * - Llama a Init_DWT() para inicializar el módulo de transformada wavelet
+ * - Llama a nsdsp_math_init() e Init_ANN() para inicializar los módulos matemático y de redes neuronales
+ * - Llama a Init_FFT() para inicializar el módulo de transformada rápida de Fourier
+ * - Llama a Init_STFT() para inicializar el módulo de transformada de Fourier de tiempo corto
+ * - Llama a Init_Welch() para inicializar el módulo de densidad espectral de potencia de Welch
+ * - Llama a Init_Fast_Fir() para inicializar el módulo de filtrado FIR por convolución rápida
+ * - Llama a Init_SDFT() para inicializar el banco de DFT deslizante
+ * - Llama a Init_LMS() para inicializar el módulo de filtros adaptativos LMS
+ * - Llama a Init_FDAF() para inicializar el módulo de filtros adaptativos en frecuencia
+ * - Llama a Init_RLS() para inicializar el módulo de filtros adaptativos RLS
+ * - Llama a Init_SAF() para inicializar el módulo de filtros adaptativos en subbandas
+ * - Llama a Init_Kalman() para inicializar el módulo de filtros de Kalman
  *
  * - Prepara todos los recursos para su uso
  *
@@ -53,9 +64,21 @@
  *   INIT_RT [label="Init_RT_Momentos()", fillcolor=lightyellow];
  *   INIT_FIR [label="Init_Fir()", fillcolor=lightyellow];
  *   INIT_DWT [label="Init_DWT()", fillcolor=lightyellow];
+ *   INIT_MATH [label="nsdsp_math_init()", fillcolor=lightyellow];
+ *   INIT_ANN [label="Init_ANN()", fillcolor=lightyellow];
+ *   INIT_FFT [label="Init_FFT()", fillcolor=lightyellow];
+ *   INIT_STFT [label="Init_STFT()", fillcolor=lightyellow];
+ *   INIT_WELCH [label="Init_Welch()", fillcolor=lightyellow];
+ *   INIT_FAST_FIR [label="Init_Fast_Fir()", fillcolor=lightyellow];
+ *   INIT_SDFT [label="Init_SDFT()", fillcolor=lightyellow];
+ *   INIT_LMS [label="Init_LMS()", fillcolor=lightyellow];
+ *   INIT_FDAF [label="Init_FDAF()", fillcolor=lightyellow];
+ *   INIT_RLS [label="Init_RLS()", fillcolor=lightyellow];
+ *   INIT_SAF [label="Init_SAF()", fillcolor=lightyellow];
+ *   INIT_KALMAN [label="Init_Kalman()", fillcolor=lightyellow];
  *   END [label="Fin", fillcolor=lightgreen];
  *
- *   START -> INIT_RT -> INIT_FIR -> INIT_DWT -> END;
+ *   START -> INIT_RT -> INIT_FIR -> INIT_DWT -> INIT_MATH -> INIT_ANN -> INIT_FFT -> INIT_STFT -> INIT_WELCH -> INIT_FAST_FIR -> INIT_SDFT -> INIT_LMS -> INIT_FDAF -> INIT_RLS -> INIT_SAF -> INIT_KALMAN -> END;
  * }
  * \enddot
  *
@@ -76,12 +99,22 @@
  *   FIR [label="fir_filter.h/fir_filter.c", fillcolor=lightyellow];
  *   DWT [label="dwt.h/dwt.c", fillcolor=lightyellow];
  *   ANN [label="ann.h/ann.c", fillcolor=lightyellow];
+ *   FFT [label="fft.h/FFT.c", fillcolor=lightyellow];
+ *   STFT [label="stft.h/STFT.c", fillcolor=lightyellow];
+ *   WELCH [label="welch.h/Welch.c", fillcolor=lightyellow];
+ *   FAST_FIR [label="fast_fir.h/fast_fir.c", fillcolor=lightyellow];
+ *   SDFT [label="sdft.h/SDFT.c", fillcolor=lightyellow];
+ *   LMS [label="lms_filter.h/LMS_Filter.c", fillcolor=lightyellow];
+ *   FDAF [label="fdaf.h/FDAF.c", fillcolor=lightyellow];
+ *   RLS [label="rls.h/RLS.c", fillcolor=lightyellow];
+ *   SAF [label="saf.h/SAF.c", fillcolor=lightyellow];
+ *   KALMAN [label="kalman.h/Kalman.c", fillcolor=lightyellow];
  *
  *   subgraph cluster_lib {
  *     label="Librería NSDSP";
  *     style=filled;
  *     color=lightgrey;
- *     NSDSP; STAT; RT; LAG; FIR; DWT; ANN;
+ *     NSDSP; STAT; RT; LAG; FIR; DWT; ANN; FFT; STFT; WELCH; FAST_FIR; SDFT; LMS; FDAF; RLS; SAF; KALMAN;
  *   }
  *
  *   APP -> NSDSP [label="include/llamadas"];
@@ -91,9 +124,30 @@
  *   NSDSP -> FIR [label="include"];
  *   NSDSP -> DWT [label="include"];
  *   NSDSP -> ANN [label="include"];
+ *   NSDSP -> FFT [label="include"];
+ *   NSDSP -> STFT [label="include"];
+ *   NSDSP -> WELCH [label="include"];
+ *   NSDSP -> FAST_FIR [label="include"];
+ *   NSDSP -> SDFT [label="include"];
+ *   NSDSP -> LMS [label="include"];
+ *   NSDSP -> FDAF [label="include"];
+ *   NSDSP -> RLS [label="include"];
+ *   NSDSP -> SAF [label="include"];
+ *   NSDSP -> KALMAN [label="include"];
  *   RT -> STAT [label="actualiza"];
  *   DWT -> LAG [label="usa"];
  *   DWT -> FIR [label="usa"];
+ *   STFT -> FFT [label="usa"];
+ *   WELCH -> STFT [label="usa"];
+ *   FAST_FIR -> FIR [label="usa"];
+ *   FAST_FIR -> FFT [label="usa"];
+ *   SDFT -> FFT [label="usa"];
+ *   LMS -> FIR [label="usa"];
+ *   FDAF -> FFT [label="usa"];
+ *   RLS -> MATH [label="usa"];
+ *   SAF -> DWT [label="usa"];
+ *   SAF -> LMS [label="usa"];
+ *   KALMAN -> MATH [label="usa"];
  * }
  * \enddot
  *
@@ -105,6 +159,16 @@
  * \subpage wavelet_transform
  * \subpage nsdsp_math
  * \subpage ann
+ * \subpage fft
+ * \subpage stft
+ * \subpage welch
+ * \subpage fast_fir
+ * \subpage sdft
+ * \subpage lms_filter
+ * \subpage fdaf
+ * \subpage rls
+ * \subpage saf
+ * \subpage kalman
  *
  * \author Dr. Carlos Romero
  *
@@ -118,6 +182,16 @@
  * | 28/08/2025 | Dr. Carlos Romero | 5 | Integración de DWT y FIR_FILTER, eliminación wavelet_decim |
  * | 13/09/2025 | Dr. Carlos Romero | 6 | Se añade inicialización de la librería nsdsp_math |
  * | 14/09/2025 | Dr. Carlos Romero | 7 | Se añade primera versión de librería ANN (Artificial Neural Network)
+ * | 16/10/2026 | Dr. Carlos Romero | 8 | Se añade inicialización del módulo FFT |
+ * | 16/10/2026 | Dr. Carlos Romero | 9 | Se añade inicialización del módulo STFT |
+ * | 16/10/2026 | Dr. Carlos Romero | 10 | Se añade inicialización del módulo Welch |
+ * | 16/10/2026 | Dr. Carlos Romero | 11 | Se añade inicialización del módulo FAST_FIR |
+ * | 16/10/2026 | Dr. Carlos Romero | 12 | Se añade inicialización del módulo SDFT |
+ * | 16/10/2026 | Dr. Carlos Romero | 13 | Se añade inicialización del módulo LMS |
+ * | 16/10/2026 | Dr. Carlos Romero | 14 | Se añade inicialización del módulo FDAF |
+ * | 16/10/2026 | Dr. Carlos Romero | 15 | Se añade inicialización del módulo RLS |
+ * | 16/10/2026 | Dr. Carlos Romero | 16 | Se añade inicialización del módulo SAF |
+ * | 16/10/2026 | Dr. Carlos Romero | 17 | Se añade inicialización del módulo Kalman |
  *
  * \copyright ZGR R&D AIE
  */
@@ -145,4 +219,34 @@ void Init_NSDSP(void)
 
     /* Inicializar el módulo ANN */
     Init_ANN();
+
+    /* Inicializar el módulo FFT */
+    Init_FFT();
+
+    /* Inicializar el módulo STFT */
+    Init_STFT();
+
+    /* Inicializar el módulo Welch */
+    Init_Welch();
+
+    /* Inicializar el módulo FAST_FIR */
+    Init_Fast_Fir();
+
+    /* Inicializar el módulo SDFT */
+    Init_SDFT();
+
+    /* Inicializar el módulo LMS */
+    Init_LMS();
+
+    /* Inicializar el módulo FDAF */
+    Init_FDAF();
+
+    /* Inicializar el módulo RLS */
+    Init_RLS();
+
+    /* Inicializar el módulo SAF */
+    Init_SAF();
+
+    /* Inicializar el módulo Kalman */
+    Init_Kalman();
 }